@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+"""
+Packs .riv files and the assets they reference into a Rive bundle (.rivb),
+which the Android runtime maps into memory instead of copying each file
+through a Java byte array (see RiveBundle).
+
+Inputs ending in .riv are stored as files; everything else as assets.
+Directories are walked recursively. Entries are named by their file name
+unless given as NAME=PATH. Identical contents are stored once, and every
+blob starts at an aligned offset.
+
+Assets are looked up by their unique filename ("name-id.ext" as exported by
+the Rive editor), then by name with and without extension.
+
+Usage:
+  ./pack_rive_bundle.py -o screens.rivb home.riv settings.riv assets/
+  ./pack_rive_bundle.py -o out.rivb hero=art/hero_v3.riv Inter-123.ttf
+  ./pack_rive_bundle.py --list screens.rivb
+
+Ship the bundle as a raw resource stored uncompressed, e.g. in build.gradle:
+  android { androidResources { noCompress += "rivb" } }
+"""
+
+import argparse
+import hashlib
+import os
+import struct
+import sys
+
+MAGIC = b"RVBN"
+VERSION = 1
+KIND_FILE = 0
+KIND_ASSET = 1
+HEADER = struct.Struct("<4sIIIQQ")
+RECORD = struct.Struct("<IIQQ")
+
+
+def align(value, alignment):
+    return (value + alignment - 1) // alignment * alignment
+
+
+def collect_inputs(args):
+    """Returns (name, path) pairs in command line order."""
+    inputs = []
+    for arg in args:
+        name, sep, path = arg.partition("=")
+        if not sep:
+            name, path = None, arg
+        if os.path.isdir(path):
+            for root, _, files in sorted(os.walk(path)):
+                for file in sorted(files):
+                    inputs.append((file, os.path.join(root, file)))
+        else:
+            inputs.append((name or os.path.basename(path), path))
+    return inputs
+
+
+def pack(inputs, output, alignment):
+    entries = []  # (kind, name, blob index)
+    blobs = []  # bytes
+    blob_by_hash = {}
+    seen = set()
+    total = 0
+    for name, path in inputs:
+        kind = KIND_FILE if path.lower().endswith(".riv") else KIND_ASSET
+        if (kind, name) in seen:
+            sys.exit(f"error: duplicate {'file' if kind == KIND_FILE else 'asset'} name: {name}")
+        seen.add((kind, name))
+        with open(path, "rb") as f:
+            data = f.read()
+        total += len(data)
+        digest = hashlib.sha256(data).digest()
+        if digest not in blob_by_hash:
+            blob_by_hash[digest] = len(blobs)
+            blobs.append(data)
+        entries.append((kind, name.encode("utf-8"), blob_by_hash[digest]))
+
+    index_size = sum(RECORD.size + len(name) for _, name, _ in entries)
+    offset = align(HEADER.size + index_size, alignment)
+    offsets = []
+    for data in blobs:
+        offsets.append(offset)
+        offset = align(offset + len(data), alignment)
+
+    with open(output, "wb") as out:
+        out.write(HEADER.pack(MAGIC, VERSION, len(entries), alignment, index_size, 0))
+        for kind, name, blob in entries:
+            out.write(RECORD.pack(kind, len(name), offsets[blob], len(blobs[blob])))
+            out.write(name)
+        for blob_offset, data in zip(offsets, blobs):
+            out.write(b"\0" * (blob_offset - out.tell()))
+            out.write(data)
+
+    stored = sum(len(data) for data in blobs)
+    print(f"{output}: {len(entries)} entries, {len(blobs)} blobs, "
+          f"{stored} of {total} bytes stored ({total - stored} deduplicated)")
+
+
+def list_bundle(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, count, alignment, index_size, _ = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        sys.exit(f"error: {path} is not a version {VERSION} Rive bundle")
+    cursor = HEADER.size
+    print(f"{path}: {count} entries, {alignment}-byte alignment")
+    for _ in range(count):
+        kind, name_length, offset, size = RECORD.unpack_from(data, cursor)
+        cursor += RECORD.size
+        name = data[cursor:cursor + name_length].decode("utf-8")
+        cursor += name_length
+        label = "file " if kind == KIND_FILE else "asset"
+        print(f"  {label} {name:40} {size:>10} bytes @ {offset}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Pack .riv files and assets into a Rive bundle.")
+    parser.add_argument("-o", "--output", help="bundle to write")
+    parser.add_argument("--alignment", type=int, default=16,
+                        help="blob alignment in bytes, a power of two (default 16)")
+    parser.add_argument("--list", metavar="BUNDLE", help="print the index of a bundle and exit")
+    parser.add_argument("inputs", nargs="*", help="files, directories or NAME=PATH")
+    args = parser.parse_args()
+
+    if args.list:
+        list_bundle(args.list)
+        return
+    if not args.output or not args.inputs:
+        parser.error("an output and at least one input are required")
+    if args.alignment <= 0 or args.alignment & (args.alignment - 1):
+        parser.error("alignment must be a power of two")
+    pack(collect_inputs(args.inputs), args.output, args.alignment)
+
+
+if __name__ == "__main__":
+    main()
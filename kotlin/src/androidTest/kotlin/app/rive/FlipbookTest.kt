@@ -0,0 +1,442 @@
+package app.rive
+
+import android.graphics.Bitmap
+import android.graphics.Canvas
+import android.graphics.RectF
+import androidx.core.graphics.createBitmap
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import app.rive.core.RiveWorker
+import app.rive.core.StateMachineHandle
+import app.rive.runtime.kotlin.core.Rive
+import app.rive.runtime.kotlin.test.R
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.cancelAndJoin
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withTimeout
+import org.junit.Before
+import org.junit.runner.RunWith
+import kotlin.concurrent.thread
+import kotlin.math.abs
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Compares flipbook frames against live off-screen rendering of the same artboard advanced to the
+ * same time. Uses the "Sweep" artboard of snapshot_test.riv, a line moving across over 1 second.
+ *
+ * Input changes use the "mixed" state machine of state_machine_configurations.riv, and view model
+ * changes the "Text" property of snapshot_test.riv's "Data Bind Text" artboard.
+ */
+@RunWith(AndroidJUnit4::class)
+class FlipbookTest {
+    companion object {
+        private const val SIZE = 64
+        private const val FPS = 10
+
+        /** Maximum per-channel difference, allowing for blending differences in the atlas. */
+        private const val TOLERANCE = 2
+
+        private const val INPUTS_STATE_MACHINE = "mixed"
+        private const val DATA_BIND_ARTBOARD = "Data Bind Text"
+    }
+
+    @Before
+    fun setup() {
+        Rive.init(InstrumentationRegistry.getInstrumentation().targetContext)
+    }
+
+    @Test
+    fun frames_match_live_rendering() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                    assertEquals(FPS, flipbook.frameCount)
+                    assertEquals(4, flipbook.columns)
+                    assertEquals(3, flipbook.rows)
+                    assertFalse(flipbook.isValid)
+
+                    flipbook.prerender()
+                    assertTrue(flipbook.isValid)
+
+                    for (index in 0 until flipbook.frameCount) {
+                        val live = renderLive(file, flipbook.frameInterval * index)
+                        assertBitmapsMatch(live, flipbook.frameBitmap(index), "frame $index")
+                    }
+                }
+            }
+        }
+    }
+
+    @Test
+    fun frame_index_wraps_around_the_loop() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                    assertEquals(0, flipbook.frameIndexAt(Duration.ZERO))
+                    assertEquals(0, flipbook.frameIndexAt(99.milliseconds))
+                    assertEquals(1, flipbook.frameIndexAt(100.milliseconds))
+                    assertEquals(9, flipbook.frameIndexAt(999.milliseconds))
+                    assertEquals(0, flipbook.frameIndexAt(1000.milliseconds))
+                    assertEquals(9, flipbook.frameIndexAt((-1).milliseconds))
+                    assertFailsWith<IndexOutOfBoundsException> {
+                        flipbook.frameBitmap(flipbook.frameCount)
+                    }
+                }
+            }
+        }
+    }
+
+    @Test
+    fun invalidate_rerenders_on_next_use() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                    flipbook.prerender()
+                    flipbook.invalidate()
+                    assertFalse(flipbook.isValid)
+
+                    flipbook.frameBitmap(0)
+                    assertTrue(flipbook.isValid)
+                }
+            }
+        }
+    }
+
+    @Test
+    fun rerendering_starts_at_the_loop_start() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                    repeat(3) { render ->
+                        flipbook.invalidate()
+                        flipbook.prerender()
+                        for (index in intArrayOf(0, 3, flipbook.frameCount - 1)) {
+                            val live = renderLive(file, flipbook.frameInterval * index)
+                            assertBitmapsMatch(
+                                live,
+                                flipbook.frameBitmap(index),
+                                "render $render frame $index"
+                            )
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    @Test
+    fun draw_rerenders_a_stale_atlas_in_the_background() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                    flipbook.prerender()
+                    flipbook.invalidate()
+
+                    // Draws the stale atlas and starts rendering a new one
+                    val target = createBitmap(SIZE, SIZE)
+                    val dst = RectF(0f, 0f, SIZE.toFloat(), SIZE.toFloat())
+                    flipbook.draw(Canvas(target), Duration.ZERO, dst)
+                    assertBitmapsMatch(renderLive(file, Duration.ZERO), target, "stale frame")
+
+                    withTimeout(5.seconds) {
+                        while (!flipbook.isValid) {
+                            delay(10)
+                        }
+                    }
+                    assertBitmapsMatch(renderLive(file, Duration.ZERO), flipbook.frameBitmap(0), "new frame")
+                }
+            }
+        }
+    }
+
+    @Test
+    fun close_waits_for_rendering() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                val flipbook = Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds)
+                var renderError: Throwable? = null
+                val renderer = thread {
+                    try {
+                        flipbook.prerender()
+                    } catch (e: Throwable) {
+                        renderError = e
+                    }
+                }
+                flipbook.close()
+                renderer.join()
+
+                // The render either finished first or stopped at the next frame
+                renderError?.let { assertTrue(it is IllegalStateException, "Unexpected $it") }
+                assertFalse(flipbook.isValid)
+                assertFailsWith<IllegalStateException> { flipbook.prerender() }
+            }
+        }
+    }
+
+    @Test
+    fun setting_a_number_input_rerenders_with_it() = withFile(R.raw.state_machine_configurations) { file ->
+        assertInputChangeRerenders(
+            file,
+            onFlipbook = { it.setNumberInput("zero", 1f) },
+            onLive = { sm -> file.riveWorker.setStateMachineNumberInput(sm, "zero", 1f) }
+        )
+    }
+
+    @Test
+    fun setting_a_boolean_input_rerenders_with_it() = withFile(R.raw.state_machine_configurations) { file ->
+        assertInputChangeRerenders(
+            file,
+            onFlipbook = { it.setBooleanInput("off", true) },
+            onLive = { sm -> file.riveWorker.setStateMachineBooleanInput(sm, "off", true) }
+        )
+    }
+
+    @Test
+    fun firing_a_trigger_rerenders_with_it() = withFile(R.raw.state_machine_configurations) { file ->
+        assertInputChangeRerenders(
+            file,
+            onFlipbook = { it.fireTrigger("trigger") },
+            onLive = { sm -> file.riveWorker.fireStateMachineTrigger(sm, "trigger") }
+        )
+    }
+
+    @Test
+    fun view_model_changes_rerender_with_them() = withFile(R.raw.snapshot_test) { file ->
+        Artboard.fromFile(file, DATA_BIND_ARTBOARD).use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                createBoundInstance(file, artboard, stateMachine).use { vmi ->
+                    Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                        val invalidations = launch { flipbook.invalidateOnChanges(vmi) }
+                        flipbook.prerender()
+                        assertTrue(flipbook.isValid)
+
+                        vmi.setString("Text", "Flipbook")
+                        withTimeout(5.seconds) {
+                            while (flipbook.isValid) {
+                                delay(10)
+                            }
+                        }
+
+                        for (index in 0 until flipbook.frameCount) {
+                            val live = renderAfterChange(
+                                file,
+                                DATA_BIND_ARTBOARD,
+                                null,
+                                flipbook,
+                                index,
+                                bindDefaultInstance = true
+                            ) { _, liveVmi -> liveVmi!!.setString("Text", "Flipbook") }
+                            assertBitmapsMatch(live, flipbook.frameBitmap(index), "frame $index")
+                        }
+                        assertTrue(flipbook.isValid)
+                        invalidations.cancelAndJoin()
+                    }
+                }
+            }
+        }
+    }
+
+    @Test
+    fun draw_and_close_on_different_threads() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                val flipbook = Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds)
+                flipbook.prerender()
+                val target = createBitmap(SIZE, SIZE)
+                val dst = RectF(0f, 0f, SIZE.toFloat(), SIZE.toFloat())
+                var drawError: Throwable? = null
+                val drawer = thread {
+                    try {
+                        var frame = 0
+                        while (true) {
+                            flipbook.draw(Canvas(target), flipbook.frameInterval * frame++, dst)
+                        }
+                    } catch (e: Throwable) {
+                        drawError = e
+                    }
+                }
+                delay(50)
+                flipbook.close()
+                drawer.join()
+
+                // Drawing stops at the close, never on a recycled atlas
+                assertTrue(drawError is IllegalStateException, "Unexpected $drawError")
+            }
+        }
+    }
+
+    @Test
+    fun oversized_atlas_is_rejected() = withSweep { file ->
+        Artboard.fromFile(file, "Sweep").use { artboard ->
+            StateMachine.fromArtboard(artboard).use { stateMachine ->
+                // 60 frames of 2048x2048 need an 16384x16384 atlas
+                assertFailsWith<IllegalArgumentException> {
+                    Flipbook(artboard, stateMachine, 2048, 2048, 60, 1000.milliseconds)
+                }
+                // 10 frames of 2048x2048 fit in 8192x6144 but exceed the byte limit
+                assertFailsWith<IllegalArgumentException> {
+                    Flipbook(artboard, stateMachine, 2048, 2048, 10, 1000.milliseconds)
+                }
+            }
+        }
+    }
+
+    /**
+     * Changes an input of the "mixed" state machine with [onFlipbook] after the flipbook's first
+     * render, then checks the atlas went stale and that the re-rendered frames match a live state
+     * machine given the same input, through [onLive], at the same point of its timeline.
+     */
+    private fun assertInputChangeRerenders(
+        file: RiveFile,
+        onFlipbook: (Flipbook) -> Unit,
+        onLive: (StateMachineHandle) -> Unit,
+    ) {
+        Artboard.fromFile(file).use { artboard ->
+            StateMachine.fromArtboard(artboard, INPUTS_STATE_MACHINE).use { stateMachine ->
+                Flipbook(artboard, stateMachine, SIZE, SIZE, FPS, 1000.milliseconds).use { flipbook ->
+                    flipbook.prerender()
+                    assertTrue(flipbook.isValid)
+
+                    onFlipbook(flipbook)
+                    assertFalse(flipbook.isValid)
+
+                    for (index in 0 until flipbook.frameCount) {
+                        val live = renderAfterChange(
+                            file,
+                            null,
+                            INPUTS_STATE_MACHINE,
+                            flipbook,
+                            index
+                        ) { sm, _ -> onLive(sm.stateMachineHandle) }
+                        assertBitmapsMatch(live, flipbook.frameBitmap(index), "frame $index")
+                    }
+                    assertTrue(flipbook.isValid)
+                }
+            }
+        }
+    }
+
+    /**
+     * Renders frame [index] of [flipbook]'s second render live: a fresh state machine is advanced
+     * the way the first render advanced the flipbook's, changed by [change], then advanced to the
+     * loop start and on to the frame.
+     *
+     * @param bindDefaultInstance Whether to bind the artboard's default view model instance to the
+     *    state machine before advancing; it is passed to [change].
+     */
+    private fun renderAfterChange(
+        file: RiveFile,
+        artboardName: String?,
+        stateMachineName: String?,
+        flipbook: Flipbook,
+        index: Int,
+        bindDefaultInstance: Boolean = false,
+        change: (StateMachine, ViewModelInstance?) -> Unit,
+    ): Bitmap = RenderBuffer(SIZE, SIZE, file.riveWorker).use { buffer ->
+        Artboard.fromFile(file, artboardName).use { artboard ->
+            StateMachine.fromArtboard(artboard, stateMachineName).use { stateMachine ->
+                val vmi = if (bindDefaultInstance) {
+                    createBoundInstance(file, artboard, stateMachine)
+                } else {
+                    null
+                }
+                try {
+                    val interval = flipbook.frameInterval
+                    val rendered = interval * (flipbook.frameCount - 1)
+                    stateMachine.advance(Duration.ZERO)
+                    repeat(flipbook.frameCount - 1) { stateMachine.advance(interval) }
+                    change(stateMachine, vmi)
+                    stateMachine.advance(flipbook.loopDuration - rendered)
+                    repeat(index) { stateMachine.advance(interval) }
+                    buffer.snapshot(artboard, stateMachine).toBitmap()
+                } finally {
+                    vmi?.close()
+                }
+            }
+        }
+    }
+
+    /** Creates the artboard's default view model instance and binds it to [stateMachine]. */
+    private fun createBoundInstance(
+        file: RiveFile,
+        artboard: Artboard,
+        stateMachine: StateMachine
+    ): ViewModelInstance =
+        ViewModelInstance.fromFile(
+            file,
+            ViewModelSource.DefaultForArtboard(artboard).defaultInstance()
+        ).also { vmi ->
+            file.riveWorker.bindViewModelInstance(
+                stateMachine.stateMachineHandle,
+                vmi.instanceHandle
+            )
+        }
+
+    /** Renders the sweep artboard with a fresh state machine advanced to [time]. */
+    private fun renderLive(file: RiveFile, time: Duration): Bitmap =
+        RenderBuffer(SIZE, SIZE, file.riveWorker).use { buffer ->
+            Artboard.fromFile(file, "Sweep").use { artboard ->
+                StateMachine.fromArtboard(artboard).use { stateMachine ->
+                    stateMachine.advance(Duration.ZERO)
+                    stateMachine.advance(time)
+                    buffer.snapshot(artboard, stateMachine).toBitmap()
+                }
+            }
+        }
+
+    private fun assertBitmapsMatch(expected: Bitmap, actual: Bitmap, label: String) {
+        assertEquals(expected.width, actual.width, "$label width")
+        assertEquals(expected.height, actual.height, "$label height")
+        for (y in 0 until expected.height) {
+            for (x in 0 until expected.width) {
+                val e = expected.getPixel(x, y)
+                val a = actual.getPixel(x, y)
+                for (shift in intArrayOf(0, 8, 16, 24)) {
+                    val diff = abs(((e ushr shift) and 0xFF) - ((a ushr shift) and 0xFF))
+                    assertTrue(diff <= TOLERANCE, "$label differs at ($x, $y): $e vs $a")
+                }
+            }
+        }
+    }
+
+    /** Loads snapshot_test.riv on a worker that is polled for the duration of [block]. */
+    private fun withSweep(block: suspend CoroutineScope.(RiveFile) -> Unit) =
+        withFile(R.raw.snapshot_test, block)
+
+    /** Loads a raw resource on a worker that is polled for the duration of [block]. */
+    private fun withFile(
+        resId: Int,
+        block: suspend CoroutineScope.(RiveFile) -> Unit
+    ) = runBlocking {
+        val riveWorker = RiveWorker()
+        val polling = launch {
+            while (isActive) {
+                riveWorker.pollMessages()
+                delay(16)
+            }
+        }
+        try {
+            val result = RiveFile.fromSource(
+                RiveFileSource.RawRes(
+                    resId,
+                    InstrumentationRegistry.getInstrumentation().context.resources
+                ),
+                riveWorker
+            )
+            val file = (result as Result.Success).value
+            file.use { block(it) }
+        } finally {
+            polling.cancelAndJoin()
+        }
+    }
+}
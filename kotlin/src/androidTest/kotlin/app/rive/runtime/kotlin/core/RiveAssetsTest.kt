@@ -1,12 +1,14 @@
 package app.rive.runtime.kotlin.core
 
 import android.graphics.Bitmap
+import android.graphics.BitmapFactory
 import android.graphics.Color
 import androidx.test.ext.junit.runners.AndroidJUnit4
 import app.rive.runtime.kotlin.test.R
 import org.junit.Assert.assertEquals
 import org.junit.Assert.assertFalse
 import org.junit.Assert.assertNotNull
+import org.junit.Assert.assertNull
 import org.junit.Assert.assertTrue
 import org.junit.Test
 import org.junit.runner.RunWith
@@ -50,6 +52,97 @@ class RiveAssetsTest {
         assertFalse(renderImage.hasCppObject)
     }
 
+    @Test
+    fun memoryReportReleasesPixelsAfterUpload() {
+        val before = RiveRenderImage.memoryReport()
+        val renderImage = RiveRenderImage.fromRGBABytes(
+            ByteArray(16 * 16 * 4),
+            16,
+            16,
+            rendererType = RendererType.Rive
+        )
+        assertTrue(renderImage.hasCppObject)
+        assertEquals(before.liveImages + 1, RiveRenderImage.memoryReport().liveImages)
+
+        // Releasing waits for the upload, so its pixels have been freed by then
+        renderImage.release()
+        val after = RiveRenderImage.memoryReport()
+        assertEquals(before.liveImages, after.liveImages)
+        assertEquals(before.pendingPixelBytes, after.pendingPixelBytes)
+        assertEquals(before.releasedPixelBytes + 16 * 16 * 4, after.releasedPixelBytes)
+    }
+
+    @Test
+    fun retainedImageReadsBackItsPixels() {
+        RiveRenderImage.retainEncodedBytes = true
+        try {
+            lateinit var imageAsset: ImageAsset
+            val myLoader = object : ContextAssetLoader(appContext) {
+                override fun loadContents(asset: FileAsset, inBandBytes: ByteArray): Boolean {
+                    if (asset is ImageAsset) {
+                        imageAsset = asset
+                        return asset.decode(imageBytes)
+                    }
+                    return false
+                }
+            }
+            val before = RiveRenderImage.memoryReport()
+            val file = File(
+                appContext.resources.openRawResource(R.raw.asset_load_check).readBytes(),
+                fileAssetLoader = myLoader,
+                rendererType = RendererType.Rive,
+            )
+            val retained = RiveRenderImage.memoryReport()
+            assertTrue(retained.retainedEncodedBytes > 0)
+            assertEquals(
+                before.retainedEncodedBytes + imageBytes.size,
+                retained.retainedEncodedBytes
+            )
+
+            val pixels = imageAsset.image.readPixels()
+            assertNotNull(pixels)
+            assertEquals(before.redecodeCount + 1, RiveRenderImage.memoryReport().redecodeCount)
+
+            // The same pixels the file decoded: premultiplied RGBA of eve.png
+            val bitmap = BitmapFactory.decodeByteArray(imageBytes, 0, imageBytes.size)
+            val argb = IntArray(bitmap.width * bitmap.height)
+            bitmap.getPixels(argb, 0, bitmap.width, 0, 0, bitmap.width, bitmap.height)
+            assertEquals(argb.size * 4, pixels!!.size)
+            argb.forEachIndexed { i, color ->
+                val a = Color.alpha(color)
+                val expected = intArrayOf(
+                    Color.red(color) * a / 255,
+                    Color.green(color) * a / 255,
+                    Color.blue(color) * a / 255,
+                    a
+                )
+                for (channel in 0 until 4) {
+                    val actual = pixels[i * 4 + channel].toInt() and 0xFF
+                    // Premultiplication may round either way
+                    assertTrue(
+                        "Pixel $i channel $channel: $actual, expected ${expected[channel]}",
+                        kotlin.math.abs(actual - expected[channel]) <= 1
+                    )
+                }
+            }
+
+            myLoader.release()
+            file.release()
+        } finally {
+            RiveRenderImage.retainEncodedBytes = false
+        }
+    }
+
+    @Test
+    fun imageWithoutRetainedBytesHasNoPixels() {
+        val before = RiveRenderImage.memoryReport()
+        val renderImage = RiveRenderImage.fromEncoded(imageBytes, RendererType.Rive)
+        // Images made from pixels keep no encoded bytes to decode again
+        assertNull(renderImage.readPixels())
+        assertEquals(before.redecodeCount, RiveRenderImage.memoryReport().redecodeCount)
+        renderImage.release()
+    }
+
     @Test
     fun makeRenderImageWithRendererType() {
         val renderImage =
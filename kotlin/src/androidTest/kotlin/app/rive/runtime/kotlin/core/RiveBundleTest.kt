@@ -0,0 +1,131 @@
+package app.rive.runtime.kotlin.core
+
+import android.content.res.AssetFileDescriptor
+import android.os.ParcelFileDescriptor
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.runtime.kotlin.core.errors.RiveException
+import app.rive.runtime.kotlin.test.R
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNull
+import org.junit.Assert.assertTrue
+import org.junit.Assert.fail
+import org.junit.Test
+import org.junit.runner.RunWith
+
+/**
+ * Tests for [RiveBundle] and [BundleAssetLoader].
+ *
+ * `test_bundle.rivb` is packed with dev/pack_rive_bundle.py from the other raw resources:
+ *
+ *     python3 dev/pack_rive_bundle.py -o kotlin/src/androidTest/res/raw/test_bundle.rivb \
+ *         asset_load_check.riv=.../asset_load_check.riv flux_capacitor.riv=.../flux_capacitor.riv \
+ *         sloth-45018.jpg=.../eve.png eve.png=.../eve.png
+ *
+ * `sloth-45018.jpg` is the unique filename of asset_load_check.riv's out-of-band image, and both
+ * image entries share one copy of eve.png.
+ */
+@RunWith(AndroidJUnit4::class)
+class RiveBundleTest {
+    private val testUtils = TestUtils()
+    private val appContext = testUtils.context
+
+    private fun raw(resId: Int) = appContext.resources.openRawResource(resId).use { it.readBytes() }
+
+    @Test
+    fun openPackedBundleResource() {
+        val bundle = RiveBundle.open(appContext, R.raw.test_bundle)
+        assertEquals(listOf("asset_load_check.riv", "flux_capacitor.riv"), bundle.fileNames)
+        assertEquals(listOf("sloth-45018.jpg", "eve.png"), bundle.assetNames)
+        // The two image entries are stored once.
+        val eveSize = raw(R.raw.eve).size
+        assertEquals(raw(R.raw.test_bundle).size.toLong(), bundle.mappedBytes)
+        assertTrue(bundle.mappedBytes < 2L * eveSize)
+        assertEquals(eveSize, bundle.assetBytes("eve.png")?.size)
+        assertTrue(raw(R.raw.eve).contentEquals(bundle.assetBytes("sloth-45018.jpg")))
+        assertNull(bundle.assetBytes("missing.png"))
+
+        val file = File(bundle, "flux_capacitor.riv")
+        // The file keeps the mapping alive.
+        bundle.release()
+        assertEquals(1, file.firstArtboard.animationCount)
+        file.release()
+    }
+
+    @Test
+    fun openAtUnalignedOffset() {
+        // Bundles inside APKs and asset packs rarely start on a page boundary.
+        val prefix = 100
+        val bytes = raw(R.raw.test_bundle)
+        val container = java.io.File(appContext.cacheDir, "container.bin")
+        container.writeBytes(ByteArray(prefix) + bytes)
+
+        val bundle = AssetFileDescriptor(
+            ParcelFileDescriptor.open(container, ParcelFileDescriptor.MODE_READ_ONLY),
+            prefix.toLong(),
+            bytes.size.toLong()
+        ).use { RiveBundle.open(it) }
+        // The descriptor is closed; the mapping outlives it.
+        assertEquals(bytes.size.toLong(), bundle.mappedBytes)
+        assertTrue(raw(R.raw.eve).contentEquals(bundle.assetBytes("eve.png")))
+
+        val file = File(bundle, "flux_capacitor.riv")
+        assertEquals(1, file.firstArtboard.animationCount)
+        file.release()
+        bundle.release()
+        container.delete()
+    }
+
+    @Test
+    fun bundleAssetLoaderResolvesReferencedImage() {
+        val bundle = RiveBundle.open(appContext, R.raw.test_bundle)
+        val loader = BundleAssetLoader(bundle)
+        RiveRenderImage.retainEncodedBytes = true
+        try {
+            val before = RiveRenderImage.memoryReport()
+            val file = File(
+                bundle,
+                "asset_load_check.riv",
+                rendererType = RendererType.Rive,
+                fileAssetLoader = loader,
+            )
+            // The out-of-band image was decoded from the bundle's copy of eve.png.
+            val after = RiveRenderImage.memoryReport()
+            assertEquals(before.liveImages + 1, after.liveImages)
+            assertEquals(
+                before.retainedEncodedBytes + raw(R.raw.eve).size,
+                after.retainedEncodedBytes
+            )
+            file.release()
+        } finally {
+            RiveRenderImage.retainEncodedBytes = false
+            loader.release()
+            bundle.release()
+        }
+    }
+
+    @Test
+    fun missingFileInBundle() {
+        val bundle = RiveBundle.open(appContext, R.raw.test_bundle)
+        val loader = BundleAssetLoader(bundle)
+        val bundleRefs = bundle.refCount
+        val loaderRefs = loader.refCount
+        try {
+            File(bundle, "missing.riv", fileAssetLoader = loader)
+            fail("Expected a RiveException")
+        } catch (e: RiveException) {
+            // The failed import keeps no reference to the bundle or the loader.
+            assertEquals(bundleRefs, bundle.refCount)
+            assertEquals(loaderRefs, loader.refCount)
+        } finally {
+            loader.release()
+            bundle.release()
+        }
+    }
+
+    @Test(expected = RiveException::class)
+    fun openJunk() {
+        val junk = java.io.File(appContext.cacheDir, "junk.rivb")
+        junk.writeBytes(raw(R.raw.junk))
+        RiveBundle.open(junk)
+    }
+}
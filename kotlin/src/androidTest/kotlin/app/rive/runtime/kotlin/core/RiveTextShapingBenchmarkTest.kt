@@ -0,0 +1,117 @@
+package app.rive.runtime.kotlin.core
+
+import android.util.Log
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import app.rive.runtime.kotlin.test.R
+import org.junit.After
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import kotlin.system.measureNanoTime
+
+/**
+ * Cost per update of a ticking number label, with and without the shaping cache.
+ *
+ * Results are logged under [TAG]; run on a device to compare, e.g.
+ * `adb logcat -s RiveShapingBenchmark`.
+ */
+@RunWith(AndroidJUnit4::class)
+class RiveTextShapingBenchmarkTest {
+    private val testUtils = TestUtils()
+    private val appContext = testUtils.context
+    private lateinit var file: File
+
+    @Before
+    fun init() {
+        file = File(appContext.resources.openRawResource(R.raw.hello_world_text).readBytes())
+    }
+
+    @After
+    fun cleanup() {
+        file.release()
+        Rive.setShapingCacheCapacity(DEFAULT_CAPACITY)
+    }
+
+    /** Sets the label to a seconds counter once per update and returns ns per update. */
+    private fun tick(updates: Int): Double {
+        val artboard = file.firstArtboard
+        val textRun = artboard.textRun("name")
+        // Warm up so both runs start with the file's fonts and paths ready.
+        repeat(WARMUP_UPDATES) { i ->
+            textRun.text = (i % DISTINCT_LABELS).toString()
+            artboard.advance(0f)
+        }
+        val nanos = measureNanoTime {
+            repeat(updates) { i ->
+                textRun.text = (i % DISTINCT_LABELS).toString()
+                artboard.advance(0f)
+            }
+        }
+        artboard.release()
+        return nanos.toDouble() / updates
+    }
+
+    @Test
+    fun tickingLabel() {
+        Rive.setShapingCacheCapacity(0)
+        val uncached = tick(UPDATES)
+
+        Rive.setShapingCacheCapacity(DEFAULT_CAPACITY)
+        val before = Rive.shapingCacheStats()
+        val cached = tick(UPDATES)
+        val after = Rive.shapingCacheStats()
+
+        Log.i(
+            TAG,
+            "ticking label: %.1f µs/update uncached, %.1f µs/update cached (%.2fx)".format(
+                uncached / 1000, cached / 1000, uncached / cached
+            )
+        )
+        // Each distinct label is shaped once, during warm-up; every measured tick reuses it.
+        val misses = after.misses - before.misses
+        val hits = after.hits - before.hits
+        assertTrue("hits: $hits", hits >= UPDATES)
+        assertTrue("misses: $misses, hits: $hits", misses * 10 < hits)
+        assertEquals(DEFAULT_CAPACITY.toLong(), after.capacity)
+    }
+
+    @Test
+    fun releasingAFileKeepsOtherFilesHits() {
+        Rive.setShapingCacheCapacity(DEFAULT_CAPACITY)
+        // Each import decodes its own fonts, so the two files' shapes are cached separately.
+        val other = File(appContext.resources.openRawResource(R.raw.hello_world_text).readBytes())
+        val otherArtboard = other.firstArtboard
+        val otherRun = otherArtboard.textRun("name")
+        repeat(DISTINCT_LABELS) { i ->
+            otherRun.text = i.toString()
+            otherArtboard.advance(0f)
+        }
+        otherArtboard.release()
+        tick(DISTINCT_LABELS)
+        val beforeRelease = Rive.shapingCacheStats()
+
+        other.release()
+        val afterRelease = Rive.shapingCacheStats()
+        assertTrue(
+            "The released file's shapes should be evicted: $beforeRelease -> $afterRelease",
+            afterRelease.entries <= beforeRelease.entries - DISTINCT_LABELS
+        )
+        assertTrue("The other file's shapes should stay", afterRelease.entries >= DISTINCT_LABELS)
+
+        // The remaining file shapes nothing new.
+        tick(DISTINCT_LABELS)
+        val afterTick = Rive.shapingCacheStats()
+        assertEquals(afterRelease.misses, afterTick.misses)
+        assertTrue(afterTick.hits - afterRelease.hits >= DISTINCT_LABELS)
+    }
+
+    companion object {
+        private const val TAG = "RiveShapingBenchmark"
+        private const val DEFAULT_CAPACITY = 256
+        private const val DISTINCT_LABELS = 60
+        private const val WARMUP_UPDATES = 120
+        private const val UPDATES = 2000
+    }
+}
@@ -60,6 +60,21 @@ class RiveTextValueRunTest {
         assertEquals(1, artboard.dependencies.count())
     }
 
+    @Test
+    fun update_text_run_with_supplementary_characters() {
+        val textRun = file.firstArtboard.textRun("name")
+
+        // Emoji are outside the BMP: surrogate pairs in Java, 4-byte sequences in UTF-8.
+        val values = listOf("😀 world", "héllo 世界 👋🏽", "🇨🇦", "a".repeat(300) + "🎉")
+        for (value in values) {
+            textRun.text = value
+            assertEquals(value, textRun.text)
+        }
+        // Unpaired surrogates cannot be encoded and are replaced.
+        textRun.text = "a\uD83Db"
+        assertEquals("a\uFFFDb", textRun.text)
+    }
+
     @Test(expected = TextValueRunException::class)
     fun read_non_existing_text_run() {
         file.firstArtboard.textRun("wrong-name")
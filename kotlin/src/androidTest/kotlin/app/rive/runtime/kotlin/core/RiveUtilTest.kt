@@ -60,4 +60,13 @@ class RiveUtilTest {
         assertEquals(100f, usedBounds.width())
         assertEquals(100f, usedBounds.height())
     }
+
+    @Test
+    fun prewarmRendererQueuesOnTheWorker() {
+        Rive.init(instrumentationContext)
+
+        Rive.prewarmRenderer()
+        // A second prewarm queues behind the first; neither may throw or block.
+        Rive.prewarmRenderer()
+    }
 }
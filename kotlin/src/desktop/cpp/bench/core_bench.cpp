@@ -0,0 +1,223 @@
+/**
+ * Benchmarks for the command-independent core of librive-android, run on the
+ * Linux desktop build (see ../CMakeLists.txt):
+ *
+ *  - shaping a ticking label through ShapingCache, with and without the cache
+ *  - UTF-16 <-> UTF-8 transcoding of JNI strings
+ *  - opening a RiveBundle and importing every file in it, with its assets
+ *    served from the mapping
+ *  - decoding an image into premultiplied RGBA
+ *
+ * Usage: rive-android-core-bench [font.ttf] [bundle.rivb] [image.png]
+ * Without arguments, the kotlin module's test resources are used.
+ */
+
+#include "helpers/image_decode_desktop.hpp"
+#include "helpers/image_memory.hpp"
+#include "helpers/rive_bundle.hpp"
+#include "helpers/shaping_cache.hpp"
+#include "helpers/utf16_transcode.hpp"
+#include "rive/file.hpp"
+#include "rive/file_asset_loader.hpp"
+#include "utils/no_op_factory.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace rive_android;
+
+namespace
+{
+constexpr int kShapeUpdates = 20000;
+constexpr int kDistinctLabels = 60;
+constexpr int kTranscodeIterations = 200000;
+constexpr int kImportIterations = 50;
+constexpr int kDecodeIterations = 20;
+
+std::vector<uint8_t> ReadFile(const std::string& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream),
+                                std::istreambuf_iterator<char>());
+}
+
+/** Runs |body| |iterations| times and returns the mean in microseconds. */
+template <typename Body> double MeanMicros(int iterations, Body&& body)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        body(i);
+    }
+    std::chrono::duration<double, std::micro> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+void BenchShaping(const std::string& fontPath)
+{
+    std::vector<uint8_t> fontBytes = ReadFile(fontPath);
+    auto font = ShapingCache::DecodeFont(
+        rive::Span<const uint8_t>(fontBytes.data(), fontBytes.size()));
+    if (font == nullptr)
+    {
+        fprintf(stderr, "shaping: cannot decode %s\n", fontPath.c_str());
+        return;
+    }
+
+    std::vector<std::vector<rive::Unichar>> labels(kDistinctLabels);
+    for (int i = 0; i < kDistinctLabels; ++i)
+    {
+        for (char c : std::to_string(i))
+        {
+            labels[i].push_back(static_cast<rive::Unichar>(c));
+        }
+    }
+    auto shape = [&](int i) {
+        const auto& label = labels[i % kDistinctLabels];
+        rive::TextRun run = {};
+        run.font = font;
+        run.size = 24.0f;
+        run.lineHeight = -1.0f;
+        run.unicharCount = static_cast<uint32_t>(label.size());
+        font->shapeText(rive::Span<const rive::Unichar>(label.data(), label.size()),
+                        rive::Span<const rive::TextRun>(&run, 1));
+    };
+
+    ShapingCache::SetCapacity(0);
+    double uncached = MeanMicros(kShapeUpdates, shape);
+    ShapingCache::SetCapacity(ShapingCache::kDefaultCapacity);
+    auto before = ShapingCache::Stats();
+    double cached = MeanMicros(kShapeUpdates, shape);
+    auto after = ShapingCache::Stats();
+    printf("shaping: %.2f us/update uncached, %.2f us/update cached (%.1fx), "
+           "%lld hits, %lld misses\n",
+           uncached,
+           cached,
+           uncached / cached,
+           static_cast<long long>(after.hits - before.hits),
+           static_cast<long long>(after.misses - before.misses));
+}
+
+void BenchTranscode()
+{
+    // A text run value: mostly ASCII, with accents and an emoji.
+    const std::u16string text =
+        u"Score: 1234 éè \U0001F3C6 Player One, level 42 of 99";
+    const auto* units = reinterpret_cast<const uint16_t*>(text.data());
+    std::string utf8(Utf8CapacityForUtf16(text.size()), '\0');
+    std::vector<uint16_t> utf16(Utf16CapacityForUtf8(utf8.size()));
+
+    size_t bytes = 0;
+    double toUtf8 = MeanMicros(kTranscodeIterations, [&](int) {
+        bytes = Utf16ToUtf8(units, text.size(), &utf8[0]);
+    });
+    double toUtf16 = MeanMicros(kTranscodeIterations, [&](int) {
+        Utf8ToUtf16(utf8.data(), bytes, utf16.data());
+    });
+    printf("transcode: %.3f us UTF-16 -> UTF-8, %.3f us UTF-8 -> UTF-16 "
+           "(%zu units)\n",
+           toUtf8,
+           toUtf16,
+           text.size());
+}
+
+/** Serves referenced assets from a bundle, like JNIFileAssetLoader. */
+class BundleLoader : public rive::FileAssetLoader
+{
+public:
+    explicit BundleLoader(const RiveBundle* bundle) : m_bundle(bundle) {}
+
+    bool loadContents(rive::FileAsset& asset,
+                      rive::Span<const uint8_t> inBandBytes,
+                      rive::Factory* factory) override
+    {
+        if (!inBandBytes.empty())
+        {
+            return false;
+        }
+        auto bundled = m_bundle->assetFor(asset);
+        if (bundled.empty())
+        {
+            return false;
+        }
+        rive::SimpleArray<uint8_t> bytes(bundled.data(), bundled.size());
+        asset.decode(bytes, factory);
+        return true;
+    }
+
+private:
+    const RiveBundle* m_bundle;
+};
+
+void BenchBundle(const std::string& bundlePath)
+{
+    rive::rcp<RiveBundle> bundle;
+    double open = MeanMicros(kImportIterations, [&](int) {
+        bundle = RiveBundle::OpenPath(bundlePath);
+    });
+    if (bundle == nullptr)
+    {
+        fprintf(stderr, "bundle: cannot open %s\n", bundlePath.c_str());
+        return;
+    }
+
+    rive::NoOpFactory factory;
+    BundleLoader loader(bundle.get());
+    for (const std::string& name : bundle->names(RiveBundle::EntryKind::File))
+    {
+        auto bytes = bundle->file(name);
+        bool imported = true;
+        double import = MeanMicros(kImportIterations, [&](int) {
+            imported &=
+                rive::File::import(bytes, &factory, nullptr, &loader) != nullptr;
+        });
+        printf("bundle: %s imported in %.1f us%s\n",
+               name.c_str(),
+               import,
+               imported ? "" : " (failed)");
+    }
+    printf("bundle: opened in %.1f us, %zu bytes mapped\n",
+           open,
+           bundle->mappedBytes());
+}
+
+void BenchDecode(const std::string& imagePath)
+{
+    std::vector<uint8_t> encoded = ReadFile(imagePath);
+    uint32_t width = 0;
+    uint32_t height = 0;
+    bool decoded = true;
+    double decode = MeanMicros(kDecodeIterations, [&](int) {
+        decoded &= decodeToRGBAPremul(
+                       rive::Span<const uint8_t>(encoded.data(), encoded.size()),
+                       false,
+                       &width,
+                       &height) != nullptr;
+    });
+    if (!decoded)
+    {
+        fprintf(stderr, "decode: cannot decode %s\n", imagePath.c_str());
+        return;
+    }
+    printf("decode: %ux%u in %.1f us, %lld texture bytes with mips\n",
+           width,
+           height,
+           decode,
+           static_cast<long long>(ImageMemory::textureBytes(width, height)));
+}
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const std::string resources = RIVE_ANDROID_TEST_RESOURCES;
+    BenchShaping(argc > 1 ? argv[1] : resources + "/font.ttf");
+    BenchTranscode();
+    BenchBundle(argc > 2 ? argv[2] : resources + "/test_bundle.rivb");
+    BenchDecode(argc > 3 ? argv[3] : resources + "/eve.png");
+    return 0;
+}
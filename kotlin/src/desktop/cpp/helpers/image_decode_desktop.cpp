@@ -0,0 +1,35 @@
+#include "helpers/image_decode_desktop.hpp"
+
+#include "helpers/general.hpp"
+#include "rive/decoders/bitmap_decoder.hpp"
+
+#include <cstring>
+
+using namespace rive;
+
+namespace rive_android
+{
+std::unique_ptr<uint8_t[]> decodeToRGBAPremul(Span<const uint8_t> encodedBytes,
+                                              bool isPremultiplied,
+                                              uint32_t* width,
+                                              uint32_t* height)
+{
+    auto bitmap = Bitmap::decode(encodedBytes.data(), encodedBytes.size());
+    if (bitmap == nullptr)
+    {
+        LOGE("decodeToRGBAPremul: unsupported or corrupt image (%zu bytes)",
+             encodedBytes.size());
+        return nullptr;
+    }
+    // Already premultiplied pixels only need widening to RGBA.
+    bitmap->pixelFormat(isPremultiplied ? Bitmap::PixelFormat::RGBA
+                                        : Bitmap::PixelFormat::RGBAPremul);
+
+    const size_t byteSize = bitmap->byteSize();
+    auto pixels = std::make_unique<uint8_t[]>(byteSize);
+    memcpy(pixels.get(), bitmap->bytes(), byteSize);
+    *width = bitmap->width();
+    *height = bitmap->height();
+    return pixels;
+}
+} // namespace rive_android
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "rive/span.hpp"
+
+#include <cstdint>
+#include <memory>
+
+namespace rive_android
+{
+/**
+ * Desktop counterpart of decodeToRGBAPremul (helpers/image_decode.hpp), which
+ * decodes through Android's BitmapFactory. Decodes PNG, JPEG and WebP with
+ * rive-runtime's decoders instead.
+ *
+ * @param isPremultiplied Whether the encoded pixels are already premultiplied.
+ * @return Premultiplied RGBA pixels, or null if decoding failed.
+ */
+std::unique_ptr<uint8_t[]> decodeToRGBAPremul(
+    rive::Span<const uint8_t> encodedBytes,
+    bool isPremultiplied,
+    uint32_t* width,
+    uint32_t* height);
+} // namespace rive_android
@@ -0,0 +1,38 @@
+#pragma once
+
+/**
+ * Desktop stand-in for the NDK's android/log.h, for the kotlin module's core
+ * sources built by ../CMakeLists.txt. Messages go to stderr as
+ * "<tag>: <message>".
+ */
+
+#include <cstdarg>
+#include <cstdio>
+
+typedef enum android_LogPriority
+{
+    ANDROID_LOG_UNKNOWN = 0,
+    ANDROID_LOG_DEFAULT,
+    ANDROID_LOG_VERBOSE,
+    ANDROID_LOG_DEBUG,
+    ANDROID_LOG_INFO,
+    ANDROID_LOG_WARN,
+    ANDROID_LOG_ERROR,
+    ANDROID_LOG_FATAL,
+    ANDROID_LOG_SILENT,
+} android_LogPriority;
+
+__attribute__((format(printf, 3, 4))) inline int __android_log_print(
+    int,
+    const char* tag,
+    const char* fmt,
+    ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int written = fprintf(stderr, "%s: ", tag);
+    written += vfprintf(stderr, fmt, args);
+    written += fprintf(stderr, "\n");
+    va_end(args);
+    return written;
+}
@@ -3,6 +3,8 @@
 #include "helpers/general.hpp"
 #include "helpers/worker_ref.hpp"
 
+#include <vector>
+
 #include "rive/refcnt.hpp"
 #include "rive/renderer/rive_render_factory.hpp"
 #include "rive/renderer/rive_render_image.hpp"
@@ -46,20 +48,53 @@ public:
 
     rive::rcp<rive::RenderImage> decodeImage(
         rive::Span<const uint8_t>) override;
+
+    /** Fonts shape through the ShapingCache. */
+    rive::rcp<rive::Font> decodeFont(rive::Span<const uint8_t>) override;
+};
+
+/** What an AndroidImage keeps on the CPU after upload (see ImageRetention). */
+struct ImageSource
+{
+    /** Encoded bytes to re-decode from; empty unless retained. */
+    std::vector<uint8_t> encoded;
+    bool isPremultiplied = false;
 };
 
+/**
+ * A Rive renderer image whose texture is created on the GL worker.
+ *
+ * The decoded RGBA pixels are freed as soon as the texture exists; the image
+ * never holds a CPU copy of its pixels afterwards. Pixels can be decoded
+ * again from the encoded bytes when ImageRetention::KeepEncoded was in
+ * effect at creation.
+ */
 class AndroidImage : public rive::RiveRenderImage
 {
 public:
     AndroidImage(int width,
                  int height,
-                 std::unique_ptr<const uint8_t[]> imageDataRGBAPtr);
+                 std::unique_ptr<const uint8_t[]> imageDataRGBAPtr,
+                 ImageSource source = {});
 
     ~AndroidImage() override;
 
+    /**
+     * Decode the image's pixels again, for CPU access or to rebuild the
+     * texture after a context loss.
+     *
+     * @return Premultiplied RGBA pixels of the image's width and height, or
+     *         null if the encoded bytes were not retained, fail to decode, or
+     *         decode to a different size.
+     */
+    std::unique_ptr<uint8_t[]> decodePixels() const;
+
 private:
     const rive::rcp<RefWorker> m_glWorker;
     RefWorker::WorkID m_textureCreationWorkID;
+    const ImageSource m_source;
+    /** Written by the upload work item; read after waiting for it. */
+    int64_t m_textureBytes = 0;
 };
 
 class AndroidCanvasFactory : public rive::Factory
@@ -73,6 +108,10 @@ public:
     rive::rcp<rive::RenderImage> decodeImage(
         rive::Span<const uint8_t> encodedBytes) override;
 
+    /** Fonts shape through the ShapingCache. */
+    rive::rcp<rive::Font> decodeFont(
+        rive::Span<const uint8_t> encodedBytes) override;
+
     rive::rcp<rive::RenderShader> makeLinearGradient(
         float sx,
         float sy,
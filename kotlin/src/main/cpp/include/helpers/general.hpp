@@ -53,7 +53,13 @@ JNIEnv* GetJNIEnv();
 
 void DetachThread();
 
+/**
+ * Java strings are converted from UTF-16 to standard UTF-8, and back, without
+ * going through JNI's modified UTF-8, which mangles supplementary characters
+ * such as emoji (see utf16_transcode.hpp).
+ */
 std::string JStringToString(JNIEnv*, jstring);
+jstring StringToJString(JNIEnv*, const std::string&);
 int SizeTTOInt(size_t);
 size_t JIntToSizeT(jint);
 
@@ -7,6 +7,7 @@
 
 #include <android/bitmap.h>
 #include <cstdint>
+#include <memory>
 #include <jni.h>
 #include <vector>
 
@@ -25,6 +26,17 @@ namespace rive_android
  *   rive::RenderImage. If null, will instead use the legacy pathway,
  *   constructing an AndroidImage.
  */
+/**
+ * Decode through Android BitmapFactory into premultiplied RGBA bytes.
+ *
+ * @return The pixels, or null if decoding failed.
+ */
+std::unique_ptr<uint8_t[]> decodeToRGBAPremul(
+    rive::Span<const uint8_t> encodedBytes,
+    bool isPremultiplied,
+    uint32_t* width,
+    uint32_t* height);
+
 rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     rive::Span<const uint8_t> encodedBytes,
     bool isPremultiplied,
@@ -37,6 +49,14 @@ rive::rcp<rive::RenderImage> renderImageFromRGBABytesRive(
     const uint8_t* pixelBytes,
     bool isPremultiplied);
 
+/** Rive (GL) path: takes ownership of RGBA bytes (premultiplied in place) ->
+ * AndroidImage */
+rive::rcp<rive::RenderImage> renderImageFromRGBAPixelsRive(
+    uint32_t width,
+    uint32_t height,
+    std::unique_ptr<uint8_t[]> pixels,
+    bool isPremultiplied);
+
 /** Canvas path: from RGBA bytes -> ARGB ints -> Bitmap::setPixels ->
  * CanvasRenderImage */
 rive::rcp<rive::RenderImage> renderImageFromRGBABytesCanvas(
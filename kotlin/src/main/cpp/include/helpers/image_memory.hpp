@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace rive_android
+{
+/**
+ * What an AndroidImage keeps on the CPU once its texture has been uploaded.
+ *
+ * Decoded RGBA pixels are always freed as soon as the texture exists; a
+ * resident copy would double the memory of every image. The policy only
+ * decides whether the much smaller encoded bytes are kept so the pixels can
+ * be re-decoded later (see AndroidImage::decodePixels()).
+ */
+enum class ImageRetention
+{
+    /** Keep nothing; the texture is the only copy. */
+    DropAll = 0,
+    /** Keep the encoded bytes of decoded images so they can be re-decoded. */
+    KeepEncoded = 1,
+};
+
+/** Snapshot of Rive renderer image memory, in bytes unless noted. */
+struct ImageMemoryReport
+{
+    int64_t liveImages = 0;
+    /** Decoded pixels waiting for their upload. */
+    int64_t pendingPixelBytes = 0;
+    /** Estimated texture memory, including mip levels. */
+    int64_t textureBytes = 0;
+    /** Encoded bytes kept for re-decoding. */
+    int64_t retainedEncodedBytes = 0;
+    /** Decoded pixels freed after upload since startup (the saving). */
+    int64_t releasedPixelBytes = 0;
+    /** Times pixels were decoded again from retained encoded bytes. */
+    int64_t redecodeCount = 0;
+};
+
+/**
+ * Process-wide accounting for AndroidImage memory. Thread-safe.
+ */
+class ImageMemory
+{
+public:
+    static ImageRetention retention()
+    {
+        return static_cast<ImageRetention>(s_retention.load(std::memory_order_relaxed));
+    }
+    static void setRetention(ImageRetention retention)
+    {
+        s_retention.store(static_cast<int>(retention), std::memory_order_relaxed);
+    }
+
+    static ImageMemoryReport report();
+
+    /** Texture bytes for an RGBA8 image with a full mip chain (4/3 of level 0). */
+    static int64_t textureBytes(uint32_t width, uint32_t height)
+    {
+        return static_cast<int64_t>(width) * height * 4 * 4 / 3;
+    }
+
+    static void imageCreated(int64_t pixelBytes, int64_t encodedBytes);
+    static void imageUploaded(int64_t pixelBytes, int64_t textureBytes);
+    static void imageDestroyed(int64_t textureBytes, int64_t encodedBytes);
+    static void imageRedecoded() { s_redecodeCount.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    static std::atomic<int> s_retention;
+    static std::atomic<int64_t> s_liveImages;
+    static std::atomic<int64_t> s_pendingPixelBytes;
+    static std::atomic<int64_t> s_textureBytes;
+    static std::atomic<int64_t> s_retainedEncodedBytes;
+    static std::atomic<int64_t> s_releasedPixelBytes;
+    static std::atomic<int64_t> s_redecodeCount;
+};
+} // namespace rive_android
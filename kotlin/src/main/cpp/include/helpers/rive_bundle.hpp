@@ -0,0 +1,92 @@
+#pragma once
+
+#include "rive/assets/file_asset.hpp"
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rive_android
+{
+/**
+ * A memory-mapped bundle of .riv files and the assets they share.
+ *
+ * Apps that ship many files as separate resources pay for every one twice:
+ * a copy into a Java byte array and a second one into native memory. A
+ * bundle packs them into a single file (built on the desktop with
+ * dev/pack_rive_bundle.py) that is mapped read-only; files and assets are
+ * handed to the importer and the asset loader as spans into the mapping, and
+ * the kernel pages in only what is read.
+ *
+ * Layout (little-endian):
+ *   header: char magic[4] = "RVBN", u32 version, u32 entryCount,
+ *           u32 alignment, u64 indexSize, u64 reserved
+ *   index:  entryCount records of
+ *           u32 kind (0 = file, 1 = asset), u32 nameLength,
+ *           u64 offset, u64 size, nameLength bytes of UTF-8 name
+ *   blobs:  each at an `alignment`-aligned offset from the start of the
+ *           bundle; entries with identical content share one blob.
+ *
+ * Immutable once opened, so lookups are thread-safe.
+ */
+class RiveBundle : public rive::RefCnt<RiveBundle>
+{
+public:
+    enum class EntryKind : uint32_t
+    {
+        File = 0,
+        Asset = 1,
+    };
+
+    /**
+     * Map a bundle stored at [offset, offset + length) of an open file, e.g.
+     * an uncompressed raw resource. The descriptor may be closed afterwards.
+     *
+     * @return Null if the range cannot be mapped or is not a valid bundle.
+     */
+    static rive::rcp<RiveBundle> Open(int fd, int64_t offset, int64_t length);
+
+    /** Map a bundle file. @return Null on failure. */
+    static rive::rcp<RiveBundle> OpenPath(const std::string& path);
+
+    ~RiveBundle();
+
+    /** The bytes of a .riv file, or an empty span if there is none. */
+    rive::Span<const uint8_t> file(const std::string& name) const;
+
+    /** The bytes of an asset, or an empty span if there is none. */
+    rive::Span<const uint8_t> asset(const std::string& name) const;
+
+    /**
+     * The bytes for a file's asset, looked up by its unique filename
+     * ("name-id.ext"), then by name with and without its extension.
+     */
+    rive::Span<const uint8_t> assetFor(const rive::FileAsset& fileAsset) const;
+
+    std::vector<std::string> names(EntryKind kind) const;
+
+    size_t mappedBytes() const { return m_mapLength; }
+
+private:
+    struct Entry
+    {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    RiveBundle(void* mapBase, size_t mapLength, const uint8_t* data, size_t size);
+
+    bool parseIndex();
+    rive::Span<const uint8_t> find(EntryKind kind, const std::string& name) const;
+
+    void* m_mapBase;
+    size_t m_mapLength;
+    const uint8_t* m_data;
+    size_t m_size;
+    std::unordered_map<std::string, Entry> m_files;
+    std::unordered_map<std::string, Entry> m_assets;
+};
+} // namespace rive_android
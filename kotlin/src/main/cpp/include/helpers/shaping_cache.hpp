@@ -0,0 +1,77 @@
+#pragma once
+
+#include "rive/refcnt.hpp"
+#include "rive/span.hpp"
+#include "rive/text_engine.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rive_android
+{
+/** Counters for the shaping cache, since startup. */
+struct ShapingCacheStats
+{
+    /** Shapes answered from the cache. */
+    int64_t hits = 0;
+    /** Shapes that ran HarfBuzz. */
+    int64_t misses = 0;
+    /** Entries dropped to stay within capacity. */
+    int64_t evictions = 0;
+    /** Entries currently cached. */
+    int64_t entries = 0;
+    /** Maximum number of entries; 0 when the cache is disabled. */
+    int64_t capacity = 0;
+};
+
+/**
+ * LRU cache of shaped text, shared by every text run in the process.
+ *
+ * Counters, timers and scores set a text run's value many times per second,
+ * and each change re-shapes the whole text even though the labels cycle
+ * through a handful of strings. Fonts decoded by the Android factories
+ * (DecodeFont) consult this cache before shaping: the key is the full input
+ * of a shape, i.e. the unichars and, per run, the font, size, line height,
+ * letter spacing, length, script, style and bidi level, plus the paragraph
+ * direction. Font features and variation axes are part of the font instance
+ * (Font::withOptions), so the font identity covers them.
+ *
+ * A hit returns a copy of the cached paragraphs, which is a few small array
+ * copies instead of a HarfBuzz run. Long texts are not cached; they rarely
+ * repeat and would crowd out the short labels that do.
+ *
+ * Entries keep their fonts alive until evicted or cleared; releasing a file
+ * evicts the entries that use its fonts (EvictFonts).
+ *
+ * Thread-safe: shaping may happen on any worker.
+ */
+class ShapingCache
+{
+public:
+    static constexpr size_t kDefaultCapacity = 256;
+    /** Texts longer than this many unichars bypass the cache. */
+    static constexpr size_t kMaxCachedUnichars = 256;
+
+    /**
+     * Decode a font whose shapes go through the cache. Used by the Android
+     * factories in place of HBFont::Decode.
+     */
+    static rive::rcp<rive::Font> DecodeFont(rive::Span<const uint8_t> data);
+
+    /** Maximum number of cached shapes; 0 disables the cache. */
+    static void SetCapacity(size_t capacity);
+
+    /** Drop every entry, e.g. when fallback fonts change. */
+    static void Clear();
+
+    /**
+     * Drop the entries that shape with any of |fonts|, e.g. the fonts of a
+     * released file, so the cache does not keep them alive. Entries for other
+     * fonts keep their hits.
+     */
+    static void EvictFonts(const std::vector<const rive::Font*>& fonts);
+
+    static ShapingCacheStats Stats();
+};
+} // namespace rive_android
@@ -22,6 +22,13 @@ public:
 
     void makeCurrent(EGLSurface eglSurface) override;
 
+    /**
+     * Draw a throwaway offscreen frame that uses the common shader variants
+     * (fills, strokes, gradients, clips, advanced blending) so they are
+     * compiled before the first real frame needs them.
+     */
+    void prewarm();
+
 private:
     std::unique_ptr<rive::gpu::RenderContext> m_renderContext;
 
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rive_android
+{
+/**
+ * UTF-16 <-> UTF-8 transcoding for strings crossing JNI.
+ *
+ * GetStringUTFChars and NewStringUTF use modified UTF-8, which writes a
+ * supplementary character (e.g. an emoji in a text run) as two 3-byte
+ * surrogates rather than one 4-byte sequence. Rive expects standard UTF-8,
+ * so such text arrived unshapeable and came back mangled. These functions
+ * convert between Java's UTF-16 and standard UTF-8 directly; ASCII runs are
+ * copied 8 or 16 units at a time with NEON on ARM and SSE2 on x86.
+ *
+ * Malformed input (unpaired surrogates, invalid UTF-8) becomes U+FFFD.
+ *
+ * mprive carries a copy in jni_common/utf16_transcode (namespace rive_mp):
+ * the two native libraries are built separately and share no sources. Keep
+ * fixes in sync.
+ */
+
+/** Worst-case UTF-8 bytes for a UTF-16 string: 3 per unit. */
+constexpr size_t Utf8CapacityForUtf16(size_t units) { return units * 3; }
+
+/** Worst-case UTF-16 units for a UTF-8 string: at most one per byte. */
+constexpr size_t Utf16CapacityForUtf8(size_t bytes) { return bytes; }
+
+/**
+ * @param dst At least Utf8CapacityForUtf16(units) bytes.
+ * @return Bytes written.
+ */
+size_t Utf16ToUtf8(const uint16_t* src, size_t units, char* dst);
+
+/**
+ * @param dst At least Utf16CapacityForUtf8(bytes) units.
+ * @return Units written.
+ */
+size_t Utf8ToUtf16(const char* src, size_t bytes, uint16_t* dst);
+} // namespace rive_android
@@ -3,6 +3,7 @@
 #include <jni.h>
 
 #include "helpers/general.hpp"
+#include "helpers/rive_bundle.hpp"
 #include "rive/factory.hpp"
 #include "rive/file_asset_loader.hpp"
 #include "rive/assets/image_asset.hpp"
@@ -29,6 +30,12 @@ public:
         }
     }
 
+    /**
+     * Serve referenced assets from a bundle before asking the Kotlin loader.
+     * Null detaches it.
+     */
+    void setBundle(rive::rcp<RiveBundle> bundle) { m_bundle = std::move(bundle); }
+
     static jobject MakeKtAsset(JNIEnv* env,
                                rive::FileAsset& asset,
                                RendererType rendererType)
@@ -93,5 +100,6 @@ private:
     jmethodID m_ktLoadContentsFn;
 
     RendererType m_rendererType = RendererType::None;
+    rive::rcp<RiveBundle> m_bundle;
 };
 } // namespace rive_android
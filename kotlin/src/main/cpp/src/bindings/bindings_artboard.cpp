@@ -21,7 +21,7 @@ extern "C"
                                                        jlong ref)
     {
         auto artboard = reinterpret_cast<rive::ArtboardInstance*>(ref);
-        return env->NewStringUTF(artboard->name().c_str());
+        return StringToJString(env, artboard->name());
     }
 
     JNIEXPORT jstring JNICALL
@@ -35,7 +35,7 @@ extern "C"
         auto* animation = artboard->animation(index);
         auto name = animation->name();
 
-        return env->NewStringUTF(name.c_str());
+        return StringToJString(env, name);
     }
 
     JNIEXPORT jstring JNICALL
@@ -50,7 +50,7 @@ extern "C"
         auto* stateMachine = artboard->stateMachine(index);
         auto name = stateMachine->name();
 
-        return env->NewStringUTF(name.c_str());
+        return StringToJString(env, name);
     }
 
     JNIEXPORT jlong JNICALL
@@ -179,7 +179,7 @@ extern "C"
         {
             return nullptr;
         }
-        return env->NewStringUTF(run->text().c_str());
+        return StringToJString(env, run->text());
     }
 
     JNIEXPORT jboolean JNICALL
@@ -229,7 +229,7 @@ extern "C"
         {
             return nullptr;
         }
-        return env->NewStringUTF(run->text().c_str());
+        return StringToJString(env, run->text());
     }
 
     JNIEXPORT jboolean JNICALL
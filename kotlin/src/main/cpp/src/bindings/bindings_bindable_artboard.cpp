@@ -1,5 +1,6 @@
 #include <jni.h>
 
+#include "helpers/general.hpp"
 #include "rive/bindable_artboard.hpp"
 
 extern "C"
@@ -22,6 +23,6 @@ extern "C"
     {
         auto bindableArtboard = reinterpret_cast<rive::BindableArtboard*>(ref);
         auto name = bindableArtboard->artboard()->name();
-        return env->NewStringUTF(name.c_str());
+        return rive_android::StringToJString(env, name);
     }
 }
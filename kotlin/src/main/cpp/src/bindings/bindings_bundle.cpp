@@ -0,0 +1,102 @@
+#include "jni_refs.hpp"
+#include "helpers/general.hpp"
+#include "helpers/rive_bundle.hpp"
+
+#include <jni.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    using namespace rive_android;
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveBundle_00024Companion_cppOpenFd(
+        JNIEnv*,
+        jobject,
+        jint fd,
+        jlong offset,
+        jlong length)
+    {
+        // Released to a raw pointer; un-ref'd in cppDelete.
+        return reinterpret_cast<jlong>(
+            RiveBundle::Open(fd, offset, length).release());
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveBundle_00024Companion_cppOpenPath(
+        JNIEnv* env,
+        jobject,
+        jstring path)
+    {
+        return reinterpret_cast<jlong>(
+            RiveBundle::OpenPath(JStringToString(env, path)).release());
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveBundle_cppDelete(JNIEnv*,
+                                                           jobject,
+                                                           jlong ref)
+    {
+        // Files and loaders that still use the bundle hold their own refs.
+        reinterpret_cast<RiveBundle*>(ref)->unref();
+    }
+
+    JNIEXPORT jobjectArray JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveBundle_cppNames(JNIEnv* env,
+                                                          jobject,
+                                                          jlong ref,
+                                                          jint kind)
+    {
+        auto* bundle = reinterpret_cast<RiveBundle*>(ref);
+        auto names =
+            bundle->names(static_cast<RiveBundle::EntryKind>(kind));
+        jclass stringClass = env->FindClass("java/lang/String");
+        auto result = env->NewObjectArray(SizeTTOInt(names.size()),
+                                          stringClass,
+                                          nullptr);
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            jstring name = StringToJString(env, names[i]);
+            env->SetObjectArrayElement(result, SizeTTOInt(i), name);
+            env->DeleteLocalRef(name);
+        }
+        env->DeleteLocalRef(stringClass);
+        return result;
+    }
+
+    JNIEXPORT jbyteArray JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveBundle_cppAssetBytes(JNIEnv* env,
+                                                               jobject,
+                                                               jlong ref,
+                                                               jstring name)
+    {
+        auto* bundle = reinterpret_cast<RiveBundle*>(ref);
+        auto bytes = bundle->asset(JStringToString(env, name));
+        if (bytes.empty())
+        {
+            return nullptr;
+        }
+        auto length = SizeTTOInt(bytes.size());
+        auto result = env->NewByteArray(length);
+        if (result != nullptr)
+        {
+            env->SetByteArrayRegion(result,
+                                    0,
+                                    length,
+                                    reinterpret_cast<const jbyte*>(bytes.data()));
+        }
+        return result;
+    }
+
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveBundle_cppMappedBytes(JNIEnv*,
+                                                                jobject,
+                                                                jlong ref)
+    {
+        return static_cast<jlong>(
+            reinterpret_cast<RiveBundle*>(ref)->mappedBytes());
+    }
+#ifdef __cplusplus
+}
+#endif
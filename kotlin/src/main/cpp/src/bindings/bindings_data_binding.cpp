@@ -25,7 +25,7 @@ extern "C"
                                                         jlong ref)
     {
         auto vm = reinterpret_cast<rive::ViewModelRuntime*>(ref);
-        return env->NewStringUTF(vm->name().c_str());
+        return StringToJString(env, vm->name());
     }
 
     JNIEXPORT jint JNICALL
@@ -158,7 +158,7 @@ extern "C"
                                                                 jlong ref)
     {
         auto vm = reinterpret_cast<rive::ViewModelInstanceRuntime*>(ref);
-        return env->NewStringUTF(vm->name().c_str());
+        return StringToJString(env, vm->name());
     }
 
     JNIEXPORT jlong JNICALL
@@ -326,7 +326,7 @@ extern "C"
     {
         auto property =
             reinterpret_cast<rive::ViewModelInstanceValueRuntime*>(ref);
-        return env->NewStringUTF(property->name().c_str());
+        return StringToJString(env, property->name());
     }
 
     JNIEXPORT jboolean JNICALL
@@ -381,7 +381,7 @@ extern "C"
     {
         auto property =
             reinterpret_cast<rive::ViewModelInstanceStringRuntime*>(ref);
-        return env->NewStringUTF(property->value().c_str());
+        return StringToJString(env, property->value());
     }
 
     JNIEXPORT void JNICALL
@@ -451,7 +451,7 @@ extern "C"
     {
         auto property =
             reinterpret_cast<rive::ViewModelInstanceEnumRuntime*>(ref);
-        return env->NewStringUTF(property->value().c_str());
+        return StringToJString(env, property->value());
     }
 
     JNIEXPORT void JNICALL
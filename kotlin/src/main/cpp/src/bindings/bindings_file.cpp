@@ -2,7 +2,10 @@
 
 #include "helpers/general.hpp"
 #include "helpers/jni_resource.hpp"
+#include "helpers/rive_bundle.hpp"
+#include "helpers/shaping_cache.hpp"
 #include "jni_refs.hpp"
+#include "rive/assets/font_asset.hpp"
 #include "rive/file.hpp"
 #include "rive/viewmodel/runtime/viewmodel_runtime.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
@@ -35,6 +38,30 @@ extern "C"
         return reinterpret_cast<jlong>(file);
     }
 
+    JNIEXPORT jlong JNICALL
+    Java_app_rive_runtime_kotlin_core_File_importFromBundle(
+        JNIEnv* env,
+        jobject,
+        jlong bundleRef,
+        jstring name,
+        jint type,
+        jlong fileAssetLoader)
+    {
+        auto* bundle = reinterpret_cast<RiveBundle*>(bundleRef);
+        auto fileName = JStringToString(env, name);
+        auto bytes = bundle->file(fileName);
+        if (bytes.empty())
+        {
+            return ThrowRiveException(
+                ("No file named " + fileName + " in the bundle.").c_str());
+        }
+        // Imported straight from the mapping; nothing is copied up front.
+        return Import(const_cast<uint8_t*>(bytes.data()),
+                      SizeTTOInt(bytes.size()),
+                      static_cast<RendererType>(type),
+                      reinterpret_cast<rive::FileAssetLoader*>(fileAssetLoader));
+    }
+
     JNIEXPORT jlong JNICALL
     Java_app_rive_runtime_kotlin_core_File_cppArtboardByName(JNIEnv* env,
                                                              jobject,
@@ -57,6 +84,21 @@ extern "C"
                                                      jlong ref)
     {
         auto file = reinterpret_cast<rive::File*>(ref);
+        // Cached shapes hold the file's fonts; let them go with it. Shapes
+        // of other files' fonts stay cached.
+        std::vector<const rive::Font*> fonts;
+        for (const auto& asset : file->assets())
+        {
+            if (asset->is<rive::FontAsset>())
+            {
+                auto* font = asset->as<rive::FontAsset>()->font().get();
+                if (font != nullptr)
+                {
+                    fonts.push_back(font);
+                }
+            }
+        }
+        ShapingCache::EvictFonts(fonts);
         // Because files are created as an RCP type that has been released, we
         // have an extra ref count to un-ref here.
         file->unref();
@@ -99,7 +141,7 @@ extern "C"
 
         auto artboard = file->artboard(index);
         auto name = artboard->name();
-        return env->NewStringUTF(name.c_str());
+        return StringToJString(env, name);
     }
 
     JNIEXPORT jlong JNICALL
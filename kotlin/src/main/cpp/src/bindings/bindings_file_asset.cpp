@@ -2,6 +2,7 @@
 #include "helpers/android_factories.hpp"
 #include "helpers/general.hpp"
 #include "helpers/image_decode.hpp"
+#include "helpers/image_memory.hpp"
 
 #include "rive/assets/image_asset.hpp"
 #include "rive/simple_array.hpp"
@@ -20,7 +21,7 @@ extern "C"
                                                         jlong address)
     {
         auto* fileAsset = reinterpret_cast<rive::FileAsset*>(address);
-        return env->NewStringUTF(fileAsset->name().c_str());
+        return StringToJString(env, fileAsset->name());
     }
 
     JNIEXPORT jstring JNICALL
@@ -29,7 +30,7 @@ extern "C"
                                                                   jlong address)
     {
         auto* fileAsset = reinterpret_cast<rive::FileAsset*>(address);
-        return env->NewStringUTF(fileAsset->uniqueFilename().c_str());
+        return StringToJString(env, fileAsset->uniqueFilename());
     }
 
     JNIEXPORT jboolean JNICALL
@@ -76,7 +77,7 @@ extern "C"
             cdnUrl += ('/');
         }
         cdnUrl += uuid;
-        return env->NewStringUTF(cdnUrl.c_str());
+        return StringToJString(env, cdnUrl);
     }
 
     /** == Images ==  */
@@ -222,6 +223,70 @@ extern "C"
         return reinterpret_cast<jlong>(renderImage.release());
     }
 
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppGetMemoryReport(
+        JNIEnv* env,
+        jobject)
+    {
+        auto report = ImageMemory::report();
+        const jlong values[] = {report.liveImages,
+                                report.pendingPixelBytes,
+                                report.textureBytes,
+                                report.retainedEncodedBytes,
+                                report.releasedPixelBytes,
+                                report.redecodeCount};
+        const auto count = static_cast<jsize>(sizeof(values) / sizeof(values[0]));
+        auto result = env->NewLongArray(count);
+        if (result != nullptr)
+        {
+            env->SetLongArrayRegion(result, 0, count, values);
+        }
+        return result;
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveRenderImage_00024Companion_cppSetRetainEncodedBytes(
+        JNIEnv*,
+        jobject,
+        jboolean retain)
+    {
+        ImageMemory::setRetention(retain == JNI_TRUE
+                                      ? ImageRetention::KeepEncoded
+                                      : ImageRetention::DropAll);
+    }
+
+    JNIEXPORT jbyteArray JNICALL
+    Java_app_rive_runtime_kotlin_core_RiveRenderImage_cppReadPixels(
+        JNIEnv* env,
+        jobject,
+        jlong ref)
+    {
+        // Kotlin only calls this for Rive renderer images, which are all
+        // AndroidImages.
+        auto* image = static_cast<AndroidImage*>(
+            reinterpret_cast<rive::RenderImage*>(ref));
+        if (image == nullptr)
+        {
+            return nullptr;
+        }
+        auto pixels = image->decodePixels();
+        if (pixels == nullptr)
+        {
+            return nullptr;
+        }
+        const auto size =
+            static_cast<jsize>(image->width()) * image->height() * 4;
+        auto result = env->NewByteArray(size);
+        if (result != nullptr)
+        {
+            env->SetByteArrayRegion(result,
+                                    0,
+                                    size,
+                                    reinterpret_cast<const jbyte*>(pixels.get()));
+        }
+        return result;
+    }
+
     JNIEXPORT void JNICALL
     Java_app_rive_runtime_kotlin_core_RiveRenderImage_cppDelete(JNIEnv*,
                                                                 jobject,
@@ -50,6 +50,17 @@ extern "C"
         auto* fileAssetLoader = reinterpret_cast<JNIFileAssetLoader*>(ref);
         fileAssetLoader->setRendererType(static_cast<RendererType>(type));
     }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_FileAssetLoader_cppSetBundle(JNIEnv*,
+                                                                   jobject,
+                                                                   jlong ref,
+                                                                   jlong bundleRef)
+    {
+        auto* fileAssetLoader = reinterpret_cast<JNIFileAssetLoader*>(ref);
+        fileAssetLoader->setBundle(
+            rive::ref_rcp(reinterpret_cast<RiveBundle*>(bundleRef)));
+    }
 #ifdef __cplusplus
 }
 #endif
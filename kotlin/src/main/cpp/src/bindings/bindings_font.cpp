@@ -3,6 +3,7 @@
 
 #include "helpers/font_helper.hpp"
 #include "helpers/general.hpp"
+#include "helpers/shaping_cache.hpp"
 #include "rive/text/utf.hpp"
 #include "helpers/jni_resource.hpp"
 
@@ -18,6 +19,8 @@ extern "C"
         jobject,
         jbyteArray fontByteArray)
     {
+        // Cached shapes resolved missing glyphs against the old fallbacks.
+        ShapingCache::Clear();
         return FontHelper::RegisterFallbackFont(fontByteArray);
     }
 
@@ -27,6 +30,7 @@ extern "C"
         jobject)
     {
         FontHelper::resetCache();
+        ShapingCache::Clear();
     }
 #ifdef __cplusplus
 }
@@ -2,8 +2,12 @@
 #include "helpers/general.hpp"
 #include "helpers/font_helper.hpp"
 #include "helpers/jni_resource.hpp"
+#include "helpers/shaping_cache.hpp"
+#include "helpers/thread_state_pls.hpp"
+#include "helpers/worker_ref.hpp"
 #include "helpers/rive_log.hpp"
 #include "models/dimensions_helper.hpp"
+#include <algorithm>
 #include <jni.h>
 
 #if defined(DEBUG) || defined(LOG)
@@ -78,6 +82,47 @@ extern "C"
         rive::Font::gFallbackProc = FontHelper::FindFontFallback;
     }
 
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_Rive_cppPrewarmRenderer(JNIEnv*, jobject)
+    {
+        auto worker = RefWorker::RiveWorker();
+        if (worker == nullptr)
+        {
+            return; // Canvas fallback: nothing to compile.
+        }
+        // Fire and forget; the worker's queue runs it before later draws.
+        worker->run([](DrawableThreadState* threadState) {
+            static_cast<PLSThreadState*>(threadState)->prewarm();
+        });
+    }
+
+    JNIEXPORT void JNICALL
+    Java_app_rive_runtime_kotlin_core_Rive_cppSetShapingCacheCapacity(
+        JNIEnv*,
+        jobject,
+        jint capacity)
+    {
+        ShapingCache::SetCapacity(static_cast<size_t>(std::max(capacity, 0)));
+    }
+
+    JNIEXPORT jlongArray JNICALL
+    Java_app_rive_runtime_kotlin_core_Rive_cppGetShapingCacheStats(JNIEnv* env,
+                                                                   jobject)
+    {
+        auto stats = ShapingCache::Stats();
+        jlong values[] = {stats.hits,
+                          stats.misses,
+                          stats.evictions,
+                          stats.entries,
+                          stats.capacity};
+        auto result = env->NewLongArray(5);
+        if (result != nullptr)
+        {
+            env->SetLongArrayRegion(result, 0, 5, values);
+        }
+        return result;
+    }
+
 #ifdef __cplusplus
 }
 #endif
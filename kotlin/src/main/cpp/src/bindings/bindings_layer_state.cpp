@@ -102,8 +102,8 @@ extern "C"
         else
         {
             // urgh this animation state is using forward declarations...
-            return env->NewStringUTF(
-                animationState->animation()->name().c_str());
+            return StringToJString(env,
+                                   animationState->animation()->name());
         }
     }
 
@@ -200,8 +200,8 @@ extern "C"
 
         auto animationInstance =
             reinterpret_cast<const rive::LinearAnimationInstance*>(ref);
-        return env->NewStringUTF(
-            animationInstance->animation()->name().c_str());
+        return StringToJString(env,
+                               animationInstance->animation()->name());
     }
 
     JNIEXPORT jint JNICALL
@@ -56,7 +56,7 @@ extern "C"
             {
                 if (!child->name().empty())
                 {
-                    jstring jKey = env->NewStringUTF(child->name().c_str());
+                    jstring jKey = StringToJString(env, child->name());
                     switch (child->coreType())
                     {
                         case rive::CustomPropertyBoolean::typeKey:
@@ -81,10 +81,10 @@ extern "C"
                         case rive::CustomPropertyString::typeKey:
                         {
 
-                            jstring jValueString = env->NewStringUTF(
+                            jstring jValueString = StringToJString(
+                                env,
                                 child->as<rive::CustomPropertyString>()
-                                    ->propertyValue()
-                                    .c_str());
+                                    ->propertyValue());
                             JNIExceptionHandler::CallObjectMethod(
                                 env,
                                 propertiesObject,
@@ -134,7 +134,7 @@ extern "C"
         if (event->is<rive::OpenUrlEvent>())
         {
             auto urlEvent = event->as<rive::OpenUrlEvent>();
-            return env->NewStringUTF(urlEvent->url().c_str());
+            return StringToJString(env, urlEvent->url());
         }
         return env->NewStringUTF("");
     }
@@ -162,7 +162,7 @@ extern "C"
                                                         jlong ref)
     {
         auto* event = reinterpret_cast<rive::Event*>(ref);
-        return env->NewStringUTF(event->name().c_str());
+        return StringToJString(env, event->name());
     }
 
     JNIEXPORT jshort JNICALL
@@ -209,12 +209,12 @@ extern "C"
             eventObject,
             putMethod,
             env->NewStringUTF("name"),
-            env->NewStringUTF(event->name().c_str()));
+            StringToJString(env, event->name()));
 
         if (event->is<rive::OpenUrlEvent>())
         {
             auto urlEvent = event->as<rive::OpenUrlEvent>();
-            auto url = urlEvent->url().c_str();
+            const std::string& url = urlEvent->url();
             jobject type = env->NewObject(GetShortClass(),
                                           GetShortConstructor(),
                                           event->coreType());
@@ -227,7 +227,7 @@ extern "C"
                                                   eventObject,
                                                   putMethod,
                                                   env->NewStringUTF("url"),
-                                                  env->NewStringUTF(url));
+                                                  StringToJString(env, url));
             const char* target = GetTargetValue(urlEvent);
             JNIExceptionHandler::CallObjectMethod(env,
                                                   eventObject,
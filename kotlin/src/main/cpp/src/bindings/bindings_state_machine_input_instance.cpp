@@ -18,7 +18,7 @@ extern "C"
     {
 
         auto* input = reinterpret_cast<rive::SMIInput*>(ref);
-        return env->NewStringUTF(input->name().c_str());
+        return StringToJString(env, input->name());
     }
 
     JNIEXPORT jboolean JNICALL
@@ -106,8 +106,8 @@ extern "C"
     {
         auto stateMachineInstance =
             reinterpret_cast<rive::StateMachineInstance*>(ref);
-        return env->NewStringUTF(
-            stateMachineInstance->stateMachine()->name().c_str());
+        return StringToJString(env,
+                               stateMachineInstance->stateMachine()->name());
     }
 
     JNIEXPORT jint JNICALL
@@ -16,7 +16,7 @@ extern "C"
                                                                jlong ref)
     {
         auto* run = reinterpret_cast<rive::TextValueRun*>(ref);
-        return env->NewStringUTF(run->text().c_str());
+        return StringToJString(env, run->text());
     }
 
     JNIEXPORT void JNICALL
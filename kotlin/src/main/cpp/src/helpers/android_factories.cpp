@@ -7,8 +7,10 @@
 #include "helpers/worker_ref.hpp"
 #include "helpers/general.hpp"
 #include "helpers/image_decode.hpp"
+#include "helpers/image_memory.hpp"
 #include "helpers/jni_exception_handler.hpp"
 #include "helpers/jni_resource.hpp"
+#include "helpers/shaping_cache.hpp"
 #include "helpers/thread_state_pls.hpp"
 
 #include "rive/math/math_types.hpp"
@@ -163,32 +165,81 @@ rcp<RenderBuffer> AndroidRiveRenderFactory::makeRenderBuffer(
 
 AndroidImage::AndroidImage(int width,
                            int height,
-                           std::unique_ptr<const uint8_t[]> imageDataRGBAPtr) :
-    RiveRenderImage(width, height), m_glWorker(RefWorker::RiveWorker())
+                           std::unique_ptr<const uint8_t[]> imageDataRGBAPtr,
+                           ImageSource source) :
+    RiveRenderImage(width, height),
+    m_glWorker(RefWorker::RiveWorker()),
+    m_source(std::move(source))
 {
+    const auto pixelBytes = static_cast<int64_t>(width) * height * 4;
+    ImageMemory::imageCreated(pixelBytes,
+                              static_cast<int64_t>(m_source.encoded.size()));
+
     // Create the texture on the worker thread where the GL context is
-    // current.
+    // current. The pixels are freed right after the upload: the texture is
+    // the only copy from then on.
     const auto* imageDataRGBA = imageDataRGBAPtr.release();
     m_textureCreationWorkID = m_glWorker->run(
-        [this, imageDataRGBA](DrawableThreadState* threadState) {
+        [this, imageDataRGBA, pixelBytes](DrawableThreadState* threadState) {
             auto plsState = reinterpret_cast<PLSThreadState*>(threadState);
             auto mipLevelCount = math::msb(m_Height | m_Width);
             auto* renderContextImpl =
                 plsState->renderContext()
                     ->static_impl_cast<RenderContextGLImpl>();
-            resetTexture(renderContextImpl->makeImageTexture(m_Width,
-                                                             m_Height,
-                                                             mipLevelCount,
-                                                             imageDataRGBA));
+            auto texture = renderContextImpl->makeImageTexture(m_Width,
+                                                               m_Height,
+                                                               mipLevelCount,
+                                                               imageDataRGBA);
             delete[] imageDataRGBA;
+
+            if (texture != nullptr)
+            {
+                m_textureBytes = ImageMemory::textureBytes(m_Width, m_Height);
+            }
+            resetTexture(std::move(texture));
+            ImageMemory::imageUploaded(pixelBytes, m_textureBytes);
         });
 }
 
+std::unique_ptr<uint8_t[]> AndroidImage::decodePixels() const
+{
+    if (m_source.encoded.empty())
+    {
+        return nullptr;
+    }
+    uint32_t width = 0;
+    uint32_t height = 0;
+    auto pixels = decodeToRGBAPremul(
+        Span<const uint8_t>(m_source.encoded.data(), m_source.encoded.size()),
+        m_source.isPremultiplied,
+        &width,
+        &height);
+    if (pixels == nullptr)
+    {
+        return nullptr;
+    }
+    // Callers size buffers and textures from m_Width/m_Height.
+    if (width != static_cast<uint32_t>(m_Width) ||
+        height != static_cast<uint32_t>(m_Height))
+    {
+        LOGE("AndroidImage::decodePixels() - decoded %ux%u, expected %dx%d",
+             width,
+             height,
+             m_Width,
+             m_Height);
+        return nullptr;
+    }
+    ImageMemory::imageRedecoded();
+    return pixels;
+}
+
 AndroidImage::~AndroidImage()
 {
     // Ensure we are done initializing the texture before we turn around and
     // delete it.
     m_glWorker->waitUntilComplete(m_textureCreationWorkID);
+    ImageMemory::imageDestroyed(m_textureBytes,
+                                static_cast<int64_t>(m_source.encoded.size()));
     // Since this is the destructor, we know nobody else is using this
     // object anymore and there is not a race condition from accessing the
     // texture from any thread.
@@ -207,6 +258,11 @@ rcp<RenderImage> AndroidRiveRenderFactory::decodeImage(
     return renderImageFromAndroidDecode(encodedBytes, false);
 }
 
+rcp<Font> AndroidRiveRenderFactory::decodeFont(Span<const uint8_t> data)
+{
+    return ShapingCache::DecodeFont(data);
+}
+
 /** AndroidCanvasFactory */
 rive::rcp<rive::RenderBuffer> AndroidCanvasFactory::makeRenderBuffer(
     rive::RenderBufferType type,
@@ -222,6 +278,12 @@ rive::rcp<rive::RenderImage> AndroidCanvasFactory::decodeImage(
     return make_rcp<CanvasRenderImage>(encodedBytes);
 }
 
+rive::rcp<rive::Font> AndroidCanvasFactory::decodeFont(
+    rive::Span<const uint8_t> encodedBytes)
+{
+    return ShapingCache::DecodeFont(encodedBytes);
+}
+
 rive::rcp<rive::RenderShader> AndroidCanvasFactory::makeLinearGradient(
     float sx,
     float sy,
@@ -4,6 +4,7 @@
 #include "helpers/android_factories.hpp"
 #include "helpers/jni_exception_handler.hpp"
 #include "helpers/rive_log.hpp"
+#include "helpers/utf16_transcode.hpp"
 #include "helpers/worker_ref.hpp"
 #include "rive/file.hpp"
 
@@ -11,6 +12,7 @@
 #include <cerrno>
 #include <cstdio>
 #include <unistd.h>
+#include <vector>
 #include <EGL/egl.h>
 #endif
 
@@ -249,18 +251,65 @@ jlong Import(uint8_t* bytes,
     }
 }
 
+// Strings up to this many UTF-16 units are marshalled through the stack.
+constexpr jsize STACK_STRING_UNITS = 256;
+
 std::string JStringToString(JNIEnv* env, jstring jStr)
 {
     if (jStr == nullptr)
     {
         return {};
     }
-    auto* cStr = env->GetStringUTFChars(jStr, nullptr);
-    auto str = std::string(cStr);
-    env->ReleaseStringUTFChars(jStr, cStr);
+    const jsize length = env->GetStringLength(jStr);
+    if (length == 0)
+    {
+        return {};
+    }
+    std::string str(Utf8CapacityForUtf16(length), '\0');
+    size_t written;
+    if (length <= STACK_STRING_UNITS)
+    {
+        // Names and paths are short: copy them out without pinning.
+        jchar units[STACK_STRING_UNITS];
+        env->GetStringRegion(jStr, 0, length, units);
+        written = Utf16ToUtf8(reinterpret_cast<const uint16_t*>(units),
+                              length,
+                              &str[0]);
+    }
+    else
+    {
+        // No JNI calls until the critical section is released.
+        auto* units = env->GetStringCritical(jStr, nullptr);
+        if (units == nullptr)
+        {
+            return {};
+        }
+        written = Utf16ToUtf8(reinterpret_cast<const uint16_t*>(units),
+                              length,
+                              &str[0]);
+        env->ReleaseStringCritical(jStr, units);
+    }
+    str.resize(written);
     return str;
 }
 
+jstring StringToJString(JNIEnv* env, const std::string& str)
+{
+    if (str.size() <= STACK_STRING_UNITS)
+    {
+        jchar units[STACK_STRING_UNITS];
+        auto length = Utf8ToUtf16(str.data(),
+                                  str.size(),
+                                  reinterpret_cast<uint16_t*>(units));
+        return env->NewString(units, static_cast<jsize>(length));
+    }
+    std::vector<jchar> units(Utf16CapacityForUtf8(str.size()));
+    auto length = Utf8ToUtf16(str.data(),
+                              str.size(),
+                              reinterpret_cast<uint16_t*>(units.data()));
+    return env->NewString(units.data(), static_cast<jsize>(length));
+}
+
 int SizeTTOInt(size_t sizeT)
 {
     return sizeT > INT_MAX ? INT_MAX : static_cast<int>(sizeT);
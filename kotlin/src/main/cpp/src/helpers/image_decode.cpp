@@ -3,6 +3,7 @@
 #include "helpers/android_factories.hpp"
 #include "helpers/canvas_render_objects.hpp"
 #include "helpers/general.hpp"
+#include "helpers/image_memory.hpp"
 #include "helpers/jni_exception_handler.hpp"
 #include "helpers/jni_resource.hpp"
 #include "jni_refs.hpp"
@@ -13,10 +14,10 @@ namespace rive_android
 {
 const uint32_t LSB_MASK = 0xFFu;
 
-rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
-    Span<const uint8_t> encodedBytes,
-    bool isPremultiplied,
-    RenderContext* renderContext)
+std::unique_ptr<uint8_t[]> decodeToRGBAPremul(Span<const uint8_t> encodedBytes,
+                                              bool isPremultiplied,
+                                              uint32_t* width,
+                                              uint32_t* height)
 {
     auto env = GetJNIEnv();
 
@@ -53,7 +54,7 @@ rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     }
 
     // At this point, we have the decoded results. Now convert into premul RGBA
-    // bytes and wrap in an AndroidImage.
+    // bytes.
 
     jsize arrayCount = env->GetArrayLength(jPixels);
     if (arrayCount < 2)
@@ -107,14 +108,41 @@ rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     env->ReleaseIntArrayElements(jPixels, rawPixels, JNI_ABORT);
     env->DeleteLocalRef(jPixels);
 
+    *width = rawWidth;
+    *height = rawHeight;
+    return out;
+}
+
+rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
+    Span<const uint8_t> encodedBytes,
+    bool isPremultiplied,
+    RenderContext* renderContext)
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    auto pixels =
+        decodeToRGBAPremul(encodedBytes, isPremultiplied, &width, &height);
+    if (pixels == nullptr)
+    {
+        return nullptr;
+    }
+
     if (renderContext != nullptr)
     {
-        return renderContext->makeImage(rawWidth, rawHeight, std::move(out));
+        return renderContext->makeImage(width, height, std::move(pixels));
     }
 
-    return make_rcp<AndroidImage>(static_cast<int>(rawWidth),
-                                  static_cast<int>(rawHeight),
-                                  std::move(out));
+    // Only decoded images have encoded bytes to fall back on.
+    ImageSource source;
+    if (ImageMemory::retention() == ImageRetention::KeepEncoded)
+    {
+        source.encoded.assign(encodedBytes.begin(), encodedBytes.end());
+        source.isPremultiplied = isPremultiplied;
+    }
+    return make_rcp<AndroidImage>(static_cast<int>(width),
+                                  static_cast<int>(height),
+                                  std::move(pixels),
+                                  std::move(source));
 }
 
 rive::rcp<rive::RenderImage> renderImageFromRGBABytesRive(
@@ -129,32 +157,40 @@ rive::rcp<rive::RenderImage> renderImageFromRGBABytesRive(
         return nullptr;
     }
 
+    const auto byteCount = static_cast<size_t>(width) * height * 4;
+    std::unique_ptr<uint8_t[]> out(new uint8_t[byteCount]);
+    memcpy(out.get(), pixelBytes, byteCount);
+    return renderImageFromRGBAPixelsRive(width,
+                                         height,
+                                         std::move(out),
+                                         isPremultiplied);
+}
+
+rive::rcp<rive::RenderImage> renderImageFromRGBAPixelsRive(
+    uint32_t width,
+    uint32_t height,
+    std::unique_ptr<uint8_t[]> pixels,
+    bool isPremultiplied)
+{
     const auto pixelCount = static_cast<size_t>(width) * height;
-    std::unique_ptr<uint8_t[]> out(new uint8_t[pixelCount * 4]);
-    const auto* src = pixelBytes;
-    auto* dst = out.get();
-    for (auto i = 0; i < pixelCount; ++i)
+    if (!isPremultiplied)
     {
-        uint32_t r = src[0];
-        uint32_t g = src[1];
-        uint32_t b = src[2];
-        uint32_t a = src[3];
-        if (!isPremultiplied)
+        // Premultiply in place: the buffer is ours, no second copy needed.
+        auto* px = pixels.get();
+        for (size_t i = 0; i < pixelCount; ++i)
         {
-            r = premultiply(r, a);
-            g = premultiply(g, a);
-            b = premultiply(b, a);
+            uint32_t a = px[3];
+            px[0] = static_cast<uint8_t>(premultiply(px[0], a));
+            px[1] = static_cast<uint8_t>(premultiply(px[1], a));
+            px[2] = static_cast<uint8_t>(premultiply(px[2], a));
+            px += 4;
         }
-        dst[0] = static_cast<uint8_t>(r);
-        dst[1] = static_cast<uint8_t>(g);
-        dst[2] = static_cast<uint8_t>(b);
-        dst[3] = static_cast<uint8_t>(a);
-        src += 4;
-        dst += 4;
     }
+
+    // No encoded form to re-decode from.
     return make_rcp<AndroidImage>(static_cast<int>(width),
                                   static_cast<int>(height),
-                                  std::move(out));
+                                  std::move(pixels));
 }
 
 rive::rcp<rive::RenderImage> renderImageFromRGBABytesCanvas(
@@ -391,12 +427,12 @@ rive::rcp<rive::RenderImage> renderImageFromBitmapRive(jobject jBitmap,
     // Always unlock srcPixels
     AndroidBitmap_unlockPixels(env, jBitmap);
 
-    // The packed buffer is RGBA. Route through the RGBA path that handles
-    // isPremultiplied/straight alpha
-    return renderImageFromRGBABytesRive(width,
-                                        height,
-                                        dstBytes.get(),
-                                        isPremultiplied);
+    // The packed buffer is RGBA. Hand it to the RGBA path that handles
+    // isPremultiplied/straight alpha; it is premultiplied in place.
+    return renderImageFromRGBAPixelsRive(width,
+                                         height,
+                                         std::move(dstBytes),
+                                         isPremultiplied);
 }
 
 rive::rcp<rive::RenderImage> renderImageFromBitmapCanvas(jobject jBitmap)
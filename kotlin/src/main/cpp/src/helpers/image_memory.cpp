@@ -0,0 +1,49 @@
+#include "helpers/image_memory.hpp"
+
+namespace rive_android
+{
+std::atomic<int> ImageMemory::s_retention{
+    static_cast<int>(ImageRetention::DropAll)};
+std::atomic<int64_t> ImageMemory::s_liveImages{0};
+std::atomic<int64_t> ImageMemory::s_pendingPixelBytes{0};
+std::atomic<int64_t> ImageMemory::s_textureBytes{0};
+std::atomic<int64_t> ImageMemory::s_retainedEncodedBytes{0};
+std::atomic<int64_t> ImageMemory::s_releasedPixelBytes{0};
+std::atomic<int64_t> ImageMemory::s_redecodeCount{0};
+
+ImageMemoryReport ImageMemory::report()
+{
+    ImageMemoryReport report;
+    report.liveImages = s_liveImages.load(std::memory_order_relaxed);
+    report.pendingPixelBytes =
+        s_pendingPixelBytes.load(std::memory_order_relaxed);
+    report.textureBytes = s_textureBytes.load(std::memory_order_relaxed);
+    report.retainedEncodedBytes =
+        s_retainedEncodedBytes.load(std::memory_order_relaxed);
+    report.releasedPixelBytes =
+        s_releasedPixelBytes.load(std::memory_order_relaxed);
+    report.redecodeCount = s_redecodeCount.load(std::memory_order_relaxed);
+    return report;
+}
+
+void ImageMemory::imageCreated(int64_t pixelBytes, int64_t encodedBytes)
+{
+    s_liveImages.fetch_add(1, std::memory_order_relaxed);
+    s_pendingPixelBytes.fetch_add(pixelBytes, std::memory_order_relaxed);
+    s_retainedEncodedBytes.fetch_add(encodedBytes, std::memory_order_relaxed);
+}
+
+void ImageMemory::imageUploaded(int64_t pixelBytes, int64_t textureBytes)
+{
+    s_pendingPixelBytes.fetch_sub(pixelBytes, std::memory_order_relaxed);
+    s_releasedPixelBytes.fetch_add(pixelBytes, std::memory_order_relaxed);
+    s_textureBytes.fetch_add(textureBytes, std::memory_order_relaxed);
+}
+
+void ImageMemory::imageDestroyed(int64_t textureBytes, int64_t encodedBytes)
+{
+    s_liveImages.fetch_sub(1, std::memory_order_relaxed);
+    s_textureBytes.fetch_sub(textureBytes, std::memory_order_relaxed);
+    s_retainedEncodedBytes.fetch_sub(encodedBytes, std::memory_order_relaxed);
+}
+} // namespace rive_android
@@ -194,12 +194,12 @@ JniResource<jobject> MakeObject(JNIEnv* env,
 
 JniResource<jstring> MakeJString(JNIEnv* env, const char* str)
 {
-    return MakeJniResource(env->NewStringUTF(str), env);
+    return MakeJString(env, std::string(str));
 }
 
 JniResource<jstring> MakeJString(JNIEnv* env, const std::string& str)
 {
-    return MakeJString(env, str.c_str());
+    return MakeJniResource(StringToJString(env, str), env);
 }
 
 std::vector<uint8_t> ByteArrayToUint8Vec(JNIEnv* env, jbyteArray byteArray)
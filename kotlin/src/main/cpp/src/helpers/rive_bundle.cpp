@@ -0,0 +1,194 @@
+#include "helpers/rive_bundle.hpp"
+#include "helpers/general.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rive_android
+{
+namespace
+{
+constexpr char kMagic[4] = {'R', 'V', 'B', 'N'};
+constexpr uint32_t kFileVersion = 1;
+
+struct BundleHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t alignment;
+    uint64_t indexSize;
+    uint64_t reserved;
+};
+static_assert(sizeof(BundleHeader) == 32, "Bundle header is 32 bytes on disk");
+
+struct IndexRecord
+{
+    uint32_t kind;
+    uint32_t nameLength;
+    uint64_t offset;
+    uint64_t size;
+};
+static_assert(sizeof(IndexRecord) == 24, "Index record is 24 bytes on disk");
+} // namespace
+
+rive::rcp<RiveBundle> RiveBundle::Open(int fd, int64_t offset, int64_t length)
+{
+    if (fd < 0 || offset < 0 || length < static_cast<int64_t>(sizeof(BundleHeader)))
+    {
+        LOGE("RiveBundle: invalid range (offset %lld, length %lld)",
+             static_cast<long long>(offset),
+             static_cast<long long>(length));
+        return nullptr;
+    }
+
+    // mmap offsets must be page aligned; resources rarely start on a page.
+    const int64_t pageSize = sysconf(_SC_PAGESIZE);
+    const int64_t mapOffset = offset - offset % pageSize;
+    const size_t lead = static_cast<size_t>(offset - mapOffset);
+    const size_t mapLength = lead + static_cast<size_t>(length);
+    void* base = mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fd, mapOffset);
+    if (base == MAP_FAILED)
+    {
+        LOGE("RiveBundle: mmap failed (%s)", strerror(errno));
+        return nullptr;
+    }
+
+    rive::rcp<RiveBundle> bundle(new RiveBundle(base,
+                                                mapLength,
+                                                static_cast<const uint8_t*>(base) + lead,
+                                                static_cast<size_t>(length)));
+    if (!bundle->parseIndex())
+    {
+        return nullptr;
+    }
+    LOGD("RiveBundle: mapped %zu files and %zu assets (%lld bytes)",
+         bundle->m_files.size(),
+         bundle->m_assets.size(),
+         static_cast<long long>(length));
+    return bundle;
+}
+
+rive::rcp<RiveBundle> RiveBundle::OpenPath(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        LOGE("RiveBundle: cannot open %s (%s)", path.c_str(), strerror(errno));
+        return nullptr;
+    }
+    struct stat info = {};
+    rive::rcp<RiveBundle> bundle;
+    if (fstat(fd, &info) == 0)
+    {
+        bundle = Open(fd, 0, static_cast<int64_t>(info.st_size));
+    }
+    // The mapping keeps the file alive.
+    close(fd);
+    return bundle;
+}
+
+RiveBundle::RiveBundle(void* mapBase,
+                       size_t mapLength,
+                       const uint8_t* data,
+                       size_t size) :
+    m_mapBase(mapBase), m_mapLength(mapLength), m_data(data), m_size(size)
+{}
+
+RiveBundle::~RiveBundle() { munmap(m_mapBase, m_mapLength); }
+
+bool RiveBundle::parseIndex()
+{
+    BundleHeader header;
+    memcpy(&header, m_data, sizeof(header));
+    if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kFileVersion ||
+        header.indexSize > m_size - sizeof(BundleHeader))
+    {
+        LOGE("RiveBundle: not a version %u bundle", kFileVersion);
+        return false;
+    }
+
+    const uint8_t* cursor = m_data + sizeof(BundleHeader);
+    const uint8_t* indexEnd = cursor + header.indexSize;
+    for (uint32_t i = 0; i < header.entryCount; ++i)
+    {
+        IndexRecord record;
+        if (static_cast<size_t>(indexEnd - cursor) < sizeof(record))
+        {
+            LOGE("RiveBundle: truncated index");
+            return false;
+        }
+        memcpy(&record, cursor, sizeof(record));
+        cursor += sizeof(record);
+
+        // Every range is checked once here so lookups can trust the index.
+        if (record.nameLength > static_cast<size_t>(indexEnd - cursor) ||
+            record.offset > m_size || record.size > m_size - record.offset ||
+            record.kind > static_cast<uint32_t>(EntryKind::Asset))
+        {
+            LOGE("RiveBundle: invalid index record %u", i);
+            return false;
+        }
+        std::string name(reinterpret_cast<const char*>(cursor), record.nameLength);
+        cursor += record.nameLength;
+
+        auto& entries = record.kind == static_cast<uint32_t>(EntryKind::File)
+                            ? m_files
+                            : m_assets;
+        entries[std::move(name)] = {record.offset, record.size};
+    }
+    return true;
+}
+
+rive::Span<const uint8_t> RiveBundle::find(EntryKind kind, const std::string& name) const
+{
+    const auto& entries = kind == EntryKind::File ? m_files : m_assets;
+    auto it = entries.find(name);
+    if (it == entries.end())
+    {
+        return {};
+    }
+    return {m_data + it->second.offset, static_cast<size_t>(it->second.size)};
+}
+
+rive::Span<const uint8_t> RiveBundle::file(const std::string& name) const
+{
+    return find(EntryKind::File, name);
+}
+
+rive::Span<const uint8_t> RiveBundle::asset(const std::string& name) const
+{
+    return find(EntryKind::Asset, name);
+}
+
+rive::Span<const uint8_t> RiveBundle::assetFor(const rive::FileAsset& fileAsset) const
+{
+    auto bytes = asset(fileAsset.uniqueFilename());
+    if (bytes.empty())
+    {
+        bytes = asset(fileAsset.name() + "." + fileAsset.fileExtension());
+    }
+    if (bytes.empty())
+    {
+        bytes = asset(fileAsset.name());
+    }
+    return bytes;
+}
+
+std::vector<std::string> RiveBundle::names(EntryKind kind) const
+{
+    const auto& entries = kind == EntryKind::File ? m_files : m_assets;
+    std::vector<std::string> result;
+    result.reserve(entries.size());
+    for (const auto& entry : entries)
+    {
+        result.push_back(entry.first);
+    }
+    return result;
+}
+} // namespace rive_android
@@ -0,0 +1,334 @@
+#include "helpers/shaping_cache.hpp"
+
+#include "rive/text/font_hb.hpp"
+
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace rive_android
+{
+namespace
+{
+struct RunKey
+{
+    rive::rcp<rive::Font> font;
+    float size;
+    float lineHeight;
+    float letterSpacing;
+    uint32_t unicharCount;
+    uint32_t script;
+    uint16_t styleId;
+    uint8_t level;
+
+    bool operator==(const RunKey& other) const
+    {
+        return font == other.font && size == other.size &&
+               lineHeight == other.lineHeight &&
+               letterSpacing == other.letterSpacing &&
+               unicharCount == other.unicharCount && script == other.script &&
+               styleId == other.styleId && level == other.level;
+    }
+};
+
+struct ShapeKey
+{
+    std::vector<rive::Unichar> text;
+    std::vector<RunKey> runs;
+    int direction = 0;
+    size_t hash = 0;
+
+    bool operator==(const ShapeKey& other) const
+    {
+        return hash == other.hash && direction == other.direction &&
+               text == other.text && runs == other.runs;
+    }
+};
+
+// FNV-1a over the fields that make up a key; floats are hashed by their bits.
+class KeyHasher
+{
+public:
+    template <typename T> void add(const T& value)
+    {
+        auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        for (size_t i = 0; i < sizeof(T); ++i)
+        {
+            m_hash = (m_hash ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+
+    size_t hash() const { return static_cast<size_t>(m_hash); }
+
+private:
+    uint64_t m_hash = 14695981039346656037ull;
+};
+
+ShapeKey MakeKey(rive::Span<const rive::Unichar> text,
+                 rive::Span<const rive::TextRun> runs,
+                 int direction)
+{
+    ShapeKey key;
+    KeyHasher hasher;
+    key.text.assign(text.begin(), text.end());
+    for (rive::Unichar unichar : text)
+    {
+        hasher.add(unichar);
+    }
+    key.runs.reserve(runs.size());
+    for (const rive::TextRun& run : runs)
+    {
+        key.runs.push_back({run.font,
+                            run.size,
+                            run.lineHeight,
+                            run.letterSpacing,
+                            run.unicharCount,
+                            run.script,
+                            run.styleId,
+                            run.level});
+        hasher.add(run.font.get());
+        hasher.add(run.size);
+        hasher.add(run.lineHeight);
+        hasher.add(run.letterSpacing);
+        hasher.add(run.unicharCount);
+        hasher.add(run.script);
+        hasher.add(run.styleId);
+        hasher.add(run.level);
+    }
+    key.direction = direction;
+    hasher.add(direction);
+    key.hash = hasher.hash();
+    return key;
+}
+
+struct Entry
+{
+    ShapeKey key;
+    rive::SimpleArray<rive::Paragraph> paragraphs;
+};
+
+class Cache
+{
+public:
+    // Returns true and fills |out| on a hit.
+    bool find(const ShapeKey& key, rive::SimpleArray<rive::Paragraph>* out)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto range = m_index.equal_range(key.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second->key == key)
+            {
+                // Most recently used entries live at the front.
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                *out = rive::SimpleArray<rive::Paragraph>(
+                    it->second->paragraphs);
+                ++m_stats.hits;
+                return true;
+            }
+        }
+        ++m_stats.misses;
+        return false;
+    }
+
+    void insert(ShapeKey key, const rive::SimpleArray<rive::Paragraph>& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_capacity == 0)
+        {
+            return;
+        }
+        // Another thread may have shaped the same text meanwhile.
+        auto range = m_index.equal_range(key.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second->key == key)
+            {
+                return;
+            }
+        }
+        size_t hash = key.hash;
+        m_entries.push_front(
+            {std::move(key), rive::SimpleArray<rive::Paragraph>(value)});
+        m_index.emplace(hash, m_entries.begin());
+        trim();
+    }
+
+    bool enabled()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_capacity != 0;
+    }
+
+    void setCapacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capacity = capacity;
+        trim();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_index.clear();
+        m_entries.clear();
+    }
+
+    void evictFonts(const std::unordered_set<const rive::Font*>& fonts)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto entry = m_entries.begin(); entry != m_entries.end();)
+        {
+            bool usesFont = false;
+            for (const RunKey& run : entry->key.runs)
+            {
+                if (fonts.count(run.font.get()) != 0)
+                {
+                    usesFont = true;
+                    break;
+                }
+            }
+            if (!usesFont)
+            {
+                ++entry;
+                continue;
+            }
+            eraseIndex(entry);
+            entry = m_entries.erase(entry);
+        }
+    }
+
+    ShapingCacheStats stats()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ShapingCacheStats stats = m_stats;
+        stats.entries = static_cast<int64_t>(m_entries.size());
+        stats.capacity = static_cast<int64_t>(m_capacity);
+        return stats;
+    }
+
+private:
+    void trim()
+    {
+        while (m_entries.size() > m_capacity)
+        {
+            eraseIndex(std::prev(m_entries.end()));
+            m_entries.pop_back();
+            ++m_stats.evictions;
+        }
+    }
+
+    void eraseIndex(std::list<Entry>::iterator entry)
+    {
+        auto range = m_index.equal_range(entry->key.hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == entry)
+            {
+                m_index.erase(it);
+                break;
+            }
+        }
+    }
+
+    std::mutex m_mutex;
+    std::list<Entry> m_entries;
+    std::unordered_multimap<size_t, std::list<Entry>::iterator> m_index;
+    size_t m_capacity = ShapingCache::kDefaultCapacity;
+    ShapingCacheStats m_stats;
+};
+
+Cache& SharedCache()
+{
+    static Cache cache;
+    return cache;
+}
+
+// An HBFont that looks its shapes up in the shared cache. Text shapes through
+// the font of its first run, so texts whose first run uses a font decoded by
+// DecodeFont are cached; variations made with withOptions() are plain
+// HBFonts and shape directly.
+class CachingHBFont : public HBFont
+{
+public:
+    explicit CachingHBFont(hb_font_t* font) : HBFont(font) {}
+
+    rive::SimpleArray<rive::Paragraph> onShapeText(
+        rive::Span<const rive::Unichar> text,
+        rive::Span<const rive::TextRun> runs,
+        int textDirectionFlag) const override
+    {
+        Cache& cache = SharedCache();
+        if (text.size() > ShapingCache::kMaxCachedUnichars ||
+            !cache.enabled())
+        {
+            return HBFont::onShapeText(text, runs, textDirectionFlag);
+        }
+        ShapeKey key = MakeKey(text, runs, textDirectionFlag);
+        rive::SimpleArray<rive::Paragraph> paragraphs;
+        if (cache.find(key, &paragraphs))
+        {
+            return paragraphs;
+        }
+        paragraphs = HBFont::onShapeText(text, runs, textDirectionFlag);
+        cache.insert(std::move(key), paragraphs);
+        return paragraphs;
+    }
+};
+} // namespace
+
+/* static */ rive::rcp<rive::Font> ShapingCache::DecodeFont(
+    rive::Span<const uint8_t> data)
+{
+    // Same as HBFont::Decode, but instantiating the caching subclass.
+    hb_blob_t* blob =
+        hb_blob_create_or_fail(reinterpret_cast<const char*>(data.data()),
+                               static_cast<unsigned>(data.size()),
+                               HB_MEMORY_MODE_DUPLICATE,
+                               nullptr,
+                               nullptr);
+    if (blob == nullptr)
+    {
+        return nullptr;
+    }
+    hb_face_t* face = hb_face_create(blob, 0);
+    hb_blob_destroy(blob);
+    if (face == nullptr)
+    {
+        return nullptr;
+    }
+    hb_font_t* font = hb_font_create(face);
+    hb_face_destroy(face);
+    if (font == nullptr)
+    {
+        return nullptr;
+    }
+    return rive::rcp<rive::Font>(new CachingHBFont(font));
+}
+
+/* static */ void ShapingCache::SetCapacity(size_t capacity)
+{
+    SharedCache().setCapacity(capacity);
+}
+
+/* static */ void ShapingCache::Clear() { SharedCache().clear(); }
+
+/* static */ void ShapingCache::EvictFonts(
+    const std::vector<const rive::Font*>& fonts)
+{
+    if (fonts.empty())
+    {
+        return;
+    }
+    SharedCache().evictFonts(
+        std::unordered_set<const rive::Font*>(fonts.begin(), fonts.end()));
+}
+
+/* static */ ShapingCacheStats ShapingCache::Stats()
+{
+    return SharedCache().stats();
+}
+} // namespace rive_android
@@ -3,6 +3,10 @@
 //
 #include "helpers/thread_state_pls.hpp"
 
+#include "rive/math/raw_path.hpp"
+#include "rive/renderer/gl/render_target_gl.hpp"
+#include "rive/renderer/rive_renderer.hpp"
+
 namespace rive_android
 {
 PLSThreadState::PLSThreadState()
@@ -77,4 +81,70 @@ void PLSThreadState::makeCurrent(EGLSurface eglSurface)
     m_currentSurface = eglSurface;
     EGL_ERR_CHECK();
 }
+
+void PLSThreadState::prewarm()
+{
+    if (m_renderContext == nullptr)
+    {
+        return;
+    }
+    makeCurrent(m_backgroundSurface);
+
+    // Curves, a self-intersecting contour for even-odd, and a clip.
+    rive::RawPath shape;
+    shape.moveTo(0, 0);
+    shape.cubicTo(1, 0, 1, 1, 0, 1);
+    shape.lineTo(1, 0);
+    shape.close();
+    auto nonZero = m_renderContext->makeRenderPath(shape, rive::FillRule::nonZero);
+    auto evenOdd = m_renderContext->makeRenderPath(shape, rive::FillRule::evenOdd);
+
+    const rive::ColorInt colors[] = {0xff000000, 0xffffffff};
+    const float stops[] = {0, 1};
+    auto linear = m_renderContext->makeLinearGradient(0, 0, 1, 1, colors, stops, 2);
+    auto radial = m_renderContext->makeRadialGradient(0.5f, 0.5f, 0.5f, colors, stops, 2);
+
+    auto fill = m_renderContext->makeRenderPaint();
+    fill->style(rive::RenderPaintStyle::fill);
+    fill->color(0xff808080);
+    auto stroke = m_renderContext->makeRenderPaint();
+    stroke->style(rive::RenderPaintStyle::stroke);
+    stroke->thickness(0.25f);
+    stroke->color(0xff808080);
+    auto linearFill = m_renderContext->makeRenderPaint();
+    linearFill->shader(linear);
+    auto radialFill = m_renderContext->makeRenderPaint();
+    radialFill->shader(radial);
+    auto blendFill = m_renderContext->makeRenderPaint();
+    blendFill->color(0x80808080);
+    blendFill->blendMode(rive::BlendMode::multiply);
+
+    GLint sampleCount = 0;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glGetIntegerv(GL_SAMPLES, &sampleCount);
+    auto renderTarget =
+        rive::make_rcp<rive::gpu::FramebufferRenderTargetGL>(1, 1, 0, sampleCount);
+
+    m_renderContext->beginFrame({
+        .renderTargetWidth = 1,
+        .renderTargetHeight = 1,
+        .loadAction = rive::gpu::LoadAction::clear,
+        .clearColor = 0,
+    });
+    {
+        rive::RiveRenderer renderer(m_renderContext.get());
+        renderer.drawPath(nonZero.get(), fill.get());
+        renderer.drawPath(evenOdd.get(), fill.get());
+        renderer.drawPath(nonZero.get(), stroke.get());
+        renderer.drawPath(nonZero.get(), linearFill.get());
+        renderer.drawPath(nonZero.get(), radialFill.get());
+        renderer.save();
+        renderer.clipPath(evenOdd.get());
+        renderer.drawPath(nonZero.get(), blendFill.get());
+        renderer.restore();
+    }
+    m_renderContext->flush({.renderTarget = renderTarget.get()});
+    // Wait for the driver, which links programs at submission.
+    glFinish();
+}
 } // namespace rive_android
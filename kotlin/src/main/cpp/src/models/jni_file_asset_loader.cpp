@@ -1,5 +1,6 @@
 #include "models/jni_file_asset_loader.hpp"
 #include "helpers/jni_exception_handler.hpp"
+#include "rive/simple_array.hpp"
 
 namespace rive_android
 {
@@ -25,8 +26,28 @@ JNIFileAssetLoader::~JNIFileAssetLoader()
 
 bool JNIFileAssetLoader::loadContents(rive::FileAsset& asset,
                                       rive::Span<const uint8_t> inBandBytes,
-                                      rive::Factory* /* unused atm */)
+                                      rive::Factory* factory)
 {
+    // Referenced assets found in the bundle are decoded straight from the
+    // mapping, without a round trip through a Java byte array.
+    if (m_bundle != nullptr && inBandBytes.empty())
+    {
+        auto bundled = m_bundle->assetFor(asset);
+        if (!bundled.empty())
+        {
+            // decode() takes ownership of its bytes (audio keeps them).
+            rive::SimpleArray<uint8_t> bytes(bundled.data(), bundled.size());
+            if (asset.decode(bytes,
+                             factory != nullptr ? factory
+                                                : GetFactory(m_rendererType)))
+            {
+                return true;
+            }
+            LOGW("JNIFileAssetLoader: failed to decode bundled asset %s",
+                 asset.name().c_str());
+        }
+    }
+
     JNIEnv* env = GetJNIEnv();
     // Renderer type must be set.
     // If not set, FileAsset constructor will throw on RendererType::None value
@@ -22,32 +22,29 @@ import java.util.concurrent.locks.ReentrantLock
  *
  * The Rive editor will always export your file in the latest runtime format.
  *
- * ⚠️ Important: If you create a [File] yourself using this constructor, you are responsible for
+ * ⚠️ Important: If you create a [File] yourself using these constructors, you are responsible for
  * calling [release] when you are done with it, otherwise it will leak memory.
- *
- * @param bytes The bytes of the .riv file.
- * @param rendererType The [RendererType] to use when rendering this file. This defaults to
- *    [Rive.defaultRendererType], which is [RendererType.Rive].
- * @param fileAssetLoader An optional [FileAssetLoader] to use when loading external assets (images,
- *    fonts, audio) referenced by this file. If it is not provided you will not be able to load
- *    external assets.
  */
 @OpenForTesting
-class File(
-    bytes: ByteArray,
-    val rendererType: RendererType = Rive.defaultRendererType,
-    fileAssetLoader: FileAssetLoader? = null,
-) : NativeObject(NULL_POINTER) {
-    init {
-        // Set the correct renderer type and make sure we make this a dependency.
-        // In fact, when importing a file, the FileAssetLoader rcp is incremented and Kotlin
-        // should do the same.
-        fileAssetLoader?.let {
-            it.setRendererType(rendererType)
-            it.acquire()
-            dependencies.add(it)
-        }
+class File : NativeObject {
+    /** The [RendererType] used when rendering this file. */
+    val rendererType: RendererType
 
+    /**
+     * @param bytes The bytes of the .riv file.
+     * @param rendererType The [RendererType] to use when rendering this file. This defaults to
+     *    [Rive.defaultRendererType], which is [RendererType.Rive].
+     * @param fileAssetLoader An optional [FileAssetLoader] to use when loading external assets
+     *    (images, fonts, audio) referenced by this file. If it is not provided you will not be able
+     *    to load external assets.
+     */
+    constructor(
+        bytes: ByteArray,
+        rendererType: RendererType = Rive.defaultRendererType,
+        fileAssetLoader: FileAssetLoader? = null,
+    ) : super(NULL_POINTER) {
+        this.rendererType = rendererType
+        addAssetLoader(fileAssetLoader)
         cppPointer = import(
             bytes,
             bytes.size,
@@ -57,6 +54,54 @@ class File(
         refs.incrementAndGet()
     }
 
+    /**
+     * Import a file from a [RiveBundle], straight from its memory mapping. Pass a
+     * [BundleAssetLoader] for the same bundle to load the file's referenced assets from it too.
+     *
+     * @param bundle The bundle holding the file. It is kept open while this file is alive.
+     * @param name The name of the file in the bundle, see [RiveBundle.fileNames].
+     * @param rendererType The [RendererType] to use when rendering this file.
+     * @param fileAssetLoader An optional [FileAssetLoader] for referenced assets.
+     * @throws RiveException If the bundle holds no file called [name] or it cannot be imported.
+     */
+    constructor(
+        bundle: RiveBundle,
+        name: String,
+        rendererType: RendererType = Rive.defaultRendererType,
+        fileAssetLoader: FileAssetLoader? = null,
+    ) : super(NULL_POINTER) {
+        this.rendererType = rendererType
+        fileAssetLoader?.setRendererType(rendererType)
+        // Hold the mapping for the import, but only keep the bundle and the loader as
+        // dependencies once it succeeded; a failed constructor is never released.
+        bundle.acquire()
+        cppPointer = try {
+            importFromBundle(
+                bundle.cppPointer,
+                name,
+                rendererType.value,
+                fileAssetLoader?.cppPointer ?: NULL_POINTER
+            )
+        } catch (e: Throwable) {
+            bundle.release()
+            throw e
+        }
+        dependencies.add(bundle)
+        addAssetLoader(fileAssetLoader)
+        refs.incrementAndGet()
+    }
+
+    private fun addAssetLoader(fileAssetLoader: FileAssetLoader?) {
+        // Set the correct renderer type and make sure we make this a dependency.
+        // In fact, when importing a file, the FileAssetLoader rcp is incremented and Kotlin
+        // should do the same.
+        fileAssetLoader?.let {
+            it.setRendererType(rendererType)
+            it.acquire()
+            dependencies.add(it)
+        }
+    }
+
     val lock = ReentrantLock()
 
     private external fun import(
@@ -66,6 +111,13 @@ class File(
         fileAssetLoaderPointer: Long,
     ): Long
 
+    private external fun importFromBundle(
+        bundlePointer: Long,
+        name: String,
+        rendererType: Int,
+        fileAssetLoaderPointer: Long,
+    ): Long
+
     private external fun cppArtboardByName(cppPointer: Long, name: String): Long
 
     @Suppress("ProtectedInFinal")
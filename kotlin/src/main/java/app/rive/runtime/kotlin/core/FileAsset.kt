@@ -7,7 +7,7 @@ import androidx.annotation.VisibleForTesting
 import app.rive.runtime.kotlin.core.RiveRenderImage.Companion.fromARGBInts
 
 sealed class FileAsset(address: Long, rendererTypeIdx: Int) : NativeObject(address) {
-    private val rendererType = RendererType.fromIndex(rendererTypeIdx)
+    protected val rendererType = RendererType.fromIndex(rendererTypeIdx)
     private external fun cppName(cppPointer: Long): String
     private external fun cppUniqueFilename(cppPointer: Long): String
     private external fun cppDecode(cppPointer: Long, bytes: ByteArray, rendererType: Int): Boolean
@@ -39,7 +39,7 @@ class ImageAsset(address: Long, rendererTypeIdx: Int) : FileAsset(address, rende
          * @return A light wrapper around a C++ address.
          */
         @VisibleForTesting
-        get() = RiveRenderImage(cppGetRenderImage(cppPointer))
+        get() = RiveRenderImage(cppGetRenderImage(cppPointer), rendererType)
 
     /** @return The width of the image in pixels. */
     val width: Float
@@ -100,8 +100,25 @@ class AudioAsset(address: Long, rendererTypeIdx: Int) : FileAsset(address, rende
  * Use the companion object methods to create one from encoded bytes, pixel bytes, ARGB integers, or
  * an [Android Bitmap][Bitmap].
  */
-class RiveRenderImage internal constructor(address: Long) : NativeObject(address) {
+class RiveRenderImage internal constructor(
+    address: Long,
+    private val rendererType: RendererType? = null,
+) : NativeObject(address) {
     external override fun cppDelete(pointer: Long)
+    private external fun cppReadPixels(cppPointer: Long): ByteArray?
+
+    /**
+     * Decodes this image's pixels again from its retained encoded bytes and returns them as
+     * premultiplied RGBA8888, row by row. Counts towards [ImageMemoryReport.redecodeCount].
+     *
+     * Only Rive renderer images decoded from a file while [retainEncodedBytes] was on keep their
+     * encoded bytes; the uploaded texture is not read back.
+     *
+     * @return The pixels, or null if the image kept no encoded bytes or was not made for the
+     *    Rive renderer.
+     */
+    fun readPixels(): ByteArray? =
+        if (rendererType == RendererType.Rive) cppReadPixels(cppPointer) else null
 
     companion object {
         private external fun cppFromRGBABytes(
@@ -122,6 +139,37 @@ class RiveRenderImage internal constructor(address: Long) : NativeObject(address
 
         private external fun cppFromBitmapRive(bitmap: Bitmap, premultiplied: Boolean): Long
         private external fun cppFromBitmapCanvas(bitmap: Bitmap): Long
+        private external fun cppGetMemoryReport(): LongArray
+        private external fun cppSetRetainEncodedBytes(retain: Boolean)
+
+        /**
+         * Whether Rive renderer images decoded from a file keep their encoded bytes, so their
+         * pixels can be decoded again later. Decoded pixels are always freed once the texture is
+         * uploaded; with this off (the default) nothing is kept besides the texture.
+         *
+         * Applies to images created after the change.
+         */
+        var retainEncodedBytes: Boolean = false
+            set(value) {
+                cppSetRetainEncodedBytes(value)
+                field = value
+            }
+
+        /**
+         * Reports the memory held by Rive renderer images, including the decoded pixel memory
+         * freed after upload.
+         */
+        fun memoryReport(): ImageMemoryReport {
+            val values = cppGetMemoryReport()
+            return ImageMemoryReport(
+                liveImages = values[0].toInt(),
+                pendingPixelBytes = values[1],
+                textureBytes = values[2],
+                retainedEncodedBytes = values[3],
+                releasedPixelBytes = values[4],
+                redecodeCount = values[5].toInt(),
+            )
+        }
 
         /**
          * Creates a [RiveRenderImage] by decoding the [bytes].
@@ -214,7 +262,7 @@ class RiveRenderImage internal constructor(address: Long) : NativeObject(address
             require(pixelBytes.size == width * height * 4) { "Bytes must have size = width * height * 4" }
             val address =
                 cppFromRGBABytes(pixelBytes, width, height, rendererType.value, premultiplied)
-            return RiveRenderImage(address)
+            return RiveRenderImage(address, rendererType)
         }
 
         /**
@@ -252,11 +300,11 @@ class RiveRenderImage internal constructor(address: Long) : NativeObject(address
                 val bitmap = Bitmap.createBitmap(pixels, width, height, Bitmap.Config.ARGB_8888)
                 bitmap.isPremultiplied = true
                 val address = cppFromBitmapCanvas(bitmap)
-                return RiveRenderImage(address)
+                return RiveRenderImage(address, rendererType)
             }
 
             val address = cppFromARGBInts(pixels, width, height, rendererType.value, premultiplied)
-            return RiveRenderImage(address)
+            return RiveRenderImage(address, rendererType)
         }
 
         /**
@@ -292,15 +340,36 @@ class RiveRenderImage internal constructor(address: Long) : NativeObject(address
 
             return if (rendererType == RendererType.Rive) {
                 val address = cppFromBitmapRive(safeBitmap, safeBitmap.isPremultiplied)
-                RiveRenderImage(address)
+                RiveRenderImage(address, rendererType)
             } else {
                 val address = cppFromBitmapCanvas(safeBitmap)
-                RiveRenderImage(address)
+                RiveRenderImage(address, rendererType)
             }
         }
     }
 }
 
+/**
+ * Memory held by Rive renderer images, from [RiveRenderImage.memoryReport].
+ *
+ * @property liveImages Images currently alive.
+ * @property pendingPixelBytes Decoded pixels still waiting for their texture upload.
+ * @property textureBytes Estimated texture memory, including mip levels.
+ * @property retainedEncodedBytes Encoded bytes kept for re-decoding (see
+ *    [RiveRenderImage.retainEncodedBytes]).
+ * @property releasedPixelBytes Decoded pixel memory freed after upload since startup; what a
+ *    resident CPU copy would have cost.
+ * @property redecodeCount Times pixels were decoded again from retained encoded bytes.
+ */
+data class ImageMemoryReport(
+    val liveImages: Int,
+    val pendingPixelBytes: Long,
+    val textureBytes: Long,
+    val retainedEncodedBytes: Long,
+    val releasedPixelBytes: Long,
+    val redecodeCount: Int,
+)
+
 /**
  * A wrapper around a native C++ object representing a font that can be rendered in Rive.
  *
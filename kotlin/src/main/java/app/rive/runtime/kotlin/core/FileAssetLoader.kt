@@ -48,6 +48,9 @@ abstract class FileAssetLoader : NativeObject(NULL_POINTER) {
 
     private external fun cppSetRendererType(pointer: Long, rendererType: Int)
 
+    /** Serve referenced assets from a bundle natively, before [loadContents] is asked. */
+    protected external fun cppSetBundle(pointer: Long, bundlePointer: Long)
+
     /**
      * Override to customize the asset loading process.
      *
@@ -20,6 +20,10 @@ object Rive {
         scaleFactor: Float
     )
 
+    private external fun cppPrewarmRenderer()
+    private external fun cppSetShapingCacheCapacity(capacity: Int)
+    private external fun cppGetShapingCacheStats(): LongArray
+
     private const val RIVE_ANDROID = "rive-android"
 
     /**
@@ -116,4 +120,51 @@ object Rive {
         FontHelper.getFallbackFontBytes(opts)?.let { bytes ->
             NativeFontHelper.cppRegisterFallbackFont(bytes)
         } == true
+
+    /**
+     * Compile the commonly used GPU programs in the background.
+     *
+     * Starts the Rive renderer if needed and draws an offscreen frame with fills, strokes,
+     * gradients, clips and blending, so the first visible frame does not stall on shader
+     * compilation. Returns immediately. Does nothing when the Canvas fallback is in use.
+     */
+    fun prewarmRenderer() = cppPrewarmRenderer()
+
+    /**
+     * Set how many shaped texts are kept for reuse; 0 disables the cache. Defaults to 256.
+     *
+     * Text runs that are updated often, e.g. counters, timers or scores, cycle through a small set
+     * of strings. Shaping each one is the expensive part of a text update, so shapes are cached
+     * by font, size, font features and string, and shared across all text runs.
+     */
+    fun setShapingCacheCapacity(capacity: Int) = cppSetShapingCacheCapacity(capacity)
+
+    /** Counters for the cache configured with [setShapingCacheCapacity]. */
+    fun shapingCacheStats(): ShapingCacheStats {
+        val values = cppGetShapingCacheStats()
+        return ShapingCacheStats(
+            hits = values[0],
+            misses = values[1],
+            evictions = values[2],
+            entries = values[3],
+            capacity = values[4],
+        )
+    }
 }
+
+/**
+ * Text shaping cache counters since startup.
+ *
+ * @property hits Texts whose shape was reused.
+ * @property misses Texts that had to be shaped.
+ * @property evictions Shapes dropped to stay within [capacity].
+ * @property entries Shapes currently cached.
+ * @property capacity Maximum number of cached shapes; 0 when disabled.
+ */
+data class ShapingCacheStats(
+    val hits: Long,
+    val misses: Long,
+    val evictions: Long,
+    val entries: Long,
+    val capacity: Long,
+)
@@ -0,0 +1,132 @@
+package app.rive.runtime.kotlin.core
+
+import android.content.Context
+import android.content.res.AssetFileDescriptor
+import androidx.annotation.RawRes
+import app.rive.runtime.kotlin.core.errors.RiveException
+
+/**
+ * A memory-mapped bundle of .riv files and the images, fonts and audio they share, built on the
+ * desktop with `dev/pack_rive_bundle.py`.
+ *
+ * Files loaded from a bundle are imported straight from the mapping, and a [BundleAssetLoader]
+ * serves their referenced assets from it too, so nothing is copied through Java byte arrays.
+ * Assets shared by several files are stored once.
+ *
+ * ⚠️ Important: You are responsible for calling [release] when you are done with the bundle.
+ * [File]s and loaders created from it keep the mapping alive until they are released as well.
+ */
+class RiveBundle private constructor(address: Long) : NativeObject(address) {
+    external override fun cppDelete(pointer: Long)
+
+    private external fun cppNames(pointer: Long, kind: Int): Array<String>
+    private external fun cppAssetBytes(pointer: Long, name: String): ByteArray?
+    private external fun cppMappedBytes(pointer: Long): Long
+
+    /** Names of the .riv files in the bundle, for [File]'s bundle constructor. */
+    val fileNames: List<String>
+        get() = cppNames(cppPointer, KIND_FILE).toList()
+
+    /** Names of the assets in the bundle. */
+    val assetNames: List<String>
+        get() = cppNames(cppPointer, KIND_ASSET).toList()
+
+    /** Size of the mapping, in bytes. Only the pages that are read take up memory. */
+    val mappedBytes: Long
+        get() = cppMappedBytes(cppPointer)
+
+    /**
+     * A copy of an asset's bytes, or null if there is none. For decoding from Kotlin, e.g. in a
+     * [FallbackAssetLoader]; files imported with a [BundleAssetLoader] do not need it.
+     */
+    fun assetBytes(name: String): ByteArray? = cppAssetBytes(cppPointer, name)
+
+    companion object {
+        private const val KIND_FILE = 0
+        private const val KIND_ASSET = 1
+
+        private external fun cppOpenFd(fd: Int, offset: Long, length: Long): Long
+        private external fun cppOpenPath(path: String): Long
+
+        /**
+         * Map a bundle file.
+         *
+         * @throws RiveException If the file cannot be mapped or is not a bundle.
+         */
+        @Throws(RiveException::class)
+        fun open(file: java.io.File): RiveBundle {
+            val pointer = cppOpenPath(file.absolutePath)
+            if (pointer == NULL_POINTER) {
+                throw RiveException("Could not open Rive bundle ${file.path}")
+            }
+            return RiveBundle(pointer)
+        }
+
+        /**
+         * Map a bundle shipped as a raw resource.
+         *
+         * The resource must be stored uncompressed to be mapped in place; add its extension to
+         * `androidResources.noCompress` in the app's build file, e.g. `noCompress += "rivb"`.
+         *
+         * @throws RiveException If the resource is compressed or is not a bundle.
+         */
+        @Throws(RiveException::class)
+        fun open(context: Context, @RawRes resId: Int): RiveBundle {
+            val descriptor = try {
+                context.resources.openRawResourceFd(resId)
+            } catch (e: android.content.res.Resources.NotFoundException) {
+                throw RiveException("Rive bundle resource $resId is compressed; add it to noCompress")
+            }
+            return descriptor.use { open(it) }
+        }
+
+        /**
+         * Map a bundle stored in part of a file, e.g. an uncompressed entry of an APK or asset
+         * pack. The offset does not need to be page aligned.
+         *
+         * The descriptor can be closed once this returns; the mapping does not need it.
+         *
+         * @throws RiveException If the range cannot be mapped or is not a bundle.
+         */
+        @Throws(RiveException::class)
+        fun open(descriptor: AssetFileDescriptor): RiveBundle {
+            val pointer = cppOpenFd(
+                descriptor.parcelFileDescriptor.fd,
+                descriptor.startOffset,
+                descriptor.length
+            )
+            if (pointer == NULL_POINTER) {
+                throw RiveException(
+                    "Could not open Rive bundle at offset ${descriptor.startOffset}"
+                )
+            }
+            return RiveBundle(pointer)
+        }
+    }
+}
+
+/**
+ * A [FileAssetLoader] that serves referenced assets from a [RiveBundle].
+ *
+ * When passed to a [File], assets are decoded straight from the bundle's mapping. Assets the
+ * bundle does not hold are declined, so it can be combined with other loaders in a
+ * [FallbackAssetLoader]; there it decodes through a copy of the bytes.
+ *
+ * Assets are matched by their unique filename (`name-id.ext`), then by name with and without
+ * extension.
+ */
+class BundleAssetLoader(private val bundle: RiveBundle) : FileAssetLoader() {
+    init {
+        bundle.acquire()
+        dependencies.add(bundle)
+        cppSetBundle(cppPointer, bundle.cppPointer)
+    }
+
+    override fun loadContents(asset: FileAsset, inBandBytes: ByteArray): Boolean {
+        if (inBandBytes.isNotEmpty()) return false
+        val bytes = bundle.assetBytes(asset.uniqueFilename)
+            ?: bundle.assetBytes(asset.name)
+            ?: return false
+        return asset.decode(bytes)
+    }
+}
@@ -0,0 +1,366 @@
+package app.rive
+
+import android.graphics.Bitmap
+import android.graphics.Canvas
+import android.graphics.Color
+import android.graphics.Paint
+import android.graphics.Rect
+import android.graphics.RectF
+import androidx.annotation.ColorInt
+import androidx.core.graphics.createBitmap
+import app.rive.core.CheckableAutoCloseable
+import app.rive.core.CloseOnce
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.SupervisorJob
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.launch
+import java.util.concurrent.atomic.AtomicBoolean
+import java.util.concurrent.locks.ReentrantLock
+import kotlin.concurrent.withLock
+import kotlin.math.ceil
+import kotlin.math.sqrt
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+import kotlin.time.Duration.Companion.seconds
+
+private const val FLIPBOOK_TAG = "Rive/Flipbook"
+
+/**
+ * A pre-rendered loop of an artboard, played back by drawing frames from a bitmap atlas.
+ *
+ * On low-end devices, advancing and rendering a complex artboard every frame may be too expensive.
+ * A flipbook renders the loop once, at a fixed resolution and frame rate, into an atlas of
+ * [columns] x [rows] frames. Playback is then a single bitmap blit per frame with [draw].
+ *
+ * The atlas is rendered on first use or by calling [prerender]. It is re-rendered after
+ * [invalidate], which is called automatically when inputs are set through this flipbook or, while
+ * [invalidateOnChanges] is collecting, when a bound view model instance changes. [draw] keeps
+ * showing the stale atlas while the new one renders in the background.
+ *
+ * Every render starts at the beginning of the loop, so frame 0 always shows the same phase of a
+ * looping animation.
+ *
+ * ⚠️ The flipbook drives the state machine's timeline while rendering, advancing it through one
+ * loop. The state machine should not be shared with a [Rive] composable at the same time.
+ *
+ * ⚠️ This class must be [closed][close] when you no longer need it to free the atlas and its
+ * render buffer. The artboard and state machine are not closed.
+ *
+ * @param artboard The artboard to render.
+ * @param stateMachine The state machine of [artboard] to advance between frames.
+ * @param frameWidth The width of each frame in pixels.
+ * @param frameHeight The height of each frame in pixels.
+ * @param fps The number of frames rendered per second of the loop.
+ * @param loopDuration The length of the loop. The frame count is rounded up to whole frames.
+ * @param fit The fit mode to use when rendering. Defaults to [Fit.Contain]. See the note on
+ *    [Fit.Layout] in [RenderBuffer.snapshot].
+ * @param clearColor The background color of each frame. Defaults to transparent.
+ * @throws IllegalArgumentException if the frame size, [fps], or [loopDuration] are not greater
+ *    than zero, or the atlas would exceed [MAX_ATLAS_SIZE] or [MAX_ATLAS_BYTES].
+ */
+class Flipbook(
+    private val artboard: Artboard,
+    private val stateMachine: StateMachine,
+    val frameWidth: Int,
+    val frameHeight: Int,
+    val fps: Int,
+    val loopDuration: Duration,
+    private val fit: Fit = Fit.Contain(),
+    @param:ColorInt private val clearColor: Int = Color.TRANSPARENT,
+) : CheckableAutoCloseable {
+    init {
+        require(frameWidth > 0 && frameHeight > 0) { "Flipbook frame width/height must be > 0" }
+        require(fps > 0) { "Flipbook fps must be > 0" }
+        require(loopDuration.isPositive()) { "Flipbook loop duration must be > 0" }
+    }
+
+    private val closer = CloseOnce("Flipbook") {
+        renderScope.cancel()
+        // Waits for a render in progress, which stops at its next frame once closed
+        renderLock.withLock {
+            buffer.close()
+            // Waits for a draw in progress, which may be on another thread
+            synchronized(atlasLock) {
+                atlas?.recycle()
+                atlas = null
+            }
+        }
+    }
+    override val closed
+        get() = closer.closed
+
+    override fun close() = closer.close()
+
+    /** The time between two frames. */
+    val frameInterval: Duration = (1.seconds.inWholeNanoseconds / fps).nanoseconds
+
+    /** The number of frames in the loop. */
+    val frameCount: Int =
+        ceil(loopDuration.inWholeNanoseconds.toDouble() / frameInterval.inWholeNanoseconds)
+            .toInt()
+            .coerceAtLeast(1)
+
+    /** The number of frames per atlas row. */
+    val columns: Int = ceil(sqrt(frameCount.toDouble())).toInt()
+
+    /** The number of atlas rows. */
+    val rows: Int = (frameCount + columns - 1) / columns
+
+    init {
+        val atlasWidth = columns.toLong() * frameWidth
+        val atlasHeight = rows.toLong() * frameHeight
+        require(atlasWidth <= MAX_ATLAS_SIZE && atlasHeight <= MAX_ATLAS_SIZE) {
+            "Flipbook atlas of ${atlasWidth}x$atlasHeight exceeds $MAX_ATLAS_SIZE pixels per side; " +
+                    "reduce the frame size, fps, or loop duration"
+        }
+        require(atlasWidth * atlasHeight * 4 <= MAX_ATLAS_BYTES) {
+            "Flipbook atlas of ${atlasWidth}x$atlasHeight exceeds $MAX_ATLAS_BYTES bytes; " +
+                    "reduce the frame size, fps, or loop duration"
+        }
+    }
+
+    private val buffer = RenderBuffer(frameWidth, frameHeight, artboard.riveWorker)
+
+    @Volatile
+    private var atlas: Bitmap? = null
+
+    @Volatile
+    private var dirty = true
+
+    /** Held while rendering, so [close] never frees the buffer or atlas under a render. */
+    private val renderLock = ReentrantLock()
+
+    /**
+     * Held while the atlas is read from, so [close] never recycles it under a draw. Separate from
+     * [renderLock] so that drawing the stale atlas does not wait for a background render.
+     */
+    private val atlasLock = Any()
+
+    /** Runs the background re-renders started by [draw]. */
+    private val renderScope = CoroutineScope(SupervisorJob() + Dispatchers.Default)
+    private val rendering = AtomicBoolean(false)
+
+    /** Total time the state machine was advanced by this flipbook, to find the loop start. */
+    private var advancedNanos = 0L
+
+    /** Scratch rect for the atlas region of the frame being drawn, guarded by [atlasLock]. */
+    private val srcRect = Rect()
+
+    /** Whether the atlas is rendered and reflects the latest inputs and properties. */
+    val isValid: Boolean
+        // A render in progress has already cleared the dirty flag
+        get() = !dirty && atlas != null && !renderLock.isLocked
+
+    /**
+     * Marks the atlas as stale. It is re-rendered on the next [draw] or [prerender].
+     *
+     * Call this after changing anything that affects the rendered output and that the flipbook
+     * cannot observe, e.g. setting inputs directly through the Rive worker.
+     */
+    fun invalidate() {
+        RiveLog.v(FLIPBOOK_TAG) { "Invalidated ${stateMachine.stateMachineHandle}" }
+        dirty = true
+    }
+
+    /**
+     * Invalidates the atlas whenever a property of [instance] is set. Suspends until cancelled, so
+     * collect it in a coroutine scoped to the flipbook's lifetime.
+     *
+     * @param instance The view model instance bound to the state machine.
+     */
+    suspend fun invalidateOnChanges(instance: ViewModelInstance) {
+        instance.dirtyFlow.collect { invalidate() }
+    }
+
+    /**
+     * Renders every frame of the loop into a new atlas, replacing the current one.
+     *
+     * The state machine is first advanced to the start of its next loop, then by [frameInterval]
+     * between frames. This blocks until all frames are rendered; for large atlases, call it from a
+     * background dispatcher ahead of playback rather than letting [draw] render on first use.
+     *
+     * @throws IllegalStateException if the flipbook has been closed.
+     */
+    @Throws(IllegalStateException::class)
+    fun prerender() = renderLock.withLock {
+        check(!closed) { "Flipbook has been closed" }
+        RiveLog.d(FLIPBOOK_TAG) {
+            "Rendering $frameCount frames at ${frameWidth}x$frameHeight " +
+                    "(${columns}x$rows atlas) for ${stateMachine.stateMachineHandle}"
+        }
+
+        // Marked clean before rendering so an invalidation during rendering is not lost
+        dirty = false
+        val newAtlas = createBitmap(columns * frameWidth, rows * frameHeight)
+        val canvas = Canvas(newAtlas)
+        val frame = createBitmap(frameWidth, frameHeight)
+        try {
+            val loopNanos = loopDuration.inWholeNanoseconds
+            val phase = advancedNanos % loopNanos
+            advance(if (phase == 0L) 0L else loopNanos - phase)
+            for (index in 0 until frameCount) {
+                // close() is waiting for the lock; stop here and let it free the buffer
+                check(!closed) { "Flipbook has been closed" }
+                if (index > 0) {
+                    advance(frameInterval.inWholeNanoseconds)
+                }
+                buffer.snapshot(artboard, stateMachine, fit, clearColor).copyInto(frame)
+                canvas.drawBitmap(
+                    frame,
+                    ((index % columns) * frameWidth).toFloat(),
+                    ((index / columns) * frameHeight).toFloat(),
+                    null
+                )
+            }
+        } catch (e: Throwable) {
+            dirty = true
+            newAtlas.recycle()
+            throw e
+        } finally {
+            frame.recycle()
+        }
+        // The old atlas may still be drawn on another thread, so it is left to the GC
+        atlas = newAtlas
+    }
+
+    private fun advance(nanos: Long) {
+        stateMachine.advance(nanos.nanoseconds)
+        advancedNanos += nanos
+    }
+
+    /**
+     * @param time The playback time. Wraps around every loop; negative times count backwards.
+     * @return The index of the frame shown at [time].
+     */
+    fun frameIndexAt(time: Duration): Int =
+        Math.floorMod(
+            time.inWholeNanoseconds / frameInterval.inWholeNanoseconds,
+            frameCount.toLong()
+        ).toInt()
+
+    /**
+     * Draws the frame for [time] into [dst].
+     *
+     * The first draw renders the atlas on the calling thread. After that, a stale atlas keeps
+     * being drawn while the new one renders in the background.
+     *
+     * Safe to call from any thread, including concurrently with [close].
+     *
+     * @param canvas The canvas to draw on.
+     * @param time The playback time, see [frameIndexAt].
+     * @param dst The destination rectangle. The frame is scaled to fill it.
+     * @param paint Optional paint, e.g. to enable bitmap filtering.
+     * @throws IllegalStateException if the flipbook has been closed.
+     */
+    @Throws(IllegalStateException::class)
+    fun draw(canvas: Canvas, time: Duration, dst: RectF, paint: Paint? = null) {
+        check(!closed) { "Flipbook has been closed" }
+        if (atlas == null) {
+            ensureAtlas()
+        } else if (dirty) {
+            prerenderInBackground()
+        }
+        synchronized(atlasLock) {
+            val current = checkNotNull(atlas) { "Flipbook has been closed" }
+            setFrameRect(frameIndexAt(time), srcRect)
+            canvas.drawBitmap(current, srcRect, dst, paint)
+        }
+    }
+
+    /**
+     * Copies a single frame out of the atlas, rendering the atlas first if it is missing or stale.
+     *
+     * @param index The frame index, from 0 until [frameCount].
+     * @return A new [frameWidth] x [frameHeight] bitmap of the frame.
+     * @throws IndexOutOfBoundsException if [index] is not a valid frame.
+     * @throws IllegalStateException if the flipbook has been closed.
+     */
+    @Throws(IndexOutOfBoundsException::class, IllegalStateException::class)
+    fun frameBitmap(index: Int): Bitmap {
+        if (index !in 0 until frameCount) {
+            throw IndexOutOfBoundsException("Frame $index out of range 0 until $frameCount")
+        }
+        ensureAtlas()
+        val rect = Rect()
+        setFrameRect(index, rect)
+        return synchronized(atlasLock) {
+            val current = checkNotNull(atlas) { "Flipbook has been closed" }
+            Bitmap.createBitmap(current, rect.left, rect.top, frameWidth, frameHeight)
+        }
+    }
+
+    /**
+     * Sets a number input on the state machine and invalidates the atlas.
+     *
+     * @param inputName The name of the number input.
+     * @param value The new value for the input.
+     */
+    fun setNumberInput(inputName: String, value: Float) {
+        artboard.riveWorker.setStateMachineNumberInput(
+            stateMachine.stateMachineHandle,
+            inputName,
+            value
+        )
+        invalidate()
+    }
+
+    /**
+     * Sets a boolean input on the state machine and invalidates the atlas.
+     *
+     * @param inputName The name of the boolean input.
+     * @param value The new value for the input.
+     */
+    fun setBooleanInput(inputName: String, value: Boolean) {
+        artboard.riveWorker.setStateMachineBooleanInput(
+            stateMachine.stateMachineHandle,
+            inputName,
+            value
+        )
+        invalidate()
+    }
+
+    /**
+     * Fires a trigger input on the state machine and invalidates the atlas.
+     *
+     * @param inputName The name of the trigger input.
+     */
+    fun fireTrigger(inputName: String) {
+        artboard.riveWorker.fireStateMachineTrigger(stateMachine.stateMachineHandle, inputName)
+        invalidate()
+    }
+
+    private fun prerenderInBackground() {
+        if (!rendering.compareAndSet(false, true)) return
+        renderScope.launch {
+            try {
+                prerender()
+            } catch (e: IllegalStateException) {
+                RiveLog.d(FLIPBOOK_TAG) { "Background render stopped: ${e.message}" }
+            } finally {
+                rendering.set(false)
+            }
+        }
+    }
+
+    /** Renders the atlas if it is missing or stale, waiting for a background render in progress. */
+    private fun ensureAtlas() = renderLock.withLock {
+        if (dirty || atlas == null) {
+            prerender()
+        }
+    }
+
+    private fun setFrameRect(index: Int, rect: Rect) {
+        val left = (index % columns) * frameWidth
+        val top = (index / columns) * frameHeight
+        rect.set(left, top, left + frameWidth, top + frameHeight)
+    }
+
+    companion object {
+        /** Largest atlas width or height, within the texture size limit of most GPUs. */
+        const val MAX_ATLAS_SIZE = 8192
+
+        /** Largest atlas size in bytes, the limit for drawing a bitmap on a hardware canvas. */
+        const val MAX_ATLAS_BYTES = 100L * 1024 * 1024
+    }
+}
@@ -69,8 +69,15 @@ kotlin {
             }
         }
         
+        // JNI source set, shared by the Android and desktop JVM targets. Both load the same
+        // native bindings (libmprive-android.so and libmprive-desktop.so).
+        val jniMain by creating {
+            dependsOn(commonMain)
+        }
+
         // Android source set
         val androidMain by getting {
+            dependsOn(jniMain)
             dependencies {
                 // Android-specific dependencies
             }
@@ -111,6 +118,7 @@ kotlin {
         
         // Desktop JVM source set
         val desktopMain by getting {
+            dependsOn(jniMain)
             dependencies {
                 // Desktop-specific dependencies
             }
@@ -188,4 +196,51 @@ android {
             }
         }
     }
-}
\ No newline at end of file
+}
+// Desktop JVM tests load libmprive-desktop.so, built from src/desktopMain/cpp and installed
+// into the desktop resources (see the CMakeLists.txt there). The library only builds on Linux
+// x86-64, and needs the rive-runtime submodule, clang and the Mesa EGL/GLES packages, so
+// desktopTest only builds it when asked to with -PdesktopNative. Without the library, the
+// desktop stubs are used and the tests that need it are skipped.
+val desktopNativeSupported = System.getProperty("os.name") == "Linux" &&
+        System.getProperty("os.arch") in setOf("amd64", "x86_64")
+val desktopNativeEnabled = desktopNativeSupported && project.hasProperty("desktopNative")
+val desktopNativeBuildDir = layout.buildDirectory.dir("cxx-desktop").get().asFile.absolutePath
+
+val configureDesktopNative by tasks.registering(Exec::class) {
+    group = "build"
+    description = "Configures the CMake build of libmprive-desktop.so."
+    onlyIf { desktopNativeSupported }
+    commandLine(
+        "cmake",
+        "-S", file("src/desktopMain/cpp").absolutePath,
+        "-B", desktopNativeBuildDir,
+        // Debug, like the Android test builds, so the native test hooks are present
+        "-DCMAKE_BUILD_TYPE=Debug"
+    )
+}
+
+val buildDesktopNative by tasks.registering(Exec::class) {
+    group = "build"
+    description = "Builds libmprive-desktop.so and installs it into the desktop resources."
+    dependsOn(configureDesktopNative)
+    onlyIf { desktopNativeSupported }
+    commandLine(
+        "cmake",
+        "--build", desktopNativeBuildDir,
+        "--target", "install",
+        "--parallel"
+    )
+}
+
+tasks.withType<Test>().matching { it.name == "desktopTest" }.configureEach {
+    if (desktopNativeEnabled) {
+        dependsOn(buildDesktopNative)
+    }
+    // Tests skip without the library, unless it was built for them
+    systemProperty("mprive.desktopNative.required", desktopNativeEnabled.toString())
+    systemProperty(
+        "java.library.path",
+        file("src/desktopMain/resources/jnilibs/linux-x86-64").absolutePath
+    )
+}
@@ -0,0 +1,156 @@
+package app.rive.mp.test.file
+
+import app.rive.mp.core.RivAnalyzer
+import app.rive.mp.core.SyntheticRiv
+import app.rive.mp.core.SyntheticRivSpec
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertTrue
+
+/**
+ * Native test hooks for riv_slicer. Only present in debug builds of the native library.
+ */
+object NativeRivSlicerTestHelper {
+    /** Slices [bytes] down to [artboardNames], as loadFile() does, or returns null on failure. */
+    external fun cppSlice(bytes: ByteArray, artboardNames: Array<String>): ByteArray?
+
+    /**
+     * Draws [frameCount] frames of [artboardName] in [bytes] through a recording renderer, with
+     * its default view model instance bound, and returns a log of each frame's draw calls, or null
+     * if the artboard is missing.
+     */
+    external fun cppRecordArtboard(bytes: ByteArray, artboardName: String, frameCount: Int): Array<String>?
+
+    /**
+     * Names of the artboards the artboard properties of [artboardName]'s default view model
+     * instance refer to, empty for a property set to none, or null if the artboard is missing.
+     */
+    external fun cppBoundArtboards(bytes: ByteArray, artboardName: String): Array<String>?
+}
+
+/**
+ * Tests the bytes produced for loadFile() with artboard names, on synthetic files holding nested
+ * artboards, data converters and view models, and on a file exported by the editor.
+ */
+class MpRivSlicerTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    // Artboard n nests artboard n + 1
+    private val spec = SyntheticRivSpec(
+        artboardCount = 5,
+        shapesPerArtboard = 2,
+        viewModelProperties = 4,
+        listLength = 2,
+        dataConverters = 3,
+        nestNextArtboard = true
+    )
+
+    @Test
+    fun nested_artboards_are_kept_and_renumbered() {
+        val sliced = slice(SyntheticRiv.generate(spec), "Artboard 2")
+        val report = assertNotNull(RivAnalyzer.analyze(sliced))
+
+        assertEquals(listOf("Artboard 2", "Artboard 3", "Artboard 4"), field(report, "name"))
+        // The chain resolves only if ids 3 and 4 were renumbered to 1 and 2
+        assertEquals(listOf("2", "1", "0"), field(report, "nestedArtboardDepth"))
+        assertEquals(listOf("2"), field(report, "viewModelCount"))
+    }
+
+    @Test
+    fun file_level_objects_are_kept_whole() {
+        // Converters and view models add the same bytes to the slice as to the file
+        val plain = spec.copy(viewModelProperties = 0, listLength = 0, dataConverters = 0)
+        val full = SyntheticRiv.generate(spec)
+        val fullPlain = SyntheticRiv.generate(plain)
+        val sliced = slice(full, "Artboard 4")
+        val slicedPlain = slice(fullPlain, "Artboard 4")
+
+        assertEquals(full.size - fullPlain.size, sliced.size - slicedPlain.size)
+        assertEquals(listOf("Artboard 4"), field(assertNotNull(RivAnalyzer.analyze(sliced)), "name"))
+    }
+
+    @Test
+    fun keeping_every_artboard_copies_the_file() {
+        val bytes = SyntheticRiv.generate(spec)
+        val names = (0 until spec.artboardCount).map { "Artboard $it" }.reversed()
+        assertEquals(bytes.toList(), slice(bytes, *names.toTypedArray()).toList())
+    }
+
+    @Test
+    fun editor_file_slice_draws_like_the_full_file() {
+        // Exported by the editor: nested artboards, one of them bound to a view model artboard
+        // property
+        val full = MpTestResources.loadRiveFile("swap_character_main")
+        val fullReport = assertNotNull(RivAnalyzer.analyze(full))
+        val fullNames = artboardNames(fullReport)
+        val depths = field(fullReport, "nestedArtboardDepth").map { it.toInt() }
+        assertTrue(depths.any { it > 0 }, "The file should nest artboards")
+        assertTrue(
+            fullNames.any { bound(full, it).isNotEmpty() },
+            "The file should have view model artboard properties"
+        )
+
+        // Keep the most deeply nesting artboard. The slicer adds what it nests; what view model
+        // artboard properties refer to has to be requested.
+        val root = fullNames[depths.indices.maxBy { depths[it] }]
+        var requested = setOf(root)
+        var sliced: ByteArray
+        var slicedReport: String
+        var kept: List<String>
+        while (true) {
+            sliced = slice(full, *requested.toTypedArray())
+            slicedReport = assertNotNull(RivAnalyzer.analyze(sliced))
+            kept = artboardNames(slicedReport)
+            val unkept = kept.flatMap { bound(full, it) }.filter { it.isNotEmpty() && it !in kept }
+            if (unkept.isEmpty()) {
+                break
+            }
+            requested = requested + unkept
+        }
+        assertEquals(
+            depths.max(),
+            field(slicedReport, "nestedArtboardDepth")[kept.indexOf(root)].toInt(),
+            "Every artboard $root nests should be kept"
+        )
+        assertTrue(kept.size < fullNames.size, "The slice should drop artboards: $kept")
+
+        // Ids are renumbered, so a nested or bound artboard that resolves to the wrong one draws
+        // differently
+        for (name in kept) {
+            val expected = record(full, name)
+            val actual = record(sliced, name)
+            assertEquals(expected.size, actual.size)
+            expected.indices.forEach { frame ->
+                assertEquals(expected[frame], actual[frame], "$name: frame $frame differs")
+            }
+        }
+    }
+
+    private fun slice(bytes: ByteArray, vararg names: String): ByteArray =
+        assertNotNull(NativeRivSlicerTestHelper.cppSlice(bytes, arrayOf(*names)))
+
+    private fun record(bytes: ByteArray, artboardName: String): Array<String> =
+        assertNotNull(NativeRivSlicerTestHelper.cppRecordArtboard(bytes, artboardName, FRAME_COUNT))
+
+    private fun bound(bytes: ByteArray, artboardName: String): List<String> =
+        assertNotNull(NativeRivSlicerTestHelper.cppBoundArtboards(bytes, artboardName)).toList()
+
+    /** Artboard names in an analyzer report, skipping image names. */
+    private fun artboardNames(report: String): List<String> =
+        field(report.substringAfter("\"artboards\""), "name")
+
+    /** Values of every [name] field in an analyzer report, in order. */
+    private fun field(report: String, name: String): List<String> =
+        Regex("\"$name\":\"?([^,\"}]*)").findAll(report).map { it.groupValues[1] }.toList()
+
+    private companion object {
+        const val FRAME_COUNT = 30
+    }
+}
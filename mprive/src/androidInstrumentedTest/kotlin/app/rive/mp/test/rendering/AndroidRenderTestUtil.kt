@@ -1,9 +1,12 @@
 package app.rive.mp.test.rendering
 
+import app.rive.mp.ArtboardHandle
 import app.rive.mp.CommandQueue
 import app.rive.mp.DrawKey
+import app.rive.mp.FileHandle
 import app.rive.mp.RenderContext
 import app.rive.mp.RiveSurface
+import app.rive.mp.StateMachineHandle
 import app.rive.mp.createDefaultRenderContext
 import app.rive.mp.test.utils.MpTestContext
 import kotlinx.coroutines.CoroutineScope
@@ -101,6 +104,35 @@ class AndroidRenderTestUtil(
         return commandQueue.createDrawKey()
     }
     
+    /**
+     * Draw an artboard until [done] holds, up to about a second. Useful to wait for work that
+     * finishes at the start of a frame, such as publishing image uploads.
+     *
+     * @param fileHandle Any loaded file, used for a round-trip after each draw so the draw has
+     *    run before [done] is checked.
+     * @return Whether [done] held.
+     */
+    suspend fun drawUntil(
+        fileHandle: FileHandle,
+        artboardHandle: ArtboardHandle,
+        done: () -> Boolean
+    ): Boolean {
+        val surface = createTestSurface(64, 64)
+        try {
+            repeat(100) {
+                commandQueue.draw(artboardHandle, StateMachineHandle(0L), surface)
+                commandQueue.getArtboardNames(fileHandle)
+                if (done()) {
+                    return true
+                }
+                Thread.sleep(10)
+            }
+            return false
+        } finally {
+            surface.close()
+        }
+    }
+
     /**
      * Cleanup the CommandQueue, RenderContext, and stop polling.
      * Should be called at the end of each test.
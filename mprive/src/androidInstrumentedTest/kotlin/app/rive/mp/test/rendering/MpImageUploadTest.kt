@@ -0,0 +1,85 @@
+package app.rive.mp.test.rendering
+
+import app.rive.mp.ImageUploads
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+
+/**
+ * Tests for image uploads on the shared-context upload thread (GpuUploadWorker).
+ *
+ * `asset_load_check.riv` embeds a JPEG, which is decoded while the file loads and uploaded
+ * through the render context.
+ */
+class MpImageUploadTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun image_is_uploaded_on_the_shared_context_and_published_by_a_frame() = runTest {
+        val testUtil = AndroidRenderTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val queuedBefore = ImageUploads.queuedCount
+            val publishedBefore = ImageUploads.publishedCount
+            val synchronousBefore = ImageUploads.synchronousCount
+
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("asset_load_check.riv"))
+            val queued = ImageUploads.queuedCount - queuedBefore
+            assertTrue(queued >= 1, "The embedded image should be queued on the upload thread")
+            assertEquals(0L, ImageUploads.synchronousCount - synchronousBefore)
+            // Nothing publishes before a frame begins, so the image still samples the placeholder
+            assertEquals(0L, ImageUploads.publishedCount - publishedBefore)
+
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val published = testUtil.drawUntil(fileHandle, artboardHandle) {
+                ImageUploads.publishedCount - publishedBefore >= queued
+            }
+            assertTrue(published, "Frames should publish the finished upload")
+            assertEquals(queued, ImageUploads.publishedCount - publishedBefore)
+
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun images_upload_on_the_render_thread_without_a_shared_context() = runTest {
+        // Make() then fails as if the shared context could not be created
+        ImageUploads.isEnabled = false
+        try {
+            val testUtil = AndroidRenderTestUtil(this)
+            try {
+                val queue = testUtil.commandQueue
+                val queuedBefore = ImageUploads.queuedCount
+                val synchronousBefore = ImageUploads.synchronousCount
+
+                val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("asset_load_check.riv"))
+                assertTrue(
+                    ImageUploads.synchronousCount - synchronousBefore >= 1,
+                    "The image should be uploaded on the render thread"
+                )
+                assertEquals(0L, ImageUploads.queuedCount - queuedBefore)
+
+                // Rendering works the same without the upload thread
+                val artboardHandle = queue.createDefaultArtboard(fileHandle)
+                testUtil.drawUntil(fileHandle, artboardHandle) { true }
+
+                queue.deleteArtboard(artboardHandle)
+                queue.deleteFile(fileHandle)
+            } finally {
+                testUtil.cleanup()
+            }
+        } finally {
+            ImageUploads.isEnabled = true
+        }
+    }
+}
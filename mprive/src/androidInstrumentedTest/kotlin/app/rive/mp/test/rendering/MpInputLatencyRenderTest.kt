@@ -0,0 +1,80 @@
+package app.rive.mp.test.rendering
+
+import app.rive.mp.core.InputEventKind
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.CoroutineStart
+import kotlinx.coroutines.async
+import kotlinx.coroutines.flow.first
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+
+/**
+ * Phase G.4 tests for input-to-present latency and the per-frame timing breakdown on a real
+ * render context.
+ *
+ * The common MpCommandQueueLatencyTest only covers the empty stats; these send an input through
+ * advance, draw and present.
+ */
+class MpInputLatencyRenderTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun pointer_event_is_measured_to_present() = runTest {
+        val testUtil = AndroidRenderTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("shapes.riv"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createDefaultStateMachine(artboardHandle)
+            val surface = testUtil.createTestSurface(64, 64)
+
+            queue.setFrameTimingEnabled(true)
+            queue.resetInputLatencyStats()
+            val frame = async(start = CoroutineStart.UNDISPATCHED) {
+                queue.frameTimingFlow.first { it.drawKey == surface.drawKey }
+            }
+
+            val eventTimeNanos = System.nanoTime()
+            queue.pointerMove(smHandle, surface, 32f, 32f, eventTimeNanos = eventTimeNanos)
+            queue.advanceStateMachine(smHandle, 0.016f)
+            queue.draw(artboardHandle, smHandle, surface)
+            val timing = frame.await()
+            val wallTime = (System.nanoTime() - eventTimeNanos).nanoseconds
+
+            val stats = queue.getInputLatencyStats().getValue(InputEventKind.POINTER_MOVE)
+            assertEquals(1L, stats.count, "The pointer move should be presented once")
+            assertTrue(stats.min >= Duration.ZERO)
+            assertTrue(stats.max <= wallTime, "Latency ${stats.max} exceeds the wall time $wallTime")
+            assertEquals(stats.min, stats.max)
+
+            // Every stage of the frame ran
+            assertTrue(timing.queueWait > Duration.ZERO, "queueWait")
+            assertTrue(timing.advance > Duration.ZERO, "The advance before the draw should count")
+            assertTrue(timing.encode > Duration.ZERO, "encode")
+            assertTrue(timing.flush > Duration.ZERO, "flush")
+            assertTrue(timing.present > Duration.ZERO, "present")
+            val stages = timing.queueWait + timing.encode + timing.flush + timing.present
+            assertTrue(stages <= wallTime, "The draw's stages cannot take longer than the test")
+
+            // Other kinds saw no input
+            assertEquals(0L, queue.getInputLatencyStats().getValue(InputEventKind.POINTER_DOWN).count)
+
+            queue.setFrameTimingEnabled(false)
+            surface.close()
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
@@ -0,0 +1,196 @@
+package app.rive.mp.test.rendering
+
+import app.rive.mp.core.LazyGpuResourceStats
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.withContext
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Native test hooks for the DeferredFactory. Only present in debug builds of the native library.
+ */
+object NativeDeferredFactoryTestHelper {
+    /**
+     * Draws [frameCount] frames of the default artboard of [bytes] through a recording renderer,
+     * imported through a DeferredFactory when [lazy] is set and directly otherwise. With
+     * [trimEachFrame], every idle object is released after each frame.
+     *
+     * @param stats Receives [LazyGpuResourceStats.FIELD_COUNT] counters after the last frame.
+     * @return A log of each frame's draw calls and the state of the objects they drew.
+     */
+    external fun cppRecordFrames(
+        bytes: ByteArray,
+        lazy: Boolean,
+        frameCount: Int,
+        trimEachFrame: Boolean,
+        stats: LongArray
+    ): Array<String>?
+}
+
+/**
+ * Phase G.13 tests for lazily created GPU resources on a real render context.
+ *
+ * The common MpCommandQueueLazyResourcesTest runs without a render context, where lazy import is
+ * a no-op; these check that objects are actually recorded at import and created by drawing, that
+ * idle ones are released, and that a lazy import draws exactly what an eager one does.
+ */
+class MpLazyGpuResourcesRenderTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun drawing_materializes_recorded_objects() = runTest {
+        val testUtil = AndroidRenderTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            queue.setLazyGpuResources(true)
+            val before = queue.lazyGpuResourceStats()
+
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val imported = queue.lazyGpuResourceStats()
+            assertTrue(
+                imported.liveObjects > before.liveObjects,
+                "Import should record paths and paints"
+            )
+            assertEquals(
+                before.materializations,
+                imported.materializations,
+                "Nothing is created before the first draw"
+            )
+
+            testUtil.drawUntil(fileHandle, artboardHandle) { true }
+            val drawn = queue.lazyGpuResourceStats()
+            assertTrue(
+                drawn.materializations > imported.materializations,
+                "Drawing should create the real objects"
+            )
+            assertTrue(drawn.materializedObjects > 0)
+            assertTrue(drawn.materializedObjects <= drawn.liveObjects)
+
+            // A second frame reuses them
+            testUtil.drawUntil(fileHandle, artboardHandle) { true }
+            assertEquals(drawn.materializations, queue.lazyGpuResourceStats().materializations)
+
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+            queue.setLazyGpuResources(false)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun idle_objects_are_released_and_recreated() = runTest {
+        val testUtil = AndroidRenderTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            queue.setLazyGpuResources(true, idleRelease = IDLE_RELEASE)
+            val shownFile = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val shown = queue.createDefaultArtboard(shownFile)
+            val otherFile = queue.loadFile(MpTestResources.loadRiveFile("basketball"))
+            val other = queue.createDefaultArtboard(otherFile)
+
+            testUtil.drawUntil(shownFile, shown) { true }
+            val drawn = queue.lazyGpuResourceStats()
+            assertTrue(drawn.materializedObjects > 0)
+
+            // Idle objects are looked for at most once a second, at the end of a frame
+            withContext(Dispatchers.Default) { delay(TRIM_INTERVAL + IDLE_RELEASE) }
+            testUtil.drawUntil(otherFile, other) { true }
+            val trimmed = queue.lazyGpuResourceStats()
+            assertTrue(
+                trimmed.releases > drawn.releases,
+                "The undrawn artboard's objects should be released"
+            )
+
+            testUtil.drawUntil(shownFile, shown) { true }
+            val redrawn = queue.lazyGpuResourceStats()
+            assertTrue(
+                redrawn.materializations > trimmed.materializations,
+                "Drawing a released artboard should create its objects again"
+            )
+
+            queue.deleteArtboard(other)
+            queue.deleteFile(otherFile)
+            queue.deleteArtboard(shown)
+            queue.deleteFile(shownFile)
+            queue.setLazyGpuResources(false)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun lazy_import_draws_what_eager_import_draws() {
+        for (name in FILES) {
+            val bytes = MpTestResources.loadRiveFile(name)
+            val eager = recordFrames(bytes, lazy = false)
+            val stats = LongArray(LazyGpuResourceStats.FIELD_COUNT)
+            val lazy = recordFrames(bytes, lazy = true, stats = stats)
+
+            assertEquals(eager.size, lazy.size)
+            eager.indices.forEach { frame ->
+                assertEquals(eager[frame], lazy[frame], "$name: frame $frame differs")
+            }
+            val counters = LazyGpuResourceStats.fromArray(stats)
+            assertTrue(counters.materializations > 0, "$name: nothing was drawn lazily")
+            assertEquals(0L, counters.releases, "$name: nothing is idle between frames")
+        }
+    }
+
+    @Test
+    fun objects_released_by_trim_draw_the_same_when_recreated() {
+        for (name in FILES) {
+            val bytes = MpTestResources.loadRiveFile(name)
+            val eager = recordFrames(bytes, lazy = false)
+            val stats = LongArray(LazyGpuResourceStats.FIELD_COUNT)
+            // Each frame's objects are released after it and recreated by the next one
+            val trimmed = recordFrames(bytes, lazy = true, trimEachFrame = true, stats = stats)
+
+            eager.indices.forEach { frame ->
+                assertEquals(eager[frame], trimmed[frame], "$name: frame $frame differs")
+            }
+            val counters = LazyGpuResourceStats.fromArray(stats)
+            assertTrue(counters.releases > 0, "$name: trim() should release idle objects")
+            assertTrue(
+                counters.materializedObjects < counters.liveObjects,
+                "$name: released objects should no longer count as materialized"
+            )
+        }
+    }
+
+    private fun recordFrames(
+        bytes: ByteArray,
+        lazy: Boolean,
+        trimEachFrame: Boolean = false,
+        stats: LongArray = LongArray(LazyGpuResourceStats.FIELD_COUNT)
+    ): Array<String> {
+        val frames = NativeDeferredFactoryTestHelper.cppRecordFrames(
+            bytes,
+            lazy,
+            FRAME_COUNT,
+            trimEachFrame,
+            stats
+        )
+        assertNotNull(frames, "The file should have a default artboard")
+        return frames
+    }
+
+    private companion object {
+        val FILES = listOf("flux_capacitor", "off_road_car_blog", "basketball")
+        const val FRAME_COUNT = 30
+        val IDLE_RELEASE = 200.milliseconds
+        val TRIM_INTERVAL = 1000.milliseconds
+    }
+}
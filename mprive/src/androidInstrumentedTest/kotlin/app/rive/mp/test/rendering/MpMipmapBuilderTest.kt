@@ -0,0 +1,92 @@
+package app.rive.mp.test.rendering
+
+import app.rive.mp.test.utils.MpTestContext
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertNotNull
+
+/**
+ * Native test hooks for mipmap_builder. Only present in debug builds of the native library.
+ */
+object NativeMipmapTestHelper {
+    /**
+     * Downsamples tightly packed RGBA pixels by one mip level, with the NEON/SSE2 path when [simd]
+     * is set and the scalar reference otherwise.
+     */
+    external fun cppDownsample(pixels: ByteArray, width: Int, height: Int, simd: Boolean): ByteArray?
+}
+
+/**
+ * Tests that the SIMD box filter used for image mip chains matches the scalar reference.
+ *
+ * The SIMD loops handle 8 (NEON) or 2 (SSE2) output pixels at a time and leave the rest of each
+ * row to the scalar loop, so widths around those multiples, odd sizes, and 1-pixel levels are
+ * where the two could disagree.
+ */
+class MpMipmapBuilderTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    private val sizes = listOf(1, 2, 3, 4, 5, 7, 9, 15, 16, 17, 18, 31, 33, 63, 65, 100, 257)
+
+    @Test
+    fun simd_matches_scalar_for_odd_and_non_power_of_two_sizes() {
+        val random = Random(0x5EED)
+        for (width in sizes) {
+            for (height in sizes) {
+                val pixels = randomPremultiplied(random, width, height)
+                assertSameLevel(pixels, width, height)
+            }
+        }
+    }
+
+    @Test
+    fun simd_matches_scalar_down_a_full_chain() {
+        var width = 301
+        var height = 77
+        var pixels = randomPremultiplied(Random(7), width, height)
+        while (width > 1 || height > 1) {
+            pixels = assertSameLevel(pixels, width, height)
+            width = maxOf(width / 2, 1)
+            height = maxOf(height / 2, 1)
+        }
+    }
+
+    @Test
+    fun averages_round_to_nearest() {
+        // 2x2 RGBA whose channel sums 3, 2, 0 and 1020 round to 1, 1, 0 and 255
+        val pixels = byteArrayOf(
+            1, 1, 0, 255.toByte(), 1, 0, 0, 255.toByte(),
+            1, 1, 0, 255.toByte(), 0, 0, 0, 255.toByte(),
+        )
+        val expected = byteArrayOf(1, 1, 0, 255.toByte())
+        assertContentEquals(expected, NativeMipmapTestHelper.cppDownsample(pixels, 2, 2, true))
+        assertContentEquals(expected, NativeMipmapTestHelper.cppDownsample(pixels, 2, 2, false))
+    }
+
+    /** Downsamples with both paths, asserts they match, and returns the level. */
+    private fun assertSameLevel(pixels: ByteArray, width: Int, height: Int): ByteArray {
+        val simd = NativeMipmapTestHelper.cppDownsample(pixels, width, height, true)
+        val scalar = NativeMipmapTestHelper.cppDownsample(pixels, width, height, false)
+        assertNotNull(simd)
+        assertNotNull(scalar)
+        assertContentEquals(scalar, simd, "SIMD and scalar levels differ for ${width}x$height")
+        return simd
+    }
+
+    /** Random RGBA with each color channel at most its alpha, as in premultiplied images. */
+    private fun randomPremultiplied(random: Random, width: Int, height: Int): ByteArray {
+        val pixels = ByteArray(width * height * 4)
+        for (i in pixels.indices step 4) {
+            val alpha = random.nextInt(256)
+            for (c in 0 until 3) {
+                pixels[i + c] = random.nextInt(alpha + 1).toByte()
+            }
+            pixels[i + 3] = alpha.toByte()
+        }
+        return pixels
+    }
+}
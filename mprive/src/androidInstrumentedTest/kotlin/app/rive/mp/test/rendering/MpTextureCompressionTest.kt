@@ -0,0 +1,362 @@
+package app.rive.mp.test.rendering
+
+import app.rive.mp.ImageUploads
+import app.rive.mp.TextureCompression
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import java.io.File
+import java.io.RandomAccessFile
+import kotlin.math.abs
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertNotNull
+import kotlin.test.assertTrue
+
+/**
+ * Native test hooks for etc2_encoder. Only present in debug builds of the native library.
+ */
+object NativeETC2TestHelper {
+    /** Encodes tightly packed premultiplied RGBA pixels as ETC2 RGBA8 blocks. */
+    external fun cppEncodeETC2(pixels: ByteArray, width: Int, height: Int): ByteArray?
+}
+
+/**
+ * Tests for the compressed texture cache behind [TextureCompression].
+ *
+ * `asset_load_check.riv` embeds a JPEG: the first load decodes and transcodes it and writes a
+ * cache entry, later loads upload the cached entry without decoding.
+ */
+class MpTextureCompressionTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    private val riv by lazy { MpTestResources.loadRiveFile("asset_load_check.riv") }
+
+    @Test
+    fun enable_fails_without_a_usable_directory() {
+        val blocker = File(MpTestContext.tempFilePath("rive-textures-blocker-${System.nanoTime()}"))
+        blocker.writeText("not a directory")
+        try {
+            assertFalse(TextureCompression.enable(File(blocker, "cache")))
+            assertFalse(TextureCompression.isEnabled)
+        } finally {
+            blocker.delete()
+        }
+    }
+
+    @Test
+    fun cached_texture_round_trips() = runTest {
+        withCacheDir { dir ->
+            val testUtil = AndroidRenderTestUtil(this)
+            try {
+                val missesBefore = TextureCompression.cacheMisses
+                loadAndPublish(testUtil)
+                assertTrue(TextureCompression.cacheMisses > missesBefore)
+                assertNotNull(cacheEntry(dir), "The transcoded image should be cached")
+
+                // The second load uploads the cached chain
+                val hitsBefore = TextureCompression.cacheHits
+                loadAndPublish(testUtil)
+                assertEquals(1L, TextureCompression.cacheHits - hitsBefore)
+            } finally {
+                testUtil.cleanup()
+            }
+        }
+    }
+
+    @Test
+    fun corrupted_entry_is_decoded_again() = runTest {
+        withCacheDir { dir ->
+            val testUtil = AndroidRenderTestUtil(this)
+            try {
+                loadAndPublish(testUtil)
+                val entry = assertNotNull(cacheEntry(dir))
+
+                // Flip the last byte of the last mip level
+                RandomAccessFile(entry, "rw").use { file ->
+                    file.seek(file.length() - 1)
+                    val last = file.read()
+                    file.seek(file.length() - 1)
+                    file.write(last xor 0xFF)
+                }
+
+                val hitsBefore = TextureCompression.cacheHits
+                val missesBefore = TextureCompression.cacheMisses
+                loadAndPublish(testUtil)
+                assertEquals(0L, TextureCompression.cacheHits - hitsBefore)
+                assertEquals(1L, TextureCompression.cacheMisses - missesBefore)
+
+                // The image was decoded, transcoded and cached again
+                val hitsAfterRepair = TextureCompression.cacheHits
+                loadAndPublish(testUtil)
+                assertEquals(1L, TextureCompression.cacheHits - hitsAfterRepair)
+            } finally {
+                testUtil.cleanup()
+            }
+        }
+    }
+
+    @Test
+    fun etc2_solid_blocks_decode_within_bound() {
+        // Every 4x4 block one color: the subblock base colors and an EAC modifier of 0 fit them
+        // closely, and alpha exactly.
+        val random = Random(7)
+        val width = 16
+        val height = 16
+        val colors = List(16) { premultiplied(random.nextInt(256), random.nextInt(256), random.nextInt(256), random.nextInt(256)) }
+        val pixels = ByteArray(width * height * 4)
+        for (y in 0 until height) {
+            for (x in 0 until width) {
+                colors[(y / 4) * 4 + x / 4].copyInto(pixels, (y * width + x) * 4)
+            }
+        }
+
+        val errors = roundTripErrors(pixels, width, height)
+        assertTrue(errors.maxColor <= 8, "Max color error ${errors.maxColor}")
+        assertEquals(0, errors.maxAlpha, "Solid alpha should be exact")
+    }
+
+    @Test
+    fun etc2_gradients_decode_within_bound() {
+        // Odd sizes exercise the partial edge blocks.
+        val width = 13
+        val height = 9
+        val pixels = ByteArray(width * height * 4)
+        for (y in 0 until height) {
+            for (x in 0 until width) {
+                premultiplied(
+                    (40 + x * 9).coerceAtMost(255),
+                    (20 + y * 11).coerceAtMost(255),
+                    (60 + (x + y) * 4).coerceAtMost(255),
+                    255 - x * 6
+                ).copyInto(pixels, (y * width + x) * 4)
+            }
+        }
+
+        val errors = roundTripErrors(pixels, width, height)
+        assertTrue(errors.meanError <= 4.0, "Mean error ${errors.meanError}")
+        assertTrue(errors.maxColor <= 24, "Max color error ${errors.maxColor}")
+        assertTrue(errors.maxAlpha <= 4, "Max alpha error ${errors.maxAlpha}")
+    }
+
+    private class RoundTripErrors(val maxColor: Int, val maxAlpha: Int, val meanError: Double)
+
+    private fun roundTripErrors(pixels: ByteArray, width: Int, height: Int): RoundTripErrors {
+        val encoded = assertNotNull(NativeETC2TestHelper.cppEncodeETC2(pixels, width, height))
+        assertEquals(((width + 3) / 4) * ((height + 3) / 4) * 16, encoded.size)
+        val decoded = ETC2Reference.decodeRGBA8(encoded, width, height)
+
+        var maxColor = 0
+        var maxAlpha = 0
+        var total = 0L
+        for (i in pixels.indices) {
+            val error = abs((pixels[i].toInt() and 0xFF) - (decoded[i].toInt() and 0xFF))
+            total += error
+            if (i % 4 == 3) maxAlpha = maxOf(maxAlpha, error) else maxColor = maxOf(maxColor, error)
+        }
+        return RoundTripErrors(maxColor, maxAlpha, total.toDouble() / pixels.size)
+    }
+
+    private fun premultiplied(r: Int, g: Int, b: Int, a: Int): ByteArray =
+        byteArrayOf((r * a / 255).toByte(), (g * a / 255).toByte(), (b * a / 255).toByte(), a.toByte())
+
+    /**
+     * Load the file, draw until its image is published, then delete the file so the next load
+     * imports it again.
+     */
+    private suspend fun loadAndPublish(testUtil: AndroidRenderTestUtil) {
+        val queue = testUtil.commandQueue
+        val publishedBefore = ImageUploads.publishedCount
+        val fileHandle = queue.loadFile(riv)
+        val artboardHandle = queue.createDefaultArtboard(fileHandle)
+        val published = testUtil.drawUntil(fileHandle, artboardHandle) {
+            ImageUploads.publishedCount > publishedBefore
+        }
+        assertTrue(published, "The image should be published")
+        queue.deleteArtboard(artboardHandle)
+        queue.deleteFile(fileHandle)
+    }
+
+    private fun cacheEntry(dir: File): File? =
+        dir.listFiles { file -> file.name.endsWith(".rvtc") }?.singleOrNull()
+
+    private inline fun withCacheDir(block: (File) -> Unit) {
+        val dir = File(MpTestContext.tempFilePath("rive-textures-${System.nanoTime()}"))
+        assertTrue(TextureCompression.enable(dir))
+        try {
+            block(dir)
+        } finally {
+            TextureCompression.disable()
+            dir.deleteRecursively()
+        }
+    }
+}
+
+/**
+ * Reference ETC2 RGBA8 decoder, written from the Khronos data format specification
+ * independently of the native encoder. Decodes every color mode (individual, differential, T, H
+ * and planar) so a block the encoder emits by mistake still decodes as a GPU would.
+ */
+private object ETC2Reference {
+    private val colorModifiers = arrayOf(
+        intArrayOf(2, 8), intArrayOf(5, 17), intArrayOf(9, 29), intArrayOf(13, 42),
+        intArrayOf(18, 60), intArrayOf(24, 80), intArrayOf(33, 106), intArrayOf(47, 183),
+    )
+    private val alphaModifiers = arrayOf(
+        intArrayOf(-3, -6, -9, -15, 2, 5, 8, 14), intArrayOf(-3, -7, -10, -13, 2, 6, 9, 12),
+        intArrayOf(-2, -5, -8, -13, 1, 4, 7, 12), intArrayOf(-2, -4, -6, -13, 1, 3, 5, 12),
+        intArrayOf(-3, -6, -8, -12, 2, 5, 7, 11), intArrayOf(-3, -7, -9, -11, 2, 6, 8, 10),
+        intArrayOf(-4, -7, -8, -11, 3, 6, 7, 10), intArrayOf(-3, -5, -8, -11, 2, 4, 7, 10),
+        intArrayOf(-2, -6, -8, -10, 1, 5, 7, 9), intArrayOf(-2, -5, -8, -10, 1, 4, 7, 9),
+        intArrayOf(-2, -4, -8, -10, 1, 3, 7, 9), intArrayOf(-2, -5, -7, -10, 1, 4, 6, 9),
+        intArrayOf(-3, -4, -7, -10, 2, 3, 6, 9), intArrayOf(-1, -2, -3, -10, 0, 1, 2, 9),
+        intArrayOf(-4, -6, -8, -9, 3, 5, 7, 8), intArrayOf(-3, -5, -7, -9, 2, 4, 6, 8),
+    )
+    private val distances = intArrayOf(3, 6, 11, 16, 23, 32, 41, 64)
+
+    /** Decodes [width] x [height] RGBA pixels from 16-byte blocks in row order. */
+    fun decodeRGBA8(blocks: ByteArray, width: Int, height: Int): ByteArray {
+        val out = ByteArray(width * height * 4)
+        var offset = 0
+        for (by in 0 until height step 4) {
+            for (bx in 0 until width step 4) {
+                val alpha = decodeAlpha(readBigEndian(blocks, offset))
+                val color = decodeColor(readBigEndian(blocks, offset + 8))
+                offset += 16
+                // Pixels within a block are in column order: index = x * 4 + y.
+                for (x in 0 until 4) {
+                    for (y in 0 until 4) {
+                        if (bx + x >= width || by + y >= height) continue
+                        val o = ((by + y) * width + bx + x) * 4
+                        for (c in 0 until 3) out[o + c] = color[x * 4 + y][c].toByte()
+                        out[o + 3] = alpha[x * 4 + y].toByte()
+                    }
+                }
+            }
+        }
+        return out
+    }
+
+    private fun readBigEndian(bytes: ByteArray, offset: Int): Long {
+        var value = 0L
+        for (i in 0 until 8) value = (value shl 8) or (bytes[offset + i].toLong() and 0xFF)
+        return value
+    }
+
+    private fun bits(block: Long, high: Int, low: Int): Int =
+        ((block ushr low) and ((1L shl (high - low + 1)) - 1)).toInt()
+
+    private fun clamp(value: Int) = value.coerceIn(0, 255)
+    private fun extend4(v: Int) = (v shl 4) or v
+    private fun extend5(v: Int) = (v shl 3) or (v shr 2)
+    private fun extend6(v: Int) = (v shl 2) or (v shr 4)
+    private fun extend7(v: Int) = (v shl 1) or (v shr 6)
+    private fun signed3(v: Int) = if (v >= 4) v - 8 else v
+
+    private fun decodeAlpha(block: Long): IntArray {
+        val base = bits(block, 63, 56)
+        val multiplier = bits(block, 55, 52)
+        val modifiers = alphaModifiers[bits(block, 51, 48)]
+        return IntArray(16) { i ->
+            clamp(base + modifiers[bits(block, 47 - i * 3, 45 - i * 3)] * multiplier)
+        }
+    }
+
+    private fun pixelIndex(block: Long, pixel: Int) =
+        (bits(block, 16 + pixel, 16 + pixel) shl 1) or bits(block, pixel, pixel)
+
+    private fun offset(color: IntArray, delta: Int) = IntArray(3) { clamp(color[it] + delta) }
+
+    private fun decodeColor(block: Long): Array<IntArray> {
+        val differential = bits(block, 33, 33) == 1
+        val flip = bits(block, 32, 32) == 1
+        val bases: Array<IntArray>
+        if (differential) {
+            val r = bits(block, 63, 59)
+            val g = bits(block, 55, 51)
+            val b = bits(block, 47, 43)
+            val r2 = r + signed3(bits(block, 58, 56))
+            val g2 = g + signed3(bits(block, 50, 48))
+            val b2 = b + signed3(bits(block, 42, 40))
+            when {
+                r2 !in 0..31 -> return decodeT(block)
+                g2 !in 0..31 -> return decodeH(block)
+                b2 !in 0..31 -> return decodePlanar(block)
+            }
+            bases = arrayOf(
+                intArrayOf(extend5(r), extend5(g), extend5(b)),
+                intArrayOf(extend5(r2), extend5(g2), extend5(b2)),
+            )
+        } else {
+            bases = arrayOf(
+                intArrayOf(extend4(bits(block, 63, 60)), extend4(bits(block, 55, 52)), extend4(bits(block, 47, 44))),
+                intArrayOf(extend4(bits(block, 59, 56)), extend4(bits(block, 51, 48)), extend4(bits(block, 43, 40))),
+            )
+        }
+        val tables = intArrayOf(bits(block, 39, 37), bits(block, 36, 34))
+        return Array(16) { pixel ->
+            val x = pixel / 4
+            val y = pixel % 4
+            val half = if (flip) (if (y >= 2) 1 else 0) else (if (x >= 2) 1 else 0)
+            val (small, large) = colorModifiers[tables[half]].let { it[0] to it[1] }
+            val delta = when (pixelIndex(block, pixel)) {
+                0 -> small
+                1 -> large
+                2 -> -small
+                else -> -large
+            }
+            offset(bases[half], delta)
+        }
+    }
+
+    private fun decodeT(block: Long): Array<IntArray> {
+        val c1 = intArrayOf(
+            extend4((bits(block, 60, 59) shl 2) or bits(block, 57, 56)),
+            extend4(bits(block, 55, 52)),
+            extend4(bits(block, 51, 48)),
+        )
+        val c2 = intArrayOf(extend4(bits(block, 47, 44)), extend4(bits(block, 43, 40)), extend4(bits(block, 39, 36)))
+        val d = distances[(bits(block, 35, 34) shl 1) or bits(block, 32, 32)]
+        val paint = arrayOf(c1, offset(c2, d), c2, offset(c2, -d))
+        return Array(16) { paint[pixelIndex(block, it)] }
+    }
+
+    private fun decodeH(block: Long): Array<IntArray> {
+        val c1 = intArrayOf(
+            extend4(bits(block, 62, 59)),
+            extend4((bits(block, 58, 56) shl 1) or bits(block, 52, 52)),
+            extend4((bits(block, 51, 51) shl 3) or bits(block, 49, 47)),
+        )
+        val c2 = intArrayOf(extend4(bits(block, 46, 43)), extend4(bits(block, 42, 39)), extend4(bits(block, 38, 35)))
+        val v1 = (c1[0] shl 16) or (c1[1] shl 8) or c1[2]
+        val v2 = (c2[0] shl 16) or (c2[1] shl 8) or c2[2]
+        val d = distances[(bits(block, 34, 34) shl 2) or (bits(block, 32, 32) shl 1) or (if (v1 >= v2) 1 else 0)]
+        val paint = arrayOf(offset(c1, d), offset(c1, -d), offset(c2, d), offset(c2, -d))
+        return Array(16) { paint[pixelIndex(block, it)] }
+    }
+
+    private fun decodePlanar(block: Long): Array<IntArray> {
+        val o = intArrayOf(
+            extend6(bits(block, 62, 57)),
+            extend7((bits(block, 56, 56) shl 6) or bits(block, 54, 49)),
+            extend6((bits(block, 48, 48) shl 5) or (bits(block, 44, 43) shl 3) or bits(block, 41, 39)),
+        )
+        val h = intArrayOf(
+            extend6((bits(block, 38, 34) shl 1) or bits(block, 32, 32)),
+            extend7(bits(block, 31, 25)),
+            extend6(bits(block, 24, 19)),
+        )
+        val v = intArrayOf(extend6(bits(block, 18, 13)), extend7(bits(block, 12, 6)), extend6(bits(block, 5, 0)))
+        return Array(16) { pixel ->
+            val x = pixel / 4
+            val y = pixel % 4
+            IntArray(3) { c -> clamp((x * (h[c] - o[c]) + y * (v[c] - o[c]) + 4 * o[c] + 2) shr 2) }
+        }
+    }
+}
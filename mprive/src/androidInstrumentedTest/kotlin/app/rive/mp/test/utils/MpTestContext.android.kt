@@ -2,6 +2,7 @@ package app.rive.mp.test.utils
 
 import androidx.test.platform.app.InstrumentationRegistry
 import app.rive.mp.RiveNative
+import java.io.File
 
 /**
  * Android implementation of MpTestContext.
@@ -41,5 +42,10 @@ actual class MpTestContext {
                 initialized = true
             }
         }
+
+        actual fun tempFilePath(name: String): String {
+            val cacheDir = InstrumentationRegistry.getInstrumentation().targetContext.cacheDir
+            return File(cacheDir, name).apply { delete() }.absolutePath
+        }
     }
 }
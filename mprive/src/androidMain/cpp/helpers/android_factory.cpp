@@ -1,5 +1,6 @@
 #include "helpers/android_factory.hpp"
 #include "helpers/image_decode.hpp"
+#include "compressed_texture_cache.hpp"
 #include "render_context.hpp"
 #include "rive_log.hpp"
 
@@ -22,11 +23,24 @@ AndroidFactory::AndroidFactory(RenderContext* renderContext)
 rive::rcp<rive::RenderImage> AndroidFactory::decodeImage(
     rive::Span<const uint8_t> encodedBytes)
 {
+    // Warm start: a cached compressed texture needs no decode at all
+    uint64_t cacheKey = 0;
+    if (m_renderContext != nullptr && CompressedTextureCache::enabled())
+    {
+        cacheKey = CompressedTextureCache::keyFor(encodedBytes.data(), encodedBytes.size());
+        if (auto image = m_renderContext->makeCachedImage(cacheKey))
+        {
+            LOGD("AndroidFactory::decodeImage: Using cached compressed texture for %zu bytes",
+                 encodedBytes.size());
+            return image;
+        }
+    }
+
     LOGD("AndroidFactory::decodeImage: Decoding %zu bytes using Android BitmapFactory",
          encodedBytes.size());
     
     // Use Android's BitmapFactory through JNI
-    return renderImageFromAndroidDecode(encodedBytes, m_renderContext);
+    return renderImageFromAndroidDecode(encodedBytes, m_renderContext, cacheKey);
 }
 
 rive::rcp<rive::RenderBuffer> AndroidFactory::makeRenderBuffer(
@@ -29,6 +29,9 @@ class RenderContext;
  * 2. decodeImage() calls renderImageFromAndroidDecode() which uses JNI to
  *    invoke Android's BitmapFactory
  * 3. The decoded RGBA pixels are then uploaded to GPU via the riveContext
+ * 4. With the CompressedTextureCache enabled, a cached ETC2 texture for the
+ *    same bytes is uploaded instead and steps 2-3 are skipped; on a miss the
+ *    decoded pixels are transcoded and cached for next time
  * 
  * ## Thread Safety
  * 
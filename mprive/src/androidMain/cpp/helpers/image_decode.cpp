@@ -43,7 +43,8 @@ static jint SizeTToJInt(size_t value)
 
 rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     Span<const uint8_t> encodedBytes,
-    RenderContext* renderContext)
+    RenderContext* renderContext,
+    uint64_t compressedCacheKey)
 {
     if (renderContext == nullptr)
     {
@@ -185,6 +186,13 @@ rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     env->DeleteLocalRef(jPixels);
 
     // Create GPU render image using the render context
+    if (compressedCacheKey != 0)
+    {
+        return renderContext->makeCompressedImage(rawWidth,
+                                                  rawHeight,
+                                                  std::move(out),
+                                                  compressedCacheKey);
+    }
     return renderContext->makeImage(rawWidth, rawHeight, std::move(out));
 }
 
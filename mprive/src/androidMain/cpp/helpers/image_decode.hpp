@@ -20,11 +20,14 @@ class RenderContext;
  * @param encodedBytes The encoded bytes of the image (PNG, JPEG, WebP, etc.)
  * @param renderContext The RenderContext to create GPU render images.
  *                      Must not be null.
+ * @param compressedCacheKey If non-zero, the image is transcoded and stored
+ *                           in the CompressedTextureCache under this key.
  * @return A GPU-accelerated RenderImage, or nullptr if decoding failed.
  */
 rive::rcp<rive::RenderImage> renderImageFromAndroidDecode(
     rive::Span<const uint8_t> encodedBytes,
-    RenderContext* renderContext);
+    RenderContext* renderContext,
+    uint64_t compressedCacheKey = 0);
 
 /**
  * Helper functions for pixel format conversion.
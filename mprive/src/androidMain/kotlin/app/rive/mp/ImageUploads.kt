@@ -0,0 +1,38 @@
+package app.rive.mp
+
+/**
+ * The image upload thread of GL render contexts.
+ *
+ * Decoded images are uploaded and mip-mapped on a dedicated thread with an EGL context shared
+ * with the render context, so a large image does not stall the frame that decodes it. Until its
+ * upload is published at the start of a frame, an image draws as transparent. When the shared
+ * context cannot be created, images are uploaded on the render thread instead.
+ *
+ * The counts are process-wide and only grow, so compare them before and after an operation.
+ */
+object ImageUploads {
+    /**
+     * Whether render contexts initialized from now on may use an upload thread. Set to false to
+     * upload on the render thread, e.g. on drivers with broken shared contexts. Render contexts
+     * that already have an upload thread keep it.
+     */
+    var isEnabled: Boolean
+        get() = cppIsEnabled()
+        set(value) = cppSetEnabled(value)
+
+    /** Images queued on an upload thread since startup. */
+    val queuedCount: Long
+        get() = cppGetStats()[0]
+
+    /** Images whose upload finished and that replaced their placeholder, since startup. */
+    val publishedCount: Long
+        get() = cppGetStats()[1]
+
+    /** Images uploaded on the render thread because there was no upload thread, since startup. */
+    val synchronousCount: Long
+        get() = cppGetStats()[2]
+
+    private external fun cppSetEnabled(enabled: Boolean)
+    private external fun cppIsEnabled(): Boolean
+    private external fun cppGetStats(): LongArray
+}
@@ -0,0 +1,62 @@
+package app.rive.mp
+
+import java.io.File
+
+/**
+ * Optional ETC2 compression of images embedded in Rive files.
+ *
+ * Images are normally uploaded as RGBA8, so a 2048x2048 image costs 16 MB of GPU memory.
+ * When enabled, decoded images are transcoded to ETC2 (a quarter of the size, supported
+ * by every OpenGL ES 3.0 device) on the image upload thread, and the compressed mip chain
+ * is written to [cacheDir]. Loading the same image again uploads the cached texture
+ * directly, skipping both the decode and the encode.
+ *
+ * Entries are keyed by the image bytes and the encoder settings, so the cache never serves
+ * stale data; it can be cleared at any time by deleting the directory. Compression is lossy
+ * and applies to images loaded after [enable] is called.
+ *
+ * Call after [MpRive.init]. Images keep loading uncompressed if the render context has no
+ * upload thread.
+ */
+object TextureCompression {
+    @Volatile
+    private var cacheDir: File? = null
+
+    /** Whether images are being compressed and cached. */
+    val isEnabled: Boolean
+        get() = cacheDir != null
+
+    /**
+     * Compress images and cache them in [cacheDir], e.g.
+     * `File(context.cacheDir, "rive-textures")`. The directory is created if missing.
+     *
+     * @return Whether compression is enabled. False if [cacheDir] could not be created, in which
+     *    case images keep loading uncompressed.
+     */
+    fun enable(cacheDir: File): Boolean {
+        cacheDir.mkdirs()
+        if (!cppConfigure(cacheDir.absolutePath)) {
+            this.cacheDir = null
+            return false
+        }
+        this.cacheDir = cacheDir
+        return true
+    }
+
+    /** Stop compressing images. Existing cache entries are kept. */
+    fun disable() {
+        cppConfigure("")
+        cacheDir = null
+    }
+
+    /** Cache lookups that found a complete, valid compressed texture since startup. */
+    val cacheHits: Long
+        get() = cppGetCacheStats()[0]
+
+    /** Cache lookups that had to decode the image since startup. */
+    val cacheMisses: Long
+        get() = cppGetCacheStats()[1]
+
+    private external fun cppConfigure(directory: String): Boolean
+    private external fun cppGetCacheStats(): LongArray
+}
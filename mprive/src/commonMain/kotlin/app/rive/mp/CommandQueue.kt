@@ -1,11 +1,23 @@
 package app.rive.mp
 
 import app.rive.mp.core.Alignment
+import app.rive.mp.core.CommandClass
 import app.rive.mp.core.CommandQueueBridge
 import app.rive.mp.core.Fit
+import app.rive.mp.core.FrameTiming
+import app.rive.mp.core.InputEventKind
+import app.rive.mp.core.LatencyStats
+import app.rive.mp.core.LazyGpuResourceStats
 import app.rive.mp.core.Listeners
+import app.rive.mp.core.QueuePolicy
+import app.rive.mp.core.QueueStats
+import app.rive.mp.core.ReplayReport
+import app.rive.mp.core.SlowCommand
 import app.rive.mp.core.SpriteDrawCommand
 import app.rive.mp.core.createCommandQueueBridge
+import app.rive.mp.event.EventFilter
+import app.rive.mp.event.RiveEvent
+import app.rive.mp.event.RiveEventData
 import kotlinx.atomicfu.atomic
 import kotlinx.coroutines.CancellableContinuation
 import kotlinx.coroutines.flow.MutableSharedFlow
@@ -15,6 +27,8 @@ import kotlin.coroutines.cancellation.CancellationException
 import kotlin.coroutines.resume
 import kotlin.coroutines.resumeWithException
 import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+import kotlin.time.Duration.Companion.seconds
 
 /**
  * Type alias matching the upstream API.
@@ -40,19 +54,62 @@ const val COMMAND_QUEUE_TAG = "Rive/CQ"
  *
  * For Phase A, this is a minimal implementation focused on thread lifecycle management.
  *
- * @param renderContext The [RenderContext] to use for rendering. The CommandQueue takes ownership.
+ * A command queue either runs on its own thread with its own [RenderContext], or on a
+ * [CommandQueueHost] shared with other queues (Phase G.10).
+ *
  * @throws IllegalStateException If the command queue cannot be created.
  */
-class CommandQueue(
-    private val renderContext: RenderContext = createDefaultRenderContext(),
-    private val bridge: CommandQueueBridge = createCommandQueueBridge()
+class CommandQueue private constructor(
+    private val renderContext: RenderContext,
+    private val bridge: CommandQueueBridge,
+    private val host: CommandQueueHost?,
+    hostWeight: Int
 ) : RefCounted {
 
+    /**
+     * Creates a command queue with its own worker thread.
+     *
+     * @param renderContext The [RenderContext] to use for rendering. The CommandQueue takes
+     *    ownership.
+     */
+    constructor(
+        renderContext: RenderContext = createDefaultRenderContext(),
+        bridge: CommandQueueBridge = createCommandQueueBridge()
+    ) : this(renderContext, bridge, null, 1)
+
+    /**
+     * Creates a command queue that runs on a shared [host] thread and renders with the host's
+     * render context. The queue holds a reference to the host until it is disposed.
+     *
+     * @param host The host to run on.
+     * @param weight Commands this queue may run per scheduling round; see [setHostWeight].
+     */
+    constructor(
+        host: CommandQueueHost,
+        weight: Int = 1,
+        bridge: CommandQueueBridge = createCommandQueueBridge()
+    ) : this(host.renderContext, bridge, host, weight)
+
+    init {
+        require(hostWeight >= 1) { "Host weight must be >= 1, was $hostWeight" }
+    }
+
     companion object {
         /**
          * Maximum number of concurrent subscribers that can safely use this CommandQueue.
          */
         const val MAX_CONCURRENT_SUBSCRIBERS = 32
+
+        // Native ScheduledInputKind values (Phase G.5)
+        private const val SCHEDULED_TRIGGER = 0
+        private const val SCHEDULED_NUMBER = 1
+        private const val SCHEDULED_BOOLEAN = 2
+        private const val SCHEDULED_DELAY_EVENT = 3
+
+        // Native EventFilterMode values (Phase G.16)
+        private const val EVENT_FILTER_ALL = 0
+        private const val EVENT_FILTER_NONE = 1
+        private const val EVENT_FILTER_MATCHING = 2
     }
 
     /**
@@ -73,7 +130,12 @@ class CommandQueue(
      * The native pointer to the CommandServer C++ object, held in a reference-counted pointer.
      */
     private val cppPointer = RCPointer(
-        bridge.cppConstructor(renderContext.nativeObjectPointer),
+        if (host == null) {
+            bridge.cppConstructor(renderContext.nativeObjectPointer)
+        } else {
+            host.acquire(COMMAND_QUEUE_TAG)
+            bridge.cppConstructorHosted(host.pointer, hostWeight)
+        },
         COMMAND_QUEUE_TAG,
         ::dispose
     )
@@ -85,7 +147,12 @@ class CommandQueue(
      */
     private fun dispose(cppPointer: Long) {
         bridge.cppDelete(cppPointer)
-        renderContext.close()
+        // A hosted queue borrows the host's render context
+        if (host == null) {
+            renderContext.close()
+        } else {
+            host.release(COMMAND_QUEUE_TAG, "CommandQueue disposed")
+        }
         
         // Cancel and clear any pending JNI continuations so callers don't hang.
         pendingContinuations.values.toList().forEach { cont ->
@@ -117,6 +184,18 @@ class CommandQueue(
     )
     val settledFlow: SharedFlow<StateMachineHandle> = _settledFlow
 
+    /**
+     * Flow that emits the timing breakdown of every completed [draw] while enabled with
+     * [setFrameTimingEnabled] (Phase G.4). Slow collectors miss frames rather than stall the
+     * message loop.
+     */
+    private val _frameTimingFlow = MutableSharedFlow<FrameTiming>(
+        replay = 0,
+        extraBufferCapacity = MAX_CONCURRENT_SUBSCRIBERS,
+        onBufferOverflow = kotlinx.coroutines.channels.BufferOverflow.DROP_OLDEST
+    )
+    val frameTimingFlow: SharedFlow<FrameTiming> = _frameTimingFlow
+
     // =============================================================================
     // Property Flows (Phase D.4)
     // =============================================================================
@@ -245,8 +324,9 @@ class CommandQueue(
     
     /**
      * A monotonically increasing request ID used to identify JNI requests.
+     * Starts at 1; request ID 0 is reserved for fire-and-forget native commands.
      */
-    private val nextRequestID = atomic(0L)
+    private val nextRequestID = atomic(1L)
     
     /**
      * A monotonically increasing counter for generating unique draw keys.
@@ -296,7 +376,10 @@ class CommandQueue(
         pendingContinuations[requestID] = cont as CancellableContinuation<Any>
         
         cont.invokeOnCancellation {
-            pendingContinuations.remove(requestID)
+            // Phase G.2: Stop the native work too if it hasn't completed yet
+            if (pendingContinuations.remove(requestID) != null && cppPointer.refCount > 0) {
+                bridge.cppCancelRequest(cppPointer.pointer, requestID)
+            }
         }
         
         nativeFn(requestID)
@@ -797,6 +880,8 @@ class CommandQueue(
      * @param alignment How the artboard is aligned within the surface. Defaults to CENTER.
      * @param scaleFactor Scale factor for high DPI displays. Defaults to 1.0.
      * @param pointerID Identifier for multi-touch support. Defaults to 0.
+     * @param eventTimeNanos Monotonic time of the input event (e.g. `MotionEvent.eventTimeNanos` or
+     *   `System.nanoTime()`), used for input-to-present latency. Defaults to 0 (the enqueue time).
      *
      * @throws IllegalStateException If the CommandQueue has been released.
      *
@@ -813,7 +898,8 @@ class CommandQueue(
         fit: Fit = Fit.CONTAIN,
         alignment: Alignment = Alignment.CENTER,
         scaleFactor: Float = 1.0f,
-        pointerID: Int = 0
+        pointerID: Int = 0,
+        eventTimeNanos: Long = 0L
     ) {
         bridge.cppPointerMove(
             cppPointer.pointer,
@@ -825,7 +911,8 @@ class CommandQueue(
             surface.height.toFloat(),
             pointerID,
             x,
-            y
+            y,
+            eventTimeNanos
         )
     }
 
@@ -847,6 +934,8 @@ class CommandQueue(
      * @param alignment How the artboard is aligned within the surface. Defaults to CENTER.
      * @param scaleFactor Scale factor for high DPI displays. Defaults to 1.0.
      * @param pointerID Identifier for multi-touch support. Defaults to 0.
+     * @param eventTimeNanos Monotonic time of the input event (e.g. `MotionEvent.eventTimeNanos` or
+     *   `System.nanoTime()`), used for input-to-present latency. Defaults to 0 (the enqueue time).
      *
      * @throws IllegalStateException If the CommandQueue has been released.
      *
@@ -862,7 +951,8 @@ class CommandQueue(
         fit: Fit = Fit.CONTAIN,
         alignment: Alignment = Alignment.CENTER,
         scaleFactor: Float = 1.0f,
-        pointerID: Int = 0
+        pointerID: Int = 0,
+        eventTimeNanos: Long = 0L
     ) {
         bridge.cppPointerDown(
             cppPointer.pointer,
@@ -874,7 +964,8 @@ class CommandQueue(
             surface.height.toFloat(),
             pointerID,
             x,
-            y
+            y,
+            eventTimeNanos
         )
     }
 
@@ -896,6 +987,8 @@ class CommandQueue(
      * @param alignment How the artboard is aligned within the surface. Defaults to CENTER.
      * @param scaleFactor Scale factor for high DPI displays. Defaults to 1.0.
      * @param pointerID Identifier for multi-touch support. Defaults to 0.
+     * @param eventTimeNanos Monotonic time of the input event (e.g. `MotionEvent.eventTimeNanos` or
+     *   `System.nanoTime()`), used for input-to-present latency. Defaults to 0 (the enqueue time).
      *
      * @throws IllegalStateException If the CommandQueue has been released.
      *
@@ -911,7 +1004,8 @@ class CommandQueue(
         fit: Fit = Fit.CONTAIN,
         alignment: Alignment = Alignment.CENTER,
         scaleFactor: Float = 1.0f,
-        pointerID: Int = 0
+        pointerID: Int = 0,
+        eventTimeNanos: Long = 0L
     ) {
         bridge.cppPointerUp(
             cppPointer.pointer,
@@ -923,7 +1017,8 @@ class CommandQueue(
             surface.height.toFloat(),
             pointerID,
             x,
-            y
+            y,
+            eventTimeNanos
         )
     }
 
@@ -941,6 +1036,8 @@ class CommandQueue(
      * @param alignment How the artboard is aligned within the surface. Defaults to CENTER.
      * @param scaleFactor Scale factor for high DPI displays. Defaults to 1.0.
      * @param pointerID Identifier for multi-touch support. Defaults to 0.
+     * @param eventTimeNanos Monotonic time of the input event (e.g. `MotionEvent.eventTimeNanos` or
+     *   `System.nanoTime()`), used for input-to-present latency. Defaults to 0 (the enqueue time).
      *
      * @throws IllegalStateException If the CommandQueue has been released.
      *
@@ -953,7 +1050,8 @@ class CommandQueue(
         fit: Fit = Fit.CONTAIN,
         alignment: Alignment = Alignment.CENTER,
         scaleFactor: Float = 1.0f,
-        pointerID: Int = 0
+        pointerID: Int = 0,
+        eventTimeNanos: Long = 0L
     ) {
         // For exit, we pass 0,0 as coordinates since they're not meaningful
         bridge.cppPointerExit(
@@ -966,7 +1064,8 @@ class CommandQueue(
             surface.height.toFloat(),
             pointerID,
             0f,
-            0f
+            0f,
+            eventTimeNanos
         )
     }
 
@@ -2203,6 +2302,773 @@ class CommandQueue(
         bridge.cppUnregisterFont(cppPointer.pointer, name)
     }
 
+    // =============================================================================
+    // Phase G.1: Queue Backpressure
+    // =============================================================================
+
+    /**
+     * Set the capacity and overflow policy of a [CommandClass].
+     *
+     * By default, [CommandClass.ADVANCE], [CommandClass.POINTER] and [CommandClass.DRAW] are
+     * bounded with [OverflowPolicy.COALESCE], so a stalled worker (GPU hang, slow import) does not
+     * accumulate a backlog that is replayed in a burst once it recovers. [CommandClass.ORDERED]
+     * only accepts [OverflowPolicy.UNBOUNDED] and [OverflowPolicy.BLOCK].
+     *
+     * @param commandClass The class of commands to configure.
+     * @param policy The capacity and overflow policy.
+     * @return true if the policy was applied, false if it is not allowed for the class.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun setQueuePolicy(commandClass: CommandClass, policy: QueuePolicy): Boolean =
+        bridge.cppSetQueuePolicy(
+            cppPointer.pointer,
+            commandClass.value,
+            policy.policy.value,
+            policy.capacity
+        )
+
+    /**
+     * Get a snapshot of the queue counters of every [CommandClass].
+     *
+     * @return The counters, keyed by command class.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun getQueueStats(): Map<CommandClass, QueueStats> {
+        val values = bridge.cppGetQueueStats(cppPointer.pointer)
+        return CommandClass.entries
+            .filter { (it.value + 1) * QueueStats.FIELD_COUNT <= values.size }
+            .associateWith { QueueStats.fromArray(values, it.value * QueueStats.FIELD_COUNT) }
+    }
+
+    /**
+     * Reset the cumulative queue counters. Pending counts are preserved.
+     *
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun resetQueueStats() = bridge.cppResetQueueStats(cppPointer.pointer)
+
+    // =============================================================================
+    // Phase G.2: Request Cancellation
+    // =============================================================================
+
+    /**
+     * Cancel all pending work that targets a file: queued introspection queries and imports are
+     * removed from the queue, and their suspended callers are cancelled. A request already being
+     * executed is cancelled too unless it has produced its result; callers whose requests
+     * completed are never cancelled.
+     *
+     * Cancelling the coroutine that awaits a single request (e.g. [loadFile]) already cancels the
+     * native request; use these when leaving a screen to drop everything queued for its resources.
+     * Deletes, setters and registrations are never cancelled.
+     *
+     * @param fileHandle The file whose pending commands should be cancelled.
+     * @return The number of commands cancelled.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun cancelAllFor(fileHandle: FileHandle): Int =
+        bridge.cppCancelAllFor(cppPointer.pointer, fileHandle.handle)
+
+    /**
+     * Cancel all pending queries targeting an artboard.
+     *
+     * @param artboardHandle The artboard whose pending commands should be cancelled.
+     * @return The number of commands cancelled.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @see cancelAllFor
+     */
+    @Throws(IllegalStateException::class)
+    fun cancelAllFor(artboardHandle: ArtboardHandle): Int =
+        bridge.cppCancelAllFor(cppPointer.pointer, artboardHandle.handle)
+
+    /**
+     * Cancel all pending queries, advances, pointer moves and draws targeting a state machine.
+     *
+     * @param smHandle The state machine whose pending commands should be cancelled.
+     * @return The number of commands cancelled.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @see cancelAllFor
+     */
+    @Throws(IllegalStateException::class)
+    fun cancelAllFor(smHandle: StateMachineHandle): Int =
+        bridge.cppCancelAllFor(cppPointer.pointer, smHandle.handle)
+
+    /**
+     * Cancel all pending property queries targeting a view model instance.
+     *
+     * @param vmiHandle The view model instance whose pending commands should be cancelled.
+     * @return The number of commands cancelled.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @see cancelAllFor
+     */
+    @Throws(IllegalStateException::class)
+    fun cancelAllFor(vmiHandle: ViewModelInstanceHandle): Int =
+        bridge.cppCancelAllFor(cppPointer.pointer, vmiHandle.handle)
+
+    /**
+     * Hold back command execution, e.g. to observe queue state deterministically in tests.
+     * Commands are still enqueued, coalesced and cancelled while paused.
+     *
+     * ⚠️ Suspending requests do not complete while the worker is paused; resume it before
+     * awaiting them.
+     *
+     * @param paused Whether the worker should stop taking commands.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    internal fun setWorkerPaused(paused: Boolean) =
+        bridge.cppSetWorkerPaused(cppPointer.pointer, paused)
+
+    /**
+     * Hold the worker after it takes the next command and before it executes it, e.g. to cancel
+     * an in-flight command deterministically in tests.
+     *
+     * ⚠️ As with [setWorkerPaused], nothing completes while held; release it before awaiting.
+     *
+     * @param hold Whether the worker should wait before executing.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    internal fun setHoldInFlight(hold: Boolean) =
+        bridge.cppSetHoldInFlight(cppPointer.pointer, hold)
+
+    // =============================================================================
+    // Phase G.3: Stall Watchdog
+    // =============================================================================
+
+    /**
+     * Set the duration above which a command is reported as slow.
+     *
+     * Commands that exceed the threshold are logged and kept in a small ring (see
+     * [getSlowCommands]). A watchdog thread also flags a command that is still running past the
+     * threshold, so a hung import or GPU call is reported while it is happening rather than after.
+     * Every command is wrapped in a system trace section named after its type.
+     *
+     * @param threshold The slow command threshold, or [Duration.ZERO] to disable the watchdog.
+     *   Defaults to 100ms.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun setSlowCommandThreshold(threshold: Duration) {
+        require(!threshold.isNegative()) { "Slow command threshold must be >= 0, was $threshold" }
+        bridge.cppSetSlowCommandThreshold(cppPointer.pointer, threshold.inWholeMilliseconds)
+    }
+
+    /**
+     * Get the most recent slow or stalled commands, oldest first.
+     *
+     * @return Up to the last 32 slow commands.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun getSlowCommands(): List<SlowCommand> {
+        val values = bridge.cppGetSlowCommands(cppPointer.pointer)
+        return (0 until values.size / SlowCommand.FIELD_COUNT).map { index ->
+            SlowCommand.fromArray(values, index * SlowCommand.FIELD_COUNT, bridge::cppGetCommandTypeName)
+        }
+    }
+
+    /**
+     * Get the total number of slow commands seen, including those no longer held by
+     * [getSlowCommands].
+     *
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun getSlowCommandCount(): Long = bridge.cppGetSlowCommandCount(cppPointer.pointer)
+
+    // =============================================================================
+    // Phase G.4: Input-to-Present Latency
+    // =============================================================================
+
+    /**
+     * Get the input-to-present latency distribution of every [InputEventKind].
+     *
+     * An input is counted once a [draw] of its state machine is presented after an
+     * [advanceStateMachine] that consumed it. Pass the event timestamp to the pointer methods
+     * (`eventTimeNanos`) to include the time spent before the event reached the queue.
+     * Per-frame breakdowns are available from [frameTimingFlow] after [setFrameTimingEnabled].
+     *
+     * @return The distributions, keyed by input kind.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun getInputLatencyStats(): Map<InputEventKind, LatencyStats> {
+        val values = bridge.cppGetInputLatencyStats(cppPointer.pointer)
+        return InputEventKind.entries
+            .filter { (it.value + 1) * LatencyStats.FIELD_COUNT <= values.size }
+            .associateWith { LatencyStats.fromArray(values, it.value * LatencyStats.FIELD_COUNT) }
+    }
+
+    /**
+     * Clear all input latency samples.
+     *
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun resetInputLatencyStats() = bridge.cppResetInputLatencyStats(cppPointer.pointer)
+
+    /**
+     * Enable or disable the per-frame timing breakdown emitted on [frameTimingFlow].
+     *
+     * Off by default, so draws do not call back into Kotlin every frame unless a profiler or
+     * frame pacing monitor is collecting. Input latency stats are recorded either way.
+     *
+     * @param enabled Whether completed draws report their timing.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun setFrameTimingEnabled(enabled: Boolean) =
+        bridge.cppSetFrameTimingEnabled(cppPointer.pointer, enabled)
+
+    // =============================================================================
+    // Phase G.5: Scheduled Inputs
+    // =============================================================================
+
+    /**
+     * Fire a trigger after a delay, without a Kotlin timer or a round trip when it fires.
+     *
+     * The delay runs in the state machine's animation time: it only elapses while the state
+     * machine is advanced with [advanceStateMachine], and the advance is split so the trigger
+     * lands at its exact animation time rather than on the next frame.
+     *
+     * With [onEvent], the trigger is instead fired [delay] after every report of the named event,
+     * measured from when the event occurred within the advance. It stays armed until cancelled.
+     *
+     * Schedules are dropped when the state machine is deleted. Missing or mistyped inputs are
+     * logged and skipped when they fire.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param inputName The name of the trigger input.
+     * @param delay The delay in animation time. Must not be negative.
+     * @param onEvent Name of an event that arms the trigger each time it is reported.
+     * @return A handle for [cancelScheduledInput].
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun scheduleTrigger(
+        smHandle: StateMachineHandle,
+        inputName: String,
+        delay: Duration,
+        onEvent: String? = null
+    ): ScheduledInputHandle =
+        scheduleInput(smHandle, SCHEDULED_TRIGGER, inputName, 0f, false, delay, onEvent)
+
+    /**
+     * Set a number input after a delay in animation time.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param inputName The name of the number input.
+     * @param value The value to set.
+     * @param delay The delay in animation time. Must not be negative.
+     * @param onEvent Name of an event that arms the input each time it is reported.
+     * @return A handle for [cancelScheduledInput].
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @see scheduleTrigger
+     */
+    @Throws(IllegalStateException::class)
+    fun scheduleNumberInput(
+        smHandle: StateMachineHandle,
+        inputName: String,
+        value: Float,
+        delay: Duration,
+        onEvent: String? = null
+    ): ScheduledInputHandle =
+        scheduleInput(smHandle, SCHEDULED_NUMBER, inputName, value, false, delay, onEvent)
+
+    /**
+     * Set a boolean input after a delay in animation time.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param inputName The name of the boolean input.
+     * @param value The value to set.
+     * @param delay The delay in animation time. Must not be negative.
+     * @param onEvent Name of an event that arms the input each time it is reported.
+     * @return A handle for [cancelScheduledInput].
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @see scheduleTrigger
+     */
+    @Throws(IllegalStateException::class)
+    fun scheduleBooleanInput(
+        smHandle: StateMachineHandle,
+        inputName: String,
+        value: Boolean,
+        delay: Duration,
+        onEvent: String? = null
+    ): ScheduledInputHandle =
+        scheduleInput(smHandle, SCHEDULED_BOOLEAN, inputName, 0f, value, delay, onEvent)
+
+    /**
+     * Hold back every report of an event until [delay] after it occurred.
+     *
+     * The delay runs in animation time, like [scheduleTrigger]: a delayed event is returned by
+     * [getReportedEvents] after the advance that reaches its delivery time, with an
+     * [RiveEvent.delay] measured from that time. Advances are not split for it. The delay stays
+     * set until cancelled, and reactions armed with `onEvent` still fire when the event occurs.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param eventName The name of the event to delay.
+     * @param delay The delay in animation time. Must not be negative.
+     * @return A handle for [cancelScheduledInput], which also drops the events still held.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun delayEvent(
+        smHandle: StateMachineHandle,
+        eventName: String,
+        delay: Duration
+    ): ScheduledInputHandle =
+        scheduleInput(smHandle, SCHEDULED_DELAY_EVENT, eventName, 0f, false, delay, null)
+
+    /**
+     * Cancel a scheduled input, event reaction or event delay. Inputs that have already fired
+     * are ignored.
+     *
+     * @param handle The handle returned by one of the schedule methods.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun cancelScheduledInput(handle: ScheduledInputHandle) =
+        bridge.cppCancelScheduledInput(cppPointer.pointer, handle.handle)
+
+    private fun scheduleInput(
+        smHandle: StateMachineHandle,
+        kind: Int,
+        inputName: String,
+        floatValue: Float,
+        boolValue: Boolean,
+        delay: Duration,
+        onEvent: String?
+    ): ScheduledInputHandle {
+        require(!delay.isNegative()) { "Schedule delay must be >= 0, was $delay" }
+        val delaySeconds = delay.inWholeMicroseconds / 1_000_000f
+        return ScheduledInputHandle(
+            bridge.cppScheduleInput(
+                cppPointer.pointer,
+                smHandle.handle,
+                kind,
+                inputName,
+                floatValue,
+                boolValue,
+                delaySeconds,
+                onEvent.orEmpty()
+            )
+        )
+    }
+
+    // =============================================================================
+    // Phase G.6: Command Capture and Replay
+    // =============================================================================
+
+    /**
+     * Start recording every command sent to this queue, so the session can be replayed with
+     * [replayCommandCapture] to reproduce a performance problem or compare builds.
+     *
+     * Commands are stored with their enqueue time; file and asset bytes are stored once per
+     * distinct content. Synchronous artboard and state machine creates are recorded too. Start
+     * the capture before loading any file, e.g. right after creating the queue: the replay starts
+     * from an empty server, so [replayCommandCapture] rejects a capture started mid-session.
+     *
+     * With a non-zero [window], the recorder keeps only the last [window] of frame, pointer and
+     * draw commands, and every other command, so it can stay on in the field and be dumped when
+     * a jank is detected. Restarting discards the previous recording.
+     *
+     * @param window How much of the frame stream to keep, or [Duration.ZERO] to keep everything.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun startCommandCapture(window: Duration = Duration.ZERO) {
+        require(!window.isNegative()) { "Capture window must be >= 0, was $window" }
+        bridge.cppStartCommandCapture(cppPointer.pointer, window.inWholeMilliseconds)
+    }
+
+    /**
+     * Stop recording and write the capture to [path].
+     *
+     * @param path The file to write, or an empty string to discard the recording.
+     * @return True if a capture was running and was written.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun stopCommandCapture(path: String): Boolean =
+        bridge.cppStopCommandCapture(cppPointer.pointer, path)
+
+    /**
+     * Replay a capture written by [stopCommandCapture] on a separate headless command server,
+     * and report how long each command type took.
+     *
+     * The replay does not touch this queue's objects and has no render context, so draws are
+     * skipped. This call blocks until the replay completes; do not call it on the main thread.
+     *
+     * @param path The capture file.
+     * @param paced True to enqueue commands at their recorded times, false to replay as fast as
+     *   possible.
+     * @return The timing report, or null if the file is missing, is not a capture, or was
+     *   captured mid-session (see [startCommandCapture]). The reason is logged.
+     */
+    fun replayCommandCapture(path: String, paced: Boolean = false): ReplayReport? {
+        val values = bridge.cppReplayCommandCapture(path, paced)
+        if (values.size < ReplayReport.HEADER_FIELD_COUNT) {
+            return null
+        }
+        return ReplayReport.fromArray(values, bridge::cppGetCommandTypeName)
+    }
+
+    // =============================================================================
+    // Phase G.9: Shared Files
+    // =============================================================================
+
+    /**
+     * Attach a file that a command queue in this process has already loaded, without importing
+     * it again. The file is shared with the other queue; artboards and state machines created
+     * from the new handle belong to this queue.
+     *
+     * [loadFile] already shares identical bytes transparently; this lets a queue that only has
+     * the key (e.g. from [sharedFileKey]) reuse the file. Files are only shared between queues
+     * that render with the same GPU context, or that are both headless.
+     *
+     * @param key The key from [sharedFileKey].
+     * @return A handle to the file, deleted with [deleteFile] like any other.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @throws CancellationException If the operation is cancelled.
+     * @throws IllegalArgumentException If no compatible queue has loaded the file.
+     */
+    @Throws(IllegalStateException::class, CancellationException::class, IllegalArgumentException::class)
+    suspend fun attachSharedFile(key: Long): FileHandle {
+        return suspendNativeRequest { requestID ->
+            bridge.cppAttachSharedFile(cppPointer.pointer, requestID, key)
+        }
+    }
+
+    /**
+     * Compute the key [attachSharedFile] looks up a file by.
+     *
+     * @param bytes The Rive file bytes.
+     * @return The content key.
+     */
+    fun sharedFileKey(bytes: ByteArray): Long = bridge.cppGetFileContentKey(bytes)
+
+    /**
+     * Get the number of distinct files currently shared across all command queues in the process.
+     */
+    fun getSharedFileCount(): Int = bridge.cppGetSharedFileCount()
+
+    // =============================================================================
+    // Phase G.10: Shared Host Thread
+    // =============================================================================
+
+    /**
+     * Whether this queue runs on a [CommandQueueHost] rather than its own thread.
+     */
+    val isHosted: Boolean
+        get() = host != null
+
+    /**
+     * Change how many commands this queue may run per scheduling round on its [CommandQueueHost].
+     * Raise it for the queue driving the visible screen, lower it for background ones. Has no
+     * effect on a queue with its own thread.
+     *
+     * @param weight The new weight, at least 1.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun setHostWeight(weight: Int) {
+        require(weight >= 1) { "Host weight must be >= 1, was $weight" }
+        bridge.cppSetHostWeight(cppPointer.pointer, weight)
+    }
+
+    // =============================================================================
+    // Phase G.11: Registered Views
+    // =============================================================================
+
+    /**
+     * Register a view with the server's frame loop. Instead of sending [advanceStateMachine] and
+     * [draw] for every view on every frame, send one [tickFrame] per frame: the server advances
+     * each registered view's state machine once and draws the view, skipping views that have
+     * settled until an input, property change or pointer event wakes them. A command only wakes
+     * the views that use its state machine, artboard, or bound view model instance.
+     *
+     * Views are not reported on [frameTimingFlow]; the frame loop would send one per tick.
+     *
+     * Call again with [view] to update the parameters, e.g. after the surface is resized.
+     *
+     * @param artboardHandle The artboard to draw.
+     * @param smHandle The state machine to advance, or null to advance the artboard on its own.
+     * @param surface The surface to draw into.
+     * @param fit How the artboard is fit to the surface.
+     * @param alignment How the artboard is aligned in the surface.
+     * @param clearColor The background color, 0xAARRGGBB.
+     * @param scaleFactor The layout scale factor.
+     * @param view The view to update, or null to register a new one.
+     * @return The view handle.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun registerView(
+        artboardHandle: ArtboardHandle,
+        smHandle: StateMachineHandle?,
+        surface: RiveSurface,
+        fit: Fit = Fit.CONTAIN,
+        alignment: Alignment = Alignment.CENTER,
+        clearColor: Int = 0xFF000000.toInt(),
+        scaleFactor: Float = 1.0f,
+        view: ViewHandle? = null
+    ): ViewHandle = ViewHandle(
+        bridge.cppRegisterView(
+            cppPointer.pointer,
+            view?.handle ?: 0L,
+            artboardHandle.handle,
+            smHandle?.handle ?: 0L,
+            surface.surfaceNativePointer,
+            surface.renderTargetPointer.pointer,
+            surface.drawKey.handle,
+            surface.width,
+            surface.height,
+            fit.ordinal.toByte(),
+            alignment.ordinal.toByte(),
+            scaleFactor,
+            clearColor
+        )
+    )
+
+    /**
+     * Remove a view registered with [registerView]. Views are also dropped when their artboard
+     * or state machine is deleted.
+     *
+     * @param view The view handle.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun unregisterView(view: ViewHandle) =
+        bridge.cppUnregisterView(cppPointer.pointer, view.handle)
+
+    /**
+     * Run one frame of the server's frame loop: advance and draw every registered view that is
+     * not settled. Ticks still pending when the next one arrives are merged; they are never
+     * dropped, even when the advance class drops its oldest commands.
+     *
+     * @param deltaTimeSeconds Seconds since the previous tick.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun tickFrame(deltaTimeSeconds: Float) {
+        val deltaTimeNs = (deltaTimeSeconds * 1_000_000_000L).toLong()
+        bridge.cppFrameTick(cppPointer.pointer, deltaTimeNs)
+    }
+
+    /**
+     * True when every registered view has settled and nothing that could wake one has been sent
+     * since. A frame loop may skip [tickFrame] while this holds.
+     */
+    val viewsIdle: Boolean
+        get() = bridge.cppViewsIdle(cppPointer.pointer)
+
+    // =============================================================================
+    // Phase G.13: Lazy GPU Resources
+    // =============================================================================
+
+    /**
+     * Import files without creating their GPU render objects up front.
+     *
+     * Once enabled, files loaded afterwards only record the paths, paints and mesh buffers of their
+     * artboards; each is created the first time it is drawn and released again after it has not
+     * been drawn for a while. Files with many artboards, of which only a few are shown, then cost
+     * GPU memory only for what is on screen. Images and gradients are still created at import.
+     *
+     * Files loaded before the call are unaffected. Has no effect without a render context.
+     *
+     * @param enabled True to import lazily.
+     * @param idleRelease How long an object may go undrawn before it is released. Idle objects are
+     *   looked for at most once a second, at the end of a frame. Defaults to 10 seconds.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun setLazyGpuResources(enabled: Boolean, idleRelease: Duration = 10.seconds) {
+        require(!idleRelease.isNegative()) { "Idle release must be >= 0, was $idleRelease" }
+        bridge.cppSetLazyGpuResources(cppPointer.pointer, enabled, idleRelease.inWholeNanoseconds)
+    }
+
+    /**
+     * Counters of the render objects created lazily since startup.
+     *
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun lazyGpuResourceStats(): LazyGpuResourceStats =
+        LazyGpuResourceStats.fromArray(bridge.cppGetLazyGpuResourceStats(cppPointer.pointer))
+
+    // =============================================================================
+    // Phase G.14: Partial Import
+    // =============================================================================
+
+    /**
+     * Load only some artboards of a Rive file.
+     *
+     * The named artboards, and the artboards they nest, are cut out of [bytes] before import, so
+     * import time and memory scale with what the screen uses rather than with the whole file.
+     * Assets, view models and enums are always kept. Artboards reached only through data-bound
+     * artboard properties are not followed; name them too.
+     *
+     * The returned file behaves like one loaded with [loadFile] that only contains these
+     * artboards; artboard indices refer to the kept artboards in file order. To use more
+     * artboards later, load the file again with a wider selection.
+     *
+     * @param bytes The Rive file bytes to load.
+     * @param artboardNames The artboards to import. Empty imports the whole file.
+     * @return A handle to the loaded file.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @throws CancellationException If the operation is cancelled.
+     * @throws IllegalArgumentException If the file cannot be loaded or an artboard is not found.
+     */
+    @Throws(IllegalStateException::class, CancellationException::class, IllegalArgumentException::class)
+    suspend fun loadFile(bytes: ByteArray, artboardNames: Collection<String>): FileHandle {
+        if (artboardNames.isEmpty()) {
+            return loadFile(bytes)
+        }
+        return suspendNativeRequest { requestID ->
+            bridge.cppLoadFileArtboards(cppPointer.pointer, requestID, bytes, artboardNames.toTypedArray())
+        }
+    }
+
+    // =============================================================================
+    // Phase G.15: Bulk View Model Instances
+    // =============================================================================
+
+    /**
+     * Create [count] instances of a named ViewModel with one command, for lists and grids that
+     * bind many rows to the same view model.
+     *
+     * Returns once the command has checked the file, view model and seed. Each instance is only
+     * created the first time a command uses its handle, from the view model's default instance,
+     * so rows that are never touched cost no instance storage.
+     *
+     * With a [seed], its top-level number, string, boolean, enum and color values, as of when
+     * the command runs, are copied into every instance. Lists, nested instances, images and
+     * artboards keep their defaults.
+     *
+     * @param fileHandle The handle of the file containing the ViewModel.
+     * @param viewModelName The name of the ViewModel to create instances of.
+     * @param count The number of instances to create.
+     * @param seed An instance of the same ViewModel to copy values from, or null for defaults.
+     * @return The contiguous range of the created instances' handles.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @throws CancellationException If the operation is cancelled.
+     * @throws IllegalArgumentException If [count] is not positive, the file handle is invalid,
+     *   the ViewModel is not found, or the seed is not a valid instance.
+     */
+    @Throws(IllegalStateException::class, CancellationException::class, IllegalArgumentException::class)
+    suspend fun createViewModelInstances(
+        fileHandle: FileHandle,
+        viewModelName: String,
+        count: Int,
+        seed: ViewModelInstanceHandle? = null
+    ): ViewModelInstanceHandleRange {
+        require(count > 0) { "count must be positive, was $count" }
+        val first: ViewModelInstanceHandle = suspendNativeRequest { requestID ->
+            bridge.cppCreateVMIBatch(
+                cppPointer.pointer,
+                requestID,
+                fileHandle.handle,
+                viewModelName,
+                count,
+                seed?.handle ?: 0L
+            )
+        }
+        return ViewModelInstanceHandleRange(first.handle, count)
+    }
+
+    // =============================================================================
+    // Phase F: Reported Events
+    // =============================================================================
+
+    /**
+     * Get the number of events reported by the last [advanceStateMachine] of a state machine.
+     *
+     * Events fired by every step of the advance are counted, including steps a scheduled input
+     * split it into. With an [EventFilter], only the events that pass it are counted.
+     *
+     * @param smHandle The handle of the state machine.
+     * @return The number of reported events.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @throws CancellationException If the operation is cancelled.
+     * @throws IllegalArgumentException If the state machine handle is invalid.
+     */
+    @Throws(IllegalStateException::class, CancellationException::class, IllegalArgumentException::class)
+    suspend fun getReportedEventCount(smHandle: StateMachineHandle): Int {
+        return suspendNativeRequest { requestID ->
+            bridge.cppGetReportedEventCount(cppPointer.pointer, requestID, smHandle.handle)
+        }
+    }
+
+    /**
+     * Get an event reported by the last [advanceStateMachine] of a state machine.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param index The index of the event, from 0 until [getReportedEventCount].
+     * @return The event; see [RiveEvent] for its subtypes.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @throws CancellationException If the operation is cancelled.
+     * @throws IllegalArgumentException If the state machine handle or index is invalid.
+     */
+    @Throws(IllegalStateException::class, CancellationException::class, IllegalArgumentException::class)
+    suspend fun getReportedEventAt(smHandle: StateMachineHandle, index: Int): RiveEvent {
+        return suspendNativeRequest { requestID ->
+            bridge.cppGetReportedEventAt(cppPointer.pointer, requestID, smHandle.handle, index)
+        }
+    }
+
+    /**
+     * Get every event reported by the last [advanceStateMachine] of a state machine, in the
+     * order they fired.
+     *
+     * @param smHandle The handle of the state machine.
+     * @return The reported events.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     * @throws CancellationException If the operation is cancelled.
+     * @throws IllegalArgumentException If the state machine handle is invalid.
+     * @see getReportedEventAt
+     */
+    @Throws(IllegalStateException::class, CancellationException::class, IllegalArgumentException::class)
+    suspend fun getReportedEvents(smHandle: StateMachineHandle): List<RiveEvent> =
+        List(getReportedEventCount(smHandle)) { index -> getReportedEventAt(smHandle, index) }
+
+    // =============================================================================
+    // Phase G.16: Event Filters
+    // =============================================================================
+
+    /**
+     * Choose which events reported by a state machine are delivered to the client.
+     *
+     * Most apps listen to a few of the events a file reports. Filtered-out events are dropped on
+     * the command server before any message is built for them, so they cost neither a string
+     * copy nor a queue round trip. The filter is dropped with the state machine.
+     *
+     * @param smHandle The state machine whose events to filter.
+     * @param filter The events to deliver; [EventFilter.All] removes the filter.
+     * @throws IllegalStateException If the CommandQueue has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun setEventFilter(smHandle: StateMachineHandle, filter: EventFilter) {
+        when (filter) {
+            EventFilter.All -> bridge.cppSetEventFilter(
+                cppPointer.pointer, smHandle.handle, EVENT_FILTER_ALL, emptyArray(), IntArray(0)
+            )
+            EventFilter.None -> bridge.cppSetEventFilter(
+                cppPointer.pointer, smHandle.handle, EVENT_FILTER_NONE, emptyArray(), IntArray(0)
+            )
+            is EventFilter.Matching -> bridge.cppSetEventFilter(
+                cppPointer.pointer,
+                smHandle.handle,
+                EVENT_FILTER_MATCHING,
+                filter.names.toTypedArray(),
+                filter.types.map { it.value.toInt() }.toIntArray()
+            )
+        }
+    }
+
     // =============================================================================
     // JNI Callbacks (called from C++)
     // =============================================================================
@@ -2678,6 +3544,98 @@ class CommandQueue(
         }
     }
 
+    // =============================================================================
+    // JNI Callbacks for Reported Events (Phase F)
+    // =============================================================================
+
+    /**
+     * Called from C++ when the reported event count has been retrieved.
+     *
+     * @param requestID The request ID that identifies the waiting coroutine.
+     * @param count The number of reported events.
+     */
+    @Suppress("unused")  // Called from JNI
+    private fun onEventCountResult(requestID: Long, count: Int) {
+        val continuation = pendingContinuations.remove(requestID)
+        if (continuation != null) {
+            @Suppress("UNCHECKED_CAST")
+            val typedCont = continuation as CancellableContinuation<Int>
+            typedCont.resume(count)
+        } else {
+            RiveLog.w(COMMAND_QUEUE_TAG) {
+                "Received event count callback for unknown requestID: $requestID"
+            }
+        }
+    }
+
+    /**
+     * Called from C++ when a reported event has been retrieved.
+     *
+     * @param requestID The request ID that identifies the waiting coroutine.
+     * @param name The event name.
+     * @param typeCode The event type key (128=General, 131=OpenURL, 407=Audio).
+     * @param delay Seconds between the event and the end of the advance.
+     * @param url The URL of an OpenURL event, empty otherwise.
+     * @param targetValue The target of an OpenURL event.
+     * @param assetId The asset ID of an Audio event, 0 otherwise.
+     * @param propertyNames Names of the custom properties.
+     * @param propertyValues Values of the custom properties (Boolean, Float or String).
+     */
+    @Suppress("unused")  // Called from JNI
+    private fun onEventDataResult(
+        requestID: Long,
+        name: String,
+        typeCode: Int,
+        delay: Float,
+        url: String,
+        targetValue: Int,
+        assetId: Int,
+        propertyNames: Array<String>,
+        propertyValues: Array<Any>
+    ) {
+        val continuation = pendingContinuations.remove(requestID)
+        if (continuation != null) {
+            val event = RiveEventData(
+                name = name,
+                typeCode = typeCode.toShort(),
+                delay = delay,
+                url = url,
+                targetValue = targetValue,
+                assetId = assetId.toUInt(),
+                properties = propertyNames.zip(propertyValues).toMap()
+            ).toRiveEvent()
+            @Suppress("UNCHECKED_CAST")
+            val typedCont = continuation as CancellableContinuation<RiveEvent>
+            typedCont.resume(event)
+        } else {
+            RiveLog.w(COMMAND_QUEUE_TAG) {
+                "Received event data callback for unknown requestID: $requestID"
+            }
+        }
+    }
+
+    /**
+     * Called from C++ when a reported event query has failed.
+     *
+     * @param requestID The request ID that identifies the waiting coroutine.
+     * @param error The error message.
+     */
+    @Suppress("unused")  // Called from JNI
+    private fun onEventOperationError(requestID: Long, error: String) {
+        val continuation = pendingContinuations.remove(requestID)
+        if (continuation != null) {
+            @Suppress("UNCHECKED_CAST")
+            val typedCont = continuation as CancellableContinuation<Any>
+            typedCont.resumeWithException(
+                IllegalArgumentException("Event operation failed: $error")
+            )
+        } else {
+            RiveLog.w(COMMAND_QUEUE_TAG) {
+                "Event operation error (requestID=$requestID): $error"
+            }
+        }
+    }
+
     // =============================================================================
     // JNI Callbacks for ViewModelInstance (Phase D.1)
     // =============================================================================
@@ -3389,4 +4347,63 @@ class CommandQueue(
             }
         }
     }
-}
\ No newline at end of file
+
+    // =============================================================================
+    // JNI Callbacks for Request Cancellation (Phase G.2)
+    // =============================================================================
+
+    /**
+     * Called from C++ when a request was cancelled before it produced a result.
+     * This cancels the suspended coroutine, if it is still waiting.
+     *
+     * @param requestID The request ID that identifies the waiting coroutine.
+     */
+    @Suppress("unused")  // Called from JNI
+    private fun onRequestCancelled(requestID: Long) {
+        val continuation = pendingContinuations.remove(requestID)
+        if (continuation != null) {
+            continuation.cancel(CancellationException("Request $requestID was cancelled."))
+        } else {
+            // Expected when the coroutine itself was cancelled first.
+            RiveLog.d(COMMAND_QUEUE_TAG) {
+                "Received cancellation for completed or unknown requestID: $requestID"
+            }
+        }
+    }
+
+    // =============================================================================
+    // JNI Callbacks for Frame Timing (Phase G.4)
+    // =============================================================================
+
+    /**
+     * Called from C++ when a draw has been presented.
+     * This emits the frame's timing breakdown on [frameTimingFlow].
+     *
+     * @param drawKey The draw key of the surface that was drawn.
+     * @param queueWaitNs Time the draw waited in the command queue.
+     * @param advanceNs State machine advance time since the previous draw.
+     * @param encodeNs Frame setup and artboard draw time.
+     * @param flushNs GPU flush time.
+     * @param presentNs Buffer swap time.
+     */
+    @Suppress("unused")  // Called from JNI
+    private fun onDrawComplete(
+        drawKey: Long,
+        queueWaitNs: Long,
+        advanceNs: Long,
+        encodeNs: Long,
+        flushNs: Long,
+        presentNs: Long
+    ) {
+        _frameTimingFlow.tryEmit(
+            FrameTiming(
+                drawKey = DrawKey(drawKey),
+                queueWait = queueWaitNs.nanoseconds,
+                advance = advanceNs.nanoseconds,
+                encode = encodeNs.nanoseconds,
+                flush = flushNs.nanoseconds,
+                present = presentNs.nanoseconds
+            )
+        )
+    }
+}
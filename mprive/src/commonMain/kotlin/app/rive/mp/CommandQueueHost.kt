@@ -0,0 +1,65 @@
+package app.rive.mp
+
+import app.rive.mp.core.CheckableAutoCloseable
+import app.rive.mp.core.CommandQueueBridge
+import app.rive.mp.core.createCommandQueueBridge
+
+const val COMMAND_QUEUE_HOST_TAG = "Rive/CQHost"
+
+/**
+ * A worker thread and render context shared by several [CommandQueue]s (Phase G.10).
+ *
+ * By default every command queue has its own thread and its own render context. Apps with many
+ * independent Rive screens can instead create one host and pass it to each queue: the queues keep
+ * their own handles, resources and backpressure policies, but run on the host's thread and render
+ * with its context, so thread count and context switches no longer grow with the number of queues.
+ * Queues on the same host also share imported files (see [CommandQueue.attachSharedFile]).
+ *
+ * The host schedules its queues in weighted round-robin: each round runs up to `weight` commands
+ * from every queue with work, so a busy queue cannot starve the others. Give a queue a higher
+ * weight (see [CommandQueue.setHostWeight]) for the screen the user is looking at.
+ *
+ * Hosts are reference counted like [CommandQueue]. Each hosted queue holds a reference until it is
+ * disposed, so the host and its render context outlive their queues.
+ *
+ * @param renderContext The [RenderContext] the hosted queues render with. The host takes ownership.
+ */
+class CommandQueueHost(
+    internal val renderContext: RenderContext = createDefaultRenderContext(),
+    private val bridge: CommandQueueBridge = createCommandQueueBridge()
+) : RefCounted {
+
+    private val cppPointer = RCPointer(
+        bridge.cppCreateHost(renderContext.nativeObjectPointer),
+        COMMAND_QUEUE_HOST_TAG,
+        ::dispose
+    )
+
+    private fun dispose(cppPointer: Long) {
+        bridge.cppDeleteHost(cppPointer)
+        renderContext.close()
+    }
+
+    /** The native host pointer. */
+    internal val pointer: Long
+        get() = cppPointer.pointer
+
+    override fun acquire(source: String) = cppPointer.acquire(source)
+    override fun release(source: String, reason: String) = cppPointer.release(source, reason)
+    override val refCount: Int
+        get() = cppPointer.refCount
+    override val isDisposed: Boolean
+        get() = cppPointer.isDisposed
+
+    /** Alias for [isDisposed] to satisfy [CheckableAutoCloseable] interface. */
+    override val closed: Boolean
+        get() = isDisposed
+
+    /**
+     * Get the number of command queues currently running on this host.
+     *
+     * @throws IllegalStateException If the host has been released.
+     */
+    @Throws(IllegalStateException::class)
+    fun getQueueCount(): Int = bridge.cppGetHostServerCount(cppPointer.pointer)
+}
@@ -61,6 +61,26 @@ value class ViewModelInstanceHandle(val handle: Long) {
     override fun toString(): String = "ViewModelInstanceHandle($handle)"
 }
 
+/**
+ * A contiguous range of view model instance handles, created with
+ * [CommandQueue.createViewModelInstances]. Each instance is deleted on its own with
+ * [CommandQueue.deleteViewModelInstance].
+ *
+ * @param first The first handle of the range.
+ * @param count The number of handles in the range.
+ */
+data class ViewModelInstanceHandleRange(val first: Long, val count: Int) : Iterable<ViewModelInstanceHandle> {
+    operator fun get(index: Int): ViewModelInstanceHandle {
+        if (index !in 0 until count) {
+            throw IndexOutOfBoundsException("Index $index is out of range for $count instances")
+        }
+        return ViewModelInstanceHandle(first + index)
+    }
+
+    override fun iterator(): Iterator<ViewModelInstanceHandle> =
+        (0 until count).asSequence().map { ViewModelInstanceHandle(first + it) }.iterator()
+}
+
 /**
  * A handle to a RenderImage on the CommandServer. Created with [CommandQueue.decodeImage] and
  * deleted with [CommandQueue.deleteImage].
@@ -104,4 +124,28 @@ value class FontHandle(val handle: Long) {
 @JvmInline
 value class DrawKey(val handle: Long) {
     override fun toString(): String = "DrawKey($handle)"
-}
\ No newline at end of file
+}
+
+/**
+ * A handle to a scheduled state machine input on the CommandServer. Created with
+ * [CommandQueue.scheduleTrigger], [CommandQueue.scheduleNumberInput],
+ * [CommandQueue.scheduleBooleanInput] or [CommandQueue.delayEvent] and cancelled with
+ * [CommandQueue.cancelScheduledInput].
+ *
+ * @param handle The handle issued by the native CommandQueue.
+ */
+@JvmInline
+value class ScheduledInputHandle(val handle: Long) {
+    override fun toString(): String = "ScheduledInputHandle($handle)"
+}
+
+/**
+ * A handle to a view registered with the CommandServer's frame loop. Created with
+ * [CommandQueue.registerView] and removed with [CommandQueue.unregisterView].
+ *
+ * @param handle The handle issued by the native CommandQueue.
+ */
+@JvmInline
+value class ViewHandle(val handle: Long) {
+    override fun toString(): String = "ViewHandle($handle)"
+}
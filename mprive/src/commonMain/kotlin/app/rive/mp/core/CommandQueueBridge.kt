@@ -7,13 +7,12 @@ import app.rive.mp.RiveInitializationException
  * Abstraction of calls to the native command queue.
  *
  * This interface allows for:
- * 1. Platform-specific implementations (JNI on Android, JNA on Desktop, etc.)
+ * 1. Platform-specific implementations (JNI on Android and Desktop, C Interop on iOS, etc.)
  * 2. Mocking in tests
  * 3. Better separation of concerns between Kotlin and native code
  *
  * Each platform provides its own implementation:
- * - Android: CommandQueueJNIBridge (uses JNI external functions)
- * - Desktop: CommandQueueJNABridge (future - uses JNA)
+ * - Android and Desktop (Linux): CommandQueueJNIBridge (uses JNI external functions)
  * - iOS: CommandQueueCInteropBridge (future - uses C Interop)
  */
 interface CommandQueueBridge {
@@ -180,6 +179,13 @@ interface CommandQueueBridge {
     fun cppSetStateMachineBooleanInput(pointer: Long, stateMachineHandle: Long, inputName: String, value: Boolean)
     fun cppFireStateMachineTrigger(pointer: Long, stateMachineHandle: Long, inputName: String)
     
+    // =========================================================================
+    // Reported Events (Phase F)
+    // =========================================================================
+    
+    fun cppGetReportedEventCount(pointer: Long, requestID: Long, smHandle: Long)
+    fun cppGetReportedEventAt(pointer: Long, requestID: Long, smHandle: Long, index: Int)
+    
     // =========================================================================
     // State Machine Input Query (Phase C.4)
     // =========================================================================
@@ -257,10 +263,10 @@ interface CommandQueueBridge {
     // Pointer Events
     // =========================================================================
     
-    fun cppPointerMove(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float)
-    fun cppPointerDown(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float)
-    fun cppPointerUp(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float)
-    fun cppPointerExit(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float)
+    fun cppPointerMove(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    fun cppPointerDown(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    fun cppPointerUp(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    fun cppPointerExit(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
     
     // =========================================================================
     // Render Target Operations
@@ -396,6 +402,384 @@ interface CommandQueueBridge {
      * @param name The name of the font to unregister.
      */
     fun cppUnregisterFont(pointer: Long, name: String)
+    
+    // =========================================================================
+    // Queue Backpressure (Phase G.1)
+    // =========================================================================
+    
+    /**
+     * Set the capacity and overflow policy of a command class.
+     * @param pointer Pointer to the CommandQueue.
+     * @param commandClass The [CommandClass] value.
+     * @param policy The [OverflowPolicy] value.
+     * @param capacity Max pending commands of the class (0 = unbounded).
+     * @return true if the policy was applied.
+     */
+    fun cppSetQueuePolicy(pointer: Long, commandClass: Int, policy: Int, capacity: Int): Boolean
+    
+    /**
+     * Get the queue counters of every command class.
+     * @param pointer Pointer to the CommandQueue.
+     * @return [QueueStats.FIELD_COUNT] longs per class, in [CommandClass] order.
+     */
+    fun cppGetQueueStats(pointer: Long): LongArray
+    
+    /**
+     * Reset the cumulative queue counters.
+     * @param pointer Pointer to the CommandQueue.
+     */
+    fun cppResetQueueStats(pointer: Long)
+    
+    // =========================================================================
+    // Request Cancellation (Phase G.2)
+    // =========================================================================
+    
+    /**
+     * Cancel a pending or in-flight request.
+     * @param pointer Pointer to the CommandQueue.
+     * @param requestID The request ID to cancel.
+     * @return true if a command was cancelled.
+     */
+    fun cppCancelRequest(pointer: Long, requestID: Long): Boolean
+    
+    /**
+     * Cancel every pending cancellable command that targets a handle.
+     * @param pointer Pointer to the CommandQueue.
+     * @param handle A file, artboard, state machine or view model instance handle.
+     * @return The number of commands cancelled.
+     */
+    fun cppCancelAllFor(pointer: Long, handle: Long): Int
+    
+    /**
+     * Pause or resume command execution.
+     * @param pointer Pointer to the CommandQueue.
+     * @param paused Whether the worker should stop taking commands.
+     */
+    fun cppSetWorkerPaused(pointer: Long, paused: Boolean)
+    
+    /**
+     * Hold or release the worker between taking a command and executing it.
+     * @param pointer Pointer to the CommandQueue.
+     * @param hold Whether the worker should wait before executing.
+     */
+    fun cppSetHoldInFlight(pointer: Long, hold: Boolean)
+    
+    // =========================================================================
+    // Stall Watchdog (Phase G.3)
+    // =========================================================================
+    
+    /**
+     * Set the duration above which a command is reported as slow.
+     * @param pointer Pointer to the CommandQueue.
+     * @param thresholdMs The threshold in milliseconds (0 disables the watchdog).
+     */
+    fun cppSetSlowCommandThreshold(pointer: Long, thresholdMs: Long)
+    
+    /**
+     * Get the most recent slow commands, oldest first.
+     * @param pointer Pointer to the CommandQueue.
+     * @return Flattened records of [SlowCommand.FIELD_COUNT] longs each.
+     */
+    fun cppGetSlowCommands(pointer: Long): LongArray
+    
+    /**
+     * Get the total number of slow commands seen since the queue was created.
+     * @param pointer Pointer to the CommandQueue.
+     * @return The total count, including records no longer held in the ring.
+     */
+    fun cppGetSlowCommandCount(pointer: Long): Long
+    
+    /**
+     * Get the name of a native command type.
+     * @param commandType The command type ordinal.
+     * @return The command type name.
+     */
+    fun cppGetCommandTypeName(commandType: Int): String
+    
+    // =========================================================================
+    // Input-to-Present Latency (Phase G.4)
+    // =========================================================================
+    
+    /**
+     * Get the input-to-present latency distribution of every input kind.
+     * @param pointer Pointer to the CommandQueue.
+     * @return Flattened records of [LatencyStats.FIELD_COUNT] longs each, in [InputEventKind] order.
+     */
+    fun cppGetInputLatencyStats(pointer: Long): LongArray
+    
+    /**
+     * Clear all input latency samples.
+     * @param pointer Pointer to the CommandQueue.
+     */
+    fun cppResetInputLatencyStats(pointer: Long)
+    
+    /**
+     * Enable or disable the per-frame timing reported with each draw.
+     * @param pointer Pointer to the CommandQueue.
+     * @param enabled Whether draws report their timing.
+     */
+    fun cppSetFrameTimingEnabled(pointer: Long, enabled: Boolean)
+    
+    // =========================================================================
+    // Scheduled Inputs (Phase G.5)
+    // =========================================================================
+    
+    /**
+     * Schedule a state machine input to fire after a delay in animation time.
+     * @param pointer Pointer to the CommandQueue.
+     * @param smHandle The state machine handle.
+     * @param kind 0 = trigger, 1 = number, 2 = boolean.
+     * @param inputName The input name.
+     * @param floatValue The value for a number input.
+     * @param boolValue The value for a boolean input.
+     * @param delaySeconds The delay in animation seconds.
+     * @param onEvent Event that arms the input each time it is reported, or empty for a one-shot timer.
+     * @return The scheduled input handle, or 0 on error.
+     */
+    fun cppScheduleInput(
+        pointer: Long,
+        smHandle: Long,
+        kind: Int,
+        inputName: String,
+        floatValue: Float,
+        boolValue: Boolean,
+        delaySeconds: Float,
+        onEvent: String
+    ): Long
+    
+    /**
+     * Cancel a scheduled input or event reaction.
+     * @param pointer Pointer to the CommandQueue.
+     * @param timerHandle The handle returned by [cppScheduleInput].
+     */
+    fun cppCancelScheduledInput(pointer: Long, timerHandle: Long)
+    
+    // =========================================================================
+    // Command Capture and Replay (Phase G.6)
+    // =========================================================================
+    
+    /**
+     * Start recording enqueued commands.
+     * @param pointer Pointer to the CommandQueue.
+     * @param windowMs Flight recorder window in milliseconds, or 0 to keep everything.
+     */
+    fun cppStartCommandCapture(pointer: Long, windowMs: Long)
+    
+    /**
+     * Stop recording and write the capture to a file.
+     * @param pointer Pointer to the CommandQueue.
+     * @param path The file to write, or empty to discard the recording.
+     * @return True if the capture was written.
+     */
+    fun cppStopCommandCapture(pointer: Long, path: String): Boolean
+    
+    /**
+     * Replay a capture file on a new headless command server. Blocks until done.
+     * @param path The capture file.
+     * @param paced True to keep the recorded pacing.
+     * @return The flattened [ReplayReport], or an empty array if the file cannot be read.
+     */
+    fun cppReplayCommandCapture(path: String, paced: Boolean): LongArray
+    
+    // =========================================================================
+    // Synthetic Files (Phase G.7)
+    // =========================================================================
+    
+    /**
+     * Generate a synthetic .riv file.
+     * @param spec The [SyntheticRivSpec] fields, flattened by [SyntheticRivSpec.toArray].
+     * @return The file bytes, or an empty array if the spec is malformed.
+     */
+    fun cppGenerateSyntheticRiv(spec: IntArray): ByteArray
+    
+    // =========================================================================
+    // File Analysis (Phase G.8)
+    // =========================================================================
+    
+    /**
+     * Import a .riv file headlessly and report its per-artboard complexity.
+     * @param bytes The .riv file bytes.
+     * @return The statistics as JSON, or null if the file cannot be imported.
+     */
+    fun cppAnalyzeRiv(bytes: ByteArray): String?
+    
+    // =========================================================================
+    // Shared Files (Phase G.9)
+    // =========================================================================
+    
+    /**
+     * Attach a file another command server in this process has already imported.
+     * @param pointer The native CommandServer pointer.
+     * @param requestID The request ID for async completion.
+     * @param contentKey The content key from [cppGetFileContentKey].
+     */
+    fun cppAttachSharedFile(pointer: Long, requestID: Long, contentKey: Long)
+    
+    /**
+     * Compute the key a file is shared under.
+     * @param bytes The Rive file bytes.
+     * @return The content key.
+     */
+    fun cppGetFileContentKey(bytes: ByteArray): Long
+    
+    /**
+     * Get the number of distinct files shared across command servers.
+     * @return The number of registered files.
+     */
+    fun cppGetSharedFileCount(): Int
+    
+    // =========================================================================
+    // Shared Host Thread (Phase G.10)
+    // =========================================================================
+    
+    /**
+     * Create a worker thread that several command queues can share.
+     * @param renderContextPointer The native RenderContext pointer, or 0 for a headless host.
+     * @return Pointer to the native host.
+     */
+    fun cppCreateHost(renderContextPointer: Long): Long
+    
+    /**
+     * Stop and delete a host. Every hosted command queue must have been deleted first.
+     * @param hostPointer Pointer to the native host.
+     */
+    fun cppDeleteHost(hostPointer: Long)
+    
+    /**
+     * Create a CommandQueue native object that runs on a shared host.
+     * @param hostPointer Pointer to the native host.
+     * @param weight Commands the queue may run per scheduling round.
+     * @return Pointer to the created CommandQueue native object.
+     */
+    fun cppConstructorHosted(hostPointer: Long, weight: Int): Long
+    
+    /**
+     * Change a hosted command queue's scheduling weight.
+     * @param pointer The native CommandServer pointer.
+     * @param weight Commands the queue may run per scheduling round.
+     */
+    fun cppSetHostWeight(pointer: Long, weight: Int)
+    
+    /**
+     * Get the number of command queues attached to a host.
+     * @param hostPointer Pointer to the native host.
+     */
+    fun cppGetHostServerCount(hostPointer: Long): Int
+    
+    // =========================================================================
+    // Registered Views (Phase G.11)
+    // =========================================================================
+    
+    /**
+     * Register a view with the server-driven frame loop, or update one.
+     * @param viewID The view to update, or 0 to register a new one.
+     * @return The view ID.
+     */
+    fun cppRegisterView(
+        pointer: Long,
+        viewID: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        surfaceNativePointer: Long,
+        renderTargetPointer: Long,
+        drawKey: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int
+    ): Long
+    
+    /**
+     * Remove a registered view.
+     * @param pointer The native CommandServer pointer.
+     * @param viewID The view ID.
+     */
+    fun cppUnregisterView(pointer: Long, viewID: Long)
+    
+    /**
+     * Advance and draw every registered view that is not settled.
+     * @param pointer The native CommandServer pointer.
+     * @param deltaTimeNs Time since the previous tick in nanoseconds.
+     */
+    fun cppFrameTick(pointer: Long, deltaTimeNs: Long)
+    
+    /**
+     * Whether every registered view is settled and ticking can stop until further input.
+     * @param pointer The native CommandServer pointer.
+     */
+    fun cppViewsIdle(pointer: Long): Boolean
+    
+    // =========================================================================
+    // Lazy GPU Resources (Phase G.13)
+    // =========================================================================
+    
+    /**
+     * Import files loaded from now on without creating their GPU render objects up front.
+     * @param pointer The native CommandServer pointer.
+     * @param enabled True to import lazily.
+     * @param idleReleaseNs Release objects not drawn for this many nanoseconds.
+     */
+    fun cppSetLazyGpuResources(pointer: Long, enabled: Boolean, idleReleaseNs: Long)
+    
+    /**
+     * Get the lazy render object counters.
+     * @param pointer The native CommandServer pointer.
+     * @return [LazyGpuResourceStats.FIELD_COUNT] longs: live, materialized, materializations, releases.
+     */
+    fun cppGetLazyGpuResourceStats(pointer: Long): LongArray
+    
+    // =========================================================================
+    // Partial Import (Phase G.14)
+    // =========================================================================
+    
+    /**
+     * Load only some artboards of a file, plus the artboards they nest.
+     * @param pointer The native CommandServer pointer.
+     * @param requestID The request ID for async completion.
+     * @param bytes The Rive file bytes.
+     * @param artboardNames The artboards to import.
+     */
+    fun cppLoadFileArtboards(pointer: Long, requestID: Long, bytes: ByteArray, artboardNames: Array<String>)
+    
+    // =========================================================================
+    // Bulk View Model Instances (Phase G.15)
+    // =========================================================================
+    
+    /**
+     * Reserve [count] contiguous view model instances of one view model.
+     * Each is created on first use, from the default instance plus the seed's values.
+     * @param pointer The native CommandServer pointer.
+     * @param requestID The request ID for async completion.
+     * @param fileHandle The handle of the file containing the view model.
+     * @param viewModelName The name of the view model to instantiate.
+     * @param count The number of instances.
+     * @param seedVmiHandle An instance to copy values from, or 0 for the defaults.
+     * @return The first handle of the range, or 0 if [count] is not positive.
+     */
+    fun cppCreateVMIBatch(
+        pointer: Long,
+        requestID: Long,
+        fileHandle: Long,
+        viewModelName: String,
+        count: Int,
+        seedVmiHandle: Long
+    ): Long
+    
+    // =========================================================================
+    // Event Filters (Phase G.16)
+    // =========================================================================
+    
+    /**
+     * Choose which reported events of a state machine reach the client.
+     * @param pointer The native CommandServer pointer.
+     * @param smHandle The state machine handle.
+     * @param mode 0 = all, 1 = none, 2 = matching [names] or [typeCodes].
+     * @param names Event names to report.
+     * @param typeCodes Event type keys to report.
+     */
+    fun cppSetEventFilter(pointer: Long, smHandle: Long, mode: Int, names: Array<String>, typeCodes: IntArray)
 }
 
 /**
@@ -0,0 +1,69 @@
+package app.rive.mp.core
+
+import app.rive.mp.DrawKey
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+
+/**
+ * Kind of input event tracked for input-to-present latency by the [app.rive.mp.CommandQueue].
+ */
+enum class InputEventKind(val value: Int) {
+    POINTER_MOVE(0),
+    POINTER_DOWN(1),
+    POINTER_UP(2),
+    POINTER_EXIT(3),
+
+    /** Number/boolean inputs and triggers set on a state machine. */
+    STATE_MACHINE_INPUT(4),
+}
+
+/**
+ * Input-to-present latency distribution of an [InputEventKind].
+ *
+ * Latency runs from the event timestamp passed with the input (or the time it was enqueued) to the
+ * end of the present of the first frame drawn after an advance that consumed it. Percentiles cover
+ * the most recent 256 events.
+ *
+ * @param count Events presented since the last reset.
+ */
+data class LatencyStats(
+    val count: Long,
+    val min: Duration,
+    val p50: Duration,
+    val p90: Duration,
+    val p99: Duration,
+    val max: Duration
+) {
+    companion object {
+        /** Number of longs per kind in the flattened array returned by the bridge. */
+        internal const val FIELD_COUNT = 6
+
+        internal fun fromArray(values: LongArray, offset: Int) = LatencyStats(
+            count = values[offset],
+            min = values[offset + 1].nanoseconds,
+            p50 = values[offset + 2].nanoseconds,
+            p90 = values[offset + 3].nanoseconds,
+            p99 = values[offset + 4].nanoseconds,
+            max = values[offset + 5].nanoseconds
+        )
+    }
+}
+
+/**
+ * Where the time of one completed draw went.
+ *
+ * @param drawKey The draw key of the surface that was drawn.
+ * @param queueWait Time the draw waited in the command queue.
+ * @param advance State machine advances since the previous draw of the same state machine.
+ * @param encode Frame setup and artboard draw.
+ * @param flush GPU flush.
+ * @param present Buffer swap.
+ */
+data class FrameTiming(
+    val drawKey: DrawKey,
+    val queueWait: Duration,
+    val advance: Duration,
+    val encode: Duration,
+    val flush: Duration,
+    val present: Duration
+)
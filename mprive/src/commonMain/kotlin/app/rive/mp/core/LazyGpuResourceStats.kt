@@ -0,0 +1,29 @@
+package app.rive.mp.core
+
+/**
+ * Counters of the render objects created lazily for files imported with
+ * [app.rive.mp.CommandQueue.setLazyGpuResources] (Phase G.13).
+ *
+ * @param liveObjects Lazy paths, paints and buffers currently alive.
+ * @param materializedObjects Of those, how many currently hold a GPU object.
+ * @param materializations GPU objects created on first draw since startup.
+ * @param releases GPU objects released after going undrawn since startup.
+ */
+data class LazyGpuResourceStats(
+    val liveObjects: Long,
+    val materializedObjects: Long,
+    val materializations: Long,
+    val releases: Long
+) {
+    companion object {
+        /** Number of longs in the array returned by the bridge. */
+        internal const val FIELD_COUNT = 4
+
+        internal fun fromArray(values: LongArray) = LazyGpuResourceStats(
+            liveObjects = values.getOrElse(0) { 0L },
+            materializedObjects = values.getOrElse(1) { 0L },
+            materializations = values.getOrElse(2) { 0L },
+            releases = values.getOrElse(3) { 0L }
+        )
+    }
+}
@@ -0,0 +1,95 @@
+package app.rive.mp.core
+
+/**
+ * Backpressure class of a command sent to the [app.rive.mp.CommandQueue].
+ *
+ * Only the fire-and-forget classes can be dropped or coalesced. [ORDERED] covers every command
+ * that returns a result or mutates state, and is never dropped.
+ */
+enum class CommandClass(val value: Int) {
+    /** Request/response and state-mutating commands. */
+    ORDERED(0),
+
+    /** State machine advances and frame ticks. Frame ticks are coalesced but never dropped. */
+    ADVANCE(1),
+
+    /** Pointer events. Only pointer moves are droppable; down/up/exit are always delivered. */
+    POINTER(2),
+
+    /** Draw calls. */
+    DRAW(3);
+
+    companion object {
+        fun fromValue(value: Int): CommandClass = entries.first { it.value == value }
+    }
+}
+
+/**
+ * What the command queue does when a [CommandClass] reaches its capacity.
+ */
+enum class OverflowPolicy(val value: Int) {
+    /** No limit; the capacity is ignored. */
+    UNBOUNDED(0),
+
+    /** Drop the oldest droppable pending command of the class. */
+    DROP_OLDEST(1),
+
+    /**
+     * Once the capacity is reached, merge into a pending command with the same target (advance
+     * deltas are summed, the latest pointer position and draw parameters win). Below capacity
+     * commands are queued as they are. When nothing can be merged, fall back to [DROP_OLDEST], so
+     * the capacity bounds the droppable commands of the class.
+     */
+    COALESCE(2),
+
+    /** Block the calling thread until the worker has drained the class below capacity. */
+    BLOCK(3),
+}
+
+/**
+ * Capacity and overflow policy of a [CommandClass].
+ *
+ * @param policy The behavior once [capacity] pending commands are queued.
+ * @param capacity Max pending commands of the class, or 0 for unbounded.
+ */
+data class QueuePolicy(
+    val policy: OverflowPolicy,
+    val capacity: Int = 0
+) {
+    init {
+        require(capacity >= 0) { "Queue capacity must be >= 0, was $capacity" }
+    }
+}
+
+/**
+ * Snapshot of the queue counters of a [CommandClass].
+ *
+ * @param enqueued Commands submitted since the last reset.
+ * @param dropped Pending commands discarded to stay within capacity.
+ * @param coalesced Commands merged into a pending command.
+ * @param blocked Times a producer had to wait for space.
+ * @param pending Commands currently waiting in the queue.
+ * @param highWater Max pending commands observed since the last reset.
+ */
+data class QueueStats(
+    val enqueued: Long,
+    val dropped: Long,
+    val coalesced: Long,
+    val blocked: Long,
+    val pending: Long,
+    val highWater: Long
+) {
+    companion object {
+        /** Number of longs per class in the flattened array returned by the bridge. */
+        internal const val FIELD_COUNT = 6
+
+        internal fun fromArray(values: LongArray, offset: Int) = QueueStats(
+            enqueued = values[offset],
+            dropped = values[offset + 1],
+            coalesced = values[offset + 2],
+            blocked = values[offset + 3],
+            pending = values[offset + 4],
+            highWater = values[offset + 5]
+        )
+    }
+}
@@ -0,0 +1,67 @@
+package app.rive.mp.core
+
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+
+/**
+ * Execution time of one command type during a replay.
+ *
+ * @param commandType Name of the native command type (e.g. "LoadFile", "AdvanceStateMachine").
+ * @param count How many commands of the type ran.
+ * @param total Total run time of those commands.
+ * @param max Run time of the slowest one.
+ */
+data class ReplayCommandTiming(
+    val commandType: String,
+    val count: Int,
+    val total: Duration,
+    val max: Duration
+)
+
+/**
+ * Result of [app.rive.mp.CommandQueue.replayCommandCapture].
+ *
+ * @param commandCount Number of commands re-executed.
+ * @param skippedCount Number of commands skipped because they cannot run headless (draws).
+ * @param errorCount Number of error messages the replay produced.
+ * @param recordedSpan Time from the first to the last command, as captured.
+ * @param wallTime Time from the first enqueue to the completion of the last command, as
+ *   replayed. Compare with [recordedSpan] for a paced replay, or across builds for an unpaced one.
+ * @param commandTimings Per-type run time, for the command types that ran.
+ */
+data class ReplayReport(
+    val commandCount: Int,
+    val skippedCount: Int,
+    val errorCount: Int,
+    val recordedSpan: Duration,
+    val wallTime: Duration,
+    val commandTimings: List<ReplayCommandTiming>
+) {
+    companion object {
+        /** Number of longs before the per-type records in the array returned by the bridge. */
+        internal const val HEADER_FIELD_COUNT = 5
+
+        /** Number of longs per command type record. */
+        internal const val TIMING_FIELD_COUNT = 4
+
+        internal fun fromArray(values: LongArray, typeName: (Int) -> String): ReplayReport {
+            val timingCount = (values.size - HEADER_FIELD_COUNT) / TIMING_FIELD_COUNT
+            return ReplayReport(
+                commandCount = values[0].toInt(),
+                skippedCount = values[1].toInt(),
+                errorCount = values[2].toInt(),
+                recordedSpan = values[3].nanoseconds,
+                wallTime = values[4].nanoseconds,
+                commandTimings = (0 until timingCount).map { index ->
+                    val offset = HEADER_FIELD_COUNT + index * TIMING_FIELD_COUNT
+                    ReplayCommandTiming(
+                        commandType = typeName(values[offset].toInt()),
+                        count = values[offset + 1].toInt(),
+                        total = values[offset + 2].nanoseconds,
+                        max = values[offset + 3].nanoseconds
+                    )
+                }
+            )
+        }
+    }
+}
@@ -0,0 +1,35 @@
+package app.rive.mp.core
+
+/**
+ * Static complexity analyzer for .riv files.
+ *
+ * Imports a file headlessly (no GPU, no [app.rive.mp.CommandQueue]) and reports what drives the
+ * per-frame cost of each artboard, so heavy assets can be gated in CI or at upload time instead of
+ * being discovered on a low-end device.
+ *
+ * The report is a JSON object:
+ * - `fileBytes`, `assetCount`, `viewModelCount`
+ * - `images`: `name`, `width`, `height` (read from the encoded header, 0 if unknown),
+ *   `encodedBytes` (0 for out-of-band assets)
+ * - `artboards`: `name`, `width`, `height`, `objectCount`, `drawableCount`, `shapeCount`,
+ *   `pathCount`, `vertexCount`, `clipCount`, `blendModeCount`, `imageCount`, `imagePixels`,
+ *   `textCount`, `nestedArtboardCount`, `nestedArtboardDepth`, `animationCount`,
+ *   `stateMachineCount`, `layerCount`, `stateCount`, `transitionCount`, `inputCount`,
+ *   `listenerCount`, `dataBindCount`, `costScore`
+ *
+ * `costScore` is a weighted sum of the statistics that dominate advance and render time (paths
+ * and vertices, clips, blend modes, image pixels, text, nesting, state machine size and data
+ * binds). Its unit is arbitrary: use it to compare files and to set gating thresholds.
+ */
+object RivAnalyzer {
+    private val bridge: CommandQueueBridge by lazy { createCommandQueueBridge() }
+
+    /**
+     * Analyze a .riv file.
+     *
+     * @param bytes The .riv file bytes.
+     * @return The report as JSON, or null if the file cannot be imported or the platform has no
+     *   native runtime.
+     */
+    fun analyze(bytes: ByteArray): String? = bridge.cppAnalyzeRiv(bytes)
+}
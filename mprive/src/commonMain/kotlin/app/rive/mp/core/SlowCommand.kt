@@ -0,0 +1,40 @@
+package app.rive.mp.core
+
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+
+/**
+ * A command that ran longer than the slow command threshold of the
+ * [app.rive.mp.CommandQueue] watchdog.
+ *
+ * @param sequence Position of the command in the worker's execution order.
+ * @param commandType Name of the native command type (e.g. "LoadFile", "Draw").
+ * @param requestID The request ID of the command, or 0 for fire-and-forget commands.
+ * @param startTimeNs Monotonic start time of the command, in nanoseconds.
+ * @param duration How long the command ran. For a command flagged while still running, this is
+ *   the time elapsed when the watchdog sampled it, and is updated once it completes.
+ * @param stalled Whether the watchdog caught the command still running past the threshold.
+ */
+data class SlowCommand(
+    val sequence: Long,
+    val commandType: String,
+    val requestID: Long,
+    val startTimeNs: Long,
+    val duration: Duration,
+    val stalled: Boolean
+) {
+    companion object {
+        /** Number of longs per record in the flattened array returned by the bridge. */
+        internal const val FIELD_COUNT = 6
+
+        internal fun fromArray(values: LongArray, offset: Int, typeName: (Int) -> String) =
+            SlowCommand(
+                sequence = values[offset],
+                commandType = typeName(values[offset + 1].toInt()),
+                requestID = values[offset + 2],
+                startTimeNs = values[offset + 3],
+                duration = values[offset + 4].nanoseconds,
+                stalled = values[offset + 5] != 0L
+            )
+    }
+}
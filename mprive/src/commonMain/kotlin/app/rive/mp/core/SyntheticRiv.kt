@@ -0,0 +1,77 @@
+package app.rive.mp.core
+
+/**
+ * Shape of a synthetic .riv file generated by [SyntheticRiv]. Every artboard gets the same
+ * content.
+ *
+ * @param artboardCount Number of artboards, named "Artboard 0", "Artboard 1", ...
+ * @param shapesPerArtboard Number of filled shapes per artboard.
+ * @param pathsPerShape Number of rectangle paths per shape.
+ * @param nestingDepth Number of nodes each shape is nested under.
+ * @param stateMachineStates Number of looping animations, and of animation states in the
+ *   artboard's "State Machine". 0 omits animations and the state machine.
+ * @param stateMachineInputs Number of number inputs, named "Input 0", "Input 1", ... Animation
+ *   state n transitions to n + 1 when "Input 0" equals n + 1.
+ * @param viewModelProperties Number of properties of the "Root" view model, alternating number
+ *   and string, named "prop 0", "prop 1", ...
+ * @param listLength Number of items in the "items" list of the "Root" view model. Each item is
+ *   its own instance of the "Item" view model.
+ * @param dataConverters Number of to-string data converters, named "Converter 0", ..., followed
+ *   by a "Group" converter chaining all of them.
+ * @param nestNextArtboard Whether each artboard but the last nests the artboard after it.
+ */
+data class SyntheticRivSpec(
+    val artboardCount: Int = 1,
+    val shapesPerArtboard: Int = 10,
+    val pathsPerShape: Int = 1,
+    val nestingDepth: Int = 0,
+    val stateMachineStates: Int = 2,
+    val stateMachineInputs: Int = 1,
+    val viewModelProperties: Int = 0,
+    val listLength: Int = 0,
+    val dataConverters: Int = 0,
+    val nestNextArtboard: Boolean = false
+) {
+    init {
+        require(
+            artboardCount >= 0 && shapesPerArtboard >= 0 && pathsPerShape >= 0 &&
+                nestingDepth >= 0 && stateMachineStates >= 0 && stateMachineInputs >= 0 &&
+                viewModelProperties >= 0 && listLength >= 0 && dataConverters >= 0
+        ) { "Synthetic file counts must be >= 0: $this" }
+    }
+
+    /** Flattens the spec in the field order expected by the bridge. */
+    internal fun toArray(): IntArray = intArrayOf(
+        artboardCount,
+        shapesPerArtboard,
+        pathsPerShape,
+        nestingDepth,
+        stateMachineStates,
+        stateMachineInputs,
+        viewModelProperties,
+        listLength,
+        dataConverters,
+        if (nestNextArtboard) 1 else 0
+    )
+}
+
+/**
+ * Generator of synthetic .riv files with controlled sizes (e.g. 1,000 artboards, 10k view model
+ * properties, deep nesting, long lists), for import time and command server benchmarks that real
+ * design files do not cover.
+ *
+ * Files are written with the type and property keys of the bundled runtime, so they can be
+ * passed straight to [app.rive.mp.CommandQueue.loadFile].
+ */
+object SyntheticRiv {
+    private val bridge: CommandQueueBridge by lazy { createCommandQueueBridge() }
+
+    /**
+     * Generate a synthetic .riv file.
+     *
+     * @param spec The file shape.
+     * @return The file bytes, or an empty array on platforms without a native runtime.
+     */
+    fun generate(spec: SyntheticRivSpec = SyntheticRivSpec()): ByteArray =
+        bridge.cppGenerateSyntheticRiv(spec.toArray())
+}
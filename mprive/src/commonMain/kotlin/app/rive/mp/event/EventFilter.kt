@@ -0,0 +1,27 @@
+package app.rive.mp.event
+
+/**
+ * Which events reported by a state machine are delivered to the client.
+ *
+ * Set with [app.rive.mp.CommandQueue.setEventFilter]. Events that do not pass are dropped on the
+ * command server before they are copied into a message, and event indices count only the events
+ * that pass. Scheduled inputs armed by an event still see every event.
+ */
+sealed interface EventFilter {
+    /** Every event is delivered. This is the default. */
+    data object All : EventFilter
+
+    /** No event is delivered. */
+    data object None : EventFilter
+
+    /**
+     * Only events with one of [names], or of one of [types], are delivered.
+     *
+     * @property names Event names to deliver.
+     * @property types Event types to deliver, whatever their name.
+     */
+    data class Matching(
+        val names: Set<String> = emptySet(),
+        val types: Set<EventType> = emptySet()
+    ) : EventFilter
+}
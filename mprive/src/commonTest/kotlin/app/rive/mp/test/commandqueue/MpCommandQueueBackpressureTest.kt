@@ -0,0 +1,208 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.core.CommandClass
+import app.rive.mp.core.OverflowPolicy
+import app.rive.mp.core.QueuePolicy
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.1 tests for CommandQueue backpressure.
+ * Tests per-class queue policies and overflow counters.
+ */
+class MpCommandQueueBackpressureTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun ordered_commands_reject_drop_policies() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            assertFalse(
+                queue.setQueuePolicy(CommandClass.ORDERED, QueuePolicy(OverflowPolicy.DROP_OLDEST, 4)),
+                "Ordered commands must not accept DROP_OLDEST"
+            )
+            assertFalse(
+                queue.setQueuePolicy(CommandClass.ORDERED, QueuePolicy(OverflowPolicy.COALESCE, 4)),
+                "Ordered commands must not accept COALESCE"
+            )
+            assertTrue(
+                queue.setQueuePolicy(CommandClass.ORDERED, QueuePolicy(OverflowPolicy.BLOCK, 256)),
+                "Ordered commands should accept BLOCK"
+            )
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun queue_stats_cover_every_class() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val stats = testUtil.commandQueue.getQueueStats()
+            assertEquals(CommandClass.entries.toSet(), stats.keys, "Stats should cover every class")
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun advance_burst_stays_within_capacity() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val fileHandle = queue.loadFile(bytes)
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createDefaultStateMachine(artboardHandle)
+
+            assertTrue(queue.setQueuePolicy(CommandClass.ADVANCE, QueuePolicy(OverflowPolicy.COALESCE, 2)))
+            queue.resetQueueStats()
+
+            repeat(500) {
+                queue.advanceStateMachine(smHandle, 0.016f)
+            }
+
+            val advance = queue.getQueueStats().getValue(CommandClass.ADVANCE)
+            assertTrue(advance.pending <= 2, "Pending advances should stay within capacity, was ${advance.pending}")
+            assertTrue(
+                advance.dropped + advance.coalesced <= advance.enqueued,
+                "Dropped and coalesced counts cannot exceed enqueued"
+            )
+
+            // Ordered commands still complete after the burst.
+            queue.getStateMachineNames(artboardHandle)
+
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun coalesce_never_drops_other_targets() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val fileHandle = queue.loadFile(bytes)
+            val artboardA = queue.createDefaultArtboard(fileHandle)
+            val artboardB = queue.createDefaultArtboard(fileHandle)
+            val smA = queue.createDefaultStateMachine(artboardA)
+            val smB = queue.createDefaultStateMachine(artboardB)
+
+            // Room for one advance per target
+            assertTrue(queue.setQueuePolicy(CommandClass.ADVANCE, QueuePolicy(OverflowPolicy.COALESCE, 2)))
+            queue.resetQueueStats()
+
+            queue.setWorkerPaused(true)
+            try {
+                repeat(100) {
+                    queue.advanceStateMachine(smA, 0.016f)
+                    queue.advanceStateMachine(smB, 0.016f)
+                }
+
+                val advance = queue.getQueueStats().getValue(CommandClass.ADVANCE)
+                assertEquals(0L, advance.dropped, "Coalescing must merge, never drop another target's advance")
+                assertEquals(200L, advance.enqueued)
+                assertEquals(198L, advance.coalesced)
+                assertEquals(2L, advance.pending)
+            } finally {
+                queue.setWorkerPaused(false)
+            }
+
+            queue.deleteStateMachine(smB)
+            queue.deleteStateMachine(smA)
+            queue.deleteArtboard(artboardB)
+            queue.deleteArtboard(artboardA)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun coalesce_waits_for_capacity() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createDefaultStateMachine(artboardHandle)
+
+            assertTrue(queue.setQueuePolicy(CommandClass.ADVANCE, QueuePolicy(OverflowPolicy.COALESCE, 4)))
+            queue.resetQueueStats()
+
+            queue.setWorkerPaused(true)
+            try {
+                repeat(4) {
+                    queue.advanceStateMachine(smHandle, 0.016f)
+                }
+                val advance = queue.getQueueStats().getValue(CommandClass.ADVANCE)
+                assertEquals(0L, advance.coalesced, "Advances below capacity are queued as they are")
+                assertEquals(4L, advance.pending)
+            } finally {
+                queue.setWorkerPaused(false)
+            }
+
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun coalesce_stays_within_capacity_when_ordered_commands_interleave() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createDefaultStateMachine(artboardHandle)
+
+            val capacity = 4
+            assertTrue(queue.setQueuePolicy(CommandClass.ADVANCE, QueuePolicy(OverflowPolicy.COALESCE, capacity)))
+            queue.resetQueueStats()
+
+            // A stalled worker, with an ordered command between every advance so none can merge
+            queue.setWorkerPaused(true)
+            try {
+                repeat(200) {
+                    queue.advanceStateMachine(smHandle, 0.016f)
+                    queue.setStateMachineNumberInput(smHandle, "level", it.toFloat())
+                    val advance = queue.getQueueStats().getValue(CommandClass.ADVANCE)
+                    assertTrue(
+                        advance.pending <= capacity,
+                        "Pending advances should stay within capacity, was ${advance.pending}"
+                    )
+                }
+                val advance = queue.getQueueStats().getValue(CommandClass.ADVANCE)
+                assertEquals(200L - capacity, advance.dropped)
+                assertEquals(0L, advance.coalesced)
+                assertEquals(capacity.toLong(), advance.highWater)
+            } finally {
+                queue.setWorkerPaused(false)
+            }
+
+            // Ordered commands still complete after the stall.
+            queue.getStateMachineNames(artboardHandle)
+
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
@@ -0,0 +1,167 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.CommandQueue
+import app.rive.mp.FileHandle
+import app.rive.mp.core.CommandClass
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CoroutineStart
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.withContext
+import kotlinx.coroutines.withTimeout
+import kotlin.test.*
+
+/**
+ * Phase G.2 tests for CommandQueue request cancellation.
+ * Tests that cancelled requests don't leave the queue in a bad state.
+ */
+class MpCommandQueueCancellationTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun cancelled_loadFile_does_not_block_later_requests() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+
+            val cancelled = async(start = CoroutineStart.UNDISPATCHED) { queue.loadFile(bytes) }
+            cancelled.cancel()
+            assertTrue(cancelled.isCancelled, "The load should be cancelled")
+
+            val fileHandle = queue.loadFile(bytes)
+            assertTrue(fileHandle.handle > 0, "A later load should still succeed")
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun cancelAllFor_cancels_pending_queries() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+
+            // With the worker paused, every query is still pending when cancelled.
+            queue.setWorkerPaused(true)
+            val queries = List(20) {
+                async(start = CoroutineStart.UNDISPATCHED) { queue.getArtboardNames(fileHandle) }
+            }
+            val cancelledCount = queue.cancelAllFor(fileHandle)
+            queue.setWorkerPaused(false)
+            assertEquals(queries.size, cancelledCount, "Every pending query should be cancelled")
+
+            queries.forEach { query ->
+                assertFailsWith<CancellationException> { query.await() }
+            }
+            assertEquals(queries.size, queries.count { it.isCancelled })
+
+            // Unrelated handles are not affected.
+            assertEquals(0, queue.cancelAllFor(FileHandle(Long.MAX_VALUE)))
+
+            // Later requests for the same file still complete.
+            assertTrue(queue.getArtboardNames(fileHandle).isNotEmpty())
+
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun cancelAllFor_leaves_other_targets_pending() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val fileA = queue.loadFile(bytes)
+            val fileB = queue.loadFile(bytes)
+
+            queue.setWorkerPaused(true)
+            val queriesA = List(3) {
+                async(start = CoroutineStart.UNDISPATCHED) { queue.getArtboardNames(fileA) }
+            }
+            val queriesB = List(5) {
+                async(start = CoroutineStart.UNDISPATCHED) { queue.getArtboardNames(fileB) }
+            }
+            assertEquals(queriesA.size, queue.cancelAllFor(fileA))
+            queue.setWorkerPaused(false)
+
+            queriesA.forEach { assertFailsWith<CancellationException> { it.await() } }
+            queriesB.forEach { assertTrue(it.await().isNotEmpty()) }
+
+            queue.deleteFile(fileB)
+            queue.deleteFile(fileA)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun cancelAllFor_cancels_the_in_flight_request() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val fileA = queue.loadFile(bytes)
+            val fileB = queue.loadFile(bytes)
+
+            // The worker takes the first query and holds it in flight
+            queue.setHoldInFlight(true)
+            val inFlight = async(start = CoroutineStart.UNDISPATCHED) { queue.getArtboardNames(fileA) }
+            awaitNothingPending(queue)
+            val pending = async(start = CoroutineStart.UNDISPATCHED) { queue.getArtboardNames(fileA) }
+            val other = async(start = CoroutineStart.UNDISPATCHED) { queue.getArtboardNames(fileB) }
+
+            assertEquals(2, queue.cancelAllFor(fileA), "The in-flight and the pending query")
+            queue.setHoldInFlight(false)
+
+            assertFailsWith<CancellationException> { inFlight.await() }
+            assertFailsWith<CancellationException> { pending.await() }
+            assertTrue(other.await().isNotEmpty(), "Only the cancelled callers should fail")
+
+            queue.deleteFile(fileB)
+            queue.deleteFile(fileA)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun completed_requests_are_not_cancelled() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val names = queue.getArtboardNames(fileHandle)
+
+            assertEquals(0, queue.cancelAllFor(fileHandle), "Nothing is left to cancel")
+            // A later request gets its own result, not a stale cancellation
+            assertEquals(names, queue.getArtboardNames(fileHandle))
+
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    /** Waits until the worker has taken every queued request. */
+    private suspend fun awaitNothingPending(queue: CommandQueue) = withContext(Dispatchers.Default) {
+        withTimeout(5_000) {
+            while (queue.getQueueStats().getValue(CommandClass.ORDERED).pending > 0L) {
+                delay(1)
+            }
+        }
+    }
+}
@@ -0,0 +1,104 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Phase G.6 tests for CommandQueue command capture and replay.
+ */
+class MpCommandQueueCaptureTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun stop_without_capture_writes_nothing() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            assertFalse(queue.stopCommandCapture(""))
+
+            // An empty path discards a running capture.
+            queue.startCommandCapture(2.seconds)
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            queue.deleteFile(fileHandle)
+            assertFalse(queue.stopCommandCapture(""))
+            assertFalse(queue.stopCommandCapture(""), "The capture should already be stopped")
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun capture_from_start_replays_without_errors() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val path = MpTestContext.tempFilePath("capture_from_start.rvcp")
+            queue.startCommandCapture()
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createDefaultStateMachine(artboardHandle)
+            repeat(10) {
+                queue.advanceStateMachine(smHandle, 0.016f)
+            }
+            queue.getStateMachineNames(artboardHandle)
+            assertTrue(queue.stopCommandCapture(path))
+
+            val report = assertNotNull(queue.replayCommandCapture(path))
+            // Load, both synchronous creates, the advances and the query
+            assertEquals(14, report.commandCount)
+            assertEquals(0, report.errorCount, "Every replayed handle should resolve")
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun mid_session_capture_is_rejected() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val path = MpTestContext.tempFilePath("capture_mid_session.rvcp")
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createDefaultStateMachine(artboardHandle)
+
+            // A flight recorder switched on after the objects it drives were created
+            queue.startCommandCapture(2.seconds)
+            repeat(10) {
+                queue.advanceStateMachine(smHandle, 0.016f)
+            }
+            queue.getStateMachineNames(artboardHandle)
+            assertTrue(queue.stopCommandCapture(path), "The capture itself should be written")
+
+            assertNull(
+                queue.replayCommandCapture(path),
+                "A capture that refers to handles created before it should be rejected"
+            )
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun replay_of_missing_file_returns_null() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            assertNull(queue.replayCommandCapture("/nonexistent/rive_capture.bin"))
+            assertFailsWith<IllegalArgumentException> {
+                queue.startCommandCapture((-1).milliseconds)
+            }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
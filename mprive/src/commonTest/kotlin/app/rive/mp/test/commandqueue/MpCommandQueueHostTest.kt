@@ -0,0 +1,63 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.CommandQueue
+import app.rive.mp.CommandQueueHost
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.10 tests for command queues sharing one host thread.
+ */
+class MpCommandQueueHostTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun hosted_queues_run_independently() = runTest {
+        val host = CommandQueueHost()
+        val first = MpCommandQueueTestUtil(this, commandQueue = CommandQueue(host))
+        val second = MpCommandQueueTestUtil(this, commandQueue = CommandQueue(host, weight = 4))
+        try {
+            assertTrue(first.commandQueue.isHosted)
+            assertEquals(2, host.getQueueCount())
+
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val firstFile = first.commandQueue.loadFile(bytes)
+            val secondFile = second.commandQueue.loadFile(bytes)
+
+            // Each queue owns its resources: deleting one queue's file leaves the other's usable
+            second.commandQueue.deleteFile(secondFile)
+            val firstArtboard = first.commandQueue.createDefaultArtboard(firstFile)
+            assertTrue(first.commandQueue.getArtboardNames(firstFile).isNotEmpty())
+
+            first.commandQueue.deleteArtboard(firstArtboard)
+            first.commandQueue.deleteFile(firstFile)
+        } finally {
+            first.cleanup()
+            second.cleanup()
+        }
+
+        // The queues released their references; the host goes away with ours
+        assertEquals(0, host.getQueueCount())
+        host.release("test", "cleanup")
+        assertTrue(host.isDisposed)
+    }
+
+    @Test
+    fun invalid_weight_is_rejected() {
+        val host = CommandQueueHost()
+        try {
+            assertFailsWith<IllegalArgumentException> {
+                CommandQueue(host, weight = 0)
+            }
+        } finally {
+            host.release("test", "cleanup")
+        }
+    }
+}
@@ -0,0 +1,35 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.core.InputEventKind
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.4 tests for CommandQueue input-to-present latency reporting.
+ */
+class MpCommandQueueLatencyTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun latency_stats_cover_every_input_kind() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            queue.resetInputLatencyStats()
+
+            val stats = queue.getInputLatencyStats()
+            assertEquals(InputEventKind.entries.toSet(), stats.keys)
+            stats.values.forEach {
+                assertEquals(0L, it.count, "No input has been presented yet")
+                assertTrue(it.min <= it.p50 && it.p50 <= it.p90 && it.p90 <= it.p99 && it.p99 <= it.max)
+            }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
@@ -0,0 +1,40 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.13 tests for lazily created GPU resources.
+ */
+class MpCommandQueueLazyResourcesTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun lazy_import_keeps_file_usable() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        val commandQueue = testUtil.commandQueue
+        try {
+            commandQueue.setLazyGpuResources(true)
+            val fileHandle = commandQueue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            assertTrue(commandQueue.getArtboardNames(fileHandle).isNotEmpty())
+
+            val artboardHandle = commandQueue.createDefaultArtboard(fileHandle)
+            val stats = commandQueue.lazyGpuResourceStats()
+            assertTrue(stats.materializedObjects <= stats.liveObjects)
+            assertEquals(0L, stats.materializations, "Nothing is created before the first draw")
+
+            commandQueue.deleteArtboard(artboardHandle)
+            commandQueue.deleteFile(fileHandle)
+            commandQueue.setLazyGpuResources(false)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
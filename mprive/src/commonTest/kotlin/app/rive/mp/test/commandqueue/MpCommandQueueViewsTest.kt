@@ -0,0 +1,119 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.core.CommandClass
+import app.rive.mp.core.OverflowPolicy
+import app.rive.mp.core.QueuePolicy
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.11 tests for views driven by the server's frame loop.
+ */
+class MpCommandQueueViewsTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun registered_view_keeps_frame_loop_awake_until_unregistered() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        val commandQueue = testUtil.commandQueue
+        try {
+            val fileHandle = commandQueue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = commandQueue.createDefaultArtboard(fileHandle)
+            val smHandle = commandQueue.createDefaultStateMachine(artboardHandle)
+            val surface = commandQueue.createImageSurface(64, 64, commandQueue.createDrawKey())
+
+            assertTrue(commandQueue.viewsIdle, "No views registered yet")
+
+            val view = commandQueue.registerView(artboardHandle, smHandle, surface)
+            assertFalse(commandQueue.viewsIdle, "A new view needs a first frame")
+
+            // Updating reuses the handle
+            assertEquals(view, commandQueue.registerView(artboardHandle, smHandle, surface, view = view))
+
+            commandQueue.tickFrame(1f / 60f)
+            commandQueue.tickFrame(1f / 60f)
+            commandQueue.unregisterView(view)
+
+            // Round-trip through the queue so the unregister has run
+            commandQueue.getArtboardNames(fileHandle)
+            assertTrue(commandQueue.viewsIdle, "Nothing to tick once the last view is gone")
+
+            commandQueue.destroyRiveSurface(surface)
+            commandQueue.deleteStateMachine(smHandle)
+            commandQueue.deleteArtboard(artboardHandle)
+            commandQueue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun view_without_state_machine_settles() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        val commandQueue = testUtil.commandQueue
+        try {
+            val fileHandle = commandQueue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = commandQueue.createDefaultArtboard(fileHandle)
+            val surface = commandQueue.createImageSurface(64, 64, commandQueue.createDrawKey())
+
+            val view = commandQueue.registerView(artboardHandle, null, surface)
+            assertFalse(commandQueue.viewsIdle, "A new view needs a first frame")
+
+            // The artboard advances on its own until an advance changes nothing
+            var ticks = 0
+            while (!commandQueue.viewsIdle && ticks < 30) {
+                commandQueue.tickFrame(1f / 60f)
+                commandQueue.getArtboardNames(fileHandle)
+                ticks++
+            }
+            assertTrue(commandQueue.viewsIdle, "A view without a state machine should settle")
+            assertTrue(ticks > 0)
+
+            // Resizing its artboard wakes it again
+            commandQueue.resizeArtboard(artboardHandle, 32, 32)
+            commandQueue.getArtboardNames(fileHandle)
+            assertFalse(commandQueue.viewsIdle, "A resize should wake the artboard's view")
+
+            commandQueue.unregisterView(view)
+            commandQueue.destroyRiveSurface(surface)
+            commandQueue.deleteArtboard(artboardHandle)
+            commandQueue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun frame_ticks_are_never_dropped() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        val commandQueue = testUtil.commandQueue
+        try {
+            assertTrue(
+                commandQueue.setQueuePolicy(CommandClass.ADVANCE, QueuePolicy(OverflowPolicy.DROP_OLDEST, 1))
+            )
+            commandQueue.resetQueueStats()
+
+            // Hold the worker so the ticks pile up past the capacity
+            commandQueue.setWorkerPaused(true)
+            try {
+                repeat(20) {
+                    commandQueue.tickFrame(1f / 60f)
+                }
+                val advance = commandQueue.getQueueStats().getValue(CommandClass.ADVANCE)
+                assertEquals(20L, advance.enqueued)
+                assertEquals(0L, advance.dropped, "Frame ticks must not be dropped")
+            } finally {
+                commandQueue.setWorkerPaused(false)
+            }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
@@ -0,0 +1,54 @@
+package app.rive.mp.test.commandqueue
+
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Phase G.3 tests for the CommandQueue stall watchdog.
+ */
+class MpCommandQueueWatchdogTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun slow_commands_are_bounded_and_ordered() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            // A 1ms threshold makes a file import very likely to be reported.
+            queue.setSlowCommandThreshold(1.milliseconds)
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            queue.deleteFile(fileHandle)
+
+            val slow = queue.getSlowCommands()
+            assertTrue(slow.size <= 32, "The slow command ring should be bounded")
+            assertTrue(queue.getSlowCommandCount() >= slow.size, "The total count includes rotated records")
+            assertEquals(slow.sortedBy { it.sequence }, slow, "Slow commands should be oldest first")
+            slow.forEach { assertTrue(it.commandType.isNotEmpty()) }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun threshold_must_not_be_negative() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            queue.setSlowCommandThreshold(Duration.ZERO)
+            assertFailsWith<IllegalArgumentException> {
+                queue.setSlowCommandThreshold((-1).milliseconds)
+            }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
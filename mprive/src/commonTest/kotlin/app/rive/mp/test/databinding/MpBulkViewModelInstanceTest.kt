@@ -0,0 +1,138 @@
+package app.rive.mp.test.databinding
+
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.15 tests for creating view model instances in bulk.
+ *
+ * Uses test file: data_bind_test_impl.riv (ViewModel "Test All").
+ */
+class MpBulkViewModelInstanceTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun instances_have_contiguous_handles() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val fileHandle = queue.loadFile(bytes)
+
+            val range = queue.createViewModelInstances(fileHandle, "Test All", 16)
+            assertEquals(16, range.count)
+            assertTrue(range.first > 0, "First handle should be positive")
+            assertEquals(
+                (range.first until range.first + 16).toList(),
+                range.map { it.handle }
+            )
+            assertEquals(range.first + 15, range[15].handle)
+            assertFailsWith<IndexOutOfBoundsException> { range[16] }
+
+            // Later handles come after the range
+            val single = queue.createDefaultViewModelInstance(fileHandle, "Test All")
+            assertTrue(single.handle >= range.first + 16, "Handle should follow the range")
+
+            range.forEach { queue.deleteViewModelInstance(it) }
+            queue.deleteViewModelInstance(single)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun instances_can_be_seeded() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val fileHandle = queue.loadFile(bytes)
+            val seed = queue.createDefaultViewModelInstance(fileHandle, "Test All")
+            queue.setNumberProperty(seed, "Test Num", 456f)
+            queue.setStringProperty(seed, "Test String", "Seeded")
+
+            val range = queue.createViewModelInstances(fileHandle, "Test All", 4, seed)
+            assertEquals(4, range.toList().distinct().size)
+            assertFalse(seed in range, "Seed should not be part of the range")
+
+            // Writes after the batch was created don't reach its instances
+            queue.setNumberProperty(seed, "Test Num", 789f)
+            assertEquals(456f, queue.getNumberProperty(range[0], "Test Num"))
+            assertEquals("Seeded", queue.getStringProperty(range[0], "Test String"))
+            assertEquals(456f, queue.getNumberProperty(range[3], "Test Num"))
+
+            range.forEach { queue.deleteViewModelInstance(it) }
+            queue.deleteViewModelInstance(seed)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun unknown_view_model_fails() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val fileHandle = queue.loadFile(bytes)
+
+            assertFailsWith<IllegalArgumentException> {
+                queue.createViewModelInstances(fileHandle, "Missing", 4)
+            }
+
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun deleting_the_file_drops_untouched_instances() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val fileHandle = queue.loadFile(bytes)
+            val range = queue.createViewModelInstances(fileHandle, "Test All", 4)
+            val value = queue.getNumberProperty(range[0], "Test Num")
+
+            queue.deleteFile(fileHandle)
+
+            // The instance already created outlives the file; the untouched ones are gone
+            assertEquals(value, queue.getNumberProperty(range[0], "Test Num"))
+            assertFailsWith<IllegalArgumentException> {
+                queue.getNumberProperty(range[1], "Test Num")
+            }
+            queue.deleteViewModelInstance(range[0])
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun non_positive_count_fails() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val fileHandle = queue.loadFile(bytes)
+
+            assertFailsWith<IllegalArgumentException> {
+                queue.createViewModelInstances(fileHandle, "Test All", 0)
+            }
+
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
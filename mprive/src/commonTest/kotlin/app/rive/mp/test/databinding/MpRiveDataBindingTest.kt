@@ -296,6 +296,47 @@ class MpRiveDataBindingTest {
         }
     }
 
+    @Test
+    fun setStringProperty_roundTripsSupplementaryAndMalformedText() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val fileHandle = testUtil.commandQueue.loadFile(bytes)
+            val vmiHandle = testUtil.commandQueue.createDefaultViewModelInstance(
+                fileHandle,
+                "Test All"
+            )
+
+            // Outside the BMP: an emoji and a CJK Extension B ideograph, as surrogate pairs.
+            // Long enough to leave the stack buffers in JStringToStdString/StdStringToJString.
+            val supplementary = "Score \uD83C\uDFC6 \uD840\uDC0B é".repeat(40)
+            testUtil.commandQueue.setStringProperty(vmiHandle, "Test String", supplementary)
+            assertEquals(
+                supplementary,
+                testUtil.commandQueue.getStringProperty(vmiHandle, "Test String"),
+                "Surrogate pairs should survive the trip through UTF-8"
+            )
+
+            // Unpaired surrogates have no UTF-8 encoding and come back as U+FFFD.
+            testUtil.commandQueue.setStringProperty(
+                vmiHandle,
+                "Test String",
+                "a\uD83Cb\uDFC6c\uD83C"
+            )
+            assertEquals(
+                "a\uFFFDb\uFFFDc\uFFFD",
+                testUtil.commandQueue.getStringProperty(vmiHandle, "Test String"),
+                "Unpaired surrogates should be replaced"
+            )
+
+            // Cleanup
+            testUtil.commandQueue.deleteViewModelInstance(vmiHandle)
+            testUtil.commandQueue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
     @Test
     fun getBooleanProperty_returnsDefaultValue() = runTest {
         val testUtil = MpCommandQueueTestUtil(this)
@@ -0,0 +1,51 @@
+package app.rive.mp.test.file
+
+import app.rive.mp.core.SyntheticRiv
+import app.rive.mp.core.SyntheticRivSpec
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.14 tests for importing a subset of a file's artboards.
+ */
+class MpPartialImportTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun only_selected_artboards_are_imported() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = SyntheticRiv.generate(SyntheticRivSpec(artboardCount = 5))
+            val fileHandle = queue.loadFile(bytes, listOf("Artboard 3", "Artboard 1"))
+
+            // Kept artboards stay in file order
+            assertEquals(listOf("Artboard 1", "Artboard 3"), queue.getArtboardNames(fileHandle))
+            val artboardHandle = queue.createArtboardByName(fileHandle, "Artboard 3")
+            assertEquals(listOf("State Machine"), queue.getStateMachineNames(artboardHandle))
+
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun unknown_artboard_fails_the_load() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val bytes = SyntheticRiv.generate(SyntheticRivSpec(artboardCount = 2))
+            assertFailsWith<IllegalArgumentException> {
+                testUtil.commandQueue.loadFile(bytes, listOf("Missing"))
+            }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
@@ -0,0 +1,36 @@
+package app.rive.mp.test.file
+
+import app.rive.mp.core.RivAnalyzer
+import app.rive.mp.core.SyntheticRiv
+import app.rive.mp.core.SyntheticRivSpec
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlin.test.*
+
+/**
+ * Phase G.8 tests for the static .riv analyzer.
+ */
+class MpRivAnalyzerTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun report_covers_every_artboard() {
+        val bytes = SyntheticRiv.generate(SyntheticRivSpec(artboardCount = 2, shapesPerArtboard = 4))
+        val report = assertNotNull(RivAnalyzer.analyze(bytes))
+
+        assertTrue(report.startsWith("{") && report.endsWith("}"))
+        assertTrue(report.contains("\"name\":\"Artboard 0\""))
+        assertTrue(report.contains("\"name\":\"Artboard 1\""))
+        assertTrue(report.contains("\"shapeCount\":4"))
+        assertTrue(report.contains("\"costScore\":"))
+    }
+
+    @Test
+    fun junk_file_has_no_report() {
+        assertNull(RivAnalyzer.analyze(MpTestResources.loadRiveFile("junk.riv")))
+    }
+}
@@ -0,0 +1,143 @@
+package app.rive.mp.test.file
+
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import app.rive.mp.CommandQueue
+import app.rive.mp.FileHandle
+import kotlinx.coroutines.Dispatchers
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.test.runTest
+import kotlinx.coroutines.withContext
+import kotlin.test.*
+
+/**
+ * Phase G.9 tests for sharing imported files across command queues.
+ */
+class MpSharedFileTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun identical_bytes_share_one_file() = runTest {
+        val first = MpCommandQueueTestUtil(this)
+        val second = MpCommandQueueTestUtil(this)
+        try {
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val before = first.commandQueue.getSharedFileCount()
+
+            val firstHandle = first.commandQueue.loadFile(bytes)
+            val secondHandle = second.commandQueue.loadFile(bytes)
+            assertEquals(before + 1, first.commandQueue.getSharedFileCount())
+
+            // Each queue instances the shared file into its own objects
+            val artboard = second.commandQueue.createDefaultArtboard(secondHandle)
+            second.commandQueue.deleteArtboard(artboard)
+
+            first.commandQueue.deleteFile(firstHandle)
+            second.commandQueue.deleteFile(secondHandle)
+        } finally {
+            first.cleanup()
+            second.cleanup()
+        }
+    }
+
+    /**
+     * Each view model lookup adds a runtime to the file, so two queues creating instances from
+     * one shared file at the same time must not corrupt it. Covers the direct creates and the
+     * lazily created members of a batch.
+     */
+    @Test
+    fun queues_create_instances_of_a_shared_file_concurrently() = runTest {
+        val first = MpCommandQueueTestUtil(this)
+        val second = MpCommandQueueTestUtil(this)
+        try {
+            val bytes = MpTestResources.loadRiveFile("data_bind_test_impl.riv")
+            val before = first.commandQueue.getSharedFileCount()
+            val firstHandle = first.commandQueue.loadFile(bytes)
+            val secondHandle = second.commandQueue.loadFile(bytes)
+            assertEquals(before + 1, first.commandQueue.getSharedFileCount(), "The file should be shared")
+
+            val results = withContext(Dispatchers.Default) {
+                listOf(
+                    first.commandQueue to firstHandle,
+                    second.commandQueue to secondHandle
+                ).map { (queue, fileHandle) ->
+                    async { createInstances(queue, fileHandle) }
+                }.awaitAll()
+            }
+
+            assertEquals(results[0], results[1], "Both queues should see the same values")
+            assertTrue(results[0].take(INSTANCE_COUNT).all { it == 123f }, "Named instances read 123")
+
+            first.commandQueue.deleteFile(firstHandle)
+            second.commandQueue.deleteFile(secondHandle)
+        } finally {
+            first.cleanup()
+            second.cleanup()
+        }
+    }
+
+    private suspend fun createInstances(queue: CommandQueue, fileHandle: FileHandle): List<Float> {
+        val values = mutableListOf<Float>()
+        repeat(INSTANCE_COUNT) {
+            val vmi = queue.createNamedViewModelInstance(fileHandle, "Test All", "Test Default")
+            values += queue.getNumberProperty(vmi, "Test Num")
+            queue.deleteViewModelInstance(vmi)
+        }
+        repeat(INSTANCE_COUNT) {
+            val vmi = queue.createBlankViewModelInstance(fileHandle, "Test All")
+            values += queue.getNumberProperty(vmi, "Test Num")
+            queue.deleteViewModelInstance(vmi)
+        }
+        // Batch members are created by the first command that uses them
+        val batch = queue.createViewModelInstances(fileHandle, "Test All", INSTANCE_COUNT)
+        for (vmi in batch) {
+            values += queue.getNumberProperty(vmi, "Test Num")
+            queue.deleteViewModelInstance(vmi)
+        }
+        return values
+    }
+
+    @Test
+    fun attach_by_key() = runTest {
+        val first = MpCommandQueueTestUtil(this)
+        val second = MpCommandQueueTestUtil(this)
+        try {
+            val bytes = MpTestResources.loadRiveFile("flux_capacitor")
+            val fileHandle = first.commandQueue.loadFile(bytes)
+
+            val attached = second.commandQueue.attachSharedFile(second.commandQueue.sharedFileKey(bytes))
+            assertEquals(
+                first.commandQueue.getArtboardNames(fileHandle),
+                second.commandQueue.getArtboardNames(attached)
+            )
+
+            second.commandQueue.deleteFile(attached)
+            first.commandQueue.deleteFile(fileHandle)
+        } finally {
+            first.cleanup()
+            second.cleanup()
+        }
+    }
+
+    @Test
+    fun attach_unknown_key_fails() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            assertFailsWith<IllegalArgumentException> {
+                testUtil.commandQueue.attachSharedFile(0x1234L)
+            }
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    private companion object {
+        const val INSTANCE_COUNT = 100
+    }
+}
@@ -0,0 +1,46 @@
+package app.rive.mp.test.file
+
+import app.rive.mp.core.SyntheticRiv
+import app.rive.mp.core.SyntheticRivSpec
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import kotlinx.coroutines.test.runTest
+import kotlin.test.*
+
+/**
+ * Phase G.7 tests for the synthetic .riv generator.
+ */
+class MpSyntheticRivTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    @Test
+    fun generated_file_loads_with_requested_shape() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = SyntheticRiv.generate(
+                SyntheticRivSpec(artboardCount = 3, shapesPerArtboard = 5, nestingDepth = 2, stateMachineStates = 3)
+            )
+            val fileHandle = queue.loadFile(bytes)
+
+            assertEquals(listOf("Artboard 0", "Artboard 1", "Artboard 2"), queue.getArtboardNames(fileHandle))
+            val artboardHandle = queue.createArtboardByName(fileHandle, "Artboard 1")
+            assertEquals(listOf("State Machine"), queue.getStateMachineNames(artboardHandle))
+
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    @Test
+    fun negative_counts_are_rejected() {
+        assertFailsWith<IllegalArgumentException> {
+            SyntheticRivSpec(listLength = -1)
+        }
+    }
+}
@@ -0,0 +1,114 @@
+package app.rive.mp.test.statemachine
+
+import app.rive.mp.CommandQueue
+import app.rive.mp.StateMachineHandle
+import app.rive.mp.event.EventFilter
+import app.rive.mp.event.EventType
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Phase G.16 tests for filtering reported events on the command thread.
+ *
+ * Uses test file: events_test.riv ("State Machine 1" reports "SomeGeneralEvent" when
+ * "FireGeneralEvent" fires, and "SomeOpenUrlEvent" when "FireOpenUrlEvent" fires).
+ */
+class MpRiveEventFilterTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    private val bothEvents = listOf("SomeGeneralEvent", "SomeOpenUrlEvent")
+
+    @Test
+    fun eventFilters_all_reportsEveryEvent() = runTest {
+        withEventsStateMachine { queue, smHandle ->
+            queue.setEventFilter(smHandle, EventFilter.All)
+            fireBothEvents(queue, smHandle)
+
+            assertEquals(2, queue.getReportedEventCount(smHandle))
+            assertEquals(bothEvents, queue.getReportedEvents(smHandle).map { it.name })
+        }
+    }
+
+    @Test
+    fun eventFilters_none_reportsNothing() = runTest {
+        withEventsStateMachine { queue, smHandle ->
+            queue.setEventFilter(smHandle, EventFilter.None)
+            fireBothEvents(queue, smHandle)
+
+            assertEquals(0, queue.getReportedEventCount(smHandle))
+            assertEquals(emptyList(), queue.getReportedEvents(smHandle))
+        }
+    }
+
+    @Test
+    fun eventFilters_matching_byNameOrType() = runTest {
+        withEventsStateMachine { queue, smHandle ->
+            queue.setEventFilter(smHandle, EventFilter.Matching(names = setOf("SomeGeneralEvent")))
+            fireBothEvents(queue, smHandle)
+            assertEquals(1, queue.getReportedEventCount(smHandle))
+            assertEquals("SomeGeneralEvent", queue.getReportedEventAt(smHandle, 0).name)
+
+            // Indices count only the events that pass
+            queue.setEventFilter(smHandle, EventFilter.Matching(types = setOf(EventType.OpenURLEvent)))
+            fireBothEvents(queue, smHandle)
+            assertEquals(1, queue.getReportedEventCount(smHandle))
+            assertEquals("SomeOpenUrlEvent", queue.getReportedEventAt(smHandle, 0).name)
+        }
+    }
+
+    @Test
+    fun eventFilters_changingTheFilter_refiltersTheLastAdvance() = runTest {
+        withEventsStateMachine { queue, smHandle ->
+            fireBothEvents(queue, smHandle)
+            assertEquals(bothEvents, queue.getReportedEvents(smHandle).map { it.name })
+
+            queue.setEventFilter(smHandle, EventFilter.None)
+            assertEquals(0, queue.getReportedEventCount(smHandle))
+
+            queue.setEventFilter(smHandle, EventFilter.Matching(names = setOf("SomeOpenUrlEvent")))
+            assertEquals(listOf("SomeOpenUrlEvent"), queue.getReportedEvents(smHandle).map { it.name })
+
+            // Removing the filter brings back every event
+            queue.setEventFilter(smHandle, EventFilter.All)
+            assertEquals(bothEvents, queue.getReportedEvents(smHandle).map { it.name })
+        }
+    }
+
+    /** Fires both events of "State Machine 1" within one advance. */
+    private fun fireBothEvents(queue: CommandQueue, smHandle: StateMachineHandle) {
+        queue.scheduleTrigger(smHandle, "FireGeneralEvent", 4.milliseconds)
+        queue.scheduleTrigger(smHandle, "FireOpenUrlEvent", 8.milliseconds)
+        queue.advanceStateMachine(smHandle, 0.016f)
+    }
+
+    private suspend fun CoroutineScope.withEventsStateMachine(
+        block: suspend (CommandQueue, StateMachineHandle) -> Unit
+    ) {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("events_test.riv"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createStateMachineByName(artboardHandle, "State Machine 1")
+
+            block(queue, smHandle)
+
+            // The filter is dropped with the state machine
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+}
@@ -0,0 +1,213 @@
+package app.rive.mp.test.statemachine
+
+import app.rive.mp.test.utils.MpCommandQueueTestUtil
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotEquals
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * Phase G.5 tests for inputs scheduled on the command thread.
+ */
+class MpRiveScheduledInputTest {
+
+    init {
+        MpTestContext.initPlatform()
+    }
+
+    /**
+     * Test that a scheduled trigger fires at its animation time, measured against the advance
+     * deltas, and that a cancelled one never fires.
+     */
+    @Test
+    fun scheduledInputs_fireAtTheirAnimationTime() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("events_test.riv")
+            val fileHandle = queue.loadFile(bytes)
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createStateMachineByName(artboardHandle, "State Machine 1")
+
+            val timer = queue.scheduleTrigger(smHandle, "FireGeneralEvent", 40.milliseconds)
+            val cancelled = queue.scheduleTrigger(smHandle, "FireOpenUrlEvent", 20.milliseconds)
+            assertNotEquals(timer, cancelled)
+            queue.cancelScheduledInput(cancelled)
+
+            // 0-16ms and 16-32ms are before the trigger
+            repeat(2) {
+                queue.advanceStateMachine(smHandle, 0.016f)
+                assertEquals(0, queue.getReportedEventCount(smHandle), "Fired before 40ms")
+            }
+
+            // 32-48ms is split at 40ms, so the event occurs in the last 8ms of the advance
+            queue.advanceStateMachine(smHandle, 0.016f)
+            val events = queue.getReportedEvents(smHandle)
+            assertEquals(listOf("SomeGeneralEvent"), events.map { it.name })
+            assertTrue(
+                events[0].delay in 0f..0.008f + TIME_TOLERANCE,
+                "The event should occur at or after 40ms, was ${0.048f - events[0].delay}s"
+            )
+
+            queue.advanceStateMachine(smHandle, 0.016f)
+            assertEquals(0, queue.getReportedEventCount(smHandle), "The timer should fire once")
+
+            assertFailsWith<IllegalArgumentException> {
+                queue.scheduleTrigger(smHandle, "FireGeneralEvent", (-1).milliseconds)
+            }
+
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    /**
+     * Test that events fired before a scheduled input splits the advance are still reported.
+     * Each step of the split advance clears the runtime's reports, so only the last step's
+     * events used to be visible.
+     */
+    @Test
+    fun scheduledInputs_keepEventsFromEarlierSteps() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("events_test.riv")
+            val fileHandle = queue.loadFile(bytes)
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createStateMachineByName(artboardHandle, "State Machine 1")
+
+            // The advance is split at 4ms and 8ms: the general event fires in the 4-8ms step,
+            // the open URL event in the last one.
+            queue.scheduleTrigger(smHandle, "FireGeneralEvent", 4.milliseconds)
+            queue.scheduleTrigger(smHandle, "FireOpenUrlEvent", 8.milliseconds)
+            queue.advanceStateMachine(smHandle, 0.016f)
+
+            val events = queue.getReportedEvents(smHandle)
+            assertEquals(listOf("SomeGeneralEvent", "SomeOpenUrlEvent"), events.map { it.name })
+            assertTrue(
+                events[0].delay > events[1].delay,
+                "The earlier event should be further from the end of the advance"
+            )
+
+            // The next advance starts a new frame.
+            queue.advanceStateMachine(smHandle, 0.016f)
+            assertEquals(0, queue.getReportedEventCount(smHandle))
+
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    /**
+     * Test that a delayed event is held until the advance that reaches its delivery time and is
+     * reported with the delay left over from that advance. A second state machine without the
+     * delay gives the time the event occurred.
+     */
+    @Test
+    fun delayedEvents_arriveAfterTheirDelay() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("events_test.riv")
+            val fileHandle = queue.loadFile(bytes)
+            val liveArtboard = queue.createDefaultArtboard(fileHandle)
+            val liveSm = queue.createStateMachineByName(liveArtboard, "State Machine 1")
+            val delayedArtboard = queue.createDefaultArtboard(fileHandle)
+            val delayedSm = queue.createStateMachineByName(delayedArtboard, "State Machine 1")
+
+            queue.delayEvent(delayedSm, "SomeGeneralEvent", 40.milliseconds)
+            for (sm in listOf(liveSm, delayedSm)) {
+                queue.scheduleTrigger(sm, "FireGeneralEvent", 0.milliseconds)
+            }
+
+            val step = 0.016f
+            queue.advanceStateMachine(liveSm, step)
+            val live = queue.getReportedEvents(liveSm).single()
+            val occurredAt = step - live.delay
+            val dueTime = occurredAt + 0.040f
+
+            // Advance until well past the delivery time, recording where the event lands
+            val delivered = mutableListOf<Pair<Float, Float>>()
+            for (advance in 1..6) {
+                queue.advanceStateMachine(delayedSm, step)
+                val endTime = advance * step
+                queue.getReportedEvents(delayedSm).forEach { event ->
+                    assertEquals("SomeGeneralEvent", event.name)
+                    delivered += endTime to event.delay
+                }
+            }
+
+            assertEquals(1, delivered.size, "The delayed event should be reported once")
+            val (endTime, delay) = delivered.single()
+            assertTrue(
+                endTime - step < dueTime - TIME_TOLERANCE && dueTime <= endTime + TIME_TOLERANCE,
+                "Delivered in the advance ending at ${endTime}s, due at ${dueTime}s"
+            )
+            assertEquals(endTime - dueTime, delay, TIME_TOLERANCE)
+
+            queue.deleteStateMachine(delayedSm)
+            queue.deleteArtboard(delayedArtboard)
+            queue.deleteStateMachine(liveSm)
+            queue.deleteArtboard(liveArtboard)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    /**
+     * Test that only the named event is delayed and that cancelling the delay drops the events
+     * it is holding.
+     */
+    @Test
+    fun delayedEvents_cancelDropsHeldEvents() = runTest {
+        val testUtil = MpCommandQueueTestUtil(this)
+        try {
+            val queue = testUtil.commandQueue
+            val bytes = MpTestResources.loadRiveFile("events_test.riv")
+            val fileHandle = queue.loadFile(bytes)
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val smHandle = queue.createStateMachineByName(artboardHandle, "State Machine 1")
+
+            val delay = queue.delayEvent(smHandle, "SomeGeneralEvent", 100.milliseconds)
+            // As in scheduledInputs_keepEventsFromEarlierSteps, both fire within one advance
+            queue.scheduleTrigger(smHandle, "FireGeneralEvent", 4.milliseconds)
+            queue.scheduleTrigger(smHandle, "FireOpenUrlEvent", 8.milliseconds)
+            queue.advanceStateMachine(smHandle, 0.016f)
+            assertEquals(
+                listOf("SomeOpenUrlEvent"),
+                queue.getReportedEvents(smHandle).map { it.name },
+                "Only the delayed event should be held"
+            )
+
+            queue.cancelScheduledInput(delay)
+            repeat(10) {
+                queue.advanceStateMachine(smHandle, 0.016f)
+                assertEquals(0, queue.getReportedEventCount(smHandle), "A held event was delivered")
+            }
+
+            queue.deleteStateMachine(smHandle)
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            testUtil.cleanup()
+        }
+    }
+
+    private companion object {
+        /** Event delays are single precision seconds. */
+        const val TIME_TOLERANCE = 0.0005f
+    }
+}
@@ -30,12 +30,12 @@ import kotlinx.coroutines.launch
  */
 class MpCommandQueueTestUtil(
     private val testScope: CoroutineScope,
-    private val pollIntervalMs: Long = 16L  // ~60 FPS
-) {
+    private val pollIntervalMs: Long = 16L,  // ~60 FPS
     /**
      * The CommandQueue instance managed by this utility.
      */
     val commandQueue: CommandQueue = CommandQueue()
+) {
     
     /**
      * The polling job that calls pollMessages() periodically.
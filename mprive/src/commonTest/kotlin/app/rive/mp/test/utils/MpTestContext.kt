@@ -24,5 +24,11 @@ expect class MpTestContext() {
          * before any tests run.
          */
         fun initPlatform()
+
+        /**
+         * A path in a writable temporary directory, for tests that write files.
+         * An existing file at the path is deleted.
+         */
+        fun tempFilePath(name: String): String
     }
 }
@@ -0,0 +1,148 @@
+#include "helpers/headless_egl.hpp"
+#include "render_context.hpp"
+#include "rive_log.hpp"
+
+#include <EGL/eglext.h>
+#include <cstring>
+
+// Log prefix for HeadlessEGL messages (embedded in log strings since macros already provide LOG_TAG)
+#define HEGL_PREFIX "[HeadlessEGL] "
+
+namespace rive_mp
+{
+
+namespace
+{
+/** Whether a space-separated EGL extension string contains name. */
+bool hasExtension(const char* extensions, const char* name)
+{
+    if (extensions == nullptr)
+    {
+        return false;
+    }
+    const size_t length = std::strlen(name);
+    for (const char* at = std::strstr(extensions, name); at != nullptr;
+         at = std::strstr(at + length, name))
+    {
+        const bool startsToken = at == extensions || at[-1] == ' ';
+        const bool endsToken = at[length] == ' ' || at[length] == '\0';
+        if (startsToken && endsToken)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+EGLDisplay getDisplay()
+{
+    const char* clientExtensions =
+        eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (hasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+    {
+        auto getPlatformDisplay =
+            reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+                eglGetProcAddress("eglGetPlatformDisplayEXT"));
+        if (getPlatformDisplay != nullptr)
+        {
+            EGLDisplay display =
+                getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+                                   EGL_DEFAULT_DISPLAY,
+                                   nullptr);
+            if (display != EGL_NO_DISPLAY)
+            {
+                LOGD(HEGL_PREFIX "Using Mesa surfaceless display");
+                return display;
+            }
+        }
+    }
+    LOGD(HEGL_PREFIX "Using default EGL display");
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+} // namespace
+
+bool CreateHeadlessEGL(HeadlessEGL* out)
+{
+    EGLDisplay display = getDisplay();
+    if (display == EGL_NO_DISPLAY)
+    {
+        LOGE(HEGL_PREFIX "Unable to get EGL display. Error: %s",
+             errorString(eglGetError()).c_str());
+        return false;
+    }
+
+    EGLint major = 0;
+    EGLint minor = 0;
+    if (!eglInitialize(display, &major, &minor))
+    {
+        LOGE(HEGL_PREFIX "eglInitialize failed. Error: %s",
+             errorString(eglGetError()).c_str());
+        return false;
+    }
+    LOGD(HEGL_PREFIX "EGL initialized with version %d.%d (%s)",
+         major,
+         minor,
+         eglQueryString(display, EGL_VENDOR));
+
+    if (!eglBindAPI(EGL_OPENGL_ES_API))
+    {
+        LOGE(HEGL_PREFIX "eglBindAPI failed. Error: %s",
+             errorString(eglGetError()).c_str());
+        return false;
+    }
+
+    const EGLint configAttributes[] = {
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_ES3_BIT_KHR,
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RED_SIZE, 8,
+        EGL_GREEN_SIZE, 8,
+        EGL_BLUE_SIZE, 8,
+        EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, 0,
+        EGL_STENCIL_SIZE, 8,
+        EGL_NONE,
+    };
+    EGLConfig config = nullptr;
+    EGLint configCount = 0;
+    if (!eglChooseConfig(display, configAttributes, &config, 1, &configCount) ||
+        configCount < 1)
+    {
+        LOGE(HEGL_PREFIX "Unable to find a suitable EGL config. Error: %s",
+             errorString(eglGetError()).c_str());
+        return false;
+    }
+
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_CLIENT_VERSION, 3,
+        EGL_NONE,
+    };
+    EGLContext context =
+        eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+    if (context == EGL_NO_CONTEXT)
+    {
+        LOGE(HEGL_PREFIX "Unable to create EGL context. Error: %s",
+             errorString(eglGetError()).c_str());
+        return false;
+    }
+
+    out->display = display;
+    out->config = config;
+    out->context = context;
+    return true;
+}
+
+void DestroyHeadlessEGL(HeadlessEGL* egl)
+{
+    if (egl->context != EGL_NO_CONTEXT)
+    {
+        LOGD(HEGL_PREFIX "Destroying EGL context");
+        if (!eglDestroyContext(egl->display, egl->context))
+        {
+            LOGE(HEGL_PREFIX "eglDestroyContext failed. Error: %s",
+                 errorString(eglGetError()).c_str());
+        }
+        egl->context = EGL_NO_CONTEXT;
+    }
+}
+
+} // namespace rive_mp
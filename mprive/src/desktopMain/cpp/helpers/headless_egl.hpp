@@ -0,0 +1,43 @@
+#pragma once
+
+#include <EGL/egl.h>
+
+namespace rive_mp
+{
+
+/**
+ * EGL objects for headless rendering on Linux desktop.
+ *
+ * The display comes from Mesa's surfaceless platform
+ * (EGL_MESA_platform_surfaceless) when the driver offers it, so no X11 or
+ * Wayland connection is needed; otherwise the default display is used. With
+ * LIBGL_ALWAYS_SOFTWARE=1 Mesa renders on llvmpipe, which makes rendering
+ * available on CI machines without a GPU.
+ *
+ * The config supports PBuffer surfaces only, with 8 bits per channel RGBA and
+ * an 8-bit stencil buffer, matching the Android RenderContextGL config.
+ */
+struct HeadlessEGL
+{
+    EGLDisplay display = EGL_NO_DISPLAY;
+    EGLConfig config = nullptr;
+    EGLContext context = EGL_NO_CONTEXT;
+};
+
+/**
+ * Initialize a display, choose a config, and create an OpenGL ES 3 context.
+ *
+ * @param out Receives the EGL objects; left untouched on failure.
+ * @return Whether every EGL object was created.
+ */
+bool CreateHeadlessEGL(HeadlessEGL* out);
+
+/**
+ * Destroy the context created by CreateHeadlessEGL.
+ *
+ * The display is not terminated: EGL displays are per process, and other
+ * headless contexts may still be using it.
+ */
+void DestroyHeadlessEGL(HeadlessEGL* egl);
+
+} // namespace rive_mp
@@ -0,0 +1,56 @@
+#include "helpers/render_context_headless.hpp"
+#include "rive_log.hpp"
+
+namespace rive_mp
+{
+
+void RenderContextGL::createAndroidFactory()
+{
+    // Desktop builds link rive-runtime's image decoders, so the Rive GPU
+    // context is used as the factory directly.
+    LOGD("[RenderContext] Using rive-runtime image decoders (no platform factory)");
+}
+
+RenderContextHeadlessGL* RenderContextHeadlessGL::Make()
+{
+    HeadlessEGL egl;
+    if (!CreateHeadlessEGL(&egl))
+    {
+        return nullptr;
+    }
+    return new RenderContextHeadlessGL(egl);
+}
+
+RenderContextHeadlessGL::RenderContextHeadlessGL(const HeadlessEGL& egl) :
+    RenderContextGL(egl.display, egl.context), m_egl(egl)
+{}
+
+RenderContextHeadlessGL::~RenderContextHeadlessGL()
+{
+    // destroy() has already released the context on the render thread
+    DestroyHeadlessEGL(&m_egl);
+}
+
+EGLSurface RenderContextHeadlessGL::makePBufferSurface(int32_t width,
+                                                       int32_t height)
+{
+    const EGLint attributes[] = {EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE};
+    auto surface = eglCreatePbufferSurface(m_egl.display, m_egl.config, attributes);
+    if (surface == EGL_NO_SURFACE)
+    {
+        LOGE(RC_PREFIX "eglCreatePbufferSurface failed. Error: %s",
+             errorString(eglGetError()).c_str());
+    }
+    return surface;
+}
+
+void RenderContextHeadlessGL::destroySurface(EGLSurface surface)
+{
+    if (!eglDestroySurface(m_egl.display, surface))
+    {
+        LOGE(RC_PREFIX "eglDestroySurface failed. Error: %s",
+             errorString(eglGetError()).c_str());
+    }
+}
+
+} // namespace rive_mp
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "helpers/headless_egl.hpp"
+#include "render_context.hpp"
+
+namespace rive_mp
+{
+
+/**
+ * RenderContextGL for Linux desktop on a natively created, headless EGL
+ * context.
+ *
+ * On Android the EGL display and context come from Kotlin (EGL14). The JVM has
+ * no EGL bindings, so this context creates and owns them itself. Rendering
+ * goes to PBuffer surfaces created with makePBufferSurface(); drawToBuffer
+ * reads them back like on Android.
+ *
+ * Images are decoded by rive-runtime's decoders rather than a platform
+ * factory, so getFactory() returns the Rive GPU context directly.
+ */
+struct RenderContextHeadlessGL : RenderContextGL
+{
+    /**
+     * Create the EGL objects and the render context.
+     *
+     * @return The new context, or nullptr if EGL could not be initialized.
+     */
+    static RenderContextHeadlessGL* Make();
+
+    ~RenderContextHeadlessGL() override;
+
+    /**
+     * Create a PBuffer surface with this context's config.
+     *
+     * @return The surface, or EGL_NO_SURFACE on failure.
+     */
+    EGLSurface makePBufferSurface(int32_t width, int32_t height);
+
+    /** Destroy a surface created by makePBufferSurface(). */
+    void destroySurface(EGLSurface surface);
+
+private:
+    explicit RenderContextHeadlessGL(const HeadlessEGL& egl);
+
+    HeadlessEGL m_egl;
+};
+
+} // namespace rive_mp
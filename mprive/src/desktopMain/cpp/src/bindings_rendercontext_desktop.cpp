@@ -0,0 +1,102 @@
+/**
+ * JNI bindings for RenderContextHeadlessGL.
+ * 
+ * These bindings let Kotlin create a headless EGL render context on Linux
+ * desktop and the PBuffer surfaces it renders into. Unlike Android, the EGL
+ * objects are created natively since the JVM has no EGL bindings.
+ */
+
+#include <jni.h>
+#include "helpers/render_context_headless.hpp"
+#include "rive_log.hpp"
+
+// Log prefix for RenderContextJNI messages (embedded in log strings since macros already provide LOG_TAG)
+#define RCJNI_PREFIX "[RenderContextJNI] "
+
+extern "C" {
+
+/**
+ * Creates a new RenderContextHeadlessGL with its own EGL display and context.
+ * 
+ * @return Pointer to the new RenderContextHeadlessGL object, or 0 on failure
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_RenderContextHeadlessGL_cppConstructor(
+    JNIEnv* env,
+    jobject thiz
+) {
+    LOGD(RCJNI_PREFIX "Creating RenderContextHeadlessGL");
+    
+    auto* renderContext = rive_mp::RenderContextHeadlessGL::Make();
+    if (renderContext == nullptr) {
+        LOGE(RCJNI_PREFIX "Failed to create headless EGL context");
+        return 0;
+    }
+    
+    LOGD(RCJNI_PREFIX "RenderContextHeadlessGL created successfully");
+    return reinterpret_cast<jlong>(renderContext);
+}
+
+/**
+ * Deletes a RenderContextHeadlessGL object and its EGL context.
+ * 
+ * @param pointer Pointer to the RenderContextHeadlessGL object to delete
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_RenderContextHeadlessGL_cppDelete(
+    JNIEnv* env,
+    jobject thiz,
+    jlong pointer
+) {
+    LOGD(RCJNI_PREFIX "Deleting RenderContextHeadlessGL");
+    
+    auto* renderContext = reinterpret_cast<rive_mp::RenderContextHeadlessGL*>(pointer);
+    if (renderContext) {
+        delete renderContext;
+    }
+}
+
+/**
+ * Creates a PBuffer surface to render into.
+ * 
+ * @param pointer Pointer to the RenderContextHeadlessGL object
+ * @param width Surface width in pixels
+ * @param height Surface height in pixels
+ * @return The EGLSurface handle, or 0 on failure
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_RenderContextHeadlessGL_cppCreatePBufferSurface(
+    JNIEnv* env,
+    jobject thiz,
+    jlong pointer,
+    jint width,
+    jint height
+) {
+    auto* renderContext = reinterpret_cast<rive_mp::RenderContextHeadlessGL*>(pointer);
+    if (renderContext == nullptr) {
+        return 0;
+    }
+    EGLSurface surface = renderContext->makePBufferSurface(width, height);
+    return surface == EGL_NO_SURFACE ? 0 : reinterpret_cast<jlong>(surface);
+}
+
+/**
+ * Destroys a PBuffer surface created by cppCreatePBufferSurface.
+ * 
+ * @param pointer Pointer to the RenderContextHeadlessGL object
+ * @param surface The EGLSurface handle
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_RenderContextHeadlessGL_cppDestroySurface(
+    JNIEnv* env,
+    jobject thiz,
+    jlong pointer,
+    jlong surface
+) {
+    auto* renderContext = reinterpret_cast<rive_mp::RenderContextHeadlessGL*>(pointer);
+    if (renderContext != nullptr && surface != 0) {
+        renderContext->destroySurface(reinterpret_cast<EGLSurface>(surface));
+    }
+}
+
+} // extern "C"
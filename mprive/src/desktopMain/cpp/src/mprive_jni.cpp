@@ -0,0 +1,38 @@
+/**
+ * JNI entry point for mprive desktop (Linux) native library.
+ * 
+ * This file provides JNI initialization for the desktop JVM.
+ * Additional JNI bindings are implemented in nativeInterop/cpp/src/bindings/ files.
+ */
+
+#include <jni.h>
+#include "jni_refs.hpp"
+#include "rive_log.hpp"
+
+extern "C" {
+
+/**
+ * Called when the native library is loaded.
+ * Stores the JVM pointer and initializes the logging system.
+ */
+JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void* reserved) {
+    rive_mp::g_JVM = vm;
+    
+    // Initialize logging
+    rive_mp::InitializeRiveLog();
+    
+    LOGI("mprive-desktop native library loaded");
+    LOGD("JNI_OnLoad completed successfully");
+    
+    return JNI_VERSION_1_6;
+}
+
+/**
+ * Called when the native library is unloaded.
+ */
+JNIEXPORT void JNICALL JNI_OnUnload(JavaVM* vm, void* reserved) {
+    LOGD("mprive-desktop native library unloading");
+    rive_mp::g_JVM = nullptr;
+}
+
+} // extern "C"
@@ -1,16 +1,20 @@
 package app.rive.mp
 
+import app.rive.mp.core.UniquePointer
+
 /**
  * Desktop-specific stub implementation of RenderContext.
- * Phase A: Minimal stub for compilation. Full implementation in Phase C/F.
+ *
+ * Used when libmprive-desktop.so is not available on this machine, so that code which does not
+ * render still runs.
  */
 internal class RenderContextDesktopStub : RenderContext() {
     override val nativeObjectPointer: Long = 0L
-    
+
     override fun createSurface(drawKey: DrawKey, commandQueue: CommandQueue): RiveSurface {
         TODO("Phase C: Desktop surface creation not yet implemented")
     }
-    
+
     override fun createImageSurface(
         width: Int,
         height: Int,
@@ -19,19 +23,146 @@ internal class RenderContextDesktopStub : RenderContext() {
     ): RiveSurface {
         TODO("Phase C: Desktop image surface creation not yet implemented")
     }
-    
+
     override fun close() {
         // Stub - nothing to clean up yet
     }
-    
+
     override val closed: Boolean = false
 }
 
 /**
- * Desktop-specific actual implementation of createDefaultRenderContext.
- * Phase A: Returns a stub. Full implementation in Phase C/F.
+ * Headless OpenGL ES rendering context for Linux desktop.
+ *
+ * There is no `android.opengl.EGL14` on the JVM, so unlike the Android RenderContextGL the EGL
+ * display, config, and context are created natively. The display is Mesa's surfaceless platform
+ * when available (falling back to the default display), which renders on the GPU driver or on
+ * llvmpipe without a window system, e.g. on CI machines.
+ *
+ * Only off-screen rendering is supported: [createImageSurface] creates EGL PBuffer surfaces, and
+ * [createSurface] throws.
+ *
+ * As it contains native resources, it implements [CheckableAutoCloseable] and should be closed
+ * when no longer needed.
+ *
+ * @throws RuntimeException If unable to create or initialize any EGL resources.
+ */
+internal class RenderContextHeadlessGL : RenderContext() {
+    private external fun cppConstructor(): Long
+    private external fun cppDelete(pointer: Long)
+    private external fun cppCreatePBufferSurface(pointer: Long, width: Int, height: Int): Long
+    private external fun cppDestroySurface(pointer: Long, surface: Long)
+
+    companion object {
+        const val TAG = "Rive/MP/RenderContextHeadlessGL"
+    }
+
+    /** The native pointer to the C++ RenderContextHeadlessGL, held in a unique pointer. */
+    private val cppPointer = UniquePointer(
+        cppConstructor().also { pointer ->
+            if (pointer == 0L) {
+                throw RuntimeException("Unable to create headless EGL context")
+            }
+        },
+        TAG,
+        ::cppDelete
+    )
+
+    override val nativeObjectPointer: Long
+        get() = cppPointer.pointer
+
+    override var closed: Boolean = false
+        private set
+
+    override fun close() {
+        if (!closed) {
+            cppPointer.close()
+            closed = true
+        }
+    }
+
+    /**
+     * Not supported; there is no window system to present to.
+     *
+     * @throws UnsupportedOperationException Always.
+     */
+    override fun createSurface(
+        drawKey: DrawKey,
+        commandQueue: CommandQueue
+    ): RiveSurface = throw UnsupportedOperationException(
+        "Headless desktop rendering only supports image surfaces"
+    )
+
+    /**
+     * Creates an off-screen EGL PBuffer surface for image capture.
+     *
+     * @param width The width of the surface in pixels.
+     * @param height The height of the surface in pixels.
+     * @param drawKey The key used to uniquely identify the draw operation.
+     * @param commandQueue The owning command queue.
+     * @return The created [RivePBufferSurface].
+     */
+    override fun createImageSurface(
+        width: Int,
+        height: Int,
+        drawKey: DrawKey,
+        commandQueue: CommandQueue
+    ): RiveSurface {
+        require(width > 0 && height > 0) { "Image surfaces require a positive width and height." }
+        RiveLog.d(TAG) { "Creating EGL PBuffer surface ($width x $height)" }
+        val eglSurface = cppCreatePBufferSurface(cppPointer.pointer, width, height)
+        if (eglSurface == 0L) {
+            throw RuntimeException("Unable to create EGL PBuffer surface")
+        }
+
+        val renderTargetPointer = commandQueue.createRiveRenderTarget(width, height)
+
+        return RivePBufferSurface(
+            eglSurface,
+            renderTargetPointer,
+            drawKey,
+            width,
+            height
+        ) { cppDestroySurface(cppPointer.pointer, it) }
+    }
+}
+
+/**
+ * Desktop EGL PBuffer surface for off-screen rendering.
+ */
+class RivePBufferSurface internal constructor(
+    private val eglSurface: Long,
+    renderTargetPointer: Long,
+    drawKey: DrawKey,
+    width: Int,
+    height: Int,
+    private val destroySurface: (Long) -> Unit
+) : RiveSurface(renderTargetPointer, drawKey, width, height) {
+
+    companion object {
+        const val TAG = "Rive/MP/PBufferSurface"
+    }
+
+    override val surfaceNativePointer: Long
+        get() = eglSurface
+
+    override fun dispose(renderTargetPointer: Long) {
+        RiveLog.d(TAG) { "Destroying EGL PBuffer surface" }
+        destroySurface(eglSurface)
+
+        super.dispose(renderTargetPointer)
+    }
+}
+
+/**
+ * Creates the default desktop RenderContext: a headless EGL context when libmprive-desktop.so is
+ * available, otherwise a stub.
  */
 actual fun createDefaultRenderContext(): RenderContext {
-    RiveLog.d("Rive/RenderContext") { "Creating stub Desktop RenderContext (Phase A)" }
-    return RenderContextDesktopStub()
+    if (!isDesktopNativeAvailable) {
+        RiveLog.w("Rive/MP/RenderContext") { "Native library unavailable; using stub RenderContext" }
+        return RenderContextDesktopStub()
+    }
+    RiveLog.d("Rive/MP/RenderContext") { "Creating desktop RenderContextHeadlessGL" }
+    return RenderContextHeadlessGL()
 }
@@ -13,7 +13,8 @@ package app.rive.mp
  * object is first accessed. The library loading triggers JNI_OnLoad in the
  * native code, which performs initial setup.
  * 
- * Note: The native library is precompiled and checked into source control at:
+ * Note: The native library is built for Linux x86-64 from mprive/src/desktopMain/cpp and
+ * installed to:
  *   mprive/src/desktopMain/resources/jnilibs/linux-x86-64/libmprive-desktop.so
  */
 actual object RiveNative {
@@ -72,3 +73,13 @@ actual object RiveNative {
      */
     actual external fun nativeGetPlatformInfo(): String
 }
+
+/**
+ * Whether libmprive-desktop.so could be loaded on this machine.
+ *
+ * Checked before choosing the JNI bridge and headless render context, so that hosts without the
+ * library (e.g. macOS or Windows) fall back to the desktop stubs instead of failing.
+ */
+internal val isDesktopNativeAvailable: Boolean by lazy {
+    runCatching { RiveNative }.isSuccess
+}
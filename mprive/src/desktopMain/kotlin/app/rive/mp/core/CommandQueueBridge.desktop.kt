@@ -1,6 +1,7 @@
 package app.rive.mp.core
 
 import app.rive.mp.CommandQueue
+import app.rive.mp.isDesktopNativeAvailable
 import kotlinx.atomicfu.atomic
 
 /**
@@ -9,8 +10,8 @@ import kotlinx.atomicfu.atomic
  * This is a minimal stub for development and testing purposes.
  * It returns incrementing handles and simulates basic behavior.
  * 
- * NOTE: This is NOT a real implementation - Desktop support is deferred (Phase F).
- * For real rendering, use Android with JNI bindings.
+ * NOTE: This is NOT a real implementation. It is only used when libmprive-desktop.so is not
+ * available; on Linux x86-64 the JNI bridge is used instead.
  */
 class DesktopCommandQueueBridge : CommandQueueBridge {
     
@@ -22,6 +23,7 @@ class DesktopCommandQueueBridge : CommandQueueBridge {
     private val nextVmiHandle = atomic(1L)
     private val nextRenderTargetHandle = atomic(1L)
     private val nextDrawKey = atomic(1L)
+    private val nextScheduledInputHandle = atomic(1L)
     
     // Track valid handles
     private val validFileHandles = mutableSetOf<Long>()
@@ -189,6 +191,18 @@ class DesktopCommandQueueBridge : CommandQueueBridge {
         // No-op for stub
     }
     
+    // =========================================================================
+    // Reported Events
+    // =========================================================================
+    
+    override fun cppGetReportedEventCount(pointer: Long, requestID: Long, smHandle: Long) {
+        // No-op for stub
+    }
+    
+    override fun cppGetReportedEventAt(pointer: Long, requestID: Long, smHandle: Long, index: Int) {
+        // No-op for stub
+    }
+    
     // =========================================================================
     // State Machine Input Query
     // =========================================================================
@@ -321,10 +335,10 @@ class DesktopCommandQueueBridge : CommandQueueBridge {
     // Pointer Events
     // =========================================================================
     
-    override fun cppPointerMove(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float) {}
-    override fun cppPointerDown(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float) {}
-    override fun cppPointerUp(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float) {}
-    override fun cppPointerExit(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float) {}
+    override fun cppPointerMove(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long) {}
+    override fun cppPointerDown(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long) {}
+    override fun cppPointerUp(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long) {}
+    override fun cppPointerExit(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long) {}
     
     // =========================================================================
     // Render Target Operations
@@ -380,9 +394,189 @@ class DesktopCommandQueueBridge : CommandQueueBridge {
     override fun cppDeleteFont(pointer: Long, fontHandle: Long) {}
     override fun cppRegisterFont(pointer: Long, name: String, fontHandle: Long) {}
     override fun cppUnregisterFont(pointer: Long, name: String) {}
+    
+    // =========================================================================
+    // Queue Backpressure (Phase G.1)
+    // =========================================================================
+    
+    override fun cppSetQueuePolicy(pointer: Long, commandClass: Int, policy: Int, capacity: Int): Boolean =
+        // Mirror the native rule: ordered commands can never be dropped or coalesced
+        !(commandClass == CommandClass.ORDERED.value &&
+            (policy == OverflowPolicy.DROP_OLDEST.value || policy == OverflowPolicy.COALESCE.value))
+    override fun cppGetQueueStats(pointer: Long): LongArray =
+        LongArray(CommandClass.entries.size * QueueStats.FIELD_COUNT)
+    override fun cppResetQueueStats(pointer: Long) {}
+    
+    // =========================================================================
+    // Request Cancellation (Phase G.2)
+    // =========================================================================
+    
+    override fun cppCancelRequest(pointer: Long, requestID: Long): Boolean = false
+    override fun cppCancelAllFor(pointer: Long, handle: Long): Int = 0
+    override fun cppSetWorkerPaused(pointer: Long, paused: Boolean) {}
+    override fun cppSetHoldInFlight(pointer: Long, hold: Boolean) {}
+    
+    // =========================================================================
+    // Stall Watchdog (Phase G.3)
+    // =========================================================================
+    
+    override fun cppSetSlowCommandThreshold(pointer: Long, thresholdMs: Long) {}
+    override fun cppGetSlowCommands(pointer: Long): LongArray = LongArray(0)
+    override fun cppGetSlowCommandCount(pointer: Long): Long = 0L
+    override fun cppGetCommandTypeName(commandType: Int): String = "Unknown"
+    
+    // =========================================================================
+    // Input-to-Present Latency (Phase G.4)
+    // =========================================================================
+    
+    override fun cppGetInputLatencyStats(pointer: Long): LongArray =
+        LongArray(InputEventKind.entries.size * LatencyStats.FIELD_COUNT)
+    override fun cppResetInputLatencyStats(pointer: Long) {}
+    override fun cppSetFrameTimingEnabled(pointer: Long, enabled: Boolean) {}
+    
+    // =========================================================================
+    // Scheduled Inputs (Phase G.5)
+    // =========================================================================
+    
+    override fun cppScheduleInput(
+        pointer: Long,
+        smHandle: Long,
+        kind: Int,
+        inputName: String,
+        floatValue: Float,
+        boolValue: Boolean,
+        delaySeconds: Float,
+        onEvent: String
+    ): Long = nextScheduledInputHandle.getAndIncrement()
+    override fun cppCancelScheduledInput(pointer: Long, timerHandle: Long) {}
+    
+    // =========================================================================
+    // Command Capture and Replay (Phase G.6)
+    // =========================================================================
+    
+    override fun cppStartCommandCapture(pointer: Long, windowMs: Long) {}
+    override fun cppStopCommandCapture(pointer: Long, path: String): Boolean = false
+    override fun cppReplayCommandCapture(path: String, paced: Boolean): LongArray = LongArray(0)
+    
+    // =========================================================================
+    // Synthetic Files (Phase G.7)
+    // =========================================================================
+    
+    override fun cppGenerateSyntheticRiv(spec: IntArray): ByteArray = ByteArray(0)
+    
+    // =========================================================================
+    // File Analysis (Phase G.8)
+    // =========================================================================
+    
+    override fun cppAnalyzeRiv(bytes: ByteArray): String? = null
+    
+    // =========================================================================
+    // Shared Files (Phase G.9)
+    // =========================================================================
+    
+    override fun cppAttachSharedFile(pointer: Long, requestID: Long, contentKey: Long) {}
+    override fun cppGetFileContentKey(bytes: ByteArray): Long = 0L
+    override fun cppGetSharedFileCount(): Int = 0
+    
+    // =========================================================================
+    // Shared Host Thread (Phase G.10)
+    // =========================================================================
+    
+    override fun cppCreateHost(renderContextPointer: Long): Long = nextCommandQueueHandle.getAndIncrement()
+    override fun cppDeleteHost(hostPointer: Long) {}
+    override fun cppConstructorHosted(hostPointer: Long, weight: Int): Long =
+        nextCommandQueueHandle.getAndIncrement()
+    override fun cppSetHostWeight(pointer: Long, weight: Int) {}
+    override fun cppGetHostServerCount(hostPointer: Long): Int = 0
+    
+    // =========================================================================
+    // Registered Views (Phase G.11)
+    // =========================================================================
+    
+    override fun cppRegisterView(
+        pointer: Long,
+        viewID: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        surfaceNativePointer: Long,
+        renderTargetPointer: Long,
+        drawKey: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int
+    ): Long = if (viewID != 0L) viewID else nextCommandQueueHandle.getAndIncrement()
+    override fun cppUnregisterView(pointer: Long, viewID: Long) {}
+    override fun cppFrameTick(pointer: Long, deltaTimeNs: Long) {}
+    override fun cppViewsIdle(pointer: Long): Boolean = true
+    
+    // =========================================================================
+    // Lazy GPU Resources (Phase G.13)
+    // =========================================================================
+    
+    override fun cppSetLazyGpuResources(pointer: Long, enabled: Boolean, idleReleaseNs: Long) {}
+    override fun cppGetLazyGpuResourceStats(pointer: Long): LongArray =
+        LongArray(LazyGpuResourceStats.FIELD_COUNT)
+    
+    // =========================================================================
+    // Partial Import (Phase G.14)
+    // =========================================================================
+    
+    override fun cppLoadFileArtboards(
+        pointer: Long,
+        requestID: Long,
+        bytes: ByteArray,
+        artboardNames: Array<String>
+    ) {
+        val fileHandle = nextFileHandle.getAndIncrement()
+        validFileHandles.add(fileHandle)
+        fileArtboards[fileHandle] = artboardNames.toList()
+        fileViewModels[fileHandle] = listOf()
+    }
+    
+    // =========================================================================
+    // Bulk View Model Instances (Phase G.15)
+    // =========================================================================
+    
+    override fun cppCreateVMIBatch(
+        pointer: Long,
+        requestID: Long,
+        fileHandle: Long,
+        viewModelName: String,
+        count: Int,
+        seedVmiHandle: Long
+    ): Long {
+        if (count <= 0) {
+            return 0L
+        }
+        val first = nextVmiHandle.getAndAdd(count.toLong())
+        if (validFileHandles.contains(fileHandle)) {
+            for (handle in first until first + count) {
+                validVmiHandles.add(handle)
+            }
+        }
+        return first
+    }
+    
+    // =========================================================================
+    // Event Filters (Phase G.16)
+    // =========================================================================
+    
+    override fun cppSetEventFilter(
+        pointer: Long,
+        smHandle: Long,
+        mode: Int,
+        names: Array<String>,
+        typeCodes: IntArray
+    ) {}
 }
 
 /**
  * Create the desktop implementation of CommandQueueBridge.
+ *
+ * Uses the JNI bridge when libmprive-desktop.so is available, otherwise the stub.
  */
-actual fun createCommandQueueBridge(): CommandQueueBridge = DesktopCommandQueueBridge()
\ No newline at end of file
+actual fun createCommandQueueBridge(): CommandQueueBridge =
+    if (isDesktopNativeAvailable) CommandQueueJNIBridge() else DesktopCommandQueueBridge()
\ No newline at end of file
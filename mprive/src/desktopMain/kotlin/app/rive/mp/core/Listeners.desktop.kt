@@ -1,11 +1,16 @@
 package app.rive.mp.core
 
+import app.rive.mp.isDesktopNativeAvailable
+
 /**
- * Desktop stub implementation of closeNative for Listeners.
- * 
- * Since the desktop stub doesn't create real native resources (handles are 0L),
- * there's nothing to clean up.
+ * Desktop implementation of closeNative for Listeners.
+ *
+ * When libmprive-desktop.so is loaded the listeners come from [CommandQueueJNIBridge] and are
+ * deleted natively, as on Android. The desktop stub bridge creates no native resources (handles
+ * are 0L), so there is nothing to clean up.
  */
 actual fun Listeners.closeNative() {
-    // No-op for desktop stub - no native resources to clean up
-}
\ No newline at end of file
+    if (isDesktopNativeAvailable) {
+        deleteNative()
+    }
+}
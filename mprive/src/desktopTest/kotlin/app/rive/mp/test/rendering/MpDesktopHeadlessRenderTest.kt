@@ -0,0 +1,96 @@
+package app.rive.mp.test.rendering
+
+import app.rive.mp.CommandQueue
+import app.rive.mp.RenderContextHeadlessGL
+import app.rive.mp.StateMachineHandle
+import app.rive.mp.core.CommandQueueJNIBridge
+import app.rive.mp.core.createCommandQueueBridge
+import app.rive.mp.createDefaultRenderContext
+import app.rive.mp.isDesktopNativeAvailable
+import app.rive.mp.test.utils.MpTestContext
+import app.rive.mp.test.utils.MpTestResources
+import app.rive.mp.test.utils.loadRiveFile
+import kotlinx.coroutines.delay
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.test.runTest
+import org.junit.Assume.assumeTrue
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertIs
+import kotlin.test.assertTrue
+
+/**
+ * Tests that desktop tests run against libmprive-desktop.so and render through the headless EGL
+ * context, rather than silently passing on the desktop stubs.
+ *
+ * The library is built for Linux x86-64 by the :mprive:buildDesktopNative task, which desktopTest
+ * runs first when Gradle is given -PdesktopNative. These tests are skipped when the library is
+ * not available, e.g. on other hosts or without the flag, but fail if it was built and does not
+ * load.
+ */
+class MpDesktopHeadlessRenderTest {
+
+    @BeforeTest
+    fun requireDesktopNative() {
+        if (!System.getProperty("mprive.desktopNative.required").toBoolean()) {
+            assumeTrue(
+                "libmprive-desktop.so is not available; build it with -PdesktopNative",
+                isDesktopNativeAvailable
+            )
+        }
+    }
+
+    @Test
+    fun native_library_backs_the_bridge() {
+        assertTrue(isDesktopNativeAvailable, "libmprive-desktop.so should load")
+        assertIs<CommandQueueJNIBridge>(createCommandQueueBridge())
+    }
+
+    @Test
+    fun renders_a_frame_into_a_pbuffer() = runTest {
+        MpTestContext.initPlatform()
+        val renderContext = createDefaultRenderContext()
+        assertIs<RenderContextHeadlessGL>(renderContext)
+
+        val queue = CommandQueue(renderContext)
+        val pollingJob = launch {
+            while (isActive) {
+                queue.pollMessages()
+                delay(16L)
+            }
+        }
+        try {
+            val fileHandle = queue.loadFile(MpTestResources.loadRiveFile("flux_capacitor"))
+            val artboardHandle = queue.createDefaultArtboard(fileHandle)
+            val surface = renderContext.createImageSurface(64, 64, queue.createDrawKey(), queue)
+            val buffer = ByteArray(64 * 64 * 4)
+
+            // Opaque green, 0x00FF00FF in RGBA
+            queue.drawToBuffer(
+                artboardHandle,
+                StateMachineHandle(0L),
+                surface,
+                buffer,
+                clearColor = 0xFF00FF00.toInt()
+            )
+
+            val pixels = buffer.asList().chunked(4)
+            assertTrue(
+                pixels.all { it[3] == 0xFF.toByte() },
+                "Every pixel should be opaque over the opaque clear color"
+            )
+            assertTrue(
+                pixels.any { it != listOf<Byte>(0x00, 0xFF.toByte(), 0x00, 0xFF.toByte()) },
+                "The artboard should be drawn over the clear color"
+            )
+
+            surface.close()
+            queue.deleteArtboard(artboardHandle)
+            queue.deleteFile(fileHandle)
+        } finally {
+            pollingJob.cancel()
+            queue.release("test", "cleanup")
+        }
+    }
+}
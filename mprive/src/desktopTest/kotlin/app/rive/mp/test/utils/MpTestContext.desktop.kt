@@ -1,6 +1,7 @@
 package app.rive.mp.test.utils
 
 import app.rive.mp.RiveNative
+import java.io.File
 
 /**
  * Desktop implementation of MpTestContext.
@@ -39,5 +40,8 @@ actual class MpTestContext {
                 initialized = true
             }
         }
+
+        actual fun tempFilePath(name: String): String =
+            File(System.getProperty("java.io.tmpdir"), name).apply { delete() }.absolutePath
     }
 }
@@ -29,5 +29,8 @@ actual class MpTestContext {
                 "This is a stub to satisfy the compiler for Android/Desktop-only testing."
             )
         }
+
+        actual fun tempFilePath(name: String): String =
+            throw UnsupportedOperationException("iOS tests are not implemented.")
     }
 }
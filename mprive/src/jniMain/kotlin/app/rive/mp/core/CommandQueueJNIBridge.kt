@@ -0,0 +1,380 @@
+package app.rive.mp.core
+
+import app.rive.mp.CommandQueue
+import app.rive.mp.RiveInitializationException
+
+/**
+ * JNI implementation of [CommandQueueBridge], shared by the Android and desktop JVM targets.
+ * All methods are declared as external and link to native C++ code via JNI.
+ */
+internal class CommandQueueJNIBridge : CommandQueueBridge {
+    // =========================================================================
+    // Core Lifecycle
+    // =========================================================================
+    
+    @Throws(RiveInitializationException::class)
+    external override fun cppConstructor(renderContextPointer: Long): Long
+    external override fun cppDelete(pointer: Long)
+    external override fun cppCreateListeners(pointer: Long, receiver: CommandQueue): Listeners
+    external override fun cppPollMessages(pointer: Long, receiver: CommandQueue)
+    
+    // =========================================================================
+    // File Operations
+    // =========================================================================
+    
+    external override fun cppLoadFile(pointer: Long, requestID: Long, bytes: ByteArray)
+    external override fun cppDeleteFile(pointer: Long, requestID: Long, fileHandle: Long)
+    external override fun cppGetArtboardNames(pointer: Long, requestID: Long, fileHandle: Long)
+    external override fun cppGetStateMachineNames(pointer: Long, requestID: Long, artboardHandle: Long)
+    external override fun cppGetViewModelNames(pointer: Long, requestID: Long, fileHandle: Long)
+    
+    // =========================================================================
+    // File Introspection APIs (Phase E.2)
+    // =========================================================================
+    
+    external override fun cppGetViewModelInstanceNames(pointer: Long, requestID: Long, fileHandle: Long, viewModelName: String)
+    external override fun cppGetViewModelProperties(pointer: Long, requestID: Long, fileHandle: Long, viewModelName: String)
+    external override fun cppGetEnums(pointer: Long, requestID: Long, fileHandle: Long)
+    
+    // =========================================================================
+    // Artboard Operations (SYNCHRONOUS)
+    // =========================================================================
+    
+    external override fun cppCreateDefaultArtboard(pointer: Long, requestID: Long, fileHandle: Long): Long
+    external override fun cppCreateArtboardByName(pointer: Long, requestID: Long, fileHandle: Long, name: String): Long
+    external override fun cppDeleteArtboard(pointer: Long, requestID: Long, artboardHandle: Long)
+    external override fun cppResizeArtboard(pointer: Long, artboardHandle: Long, width: Int, height: Int, scaleFactor: Float)
+    external override fun cppResetArtboardSize(pointer: Long, artboardHandle: Long)
+    
+    // =========================================================================
+    // State Machine Operations (SYNCHRONOUS for creation)
+    // =========================================================================
+    
+    external override fun cppCreateDefaultStateMachine(pointer: Long, requestID: Long, artboardHandle: Long): Long
+    external override fun cppCreateStateMachineByName(pointer: Long, requestID: Long, artboardHandle: Long, name: String): Long
+    external override fun cppDeleteStateMachine(pointer: Long, requestID: Long, stateMachineHandle: Long)
+    external override fun cppAdvanceStateMachine(pointer: Long, stateMachineHandle: Long, deltaTimeNs: Long)
+    
+    // =========================================================================
+    // Linear Animation Operations
+    // =========================================================================
+    
+    external override fun cppCreateDefaultAnimation(pointer: Long, artboardHandle: Long): Long
+    external override fun cppCreateAnimationByName(pointer: Long, artboardHandle: Long, name: String): Long
+    external override fun cppAdvanceAndApplyAnimation(pointer: Long, animHandle: Long, artboardHandle: Long, deltaTime: Float, advanceArtboard: Boolean): Boolean
+    external override fun cppDeleteAnimation(pointer: Long, animHandle: Long)
+    external override fun cppSetAnimationTime(pointer: Long, animHandle: Long, time: Float)
+    external override fun cppSetAnimationLoop(pointer: Long, animHandle: Long, loopMode: Int)
+    external override fun cppSetAnimationDirection(pointer: Long, animHandle: Long, direction: Int)
+    
+    // =========================================================================
+    // State Machine Input Manipulation (SMI)
+    // =========================================================================
+    
+    external override fun cppSetStateMachineNumberInput(pointer: Long, stateMachineHandle: Long, inputName: String, value: Float)
+    external override fun cppSetStateMachineBooleanInput(pointer: Long, stateMachineHandle: Long, inputName: String, value: Boolean)
+    external override fun cppFireStateMachineTrigger(pointer: Long, stateMachineHandle: Long, inputName: String)
+    
+    // =========================================================================
+    // Reported Events
+    // =========================================================================
+    
+    external override fun cppGetReportedEventCount(pointer: Long, requestID: Long, smHandle: Long)
+    external override fun cppGetReportedEventAt(pointer: Long, requestID: Long, smHandle: Long, index: Int)
+    
+    // =========================================================================
+    // State Machine Input Query
+    // =========================================================================
+    
+    external override fun cppGetInputCount(pointer: Long, requestID: Long, smHandle: Long)
+    external override fun cppGetInputNames(pointer: Long, requestID: Long, smHandle: Long)
+    external override fun cppGetInputInfo(pointer: Long, requestID: Long, smHandle: Long, inputIndex: Int)
+    external override fun cppGetNumberInput(pointer: Long, requestID: Long, smHandle: Long, inputName: String)
+    external override fun cppSetNumberInput(pointer: Long, requestID: Long, smHandle: Long, inputName: String, value: Float)
+    external override fun cppGetBooleanInput(pointer: Long, requestID: Long, smHandle: Long, inputName: String)
+    external override fun cppSetBooleanInput(pointer: Long, requestID: Long, smHandle: Long, inputName: String, value: Boolean)
+    external override fun cppFireTrigger(pointer: Long, requestID: Long, smHandle: Long, inputName: String)
+    
+    // =========================================================================
+    // ViewModelInstance Operations (SYNCHRONOUS for creation)
+    // =========================================================================
+    
+    external override fun cppCreateBlankVMI(pointer: Long, requestID: Long, fileHandle: Long, viewModelName: String): Long
+    external override fun cppCreateDefaultVMI(pointer: Long, requestID: Long, fileHandle: Long, viewModelName: String): Long
+    external override fun cppCreateNamedVMI(pointer: Long, requestID: Long, fileHandle: Long, viewModelName: String, instanceName: String): Long
+    external override fun cppDeleteVMI(pointer: Long, requestID: Long, vmiHandle: Long)
+    external override fun cppBindViewModelInstance(pointer: Long, requestID: Long, smHandle: Long, vmiHandle: Long)
+    external override fun cppGetDefaultViewModelInstance(pointer: Long, requestID: Long, fileHandle: Long, artboardHandle: Long)
+    
+    // =========================================================================
+    // Property Operations
+    // =========================================================================
+    
+    external override fun cppGetNumberProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppSetNumberProperty(pointer: Long, vmiHandle: Long, propertyPath: String, value: Float)
+    external override fun cppGetStringProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppSetStringProperty(pointer: Long, vmiHandle: Long, propertyPath: String, value: String)
+    external override fun cppGetBooleanProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppSetBooleanProperty(pointer: Long, vmiHandle: Long, propertyPath: String, value: Boolean)
+    external override fun cppGetEnumProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppSetEnumProperty(pointer: Long, vmiHandle: Long, propertyPath: String, value: String)
+    external override fun cppGetColorProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppSetColorProperty(pointer: Long, vmiHandle: Long, propertyPath: String, value: Int)
+    external override fun cppFireTriggerProperty(pointer: Long, vmiHandle: Long, propertyPath: String)
+    
+    // =========================================================================
+    // Property Subscriptions
+    // =========================================================================
+    
+    external override fun cppSubscribeToProperty(pointer: Long, vmiHandle: Long, propertyPath: String, propertyType: Int)
+    external override fun cppUnsubscribeFromProperty(pointer: Long, vmiHandle: Long, propertyPath: String, propertyType: Int)
+    
+    // =========================================================================
+    // List Operations
+    // =========================================================================
+    
+    external override fun cppGetListSize(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppGetListItem(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, index: Int)
+    external override fun cppAddListItem(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, itemHandle: Long)
+    external override fun cppAddListItemAt(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, index: Int, itemHandle: Long)
+    external override fun cppRemoveListItem(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, itemHandle: Long)
+    external override fun cppRemoveListItemAt(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, index: Int)
+    external override fun cppSwapListItems(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, indexA: Int, indexB: Int)
+    
+    // =========================================================================
+    // Nested VMI Operations
+    // =========================================================================
+    
+    external override fun cppGetInstanceProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String)
+    external override fun cppSetInstanceProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, nestedHandle: Long)
+    
+    // =========================================================================
+    // Asset Property Operations
+    // =========================================================================
+    
+    external override fun cppSetImageProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, imageHandle: Long)
+    external override fun cppSetArtboardProperty(pointer: Long, requestID: Long, vmiHandle: Long, propertyPath: String, fileHandle: Long, artboardHandle: Long)
+    
+    // =========================================================================
+    // Pointer Events
+    // =========================================================================
+    
+    external override fun cppPointerMove(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    external override fun cppPointerDown(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    external override fun cppPointerUp(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    external override fun cppPointerExit(pointer: Long, stateMachineHandle: Long, fit: Byte, alignment: Byte, layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float, pointerID: Int, x: Float, y: Float, clientTimeNs: Long)
+    
+    // =========================================================================
+    // Render Target Operations
+    // =========================================================================
+    
+    external override fun cppCreateRenderTarget(pointer: Long, requestID: Long, width: Int, height: Int, sampleCount: Int)
+    external override fun cppDeleteRenderTarget(pointer: Long, requestID: Long, renderTargetHandle: Long)
+    external override fun cppCreateRiveRenderTarget(pointer: Long, width: Int, height: Int): Long
+    external override fun cppCreateDrawKey(pointer: Long): Long
+    
+    // =========================================================================
+    // Drawing Operations
+    // =========================================================================
+    
+    external override fun cppDraw(
+        pointer: Long,
+        renderContextPointer: Long,
+        surfaceNativePointer: Long,
+        drawKey: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        renderTargetPointer: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int
+    )
+    
+    external override fun cppDrawToBuffer(pointer: Long, renderContextPointer: Long, surfaceNativePointer: Long, drawKey: Long, artboardHandle: Long, stateMachineHandle: Long, renderTargetPointer: Long, width: Int, height: Int, fit: Byte, alignment: Byte, scaleFactor: Float, clearColor: Int, buffer: ByteArray)
+    
+    external override fun cppRunOnCommandServer(pointer: Long, work: () -> Unit)
+    
+    // =========================================================================
+    // Batch Sprite Rendering
+    // =========================================================================
+    
+    external override fun cppDrawMultiple(pointer: Long, renderContextPointer: Long, surfaceNativePointer: Long, drawKey: Long, renderTargetPointer: Long, viewportWidth: Int, viewportHeight: Int, clearColor: Int, artboardHandles: LongArray, stateMachineHandles: LongArray, transforms: FloatArray, artboardWidths: FloatArray, artboardHeights: FloatArray, count: Int)
+    
+    external override fun cppDrawMultipleToBuffer(pointer: Long, renderContextPointer: Long, surfaceNativePointer: Long, drawKey: Long, renderTargetPointer: Long, viewportWidth: Int, viewportHeight: Int, clearColor: Int, artboardHandles: LongArray, stateMachineHandles: LongArray, transforms: FloatArray, artboardWidths: FloatArray, artboardHeights: FloatArray, count: Int, buffer: ByteArray)
+    
+    // =========================================================================
+    // Asset Operations (Phase E.1)
+    // =========================================================================
+    
+    external override fun cppDecodeImage(pointer: Long, requestID: Long, bytes: ByteArray)
+    external override fun cppDeleteImage(pointer: Long, imageHandle: Long)
+    external override fun cppRegisterImage(pointer: Long, name: String, imageHandle: Long)
+    external override fun cppUnregisterImage(pointer: Long, name: String)
+    
+    external override fun cppDecodeAudio(pointer: Long, requestID: Long, bytes: ByteArray)
+    external override fun cppDeleteAudio(pointer: Long, audioHandle: Long)
+    external override fun cppRegisterAudio(pointer: Long, name: String, audioHandle: Long)
+    external override fun cppUnregisterAudio(pointer: Long, name: String)
+    
+    external override fun cppDecodeFont(pointer: Long, requestID: Long, bytes: ByteArray)
+    external override fun cppDeleteFont(pointer: Long, fontHandle: Long)
+    external override fun cppRegisterFont(pointer: Long, name: String, fontHandle: Long)
+    external override fun cppUnregisterFont(pointer: Long, name: String)
+    
+    // =========================================================================
+    // Queue Backpressure (Phase G.1)
+    // =========================================================================
+    
+    external override fun cppSetQueuePolicy(pointer: Long, commandClass: Int, policy: Int, capacity: Int): Boolean
+    external override fun cppGetQueueStats(pointer: Long): LongArray
+    external override fun cppResetQueueStats(pointer: Long)
+    
+    // =========================================================================
+    // Request Cancellation (Phase G.2)
+    // =========================================================================
+    
+    external override fun cppCancelRequest(pointer: Long, requestID: Long): Boolean
+    external override fun cppCancelAllFor(pointer: Long, handle: Long): Int
+    external override fun cppSetWorkerPaused(pointer: Long, paused: Boolean)
+    external override fun cppSetHoldInFlight(pointer: Long, hold: Boolean)
+    
+    // =========================================================================
+    // Stall Watchdog (Phase G.3)
+    // =========================================================================
+    
+    external override fun cppSetSlowCommandThreshold(pointer: Long, thresholdMs: Long)
+    external override fun cppGetSlowCommands(pointer: Long): LongArray
+    external override fun cppGetSlowCommandCount(pointer: Long): Long
+    external override fun cppGetCommandTypeName(commandType: Int): String
+    
+    // =========================================================================
+    // Input-to-Present Latency (Phase G.4)
+    // =========================================================================
+    
+    external override fun cppGetInputLatencyStats(pointer: Long): LongArray
+    external override fun cppResetInputLatencyStats(pointer: Long)
+    external override fun cppSetFrameTimingEnabled(pointer: Long, enabled: Boolean)
+    
+    // =========================================================================
+    // Scheduled Inputs (Phase G.5)
+    // =========================================================================
+    
+    external override fun cppScheduleInput(
+        pointer: Long,
+        smHandle: Long,
+        kind: Int,
+        inputName: String,
+        floatValue: Float,
+        boolValue: Boolean,
+        delaySeconds: Float,
+        onEvent: String
+    ): Long
+    external override fun cppCancelScheduledInput(pointer: Long, timerHandle: Long)
+    
+    // =========================================================================
+    // Command Capture and Replay (Phase G.6)
+    // =========================================================================
+    
+    external override fun cppStartCommandCapture(pointer: Long, windowMs: Long)
+    external override fun cppStopCommandCapture(pointer: Long, path: String): Boolean
+    external override fun cppReplayCommandCapture(path: String, paced: Boolean): LongArray
+    
+    // =========================================================================
+    // Synthetic Files (Phase G.7)
+    // =========================================================================
+    
+    external override fun cppGenerateSyntheticRiv(spec: IntArray): ByteArray
+    
+    // =========================================================================
+    // File Analysis (Phase G.8)
+    // =========================================================================
+    
+    external override fun cppAnalyzeRiv(bytes: ByteArray): String?
+    
+    // =========================================================================
+    // Shared Files (Phase G.9)
+    // =========================================================================
+    
+    external override fun cppAttachSharedFile(pointer: Long, requestID: Long, contentKey: Long)
+    external override fun cppGetFileContentKey(bytes: ByteArray): Long
+    external override fun cppGetSharedFileCount(): Int
+    
+    // =========================================================================
+    // Shared Host Thread (Phase G.10)
+    // =========================================================================
+    
+    external override fun cppCreateHost(renderContextPointer: Long): Long
+    external override fun cppDeleteHost(hostPointer: Long)
+    external override fun cppConstructorHosted(hostPointer: Long, weight: Int): Long
+    external override fun cppSetHostWeight(pointer: Long, weight: Int)
+    external override fun cppGetHostServerCount(hostPointer: Long): Int
+    
+    // =========================================================================
+    // Registered Views (Phase G.11)
+    // =========================================================================
+    
+    external override fun cppRegisterView(
+        pointer: Long,
+        viewID: Long,
+        artboardHandle: Long,
+        stateMachineHandle: Long,
+        surfaceNativePointer: Long,
+        renderTargetPointer: Long,
+        drawKey: Long,
+        width: Int,
+        height: Int,
+        fit: Byte,
+        alignment: Byte,
+        scaleFactor: Float,
+        clearColor: Int
+    ): Long
+    external override fun cppUnregisterView(pointer: Long, viewID: Long)
+    external override fun cppFrameTick(pointer: Long, deltaTimeNs: Long)
+    external override fun cppViewsIdle(pointer: Long): Boolean
+    
+    // =========================================================================
+    // Lazy GPU Resources (Phase G.13)
+    // =========================================================================
+    
+    external override fun cppSetLazyGpuResources(pointer: Long, enabled: Boolean, idleReleaseNs: Long)
+    external override fun cppGetLazyGpuResourceStats(pointer: Long): LongArray
+    
+    // =========================================================================
+    // Partial Import (Phase G.14)
+    // =========================================================================
+    
+    external override fun cppLoadFileArtboards(
+        pointer: Long,
+        requestID: Long,
+        bytes: ByteArray,
+        artboardNames: Array<String>
+    )
+    
+    // =========================================================================
+    // Bulk View Model Instances (Phase G.15)
+    // =========================================================================
+    
+    external override fun cppCreateVMIBatch(
+        pointer: Long,
+        requestID: Long,
+        fileHandle: Long,
+        viewModelName: String,
+        count: Int,
+        seedVmiHandle: Long
+    ): Long
+    
+    // =========================================================================
+    // Event Filters (Phase G.16)
+    // =========================================================================
+    
+    external override fun cppSetEventFilter(
+        pointer: Long,
+        smHandle: Long,
+        mode: Int,
+        names: Array<String>,
+        typeCodes: IntArray
+    )
+}
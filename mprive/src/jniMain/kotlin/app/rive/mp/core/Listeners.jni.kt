@@ -0,0 +1,30 @@
+package app.rive.mp.core
+
+/**
+ * Deletes the native listeners created by [CommandQueueJNIBridge.cppCreateListeners]. Shared by
+ * the platforms that use the JNI bridge.
+ */
+internal fun Listeners.deleteNative() {
+    cppDelete(
+        fileListener,
+        artboardListener,
+        stateMachineListener,
+        viewModelInstanceListener,
+        imageListener,
+        audioListener,
+        fontListener
+    )
+}
+
+/**
+ * Native method to delete listeners.
+ */
+private external fun cppDelete(
+    fileListener: Long,
+    artboardListener: Long,
+    stateMachineListener: Long,
+    viewModelInstanceListener: Long,
+    imageListener: Long,
+    audioListener: Long,
+    fontListener: Long
+)
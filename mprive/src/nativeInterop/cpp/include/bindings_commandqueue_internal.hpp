@@ -33,6 +33,10 @@ extern jmethodID g_onNumberInputValueMethodID;
 extern jmethodID g_onBooleanInputValueMethodID;
 extern jmethodID g_onInputOperationSuccessMethodID;
 extern jmethodID g_onInputOperationErrorMethodID;
+// Reported event callbacks (Phase F)
+extern jmethodID g_onEventCountResultMethodID;
+extern jmethodID g_onEventDataResultMethodID;
+extern jmethodID g_onEventOperationErrorMethodID;
 // ViewModelInstance callbacks
 extern jmethodID g_onVMICreatedMethodID;
 extern jmethodID g_onVMIErrorMethodID;
@@ -82,6 +86,10 @@ extern jmethodID g_onAudioDecodedMethodID;
 extern jmethodID g_onAudioErrorMethodID;
 extern jmethodID g_onFontDecodedMethodID;
 extern jmethodID g_onFontErrorMethodID;
+// Request cancellation callback (Phase G.2)
+extern jmethodID g_onRequestCancelledMethodID;
+// Frame timing callback (Phase G.4)
+extern jmethodID g_onDrawCompleteMethodID;
 
 /**
  * Initialize cached method IDs for JNI callbacks.
@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -10,6 +11,9 @@
 #include <thread>
 #include "jni_refs.hpp"
 #include "command_server_types.hpp"
+#include "command_server_host.hpp"
+#include "deferred_factory.hpp"
+#include "shared_file_registry.hpp"
 
 // Rive headers
 #include "rive/file.hpp"
@@ -22,6 +26,7 @@
 
 // Forward declarations for Rive GPU types
 namespace rive {
+class Event;
 namespace gpu {
 class RenderTargetGL;
 }
@@ -49,6 +54,8 @@ class RenderContext;
  * - JNI callbacks
  */
 class CommandServer {
+    friend class CommandServerHost;
+
 public:
     /**
      * Constructs a CommandServer and starts the worker thread.
@@ -59,6 +66,17 @@ public:
      */
     CommandServer(JNIEnv* env, jobject commandQueue, void* renderContext);
     
+    /**
+     * Constructs a CommandServer that runs on a shared host thread (Phase G.10)
+     * instead of its own, using the host's render context.
+     * 
+     * @param env The JNI environment.
+     * @param commandQueue The Java CommandQueue object (for callbacks).
+     * @param host The host; it must outlive the server.
+     * @param weight Commands this server may run per scheduling round.
+     */
+    CommandServer(JNIEnv* env, jobject commandQueue, CommandServerHost* host, uint32_t weight);
+    
     /**
      * Destructs the CommandServer, stopping the worker thread and cleaning up resources.
      */
@@ -107,6 +125,19 @@ public:
      */
     void loadFile(int64_t requestID, const std::vector<uint8_t>& bytes);
     
+    /**
+     * Enqueues a LoadFile command that imports only some artboards
+     * (Phase G.14).
+     * 
+     * @param requestID The request ID for async completion.
+     * @param bytes The Rive file bytes.
+     * @param artboardNames The artboards to import; the artboards they nest
+     *        are imported too. Empty imports every artboard.
+     */
+    void loadFile(int64_t requestID,
+                  const std::vector<uint8_t>& bytes,
+                  std::vector<std::string> artboardNames);
+    
     /**
      * Enqueues a DeleteFile command.
      * 
@@ -115,6 +146,16 @@ public:
      */
     void deleteFile(int64_t requestID, int64_t fileHandle);
     
+    /**
+     * Enqueues an AttachSharedFile command (Phase G.9). Completes like
+     * LoadFile, with a new handle to a file that another server (or this
+     * one) has already imported with the same factory.
+     * 
+     * @param requestID The request ID for async completion.
+     * @param contentKey The content hash of the file bytes (see contentHash()).
+     */
+    void attachSharedFile(int64_t requestID, uint64_t contentKey);
+    
     /**
      * Enqueues a GetArtboardNames command.
      * 
@@ -793,10 +834,11 @@ public:
      * @param pointerID Pointer ID for multi-touch support.
      * @param x X coordinate in surface space.
      * @param y Y coordinate in surface space.
+     * @param clientTimeNs Monotonic time of the input event (0 = enqueue time).
      */
     void pointerMove(int64_t smHandle, int8_t fit, int8_t alignment,
                      float layoutScale, float surfaceWidth, float surfaceHeight,
-                     int32_t pointerID, float x, float y);
+                     int32_t pointerID, float x, float y, int64_t clientTimeNs = 0);
 
     /**
      * Enqueues a PointerDown command.
@@ -804,7 +846,7 @@ public:
      */
     void pointerDown(int64_t smHandle, int8_t fit, int8_t alignment,
                      float layoutScale, float surfaceWidth, float surfaceHeight,
-                     int32_t pointerID, float x, float y);
+                     int32_t pointerID, float x, float y, int64_t clientTimeNs = 0);
 
     /**
      * Enqueues a PointerUp command.
@@ -812,7 +854,7 @@ public:
      */
     void pointerUp(int64_t smHandle, int8_t fit, int8_t alignment,
                    float layoutScale, float surfaceWidth, float surfaceHeight,
-                   int32_t pointerID, float x, float y);
+                   int32_t pointerID, float x, float y, int64_t clientTimeNs = 0);
 
     /**
      * Enqueues a PointerExit command.
@@ -820,7 +862,7 @@ public:
      */
     void pointerExit(int64_t smHandle, int8_t fit, int8_t alignment,
                      float layoutScale, float surfaceWidth, float surfaceHeight,
-                     int32_t pointerID, float x, float y);
+                     int32_t pointerID, float x, float y, int64_t clientTimeNs = 0);
 
     // ==========================================================================
     // Phase E.1: Asset Operations
@@ -919,6 +961,391 @@ public:
      */
     void unregisterFont(const std::string& name);
 
+    // ==========================================================================
+    // Phase G.1: Queue Backpressure
+    // ==========================================================================
+
+    /**
+     * Sets the capacity and overflow policy for a command class.
+     * Takes effect for the next enqueued command. Thread-safe.
+     *
+     * Ordered commands only accept Unbounded or Block, since dropping or
+     * merging them would lose replies or state changes.
+     *
+     * @param commandClass The command class to configure.
+     * @param policy The capacity and overflow policy.
+     * @return true if the policy was applied, false if it is not allowed for the class.
+     */
+    bool setQueuePolicy(CommandClass commandClass, QueuePolicy policy);
+
+    /**
+     * Gets the current policy for a command class. Thread-safe.
+     *
+     * @param commandClass The command class to query.
+     * @return The current policy.
+     */
+    QueuePolicy getQueuePolicy(CommandClass commandClass) const;
+
+    /**
+     * Gets a snapshot of the queue counters for a command class. Thread-safe.
+     *
+     * @param commandClass The command class to query.
+     * @return The counters at the time of the call.
+     */
+    QueueStats getQueueStats(CommandClass commandClass) const;
+
+    /**
+     * Resets the cumulative queue counters (pending counts are preserved).
+     */
+    void resetQueueStats();
+
+    // ==========================================================================
+    // Phase G.2: Request Cancellation
+    // ==========================================================================
+
+    /**
+     * Cancels a request by its ID. Thread-safe.
+     *
+     * A pending command is removed from the queue. An in-flight command is
+     * flagged so its handler can stop at the next checkpoint; any result it
+     * still produces is discarded. Either way, exactly one RequestCancelled
+     * message is sent for the request.
+     *
+     * Only cancellable commands are affected (see isCancellable()).
+     *
+     * @param requestID The request ID to cancel.
+     * @return true if a pending or in-flight command was cancelled.
+     */
+    bool cancel(int64_t requestID);
+
+    /**
+     * Cancels every cancellable command that targets a handle. Thread-safe.
+     *
+     * Fire-and-forget commands (advance, pointer move, draw) are removed
+     * silently; request/response commands get one RequestCancelled message each.
+     * The in-flight command is flagged as by cancel() if it targets the handle
+     * and has not posted its result yet.
+     *
+     * @param handle A file, artboard, state machine or view model instance handle.
+     * @return The number of commands cancelled.
+     */
+    int32_t cancelAllFor(int64_t handle);
+
+    /**
+     * Holds back command execution. Commands are still admitted under their
+     * queue policy, coalesced and cancelled while paused, which makes queue
+     * state deterministic for tests; stop() resumes so the queue drains.
+     * Thread-safe.
+     *
+     * @param paused Whether the worker should stop taking commands.
+     */
+    void setWorkerPaused(bool paused);
+
+    /**
+     * Holds the worker after it takes the next command and marks it in
+     * flight, before executing it, so tests can cancel an in-flight command
+     * deterministically. stop() releases it. Thread-safe.
+     *
+     * @param hold Whether the worker should wait before executing.
+     */
+    void setHoldInFlight(bool hold);
+
+    // ==========================================================================
+    // Phase G.3: Stall Watchdog
+    // ==========================================================================
+
+    /**
+     * Sets the duration above which a command is reported as slow.
+     * The watchdog samples the worker at half this interval. Thread-safe.
+     *
+     * @param thresholdMs The threshold in milliseconds (0 disables the watchdog).
+     */
+    void setSlowCommandThreshold(int64_t thresholdMs);
+
+    /**
+     * Gets the recent slow commands, oldest first. Commands still running
+     * when sampled are reported with stalled = true. Thread-safe.
+     *
+     * @return Up to kSlowCommandRingSize records.
+     */
+    std::vector<SlowCommandRecord> getSlowCommands() const;
+
+    /**
+     * Gets the total number of slow commands seen, including those that
+     * have rotated out of the ring. Thread-safe.
+     */
+    uint64_t getSlowCommandCount() const;
+
+    static constexpr size_t kSlowCommandRingSize = 32;
+
+    // ==========================================================================
+    // Phase G.4: Input-to-Present Latency
+    // ==========================================================================
+
+    /**
+     * Gets the input-to-present latency distribution of an input kind:
+     * the time from the client event timestamp to the end of the present
+     * of the first frame drawn after an advance that consumed the input.
+     * Percentiles cover the last kLatencySampleCount events. Thread-safe.
+     *
+     * @param kind The input kind.
+     * @return The distribution (all zero if no events were presented).
+     */
+    LatencyStats getInputLatencyStats(InputEventKind kind) const;
+
+    /**
+     * Clears all latency samples. Thread-safe.
+     */
+    void resetInputLatencyStats();
+
+    /**
+     * Enables the per-frame timing breakdown sent with DrawComplete. Off by
+     * default: every completed draw would otherwise cost a JNI callback.
+     * Thread-safe.
+     *
+     * @param enabled Whether draws report their timing to Kotlin.
+     */
+    void setFrameTimingEnabled(bool enabled);
+
+    static constexpr size_t kLatencySampleCount = 256;
+
+    // ==========================================================================
+    // Phase G.5: Scheduled Inputs
+    // ==========================================================================
+
+    /**
+     * Schedules a state machine input to fire after a delay. The delay runs in
+     * the state machine's animation time: it only elapses as the state machine
+     * is advanced, and the advance is split so the input lands at the exact
+     * animation time rather than on the next frame boundary.
+     *
+     * With a non-empty onEvent, the schedule is a reaction instead: each time
+     * the state machine reports the named event, the input is fired delaySeconds
+     * after the moment the event occurred. Reactions stay armed until cancelled.
+     *
+     * With ScheduledInputKind::DelayEvent, inputName names an event instead, and
+     * every report of it is held back from GetReportedEventCount/At until
+     * delaySeconds of animation time after it occurred. The delay stays set
+     * until cancelled; cancelling drops the events it is still holding.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param kind What to do with the input.
+     * @param inputName The name of the input.
+     * @param floatValue The value for a number input.
+     * @param boolValue The value for a boolean input.
+     * @param delaySeconds The delay in animation seconds (>= 0).
+     * @param onEvent The event that arms the input, or empty for a one-shot timer.
+     * @return An ID for cancelScheduledInput().
+     */
+    int64_t scheduleInput(int64_t smHandle,
+                          ScheduledInputKind kind,
+                          const std::string& inputName,
+                          float floatValue,
+                          bool boolValue,
+                          float delaySeconds,
+                          const std::string& onEvent);
+
+    /**
+     * Cancels a scheduled input or event reaction. Unknown or already fired
+     * IDs are ignored.
+     *
+     * @param timerID The ID returned by scheduleInput().
+     */
+    void cancelScheduledInput(int64_t timerID);
+
+    // ==========================================================================
+    // Phase G.6: Command Capture and Replay
+    // ==========================================================================
+
+    /**
+     * Starts recording every enqueued command, with its enqueue time, so the
+     * session can be replayed later. File and asset bytes are stored once per
+     * distinct content hash. Restarting discards the previous recording.
+     *
+     * With a non-zero window the recorder runs as a flight recorder: frame,
+     * pointer and draw commands older than the window are discarded, while
+     * ordered commands are always kept so the handles they create replay the
+     * same way. Synchronous artboard and state machine creates are recorded
+     * too. Only a capture started before any handle was created replays;
+     * the replay rejects a mid-session capture. Thread-safe.
+     *
+     * @param windowMs How much of the frame stream to keep (0 keeps everything).
+     */
+    void startCommandCapture(int64_t windowMs);
+
+    /**
+     * Stops recording and writes the capture to a file. Thread-safe.
+     *
+     * @param path The file to write, or empty to discard the recording.
+     * @return True if a capture was running and was written.
+     */
+    bool stopCommandCapture(const std::string& path);
+
+    /**
+     * Re-executes a captured command stream on a new headless CommandServer
+     * (no render context) and reports how long it took. Draw commands are
+     * skipped because they need a surface. Blocks until the replay finishes.
+     *
+     * @param env The JNI environment.
+     * @param commandQueue The Java object the replay server holds for callbacks.
+     * @param path The capture file.
+     * @param paced True to enqueue at the recorded pacing, false to replay as fast as possible.
+     * @param report Receives the timing report.
+     * @return False if the file is missing or malformed, or was captured
+     *   mid-session.
+     */
+    static bool replayCommandCapture(JNIEnv* env,
+                                     jobject commandQueue,
+                                     const std::string& path,
+                                     bool paced,
+                                     ReplayReport& report);
+
+    // ==========================================================================
+    // Phase G.10: Shared Host Thread
+    // ==========================================================================
+
+    /**
+     * Changes how many commands this server may run per scheduling round on
+     * its host. No effect on a server with its own thread. Thread-safe.
+     *
+     * @param weight The new weight (at least 1).
+     */
+    void setHostWeight(uint32_t weight);
+
+    /**
+     * True if this server runs on a shared CommandServerHost.
+     */
+    bool isHosted() const { return m_host != nullptr; }
+
+    // ==========================================================================
+    // Phase G.11: Registered Views
+    // ==========================================================================
+
+    /**
+     * Registers a view with the server's frame loop, or updates one (e.g.
+     * after a resize). On every frameTick() the server advances and draws
+     * each registered view that is not settled, with the parameters given
+     * here, so the client sends one tick per frame instead of an advance and
+     * a draw per view. Thread-safe.
+     *
+     * @param viewID The view to update, or 0 to register a new one.
+     * @param artboardHandle The artboard to draw.
+     * @param smHandle The state machine to advance (0 to advance the artboard alone).
+     * @param surfacePtr Native surface pointer.
+     * @param renderTargetPtr Rive render target pointer.
+     * @param drawKey Draw key of the surface. Views send no DrawComplete.
+     * @param width Surface width in pixels.
+     * @param height Surface height in pixels.
+     * @param fitMode Fit enum ordinal.
+     * @param alignmentMode Alignment enum ordinal.
+     * @param clearColor Clear color (0xAARRGGBB).
+     * @param scaleFactor Layout scale factor.
+     * @return The view ID, allocated on the calling thread.
+     */
+    int64_t registerView(int64_t viewID,
+                         int64_t artboardHandle,
+                         int64_t smHandle,
+                         int64_t surfacePtr,
+                         int64_t renderTargetPtr,
+                         int64_t drawKey,
+                         int32_t width,
+                         int32_t height,
+                         int32_t fitMode,
+                         int32_t alignmentMode,
+                         uint32_t clearColor,
+                         float scaleFactor);
+
+    /**
+     * Removes a registered view. Thread-safe.
+     */
+    void unregisterView(int64_t viewID);
+
+    /**
+     * Enqueues a frame of the server-driven frame loop. Once the Advance
+     * class is at capacity under Coalesce, pending ticks coalesce by adding
+     * their delta times. Thread-safe.
+     *
+     * @param deltaTime Seconds since the previous tick.
+     */
+    void frameTick(float deltaTime);
+
+    /**
+     * True when every registered view is settled and no command that could
+     * wake one has been enqueued since, so the client may stop ticking until
+     * it sends further input. Thread-safe.
+     */
+    bool viewsIdle() const { return m_viewsIdle.load(std::memory_order_relaxed); }
+
+    // ==========================================================================
+    // Phase G.13: Lazy GPU Resources
+    // ==========================================================================
+
+    /**
+     * Imports files loaded from now on with the render context's
+     * DeferredFactory: render paths, paints and buffers are created when an
+     * artboard is first drawn and released after it has not been drawn for
+     * a while. No effect without a render context. Thread-safe.
+     *
+     * @param idleReleaseNs Release objects not drawn for this long; applied
+     *        to the factory at the next frame.
+     */
+    void setLazyGpuResources(bool enabled, int64_t idleReleaseNs)
+    {
+        m_lazyIdleReleaseNs.store(idleReleaseNs, std::memory_order_relaxed);
+        m_lazyGpuResources.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * Counters of the render context's DeferredFactory (all zero if no file
+     * was imported lazily). Thread-safe.
+     */
+    rive_mp::DeferredFactory::Stats lazyGpuResourceStats() const;
+
+    // ==========================================================================
+    // Phase G.15: Bulk View Model Instances
+    // ==========================================================================
+
+    /**
+     * Reserves count contiguous ViewModelInstance handles and enqueues a
+     * CreateVMIBatch command that validates them. Each instance is created
+     * from the view model's default instance the first time a command uses
+     * its handle, with the seed's top-level number, string, boolean, enum
+     * and color values (as of when the command runs) applied on top.
+     * Completes with VMICreated (handle = first) or VMIError. Thread-safe.
+     *
+     * @param requestID The request ID for async completion.
+     * @param fileHandle The handle of the file containing the ViewModel.
+     * @param viewModelName The name of the ViewModel to instantiate.
+     * @param count The number of instances (at least 1).
+     * @param seedVmiHandle An instance of the same ViewModel to copy values
+     *        from, or 0 for the defaults.
+     * @return The first handle of the range, allocated on the calling thread.
+     */
+    int64_t createVMIBatch(int64_t requestID, int64_t fileHandle,
+                           const std::string& viewModelName, int32_t count,
+                           int64_t seedVmiHandle);
+
+    // ==========================================================================
+    // Phase G.16: Event Filters
+    // ==========================================================================
+
+    /**
+     * Chooses which of a state machine's reported events reach the client.
+     * Events that do not pass are skipped by GetReportedEventCount and
+     * GetReportedEventAt before any message is built, and indices count only
+     * the events that pass. Event reactions of scheduled inputs still see
+     * every event. The filter is dropped with the state machine. Thread-safe.
+     *
+     * @param smHandle The handle of the state machine.
+     * @param mode Which events to report.
+     * @param names For Matching: event names to report.
+     * @param typeCodes For Matching: event type keys to report (e.g. 131 for OpenURLEvent).
+     */
+    void setEventFilter(int64_t smHandle,
+                        EventFilterMode mode,
+                        std::vector<std::string> names,
+                        std::vector<int32_t> typeCodes);
+
 private:
     /**
      * The main loop for the worker thread.
@@ -932,6 +1359,132 @@ private:
      * @param cmd The command to execute.
      */
     void executeCommand(const Command& cmd);
+
+    /**
+     * Applies the queue policy of the command's class before it is pushed.
+     * Must be called with m_mutex held (the lock may be released while blocking).
+     *
+     * @param cmd The command about to be enqueued.
+     * @param lock The held lock on m_mutex.
+     * @return true if the command should be pushed, false if it was merged
+     *         into a pending command or dropped.
+     */
+    bool admitCommandLocked(Command& cmd, std::unique_lock<std::mutex>& lock);
+
+    /**
+     * Merges cmd into a pending command with the same coalescing key.
+     * Never looks past an Ordered or discrete pointer command, so merging
+     * does not reorder effects.
+     *
+     * @return true if the command was merged.
+     */
+    bool coalescePendingLocked(Command& cmd);
+
+    /**
+     * Removes the oldest droppable pending command of a class.
+     *
+     * @return true if a command was dropped.
+     */
+    bool dropOldestLocked(CommandClass commandClass);
+
+    /**
+     * Removes a pending command. Must be called with m_mutex held.
+     *
+     * @param it The pending command to remove.
+     * @param cancelledRequestIDs Receives the request ID if the command
+     *        expects a reply; the caller sends the RequestCancelled messages
+     *        after releasing m_mutex.
+     * @return The iterator following the removed command.
+     */
+    std::deque<Command>::iterator cancelPendingLocked(std::deque<Command>::iterator it,
+                                                      std::vector<int64_t>& cancelledRequestIDs);
+
+    /**
+     * Whether the in-flight command has been cancelled. Handlers doing
+     * long-running work check this between steps and bail out early.
+     *
+     * @param cmd The command being executed.
+     */
+    bool isCancelled(const Command& cmd) const;
+
+    /**
+     * Flags the in-flight command as cancelled unless it already posted its
+     * result, in which case its caller has the answer and nothing is sent.
+     * Must be called with m_mutex held and m_inFlight set.
+     *
+     * @return true if the command was flagged.
+     */
+    bool cancelInFlightLocked();
+
+    /**
+     * The main loop for the watchdog thread.
+     * Samples the in-flight command and flags it once it exceeds the threshold.
+     */
+    void watchdogLoop();
+
+    /**
+     * Publishes the command about to run for the watchdog to sample.
+     * Called on the worker thread.
+     *
+     * @return The command's start time in steady_clock nanoseconds.
+     */
+    int64_t beginCommandTiming(const Command& cmd);
+
+    /**
+     * Clears the in-flight command and records it if it was slow.
+     * Called on the worker thread.
+     *
+     * @param cmd The command that just finished.
+     * @param startNs The value returned by beginCommandTiming().
+     */
+    void endCommandTiming(const Command& cmd, int64_t startNs);
+
+    /**
+     * Adds or updates a slow command record. Must be called with m_watchdogMutex held.
+     */
+    void recordSlowCommandLocked(const SlowCommandRecord& record);
+
+    /**
+     * Tracks latency for a command that just executed: input commands start
+     * waiting for an advance, advances mark the pending inputs of their state
+     * machine as consumed. Called on the worker thread.
+     *
+     * @param cmd The command that just finished.
+     * @param durationNs How long the command ran.
+     */
+    void noteCommandExecuted(const Command& cmd, int64_t durationNs);
+
+    /**
+     * Returns and clears the advance time accumulated for a state machine
+     * since its previous draw. Called on the worker thread.
+     */
+    int64_t takeFrameAdvanceNs(int64_t smHandle);
+
+    /**
+     * Advances a state machine, firing its scheduled inputs at their exact
+     * animation time along the way. Called on the worker thread.
+     *
+     * @return The result of the last advanceAndApply(), or true while
+     *         scheduled inputs are still pending.
+     */
+    bool advanceWithScheduledInputs(int64_t smHandle,
+                                    rive::StateMachineInstance* sm,
+                                    float deltaTime);
+
+    void handleScheduleInput(const Command& cmd);
+    void handleCancelScheduledInput(const Command& cmd);
+
+    // Event filter handlers (Phase G.16)
+    void handleSetEventFilter(const Command& cmd);
+
+    /**
+     * Completes the consumed inputs of a state machine once its frame has been
+     * presented. Called on the worker thread.
+     *
+     * @param smHandle The state machine that was drawn.
+     * @param presentedNs steady_clock time at the end of the present.
+     */
+    void notePresented(int64_t smHandle, int64_t presentedNs);
     
     /**
      * Handles a LoadFile command.
@@ -947,6 +1500,58 @@ private:
      */
     void handleDeleteFile(const Command& cmd);
     
+    /**
+     * Handles a RegisterView command.
+     * 
+     * @param cmd The command to execute.
+     */
+    void handleRegisterView(const Command& cmd);
+    
+    /**
+     * Handles an UnregisterView command.
+     * 
+     * @param cmd The command to execute.
+     */
+    void handleUnregisterView(const Command& cmd);
+    
+    /**
+     * Handles a FrameTick command: advances each awake view's state machine
+     * (or, without one, its artboard) once and draws the view.
+     * 
+     * @param cmd The command to execute.
+     */
+    void handleFrameTick(const Command& cmd);
+    
+    /**
+     * What a command that may change what a registered view shows acts on.
+     */
+    enum class ViewTarget {
+        None,                // Does not affect views
+        Artboard,            // cmd.handle is an artboard
+        StateMachine,        // cmd.handle is a state machine
+        ViewModelInstance,   // cmd.handle is a view model instance
+    };
+    static ViewTarget viewTargetOf(CommandType type);
+
+    /**
+     * Marks the registered views that use the target of an executed command
+     * dirty, so they are advanced and drawn on the next tick even if settled.
+     */
+    void wakeViewsFor(const Command& cmd);
+    
+    /**
+     * Handles an AttachSharedFile command.
+     * 
+     * @param cmd The command to execute.
+     */
+    void handleAttachSharedFile(const Command& cmd);
+    
+    /**
+     * Gets the factory files are imported with: the render context's, or the
+     * shared headless factory when there is none.
+     */
+    rive::Factory* importFactory();
+    
     /**
      * Handles a GetArtboardNames command.
      * 
@@ -1082,12 +1687,41 @@ private:
     void handleBindViewModelInstance(const Command& cmd);
     void handleGetDefaultVMI(const Command& cmd);
 
+    // Bulk VMI handlers (Phase G.15)
+    void handleCreateVMIBatch(const Command& cmd);
+
+    /**
+     * Locks a file handle's view model runtimes against other servers that
+     * share the file (Phase G.9). Hold the lock around viewModelByName() and
+     * the instance created from its result.
+     *
+     * @return The lock, or an empty lock if the file is not shared.
+     */
+    std::unique_lock<std::mutex> lockSharedFile(int64_t fileHandle);
+
+    /**
+     * Looks up a VMI handle, creating its instance first if the handle is a
+     * still-pending member of a batch. Use instead of m_viewModelInstances.find
+     * wherever a command reads or writes an instance.
+     *
+     * @return An iterator into m_viewModelInstances, or end() if the handle
+     *         is unknown or its batch's file or view model is gone.
+     */
+    std::map<int64_t, rive::rcp<rive::ViewModelInstanceRuntime>>::iterator findVMI(int64_t handle);
+
+    /**
+     * Drops a still-pending batch handle without creating its instance.
+     *
+     * @return True if the handle was pending.
+     */
+    bool releasePendingVMI(int64_t handle);
+
     // Render target operation handlers (Phase C.2.3)
     void handleCreateRenderTarget(const Command& cmd);
     void handleDeleteRenderTarget(const Command& cmd);
 
     // Rendering operation handlers (Phase C.2.6)
-    void handleDraw(const Command& cmd);
+    void handleDraw(const Command& cmd, bool reportComplete = true);
 
     // Artboard resizing handlers (Phase E.3)
     void handleResizeArtboard(const Command& cmd);
@@ -1152,6 +1786,11 @@ private:
      */
     void enqueueMessage(Message msg);
     
+    /**
+     * Applies the default queue policies. Shared by both constructors.
+     */
+    void initQueuePolicies();
+
     /**
      * Starts the worker thread.
      */
@@ -1162,12 +1801,200 @@ private:
      */
     void stop();
     
+    /**
+     * Pops and executes one command, if any is queued. Called from the
+     * worker loop, or from the host thread for a hosted server.
+     * 
+     * @return True if a command ran.
+     */
+    bool runNextCommand();
+    
+    /**
+     * True if commands are queued. Thread-safe.
+     */
+    bool hasPendingCommands() const;
+    
+    /**
+     * True when called on the thread that executes this server's commands.
+     */
+    bool isWorkerThread() const;
+    
     // Thread management
     std::thread m_thread;
-    std::queue<Command> m_commandQueue;
-    std::mutex m_mutex;
+    std::deque<Command> m_commandQueue;
+    mutable std::mutex m_mutex;
     std::condition_variable m_cv;
     std::atomic<bool> m_running{false};
+
+    // Phase G.10: Shared host thread; null for a server with its own thread
+    CommandServerHost* m_host = nullptr;
+    uint32_t m_hostWeight = 1;
+
+    // Phase G.1: Per-class backpressure (protected by m_mutex)
+    QueuePolicy m_queuePolicies[kCommandClassCount];
+    QueueStats m_queueStats[kCommandClassCount];
+    std::condition_variable m_queueSpaceCv;  // Signalled when the worker pops a command
+
+    // Phase G.2: Cancellation token for the command being executed
+    const Command* m_inFlight = nullptr;             // Protected by m_mutex
+    bool m_workerPaused = false;                     // Protected by m_mutex
+    bool m_holdInFlight = false;                     // Protected by m_mutex
+    std::condition_variable m_holdCv;                // Signalled when m_holdInFlight is cleared
+    std::atomic<int64_t> m_cancelledRequestID{0};    // Non-zero while the in-flight request is cancelled
+    int64_t m_inFlightReplyID = 0;                   // Protected by m_messageMutex
+    bool m_inFlightReplied = false;                  // Protected by m_messageMutex
+
+    // Phase G.3: Stall watchdog. The worker publishes the in-flight command
+    // through atomics; the watchdog samples them without taking m_mutex.
+    std::thread m_watchdogThread;
+    mutable std::mutex m_watchdogMutex;
+    std::condition_variable m_watchdogCv;
+    bool m_watchdogStop = false;                      // Protected by m_watchdogMutex
+    std::atomic<int64_t> m_slowThresholdNs{100 * 1000000LL};
+    std::atomic<uint64_t> m_commandSequence{0};
+    std::atomic<int32_t> m_currentCommandType{0};
+    std::atomic<int64_t> m_currentRequestID{0};
+    std::atomic<int64_t> m_currentStartNs{0};        // 0 while the worker is idle
+    SlowCommandRecord m_slowCommands[kSlowCommandRingSize];  // Protected by m_watchdogMutex
+    size_t m_slowCommandNext = 0;                    // Protected by m_watchdogMutex
+    uint64_t m_slowCommandCount = 0;                 // Protected by m_watchdogMutex
+
+    // Phase G.5: Scheduled inputs, per state machine (worker thread only).
+    // Times are in the state machine's animation clock, which only moves
+    // with AdvanceStateMachine.
+    struct ScheduledInput {
+        int64_t id = 0;
+        ScheduledInputKind kind = ScheduledInputKind::Trigger;
+        std::string inputName;
+        float floatValue = 0.0f;
+        bool boolValue = false;
+        float delaySeconds = 0.0f;
+        std::string onEvent;                         // Empty for one-shot timers
+    };
+    struct HeldEvent {
+        int64_t id = 0;                              // The DelayEvent schedule holding it
+        rive::Event* event = nullptr;
+    };
+    struct StateMachineSchedule {
+        double clock = 0.0;                          // Animation seconds advanced so far
+        std::multimap<double, ScheduledInput> timers; // Keyed by due time
+        std::vector<ScheduledInput> reactions;       // Armed by reported events
+        std::vector<ScheduledInput> eventDelays;     // DelayEvent schedules
+        std::multimap<double, HeldEvent> heldEvents; // Keyed by delivery time
+
+        bool empty() const
+        {
+            return timers.empty() && reactions.empty() && eventDelays.empty() &&
+                   heldEvents.empty();
+        }
+    };
+    std::map<int64_t, StateMachineSchedule> m_schedules;  // Keyed by smHandle
+    std::atomic<int64_t> m_nextTimerID{1};           // Allocated on the caller thread
+
+    // Phase G.6: Command capture. Records are encoded on the enqueueing
+    // thread; m_capturing keeps the cost to one load while the recorder is off.
+    struct CapturedCommand {
+        int64_t timeNs = 0;                          // steady_clock enqueue time
+        CommandClass commandClass = CommandClass::Ordered;
+        std::vector<uint8_t> payload;                // Encoded command fields
+    };
+    std::atomic<bool> m_capturing{false};
+    std::mutex m_captureMutex;
+    int64_t m_captureWindowNs = 0;                   // 0 keeps everything. Protected by m_captureMutex
+    size_t m_captureTrimAt = 0;                      // Protected by m_captureMutex
+    std::vector<CapturedCommand> m_capturedCommands; // Protected by m_captureMutex
+    std::map<uint64_t, std::vector<uint8_t>> m_captureBlobs;  // Keyed by content hash. Protected by m_captureMutex
+    int64_t m_captureFirstHandle = 0;                // m_nextHandle at start. Protected by m_captureMutex
+
+    // Phase G.6: Per-type execution time, only sized while replaying.
+    // Set before the first command is enqueued and read after the last one
+    // has completed, so the worker is the only writer.
+    std::vector<ReplayTypeTiming> m_replayTimings;
+
+    /**
+     * Records a command if the capture is running.
+     *
+     * @param resultHandle The handle a synchronous create returned, or 0.
+     */
+    void captureCommand(const Command& cmd, int64_t resultHandle = 0);
+
+    /**
+     * Records a synchronous create, which bypasses the queue, as the
+     * equivalent async command and the handle it returned.
+     */
+    void captureSyncCreate(CommandType type,
+                           int64_t parentHandle,
+                           const std::string& name,
+                           int64_t handle);
+
+    /**
+     * Re-runs a recorded synchronous create on this (replay) server.
+     *
+     * @return The new handle, or 0 on failure.
+     */
+    int64_t replaySyncCreate(const Command& cmd);
+
+    /**
+     * Drops frame, pointer and draw records older than the flight recorder window.
+     */
+    void trimCaptureLocked(int64_t nowNs);
+
+    /**
+     * Adds an executed command to the replay timings (no-op outside a replay).
+     */
+    void noteReplayTiming(const Command& cmd, int64_t durationNs);
+
+    /**
+     * Arms event reactions for the events reported by the advance that just
+     * ended at schedule.clock.
+     */
+    static void armEventReactions(rive::StateMachineInstance* sm,
+                                  StateMachineSchedule& schedule);
+
+    // Phase G.5: Events reported by the last advance of each state machine,
+    // across every step a scheduled input split it into. advanceAndApply()
+    // clears the runtime's reports, so each step's are copied out here and
+    // GetReportedEventCount/At read this list, after filtering (worker
+    // thread only).
+    struct FrameEvent {
+        rive::Event* event = nullptr;
+        float secondsDelay = 0.0f;                   // Before the end of the whole advance
+    };
+    std::map<int64_t, std::vector<FrameEvent>> m_frameEvents;  // Keyed by smHandle
+
+    /**
+     * Applies the DelayEvent schedules to the events of an advance that ended
+     * at schedule.clock: holds back events that are not due yet and adds the
+     * held events that have come due, so the list stays in the order the
+     * client sees them happen.
+     */
+    static void delayFrameEvents(StateMachineSchedule& schedule,
+                                 std::vector<FrameEvent>& events);
+
+    /**
+     * Appends the events reported by the step that just ended.
+     *
+     * @param laterSeconds Time from the end of the step to the end of the
+     *        whole advance, added to each event's delay.
+     */
+    static void collectFrameEvents(rive::StateMachineInstance* sm,
+                                   double laterSeconds,
+                                   std::vector<FrameEvent>& events);
+
+    // Phase G.4: Input-to-present latency. Pending inputs and advance times
+    // are only touched by the worker; the sample rings are read by callers.
+    struct PendingInput {
+        InputEventKind kind = InputEventKind::PointerMove;
+        int64_t clientTimeNs = 0;
+        bool advanced = false;                       // Consumed by an advance
+    };
+    std::map<int64_t, std::vector<PendingInput>> m_pendingInputs;  // Keyed by smHandle
+    std::map<int64_t, int64_t> m_frameAdvanceNs;     // Keyed by smHandle
+    mutable std::mutex m_latencyMutex;
+    int64_t m_latencySamples[kInputEventKindCount][kLatencySampleCount] = {};  // Protected by m_latencyMutex
+    size_t m_latencySampleNext[kInputEventKindCount] = {};                     // Protected by m_latencyMutex
+    uint64_t m_latencyCount[kInputEventKindCount] = {};                        // Protected by m_latencyMutex
+    std::atomic<bool> m_frameTimingEnabled{false};
     
     // JNI reference to the Java CommandQueue object (for callbacks in Phase B+)
     rive_mp::GlobalRef<jobject> m_commandQueueRef;
@@ -1175,8 +2002,25 @@ private:
     // Render context (for Phase C+)
     void* m_renderContext;
 
-    // Fallback factory for when no render context is available (for tests)
-    std::unique_ptr<rive::NoOpFactory> m_noOpFactory;
+    // Phase G.9: Registry keys of the shared files behind file handles (worker thread only)
+    std::map<int64_t, SharedFileRegistry::Key> m_sharedFileKeys;
+    // and the registry's mutex for each, see lockSharedFile() (worker thread only)
+    std::map<int64_t, std::shared_ptr<std::mutex>> m_sharedFileMutexes;
+
+    // Phase G.11: Views drawn by the server's frame loop (worker thread only)
+    struct RegisteredView {
+        Command draw;            // Draw parameters, reused every frame
+        bool dirty = true;       // Draw on the next tick even if settled
+        bool settled = false;    // The state machine stopped playing
+    };
+    std::map<int64_t, RegisteredView> m_views;
+    std::map<int64_t, int64_t> m_viewModelBindings;  // smHandle -> bound vmiHandle (worker thread only)
+    std::atomic<bool> m_viewsIdle{true};
+    std::atomic<int64_t> m_nextViewID{1};
+
+    // Phase G.13: Import with the deferred factory
+    std::atomic<bool> m_lazyGpuResources{false};
+    std::atomic<int64_t> m_lazyIdleReleaseNs{10'000'000'000LL};
     
     // Message queue for callbacks to Kotlin
     std::queue<Message> m_messageQueue;
@@ -1203,6 +2047,36 @@ private:
     // Phase D: View model instance resource map
     std::map<int64_t, rive::rcp<rive::ViewModelInstanceRuntime>> m_viewModelInstances;
 
+    // Phase G.15: Reserved VMI ranges keyed by first handle (worker thread only)
+    std::map<int64_t, VMIBatch> m_vmiBatches;
+
+    // Phase G.16: Event filters, per state machine (worker thread only). State
+    // machines without an entry report every event.
+    struct EventFilter {
+        EventFilterMode mode = EventFilterMode::All;
+        std::vector<std::string> names;
+        std::vector<int32_t> typeCodes;
+    };
+    std::map<int64_t, EventFilter> m_eventFilters;  // Keyed by smHandle
+
+    // Every event of the last advance of a filtered state machine, while
+    // m_frameEvents holds the ones that pass, so a new filter can be applied
+    // to the same advance (worker thread only).
+    std::map<int64_t, std::vector<FrameEvent>> m_unfilteredFrameEvents;  // Keyed by smHandle
+
+    /**
+     * Reduces a state machine's m_frameEvents to the events that pass its
+     * filter, once per advance and on SetEventFilter, so reading the events
+     * is a plain index. Does nothing for unfiltered state machines.
+     */
+    void filterFrameEvents(int64_t smHandle);
+
+    /**
+     * Whether a reported event passes a state machine's filter (null = all).
+     * Compares the event's name and type in place; does not allocate.
+     */
+    static bool eventPassesFilter(const EventFilter* filter, const rive::Event* event);
+
     // Phase D.4: Property subscriptions
     std::vector<PropertySubscription> m_propertySubscriptions;
     std::mutex m_subscriptionsMutex;
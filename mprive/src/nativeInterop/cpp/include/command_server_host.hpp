@@ -0,0 +1,111 @@
+#ifndef RIVE_ANDROID_COMMAND_SERVER_HOST_HPP
+#define RIVE_ANDROID_COMMAND_SERVER_HOST_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rive_android {
+
+class CommandServer;
+
+/**
+ * A worker thread shared by several CommandServers (Phase G.10).
+ *
+ * Each hosted CommandServer keeps its own command queue, backpressure
+ * policies, message queue and resource maps, so handles stay namespaced per
+ * queue. The host owns the thread and the render context instead: one GL
+ * context, one thread and one set of wakeups however many queues it serves.
+ *
+ * Scheduling is weighted round-robin. Every round visits the servers in
+ * turn, starting one further along each round, and runs up to `weight`
+ * commands from each; a weight-1 server gets a fair share, a weight-4
+ * server up to four times as much when everyone is busy. A server with
+ * nothing queued is skipped at no cost.
+ */
+class CommandServerHost {
+public:
+    /**
+     * Constructs the host and starts its worker thread.
+     *
+     * @param renderContext The native RenderContext pointer, or null for a
+     *        headless host. Initialized and destroyed on the worker thread.
+     */
+    explicit CommandServerHost(void* renderContext);
+
+    /**
+     * Stops the worker thread. Every server must have been detached.
+     */
+    ~CommandServerHost();
+
+    CommandServerHost(const CommandServerHost&) = delete;
+    CommandServerHost& operator=(const CommandServerHost&) = delete;
+
+    /**
+     * Adds a server to the rotation. Thread-safe.
+     *
+     * @param server The server; it must stay alive until detach() returns.
+     * @param weight Commands the server may run per round (at least 1).
+     */
+    void attach(CommandServer* server, uint32_t weight);
+
+    /**
+     * Removes a server once its queued commands have run. Blocks until the
+     * worker no longer touches the server. Thread-safe; must not be called
+     * from the worker thread.
+     */
+    void detach(CommandServer* server);
+
+    /**
+     * Changes a server's weight. Thread-safe.
+     */
+    void setWeight(CommandServer* server, uint32_t weight);
+
+    /**
+     * Wakes the worker: a hosted server has queued a command. Thread-safe.
+     */
+    void notifyWork();
+
+    /**
+     * True when called on the worker thread.
+     */
+    bool isWorkerThread() const { return std::this_thread::get_id() == m_thread.get_id(); }
+
+    void* renderContext() const { return m_renderContext; }
+
+    size_t serverCount() const;
+
+private:
+    struct HostedServer {
+        CommandServer* server = nullptr;
+        uint32_t weight = 1;
+        bool detaching = false;  // Drain, then remove
+    };
+
+    void hostLoop();
+
+    /**
+     * Runs one scheduling round.
+     *
+     * @return True if any command ran.
+     */
+    bool runRound();
+
+    void* m_renderContext;
+    std::thread m_thread;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;              // Wakes the worker
+    std::condition_variable m_detachCv;        // Signals completed detaches
+    std::vector<HostedServer> m_servers;       // Protected by m_mutex
+    size_t m_nextServer = 0;                   // Protected by m_mutex
+    uint64_t m_wakeups = 0;                    // Protected by m_mutex
+    bool m_stop = false;                       // Protected by m_mutex
+};
+
+} // namespace rive_android
+
+#endif // RIVE_ANDROID_COMMAND_SERVER_HOST_HPP
@@ -1,6 +1,7 @@
 #ifndef RIVE_ANDROID_COMMAND_SERVER_TYPES_HPP
 #define RIVE_ANDROID_COMMAND_SERVER_TYPES_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -111,8 +112,24 @@ enum class CommandType {
     UnregisterFont,           // Unregister font by name
     // Synchronous execution on worker thread
     RunOnce,                  // Execute a function on the worker thread (for GL operations)
+    // Phase G.5: Scheduled inputs
+    ScheduleInput,            // Fire an input after a delay in animation time (or on an event)
+    CancelScheduledInput,     // Cancel a scheduled input or event reaction
+    // Phase G.9: Shared files
+    AttachSharedFile,         // Attach a file another server has imported
+    // Phase G.11: Registered views
+    RegisterView,             // Register or update a view drawn by the frame loop (handle = view ID)
+    UnregisterView,           // Remove a registered view (handle = view ID)
+    FrameTick,                // Advance and draw every registered view that is not settled
+    // Phase G.15: Bulk view model instances
+    CreateVMIBatch,           // Reserve a range of VMIs of one ViewModel (handle = file, firstHandle, instanceCount)
+    // Phase G.16: Event filters
+    SetEventFilter,           // Choose which reported events reach the client (handle = state machine)
 };
 
+// Keep in sync with the last CommandType (used to size per-type tables).
+constexpr size_t kCommandTypeCount = static_cast<size_t>(CommandType::SetEventFilter) + 1;
+
 /**
  * Message types that can be sent from CommandServer to Kotlin.
  */
@@ -203,6 +220,8 @@ enum class MessageType {
     AudioError,               // Audio decode/operation failed
     FontDecoded,              // Font decoded successfully (returns fontHandle)
     FontError,                // Font decode/operation failed
+    // Phase G.2: Request cancellation
+    RequestCancelled,         // Request was cancelled before producing a result
 };
 
 /**
@@ -249,6 +268,230 @@ struct PropertySubscription {
     }
 };
 
+/**
+ * A top-level scalar property copied from the seed of a VMI batch (Phase G.15).
+ */
+struct VMISeedValue {
+    std::string name;
+    PropertyDataType type = PropertyDataType::NONE;
+    float numberValue = 0.0f;
+    std::string stringValue;     // STRING and ENUM
+    bool boolValue = false;
+    int32_t colorValue = 0;
+};
+
+/**
+ * A range of VMI handles reserved by createVMIBatch (Phase G.15).
+ *
+ * Instances are created from the view model's default instance, with the
+ * seed values applied, the first time a command uses their handle, so a
+ * batch whose handles are never touched costs no instance storage.
+ */
+struct VMIBatch {
+    int64_t fileHandle = 0;
+    std::string viewModelName;
+    int64_t firstHandle = 0;
+    std::vector<bool> pending;   // Per handle: reserved and not yet created or deleted
+    size_t pendingCount = 0;
+    std::vector<VMISeedValue> seedValues;
+};
+
+/**
+ * Command classes used for queue backpressure (Phase G.1).
+ *
+ * Only the fire-and-forget classes are bounded. Everything else falls into
+ * Ordered, which is never dropped or coalesced because callers either wait
+ * on a reply or rely on the command's side effect.
+ */
+enum class CommandClass {
+    Ordered = 0,              // Request/response and state-mutating commands
+    Advance = 1,              // AdvanceStateMachine, FrameTick (FrameTick is coalesced, never dropped)
+    Pointer = 2,              // PointerMove/Down/Up/Exit (only PointerMove is droppable)
+    Draw = 3,                 // Draw
+};
+
+constexpr size_t kCommandClassCount = 4;
+
+/**
+ * Maps a command type to its backpressure class.
+ */
+inline CommandClass commandClassOf(CommandType type) {
+    switch (type) {
+        case CommandType::AdvanceStateMachine:
+        case CommandType::FrameTick:
+            return CommandClass::Advance;
+        case CommandType::PointerMove:
+        case CommandType::PointerDown:
+        case CommandType::PointerUp:
+        case CommandType::PointerExit:
+            return CommandClass::Pointer;
+        case CommandType::Draw:
+            return CommandClass::Draw;
+        default:
+            return CommandClass::Ordered;
+    }
+}
+
+/**
+ * What to do when a bounded command class reaches its capacity.
+ */
+enum class OverflowPolicy {
+    Unbounded = 0,            // No limit (capacity is ignored)
+    DropOldest = 1,           // Drop the oldest droppable pending command of the class
+    Coalesce = 2,             // At capacity, merge into a pending command with the same key, else DropOldest
+    Block = 3,                // Block the producer until the worker drains the class
+};
+
+/**
+ * Whether a command may be cancelled by requestID or handle (Phase G.2).
+ *
+ * Only commands that have no lasting side effect when skipped qualify:
+ * imports/decodes, read-only queries and the fire-and-forget frame commands.
+ * Deletes, setters, registrations and RunOnce (whose caller is blocked on
+ * it) always run.
+ */
+inline bool isCancellable(CommandType type) {
+    switch (type) {
+        case CommandType::LoadFile:
+        case CommandType::GetArtboardNames:
+        case CommandType::GetStateMachineNames:
+        case CommandType::GetViewModelNames:
+        case CommandType::GetViewModelInstanceNames:
+        case CommandType::GetViewModelProperties:
+        case CommandType::GetEnums:
+        case CommandType::GetInputCount:
+        case CommandType::GetInputNames:
+        case CommandType::GetInputInfo:
+        case CommandType::GetNumberInput:
+        case CommandType::GetBooleanInput:
+        case CommandType::GetReportedEventCount:
+        case CommandType::GetReportedEventAt:
+        case CommandType::GetNumberProperty:
+        case CommandType::GetStringProperty:
+        case CommandType::GetBooleanProperty:
+        case CommandType::GetEnumProperty:
+        case CommandType::GetColorProperty:
+        case CommandType::GetListSize:
+        case CommandType::GetListItem:
+        case CommandType::GetInstanceProperty:
+        case CommandType::GetDefaultVMI:
+        case CommandType::DecodeImage:
+        case CommandType::DecodeAudio:
+        case CommandType::DecodeFont:
+        case CommandType::AdvanceStateMachine:
+        case CommandType::PointerMove:
+        case CommandType::Draw:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Per-class queue policy.
+ */
+struct QueuePolicy {
+    OverflowPolicy policy = OverflowPolicy::Unbounded;
+    uint32_t capacity = 0;    // Max pending commands of the class (0 = unbounded)
+};
+
+/**
+ * Per-class queue counters, reported by CommandServer::getQueueStats().
+ */
+struct QueueStats {
+    uint64_t enqueued = 0;    // Commands submitted by producers
+    uint64_t dropped = 0;     // Pending commands discarded by DropOldest
+    uint64_t coalesced = 0;   // Commands merged into a pending command
+    uint64_t blocked = 0;     // Times a producer had to wait (Block policy)
+    uint32_t pending = 0;     // Commands currently in the queue
+    uint32_t highWater = 0;   // Max pending commands observed
+};
+
+/**
+ * Kind of input event tracked for input-to-present latency (Phase G.4).
+ */
+enum class InputEventKind {
+    PointerMove = 0,
+    PointerDown = 1,
+    PointerUp = 2,
+    PointerExit = 3,
+    StateMachineInput = 4,    // SetNumberInput, SetBooleanInput, FireTrigger
+};
+
+constexpr size_t kInputEventKindCount = 5;
+
+/**
+ * Maps an input command to its latency kind.
+ *
+ * @return false if the command is not an input command.
+ */
+inline bool inputEventKindOf(CommandType type, InputEventKind& outKind) {
+    switch (type) {
+        case CommandType::PointerMove:
+            outKind = InputEventKind::PointerMove;
+            return true;
+        case CommandType::PointerDown:
+            outKind = InputEventKind::PointerDown;
+            return true;
+        case CommandType::PointerUp:
+            outKind = InputEventKind::PointerUp;
+            return true;
+        case CommandType::PointerExit:
+            outKind = InputEventKind::PointerExit;
+            return true;
+        case CommandType::SetNumberInput:
+        case CommandType::SetBooleanInput:
+        case CommandType::FireTrigger:
+            outKind = InputEventKind::StateMachineInput;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * What a scheduled input does when it fires (Phase G.5).
+ */
+enum class ScheduledInputKind {
+    Trigger = 0,              // Fire a trigger input
+    Number = 1,               // Set a number input
+    Boolean = 2,              // Set a boolean input
+    DelayEvent = 3,           // Hold a reported event's delivery (inputName is the event)
+};
+
+/**
+ * Which reported events of a state machine reach the client (Phase G.16).
+ */
+enum class EventFilterMode {
+    All = 0,                  // Every event (the default)
+    None = 1,                 // No events
+    Matching = 2,             // Events whose name or type code is listed
+};
+
+/**
+ * Input-to-present latency distribution of an input kind, over the most
+ * recent samples (Phase G.4).
+ */
+struct LatencyStats {
+    uint64_t count = 0;       // Events presented since the last reset
+    int64_t minNs = 0;
+    int64_t p50Ns = 0;
+    int64_t p90Ns = 0;
+    int64_t p99Ns = 0;
+    int64_t maxNs = 0;
+};
+
+/**
+ * Where the time of one Draw went (Phase G.4).
+ */
+struct FrameTiming {
+    int64_t queueWaitNs = 0;  // Enqueue to start of execution
+    int64_t advanceNs = 0;    // State machine advances since the previous draw
+    int64_t encodeNs = 0;     // beginFrame + artboard draw
+    int64_t flushNs = 0;      // GPU flush
+    int64_t presentNs = 0;    // Buffer swap
+};
+
 /**
  * A command to be executed by the CommandServer.
  */
@@ -258,6 +501,7 @@ struct Command {
     
     // Command-specific data
     std::vector<uint8_t> bytes;  // For LoadFile
+    std::vector<std::string> artboardNames; // For LoadFile (Phase G.14, empty = all artboards)
     int64_t handle = 0;          // For DeleteFile, etc.
     std::string name;            // For CreateArtboardByName, CreateStateMachineByName
     float deltaTime = 0.0f;      // For AdvanceStateMachine (in seconds)
@@ -331,6 +575,27 @@ struct Command {
     // RunOnce callback (Phase C.2.6 - synchronous GL operations)
     std::function<void()> runOnceCallback;
 
+    // Scheduled input data (Phase G.5)
+    int32_t scheduledKind = 0;   // For ScheduleInput (ScheduledInputKind)
+    float delaySeconds = 0.0f;   // For ScheduleInput (animation time)
+    int64_t timerID = 0;         // For ScheduleInput, CancelScheduledInput
+
+    // Shared file data (Phase G.9)
+    uint64_t contentKey = 0;     // For AttachSharedFile (content hash of the file bytes)
+
+    // Bulk view model instance data (Phase G.15)
+    int64_t firstHandle = 0;     // For CreateVMIBatch (first handle of the reserved range)
+    int32_t instanceCount = 0;   // For CreateVMIBatch (vmiHandle = optional seed instance)
+
+    // Event filter data (Phase G.16)
+    int32_t eventFilterMode = 0;            // For SetEventFilter (EventFilterMode)
+    std::vector<std::string> eventNames;    // For SetEventFilter (Matching)
+    std::vector<int32_t> eventTypeCodes;    // For SetEventFilter (Matching, event core type keys)
+
+    // Latency tracking (Phase G.4)
+    int64_t enqueueTimeNs = 0;   // steady_clock time when the command was enqueued
+    int64_t clientTimeNs = 0;    // For input commands (client event time, 0 = enqueue time)
+
     Command() = default;
     explicit Command(CommandType t, int64_t reqID = 0) 
         : type(t), requestID(reqID) {}
@@ -377,11 +642,60 @@ struct Message {
     std::vector<float> eventPropertyFloats;
     std::vector<std::string> eventPropertyStrings;
 
+    // Per-frame timing breakdown (Phase G.4)
+    FrameTiming frameTiming;     // For DrawComplete
+
     Message() = default;
     explicit Message(MessageType t, int64_t reqID = 0)
         : type(t), requestID(reqID) {}
 };
 
+/**
+ * A command that ran longer than the watchdog threshold (Phase G.3).
+ */
+struct SlowCommandRecord {
+    uint64_t sequence = 0;       // Worker command sequence number
+    CommandType type = CommandType::None;
+    int64_t requestID = 0;
+    int64_t startTimeNs = 0;     // steady_clock time when the command started
+    int64_t durationNs = 0;      // Run time (so far, if stalled)
+    bool stalled = false;        // Still running when the watchdog last sampled it
+};
+
+/**
+ * Per-type execution time of a replayed command stream (Phase G.6).
+ */
+struct ReplayTypeTiming {
+    CommandType type = CommandType::None;
+    uint32_t count = 0;
+    int64_t totalNs = 0;
+    int64_t maxNs = 0;
+};
+
+/**
+ * Result of replaying a captured command stream (Phase G.6).
+ */
+struct ReplayReport {
+    uint32_t commandCount = 0;   // Commands re-executed
+    uint32_t skippedCount = 0;   // Commands that cannot run headless (Draw)
+    uint32_t errorCount = 0;     // Error messages produced by the replay
+    int64_t recordedSpanNs = 0;  // First to last record, as captured
+    int64_t wallTimeNs = 0;      // First enqueue to last completion, as replayed
+    std::vector<ReplayTypeTiming> types;  // Only types that ran, in CommandType order
+};
+
+/**
+ * Returns a stable, human-readable name for a command type
+ * (used for logs, trace sections and diagnostics).
+ */
+const char* commandTypeName(CommandType type);
+
+/**
+ * Current steady_clock time in nanoseconds. Matches CLOCK_MONOTONIC, the
+ * base of System.nanoTime() and MotionEvent event times.
+ */
+int64_t steadyClockNowNs();
+
 } // namespace rive_android
 
 #endif // RIVE_ANDROID_COMMAND_SERVER_TYPES_HPP
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rive_mp
+{
+
+/** An encoded texture with its full mip chain, as stored in the cache. */
+struct CompressedTexture
+{
+    uint32_t glFormat = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    /** Level 0 first; each entry holds that level's compressed blocks. */
+    std::vector<std::vector<uint8_t>> levels;
+};
+
+/**
+ * Persistent on-disk cache of compressed image textures.
+ *
+ * Images embedded in .riv files are otherwise decoded and uploaded as RGBA8
+ * on every load; a 2048x2048 image costs 16 MB of texture memory. When the
+ * cache is configured, decoded images are transcoded to ETC2 on the
+ * GpuUploadWorker thread and the result is written here. On later loads the
+ * compressed levels are read back and uploaded directly, skipping both the
+ * platform decode and the encode.
+ *
+ * Entries are keyed by the content hash of the encoded image bytes combined
+ * with the target format and encoder version, so changing either never
+ * returns stale data. Files are written to a temporary name and renamed, so
+ * a crash mid-write never leaves a truncated entry. Each entry also carries a
+ * checksum of its levels: load() reads and verifies the whole entry, and
+ * deletes it if anything is off, so a damaged file is decoded again instead
+ * of being uploaded.
+ *
+ * Thread-safe. The cache is disabled until configure() is given a directory.
+ */
+class CompressedTextureCache
+{
+public:
+    /**
+     * Enable the cache in the given directory (created if missing), or
+     * disable it with an empty path.
+     *
+     * @return Whether the cache is enabled afterwards; false if the directory
+     *         could not be created.
+     */
+    static bool configure(const std::string& directory);
+
+    static bool enabled() { return s_enabled.load(std::memory_order_acquire); }
+
+    /** Cache key for encoded image bytes with the current encoder settings. */
+    static uint64_t keyFor(const uint8_t* encodedBytes, size_t size);
+
+    /**
+     * Read and verify an entry, including every mip level. Counts a hit only
+     * for a complete, valid entry; invalid entries are deleted.
+     *
+     * @return False if there is no valid entry for the key.
+     */
+    static bool load(uint64_t key, CompressedTexture* texture);
+
+    /** Write an entry, replacing any existing one. */
+    static bool store(uint64_t key, const CompressedTexture& texture);
+
+    /** Delete an entry, e.g. one the driver refused to upload. */
+    static void remove(uint64_t key);
+
+    /** Valid entries found / lookups that must decode, since startup. */
+    static uint64_t hitCount() { return s_hits.load(std::memory_order_relaxed); }
+    static uint64_t missCount() { return s_misses.load(std::memory_order_relaxed); }
+
+private:
+    static std::string pathFor(uint64_t key);
+
+    static std::mutex s_mutex;
+    static std::string s_directory; // Protected by s_mutex
+    static std::atomic<bool> s_enabled;
+    static std::atomic<uint64_t> s_hits;
+    static std::atomic<uint64_t> s_misses;
+};
+
+} // namespace rive_mp
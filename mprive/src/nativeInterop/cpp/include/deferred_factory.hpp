@@ -0,0 +1,326 @@
+#pragma once
+
+#include "rive/factory.hpp"
+#include "rive/math/raw_path.hpp"
+#include "rive/renderer.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace rive_mp
+{
+
+class DeferredFactory;
+
+/**
+ * Bookkeeping shared by every deferred render object: whether its real
+ * object exists and when it was last drawn.
+ *
+ * The real object itself is only touched on the draw thread; whether it
+ * exists is mirrored in an atomic so stats() can read it from any thread.
+ */
+class DeferredResource
+{
+public:
+    virtual ~DeferredResource() = default;
+
+    /**
+     * Drop the real object; the next draw creates it again.
+     *
+     * @return False if the real object is the only copy of the state and was
+     *         kept.
+     */
+    virtual bool releaseMaterialized() = 0;
+
+    bool isMaterialized() const { return m_materialized.load(std::memory_order_acquire); }
+
+    int64_t lastUsedNs() const { return m_lastUsedNs; }
+
+    /** The factory that created the object. */
+    DeferredFactory* owner() const { return m_owner; }
+
+protected:
+    explicit DeferredResource(DeferredFactory* owner) : m_owner(owner) {}
+
+    /** Record whether the real object exists. Draw thread only. */
+    void setMaterialized(bool materialized)
+    {
+        m_materialized.store(materialized, std::memory_order_release);
+    }
+
+    DeferredFactory* const m_owner;
+    int64_t m_lastUsedNs = 0;
+
+private:
+    std::atomic<bool> m_materialized{false};
+};
+
+/**
+ * A render path that records its contours and only creates the real path
+ * when it is first drawn.
+ *
+ * Once the real path exists, later edits (animated paths are rebuilt every
+ * frame) go straight to it rather than through the recorded contours, so
+ * each edit is written once. The real path then holds the only copy of the
+ * contours and is no longer released when idle.
+ */
+class DeferredRenderPath : public LITE_RTTI_OVERRIDE(rive::RenderPath, DeferredRenderPath),
+                           public DeferredResource
+{
+public:
+    DeferredRenderPath(DeferredFactory* factory, rive::FillRule fillRule);
+    DeferredRenderPath(DeferredFactory* factory, rive::RawPath& rawPath, rive::FillRule fillRule);
+    ~DeferredRenderPath() override;
+
+    void rewind() override;
+    void addRenderPath(rive::RenderPath* path, const rive::Mat2D& transform) override;
+    void addRawPath(const rive::RawPath& path) override;
+    void moveTo(float x, float y) override;
+    void lineTo(float x, float y) override;
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override;
+    void close() override;
+    void fillRule(rive::FillRule value) override;
+
+    /** The real path, created or brought up to date. Draw thread only. */
+    rive::RenderPath* materialize(int64_t frameNs);
+
+    bool releaseMaterialized() override;
+
+private:
+    /** Create the real path if needed and bring it up to date. */
+    rive::RenderPath* syncReal();
+
+    /**
+     * Make edits go to the real path from now on, creating it if needed.
+     * Edits run on the draw thread, as materialization does.
+     */
+    rive::RenderPath* forwardToReal();
+
+    rive::RawPath m_rawPath; // Empty once forwarding
+    rive::FillRule m_fillRule;
+    bool m_dirty = true;
+    bool m_forwarding = false;
+    rive::rcp<rive::RenderPath> m_real;
+};
+
+/**
+ * A render paint that records its state and only creates the real paint when
+ * it is first drawn with.
+ */
+class DeferredRenderPaint : public LITE_RTTI_OVERRIDE(rive::RenderPaint, DeferredRenderPaint),
+                            public DeferredResource
+{
+public:
+    explicit DeferredRenderPaint(DeferredFactory* factory);
+    ~DeferredRenderPaint() override;
+
+    void style(rive::RenderPaintStyle style) override;
+    void color(rive::ColorInt value) override;
+    void thickness(float value) override;
+    void join(rive::StrokeJoin value) override;
+    void cap(rive::StrokeCap value) override;
+    void blendMode(rive::BlendMode value) override;
+    void shader(rive::rcp<rive::RenderShader> shader) override;
+    void invalidateStroke() override;
+
+    rive::RenderPaint* materialize(int64_t frameNs);
+
+    bool releaseMaterialized() override
+    {
+        m_real = nullptr;
+        setMaterialized(false);
+        return true;
+    }
+
+private:
+    rive::RenderPaintStyle m_style = rive::RenderPaintStyle::fill;
+    rive::ColorInt m_color = 0xff000000;
+    float m_thickness = 1.0f;
+    rive::StrokeJoin m_join = rive::StrokeJoin::miter;
+    rive::StrokeCap m_cap = rive::StrokeCap::butt;
+    rive::BlendMode m_blendMode = rive::BlendMode::srcOver;
+    rive::rcp<rive::RenderShader> m_shader;
+    rive::rcp<rive::RenderPaint> m_real;
+};
+
+/**
+ * A render buffer backed by CPU memory until it is first drawn, then
+ * uploaded to a real buffer.
+ */
+class DeferredRenderBuffer : public LITE_RTTI_OVERRIDE(rive::RenderBuffer, DeferredRenderBuffer),
+                             public DeferredResource
+{
+public:
+    DeferredRenderBuffer(DeferredFactory* factory,
+                         rive::RenderBufferType type,
+                         rive::RenderBufferFlags flags,
+                         size_t sizeInBytes);
+    ~DeferredRenderBuffer() override;
+
+    rive::rcp<rive::RenderBuffer> materialize(int64_t frameNs);
+
+    bool releaseMaterialized() override
+    {
+        m_real = nullptr;
+        setMaterialized(false);
+        return true;
+    }
+
+protected:
+    void* onMap() override { return m_data.data(); }
+    void onUnmap() override { m_dirty = true; }
+
+private:
+    std::vector<uint8_t> m_data;
+    bool m_dirty = false;
+    rive::rcp<rive::RenderBuffer> m_real;
+};
+
+/**
+ * Factory that imports files without creating GPU-side render objects
+ * (Phase G.13).
+ *
+ * Importing a file creates the paths, paints and buffers of every artboard,
+ * even those the app never shows. With this factory, import only records
+ * what each object needs. The real object is created through the wrapped
+ * factory the first time a DeferredRenderer draws it, and is released again
+ * once it has not been drawn for `idleReleaseNs`, so artboards that are not
+ * on screen cost no GPU memory.
+ *
+ * Images are still decoded by the wrapped factory at import time: their
+ * size is needed for layout, and uploads already run off the render thread.
+ * Gradient shaders are plain values and are also created directly.
+ *
+ * Files imported with this factory must be drawn with a DeferredRenderer,
+ * which recognizes deferred objects by their lite RTTI type rather than by a
+ * lookup. Objects may be created and destroyed on any thread; materialization
+ * and trimming happen on the draw thread.
+ */
+class DeferredFactory : public rive::Factory
+{
+public:
+    struct Stats
+    {
+        int64_t liveObjects = 0;
+        int64_t materializedObjects = 0;
+        int64_t materializations = 0;
+        int64_t releases = 0;
+    };
+
+    /** @param inner The factory that creates the real objects; must outlive this one. */
+    explicit DeferredFactory(rive::Factory* inner);
+
+    rive::rcp<rive::RenderBuffer> makeRenderBuffer(rive::RenderBufferType type,
+                                                   rive::RenderBufferFlags flags,
+                                                   size_t sizeInBytes) override;
+    rive::rcp<rive::RenderShader> makeLinearGradient(float sx,
+                                                     float sy,
+                                                     float ex,
+                                                     float ey,
+                                                     const rive::ColorInt colors[],
+                                                     const float stops[],
+                                                     size_t count) override;
+    rive::rcp<rive::RenderShader> makeRadialGradient(float cx,
+                                                     float cy,
+                                                     float radius,
+                                                     const rive::ColorInt colors[],
+                                                     const float stops[],
+                                                     size_t count) override;
+    rive::rcp<rive::RenderPath> makeRenderPath(rive::RawPath& rawPath,
+                                               rive::FillRule fillRule) override;
+    rive::rcp<rive::RenderPath> makeEmptyRenderPath() override;
+    rive::rcp<rive::RenderPaint> makeRenderPaint() override;
+    rive::rcp<rive::RenderImage> decodeImage(rive::Span<const uint8_t> encodedBytes) override;
+
+    rive::Factory* inner() const { return m_inner; }
+
+    /** Objects not drawn for this long are released by trim(). */
+    void setIdleReleaseNs(int64_t idleReleaseNs) { m_idleReleaseNs = idleReleaseNs; }
+
+    /** Start a frame; objects drawn in it are stamped with its time. */
+    void beginFrame();
+    int64_t frameNs() const { return m_frameNs; }
+
+    /**
+     * Release every real object that has not been drawn for idleReleaseNs.
+     * Runs at most once a second unless forced. Draw thread only.
+     *
+     * @return The number of objects released.
+     */
+    size_t trim(bool force = false);
+
+    Stats stats() const;
+
+private:
+    friend class DeferredRenderPath;
+    friend class DeferredRenderPaint;
+    friend class DeferredRenderBuffer;
+
+    void track(const void* object, DeferredResource* resource);
+    void untrack(const void* object);
+    void noteMaterialized() { m_materializations.fetch_add(1, std::memory_order_relaxed); }
+
+    rive::Factory* m_inner;
+    int64_t m_idleReleaseNs = 10'000'000'000LL;
+    int64_t m_frameNs = 0;
+    int64_t m_lastTrimNs = 0;
+
+    // Every live object, for trim() and stats(). Not consulted when drawing.
+    mutable std::mutex m_mutex;
+    // Keyed by the rive base pointer handed to the runtime
+    std::unordered_map<const void*, DeferredResource*> m_objects; // Protected by m_mutex
+    std::atomic<int64_t> m_materializations{0};
+    std::atomic<int64_t> m_releases{0};
+};
+
+/**
+ * Renderer that draws files imported with a DeferredFactory.
+ *
+ * Wraps the real renderer and swaps each deferred path, paint and buffer for
+ * its real object, creating it on first use. Objects from other factories
+ * pass through unchanged, so it can draw any artboard.
+ */
+class DeferredRenderer : public rive::Renderer
+{
+public:
+    /**
+     * @param renderer The real renderer.
+     * @param factory The deferred factory, or null to pass everything through.
+     */
+    DeferredRenderer(rive::Renderer* renderer, DeferredFactory* factory) :
+        m_renderer(renderer), m_factory(factory)
+    {}
+
+    void save() override { m_renderer->save(); }
+    void restore() override { m_renderer->restore(); }
+    void transform(const rive::Mat2D& transform) override { m_renderer->transform(transform); }
+    void modulateOpacity(float opacity) override { m_renderer->modulateOpacity(opacity); }
+    void clipPath(rive::RenderPath* path) override;
+    void drawPath(rive::RenderPath* path, rive::RenderPaint* paint) override;
+    void drawImage(const rive::RenderImage* image,
+                   rive::ImageSampler options,
+                   rive::BlendMode blendMode,
+                   float opacity) override;
+    void drawImageMesh(const rive::RenderImage* image,
+                       rive::ImageSampler options,
+                       rive::rcp<rive::RenderBuffer> vertices_f32,
+                       rive::rcp<rive::RenderBuffer> uvCoords_f32,
+                       rive::rcp<rive::RenderBuffer> indices_u16,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       rive::BlendMode blendMode,
+                       float opacity) override;
+
+private:
+    rive::RenderPath* resolve(rive::RenderPath* path) const;
+    rive::RenderPaint* resolve(rive::RenderPaint* paint) const;
+    rive::rcp<rive::RenderBuffer> resolve(rive::rcp<rive::RenderBuffer> buffer) const;
+
+    rive::Renderer* m_renderer;
+    DeferredFactory* m_factory;
+};
+
+} // namespace rive_mp
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Minimal ETC2 RGBA8 (EAC alpha) block encoder for compressed image textures.
+ *
+ * ETC2 is part of core OpenGL ES 3.0, so every device Rive renders on can
+ * sample it without extensions, at a quarter of the memory of RGBA8. Color is
+ * written in the ETC1-compatible individual and differential modes (the
+ * T/H/planar modes are not searched); alpha uses a per-table fit of the EAC
+ * base, multiplier and modifiers. This trades some quality for an encoder
+ * fast enough to run at import time on a worker thread.
+ */
+namespace rive_mp {
+    /** Encoder revision; part of the texture cache key. */
+    constexpr uint32_t kETC2EncoderVersion = 1;
+
+    /** GL_COMPRESSED_RGBA8_ETC2_EAC */
+    constexpr uint32_t kGLCompressedRGBA8ETC2EAC = 0x9278;
+
+    /**
+     * Size of an encoded image: 16 bytes per 4x4 block.
+     */
+    inline size_t ETC2RGBA8Size(uint32_t width, uint32_t height) {
+        return static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * 16;
+    }
+
+    /**
+     * Encode premultiplied RGBA pixels. Partial edge blocks repeat the last
+     * row/column.
+     *
+     * @param rgba Tightly packed RGBA pixels.
+     * @param width Width in pixels.
+     * @param height Height in pixels.
+     * @param out Output of ETC2RGBA8Size(width, height) bytes.
+     */
+    void EncodeETC2RGBA8(const uint8_t* rgba, uint32_t width, uint32_t height, uint8_t* out);
+}
@@ -0,0 +1,261 @@
+#pragma once
+#include <GLES3/gl3.h>
+
+#include "compressed_texture_cache.hpp"
+#include "rive/renderer/gl/render_context_gl_impl.hpp"
+#include "rive/renderer/rive_render_image.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <EGL/egl.h>
+
+namespace rive_mp
+{
+
+/**
+ * A RiveRenderImage whose texture is filled in by the GpuUploadWorker.
+ *
+ * Until its upload is published the image samples a shared 1x1 transparent
+ * placeholder, so artboards draw normally (minus the image) while large
+ * images are still being uploaded and mip-mapped.
+ */
+class UploadedRenderImage : public rive::RiveRenderImage
+{
+public:
+    UploadedRenderImage(uint32_t width,
+                        uint32_t height,
+                        rive::rcp<rive::gpu::Texture> placeholder) :
+        RiveRenderImage(static_cast<int>(width), static_cast<int>(height))
+    {
+        resetTexture(std::move(placeholder));
+    }
+
+    /** Swap the placeholder for the uploaded texture. Render thread only. */
+    void publish(rive::rcp<rive::gpu::Texture> texture)
+    {
+        resetTexture(std::move(texture));
+        m_ready = true;
+    }
+
+    bool isReady() const { return m_ready; }
+
+private:
+    bool m_ready = false;
+};
+
+/**
+ * Uploads image textures on a dedicated thread with its own EGL context
+ * (Phase G.12).
+ *
+ * `RenderContext::makeImage` used to create each texture, upload its pixels
+ * and build its mip chain on the render thread, so a large image stalled the
+ * frame that decoded it. The worker owns a second EGL context in the render
+ * context's share group: it creates and fills textures there, then inserts a
+ * fence. The render thread publishes an upload only once its fence has
+ * signaled, so a texture is never sampled half-written, and the render thread
+ * never blocks on an upload.
+ *
+ * The worker only needs an EGLDisplay and a context to share with, so it runs
+ * unchanged on a headless (surfaceless Mesa/llvmpipe) display. When a pbuffer
+ * cannot be created it falls back to EGL_KHR_surfaceless_context.
+ *
+ * Threading:
+ * - Make(), makeImage(), publishCompleted() and the destructor are called on
+ *   the render thread, with the render context current.
+ * - Only the worker thread makes the upload context current.
+ * - The worker only issues GL calls on the current (upload) context and hands
+ *   finished textures to `RenderContextGLImpl::adoptImageTexture`; the impl
+ *   must outlive the worker.
+ *
+ * Mip chains are built on the CPU (see mipmap_builder.hpp) and uploaded
+ * level by level instead of with glGenerateMipmap, so no filtering runs on
+ * any GL queue. Each level is derived from the previous one and freed once
+ * uploaded, so building a chain never holds more than two levels at a time.
+ *
+ * When the CompressedTextureCache is enabled, makeCompressedImage() also
+ * transcodes each level to ETC2 on the worker, writes the chain to the cache
+ * and uploads it compressed; makeCachedImage() uploads a cached chain without
+ * decoding or encoding anything. Cached chains are read and verified before
+ * an image is handed out, so a damaged entry falls back to decoding instead
+ * of leaving an image on its placeholder.
+ */
+class GpuUploadWorker
+{
+public:
+    /**
+     * Create the upload context and start the worker thread.
+     *
+     * @param display The render context's display.
+     * @param shareContext The render context's EGL context.
+     * @param impl The Rive render context implementation that creates textures.
+     * @return The worker, or nullptr if a shared context could not be made
+     *         current (callers then upload synchronously).
+     */
+    static std::unique_ptr<GpuUploadWorker> Make(EGLDisplay display,
+                                                 EGLContext shareContext,
+                                                 rive::gpu::RenderContextGLImpl* impl);
+
+    /** Stop the worker. Unpublished images keep their placeholder. */
+    ~GpuUploadWorker();
+
+    GpuUploadWorker(const GpuUploadWorker&) = delete;
+    GpuUploadWorker& operator=(const GpuUploadWorker&) = delete;
+
+    /**
+     * Queue an upload and return its image immediately.
+     *
+     * @param width Image width in pixels.
+     * @param height Image height in pixels.
+     * @param pixels RGBA pixel data (premultiplied alpha, 4 bytes per pixel).
+     */
+    rive::rcp<rive::RenderImage> makeImage(uint32_t width,
+                                           uint32_t height,
+                                           std::unique_ptr<uint8_t[]> pixels);
+
+    /**
+     * Queue a transcode to ETC2 and return the image immediately. The
+     * compressed chain is written to the CompressedTextureCache under
+     * cacheKey and uploaded; if transcoding fails the pixels are uploaded
+     * as RGBA8 instead.
+     */
+    rive::rcp<rive::RenderImage> makeCompressedImage(uint32_t width,
+                                                     uint32_t height,
+                                                     std::unique_ptr<uint8_t[]> pixels,
+                                                     uint64_t cacheKey);
+
+    /**
+     * Read a cached compressed chain and queue its upload. The entry is read
+     * in full and verified on the calling thread.
+     *
+     * @return The image, or nullptr if the cache has no valid entry for
+     *         cacheKey (callers then decode the image).
+     */
+    rive::rcp<rive::RenderImage> makeCachedImage(uint64_t cacheKey);
+
+    /**
+     * Publish every finished upload whose fence has signaled. Never waits.
+     *
+     * @return The number of images published.
+     */
+    size_t publishCompleted();
+
+    /** Uploads queued or in flight that have not been published yet. */
+    size_t pendingCount() const;
+
+    /**
+     * Allow or forbid creating workers. While disabled, Make() returns
+     * nullptr as if the shared context had failed, so render contexts
+     * initialized afterwards upload on the render thread. A kill switch for
+     * drivers with broken share groups, and how tests reach the fallback.
+     */
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_release); }
+    static bool enabled() { return s_enabled.load(std::memory_order_acquire); }
+
+    /** Uploads queued on any worker since startup. */
+    static uint64_t queuedCount() { return s_queued.load(std::memory_order_relaxed); }
+
+    /** Uploads published by any worker since startup. */
+    static uint64_t publishedCount() { return s_published.load(std::memory_order_relaxed); }
+
+    /** Images uploaded on the render thread because there was no worker. */
+    static uint64_t synchronousCount() { return s_synchronous.load(std::memory_order_relaxed); }
+    static void noteSynchronousUpload() { s_synchronous.fetch_add(1, std::memory_order_relaxed); }
+
+private:
+    enum class JobSource
+    {
+        Pixels,    // Upload RGBA8
+        Transcode, // Encode to ETC2, cache, upload compressed
+        Cache      // Upload a cached compressed chain
+    };
+
+    struct UploadJob
+    {
+        rive::rcp<UploadedRenderImage> image;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::unique_ptr<uint8_t[]> pixels;
+        JobSource source = JobSource::Pixels;
+        uint64_t cacheKey = 0;
+        CompressedTexture cached; // JobSource::Cache only
+    };
+
+    struct CompletedUpload
+    {
+        rive::rcp<UploadedRenderImage> image;
+        rive::rcp<rive::gpu::Texture> texture;
+        GLsync fence = nullptr;
+    };
+
+    enum class StartState
+    {
+        Starting,
+        Running,
+        Failed
+    };
+
+    GpuUploadWorker(EGLDisplay display,
+                    EGLContext context,
+                    EGLSurface surface,
+                    rive::gpu::RenderContextGLImpl* impl,
+                    rive::rcp<rive::gpu::Texture> placeholder);
+
+    rive::rcp<rive::RenderImage> queueJob(UploadJob job);
+
+    void uploadLoop();
+
+    /** Produce the texture for a job. Worker thread only. */
+    rive::rcp<rive::gpu::Texture> runJob(UploadJob& job);
+
+    /**
+     * Create a mip-mapped texture and upload every level. Worker thread only.
+     *
+     * @return The texture, or null on failure.
+     */
+    rive::rcp<rive::gpu::Texture> uploadMipChain(uint32_t width,
+                                                 uint32_t height,
+                                                 std::unique_ptr<uint8_t[]> pixels);
+
+    /**
+     * Build the mip chain on the CPU and encode each level to ETC2.
+     * Worker thread only.
+     */
+    static CompressedTexture transcodeMipChain(uint32_t width,
+                                               uint32_t height,
+                                               const uint8_t* pixels);
+
+    /**
+     * Create a texture from precompressed levels. Worker thread only.
+     *
+     * @return The texture, or null on failure.
+     */
+    rive::rcp<rive::gpu::Texture> uploadCompressed(const CompressedTexture& texture);
+
+    EGLDisplay m_display;
+    EGLContext m_context;
+    EGLSurface m_surface; // 1x1 pbuffer, or EGL_NO_SURFACE when surfaceless
+    rive::gpu::RenderContextGLImpl* m_impl;
+    rive::rcp<rive::gpu::Texture> m_placeholder;
+    std::thread m_thread;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    StartState m_startState = StartState::Starting; // Protected by m_mutex
+    bool m_stop = false;                            // Protected by m_mutex
+    std::deque<UploadJob> m_jobs;                   // Protected by m_mutex
+    std::vector<CompletedUpload> m_completed;       // Protected by m_mutex
+    size_t m_inFlight = 0;                          // Protected by m_mutex
+
+    static std::atomic<bool> s_enabled;
+    static std::atomic<uint64_t> s_queued;
+    static std::atomic<uint64_t> s_published;
+    static std::atomic<uint64_t> s_synchronous;
+};
+
+} // namespace rive_mp
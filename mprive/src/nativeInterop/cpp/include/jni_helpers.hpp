@@ -6,6 +6,10 @@
 namespace rive_mp {
     /**
      * Convert Java String to C++ std::string.
+     *
+     * Transcodes the UTF-16 contents to standard UTF-8 (see
+     * utf16_transcode.hpp) rather than going through modified UTF-8, so
+     * supplementary characters such as emoji survive the trip.
      * 
      * @param env JNI environment
      * @param jstr Java string
@@ -15,6 +19,9 @@ namespace rive_mp {
     
     /**
      * Convert C++ std::string to Java String.
+     *
+     * The string is standard UTF-8, as produced by the runtime; malformed
+     * sequences become U+FFFD.
      * 
      * @param env JNI environment
      * @param str C++ string
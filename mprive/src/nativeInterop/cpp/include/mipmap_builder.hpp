@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * CPU mip chain generation for image uploads.
+ *
+ * Levels are built with a 2x2 box filter over premultiplied RGBA, which is
+ * the correct average for premultiplied data (no dark fringes around
+ * transparent edges). The inner loop uses NEON on ARM and SSE2 on x86, with
+ * a scalar fallback elsewhere and for 1-pixel-wide levels.
+ */
+namespace rive_mp {
+    /**
+     * Number of levels in a full mip chain, down to 1x1.
+     */
+    uint32_t MipLevelCount(uint32_t width, uint32_t height);
+
+    /**
+     * Size of the level below a width or height (halved, at least 1).
+     */
+    inline uint32_t MipLevelSize(uint32_t size) { return size > 1 ? size / 2 : 1; }
+
+    /**
+     * Build the next mip level with a 2x2 box filter.
+     *
+     * Odd sizes drop the last row/column, as glGenerateMipmap is allowed to;
+     * 1-pixel dimensions repeat the single row/column.
+     *
+     * @param src Premultiplied RGBA, tightly packed.
+     * @param width Source width in pixels.
+     * @param height Source height in pixels.
+     * @param dst Output of MipLevelSize(width) x MipLevelSize(height) pixels.
+     */
+    void DownsampleBox2x(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+
+    /**
+     * DownsampleBox2x without the NEON/SSE2 inner loop. The reference the
+     * SIMD path is tested against; both must produce identical bytes.
+     */
+    void DownsampleBox2xScalar(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+}
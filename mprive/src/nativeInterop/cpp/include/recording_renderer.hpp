@@ -0,0 +1,254 @@
+#pragma once
+
+#ifdef DEBUG
+
+#include "rive/renderer.hpp"
+#include "utils/no_op_factory.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/**
+ * A factory and renderer that stand in for the GPU in tests.
+ *
+ * Debug builds only: the renderer logs every call with the full state of
+ * the paths, paints and buffers it is given, so two draws of an artboard log
+ * the same text exactly when they draw the same thing.
+ */
+namespace rive_mp {
+
+inline void AppendRecordedFloat(std::string& out, float value) {
+    char number[32];
+    snprintf(number, sizeof(number), " %.4f", value);
+    out += number;
+}
+
+/** A path that keeps its contours so the renderer can log them. */
+class RecordingPath : public rive::RenderPath {
+public:
+    explicit RecordingPath(rive::FillRule fillRule) : m_fillRule(fillRule) {}
+
+    void rewind() override { m_rawPath.rewind(); }
+    void addRenderPath(rive::RenderPath* path, const rive::Mat2D& transform) override {
+        m_rawPath.addPath(static_cast<RecordingPath*>(path)->m_rawPath, &transform);
+    }
+    void addRawPath(const rive::RawPath& path) override { m_rawPath.addPath(path); }
+    void moveTo(float x, float y) override { m_rawPath.moveTo(x, y); }
+    void lineTo(float x, float y) override { m_rawPath.lineTo(x, y); }
+    void cubicTo(float ox, float oy, float ix, float iy, float x, float y) override {
+        m_rawPath.cubicTo(ox, oy, ix, iy, x, y);
+    }
+    void close() override { m_rawPath.close(); }
+    void fillRule(rive::FillRule value) override { m_fillRule = value; }
+
+    void append(std::string& out) const {
+        out += "path " + std::to_string(static_cast<int>(m_fillRule));
+        for (rive::PathVerb verb : m_rawPath.verbs()) {
+            out += ' ';
+            out += std::to_string(static_cast<int>(verb));
+        }
+        for (const rive::Vec2D& point : m_rawPath.points()) {
+            AppendRecordedFloat(out, point.x);
+            AppendRecordedFloat(out, point.y);
+        }
+        out += '\n';
+    }
+
+private:
+    rive::RawPath m_rawPath;
+    rive::FillRule m_fillRule;
+};
+
+/** A gradient that only remembers how it was made. */
+class RecordingShader : public rive::RenderShader {
+public:
+    explicit RecordingShader(std::string description) : description(std::move(description)) {}
+
+    const std::string description;
+};
+
+class RecordingPaint : public rive::RenderPaint {
+public:
+    void style(rive::RenderPaintStyle value) override { m_style = value; }
+    void color(rive::ColorInt value) override { m_color = value; }
+    void thickness(float value) override { m_thickness = value; }
+    void join(rive::StrokeJoin value) override { m_join = value; }
+    void cap(rive::StrokeCap value) override { m_cap = value; }
+    void blendMode(rive::BlendMode value) override { m_blendMode = value; }
+    void shader(rive::rcp<rive::RenderShader> value) override { m_shader = std::move(value); }
+    void invalidateStroke() override {}
+
+    void append(std::string& out) const {
+        char state[96];
+        snprintf(state,
+                 sizeof(state),
+                 "paint %d %08x %.4f %d %d %d ",
+                 static_cast<int>(m_style),
+                 m_color,
+                 m_thickness,
+                 static_cast<int>(m_join),
+                 static_cast<int>(m_cap),
+                 static_cast<int>(m_blendMode));
+        out += state;
+        out += m_shader != nullptr
+                   ? static_cast<const RecordingShader*>(m_shader.get())->description
+                   : "solid";
+        out += '\n';
+    }
+
+private:
+    rive::RenderPaintStyle m_style = rive::RenderPaintStyle::fill;
+    rive::ColorInt m_color = 0xff000000;
+    float m_thickness = 1.0f;
+    rive::StrokeJoin m_join = rive::StrokeJoin::miter;
+    rive::StrokeCap m_cap = rive::StrokeCap::butt;
+    rive::BlendMode m_blendMode = rive::BlendMode::srcOver;
+    rive::rcp<rive::RenderShader> m_shader;
+};
+
+class RecordingBuffer : public rive::RenderBuffer {
+public:
+    RecordingBuffer(rive::RenderBufferType type, rive::RenderBufferFlags flags, size_t sizeInBytes) :
+        rive::RenderBuffer(type, flags, sizeInBytes), data(sizeInBytes) {}
+
+    std::vector<uint8_t> data;
+
+protected:
+    void* onMap() override { return data.data(); }
+    void onUnmap() override {}
+};
+
+/** Stands in for the GPU factory; images are left to the no-op factory. */
+class RecordingFactory : public rive::NoOpFactory {
+public:
+    rive::rcp<rive::RenderBuffer> makeRenderBuffer(rive::RenderBufferType type,
+                                                   rive::RenderBufferFlags flags,
+                                                   size_t sizeInBytes) override {
+        return rive::make_rcp<RecordingBuffer>(type, flags, sizeInBytes);
+    }
+
+    rive::rcp<rive::RenderShader> makeLinearGradient(float sx, float sy, float ex, float ey,
+                                                     const rive::ColorInt colors[],
+                                                     const float stops[],
+                                                     size_t count) override {
+        std::string description = "linear";
+        for (float value : {sx, sy, ex, ey}) {
+            AppendRecordedFloat(description, value);
+        }
+        return rive::make_rcp<RecordingShader>(describeStops(description, colors, stops, count));
+    }
+
+    rive::rcp<rive::RenderShader> makeRadialGradient(float cx, float cy, float radius,
+                                                     const rive::ColorInt colors[],
+                                                     const float stops[],
+                                                     size_t count) override {
+        std::string description = "radial";
+        for (float value : {cx, cy, radius}) {
+            AppendRecordedFloat(description, value);
+        }
+        return rive::make_rcp<RecordingShader>(describeStops(description, colors, stops, count));
+    }
+
+    rive::rcp<rive::RenderPath> makeRenderPath(rive::RawPath& rawPath,
+                                               rive::FillRule fillRule) override {
+        auto path = rive::make_rcp<RecordingPath>(fillRule);
+        path->addRawPath(rawPath);
+        return path;
+    }
+
+    rive::rcp<rive::RenderPath> makeEmptyRenderPath() override {
+        return rive::make_rcp<RecordingPath>(rive::FillRule::nonZero);
+    }
+
+    rive::rcp<rive::RenderPaint> makeRenderPaint() override {
+        return rive::make_rcp<RecordingPaint>();
+    }
+
+private:
+    static std::string describeStops(std::string description,
+                                     const rive::ColorInt colors[],
+                                     const float stops[],
+                                     size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            char stop[32];
+            snprintf(stop, sizeof(stop), " %08x@%.4f", colors[i], stops[i]);
+            description += stop;
+        }
+        return description;
+    }
+};
+
+/**
+ * Logs every call with the full state of the real objects it receives, so
+ * two frames log the same text exactly when they draw the same thing.
+ */
+class RecordingRenderer : public rive::Renderer {
+public:
+    std::string log;
+
+    void save() override { log += "save\n"; }
+    void restore() override { log += "restore\n"; }
+    void transform(const rive::Mat2D& transform) override {
+        log += "transform";
+        for (int i = 0; i < 6; ++i) {
+            AppendRecordedFloat(log, transform[i]);
+        }
+        log += '\n';
+    }
+    void modulateOpacity(float opacity) override {
+        log += "opacity";
+        AppendRecordedFloat(log, opacity);
+        log += '\n';
+    }
+    void clipPath(rive::RenderPath* path) override {
+        log += "clip ";
+        static_cast<RecordingPath*>(path)->append(log);
+    }
+    void drawPath(rive::RenderPath* path, rive::RenderPaint* paint) override {
+        log += "draw ";
+        static_cast<RecordingPath*>(path)->append(log);
+        static_cast<RecordingPaint*>(paint)->append(log);
+    }
+    void drawImage(const rive::RenderImage*,
+                   rive::ImageSampler,
+                   rive::BlendMode blendMode,
+                   float opacity) override {
+        log += "image " + std::to_string(static_cast<int>(blendMode));
+        AppendRecordedFloat(log, opacity);
+        log += '\n';
+    }
+    void drawImageMesh(const rive::RenderImage*,
+                       rive::ImageSampler,
+                       rive::rcp<rive::RenderBuffer> vertices_f32,
+                       rive::rcp<rive::RenderBuffer> uvCoords_f32,
+                       rive::rcp<rive::RenderBuffer> indices_u16,
+                       uint32_t vertexCount,
+                       uint32_t indexCount,
+                       rive::BlendMode blendMode,
+                       float opacity) override {
+        log += "mesh " + std::to_string(vertexCount) + " " + std::to_string(indexCount) + " " +
+               std::to_string(static_cast<int>(blendMode));
+        AppendRecordedFloat(log, opacity);
+        for (const auto& buffer : {vertices_f32, uvCoords_f32, indices_u16}) {
+            if (buffer == nullptr) {
+                log += " null";
+                continue;
+            }
+            // FNV-1a of the contents
+            uint64_t hash = 14695981039346656037ULL;
+            for (uint8_t byte : static_cast<RecordingBuffer*>(buffer.get())->data) {
+                hash = (hash ^ byte) * 1099511628211ULL;
+            }
+            char digest[24];
+            snprintf(digest, sizeof(digest), " %016" PRIx64, hash);
+            log += digest;
+        }
+        log += '\n';
+    }
+};
+
+} // namespace rive_mp
+
+#endif // DEBUG
@@ -1,6 +1,8 @@
 #pragma once
 #include <GLES3/gl3.h>
 
+#include "deferred_factory.hpp"
+#include "gpu_upload_worker.hpp"
 #include "rive_log.hpp"
 #include "rive/renderer/gl/render_context_gl_impl.hpp"
 #include "rive/renderer/render_context.hpp"
@@ -23,8 +25,12 @@ namespace rive_mp
 {
 
 #ifndef RIVE_ANDROID
-// Forward declaration for non-Android platforms
-class AndroidFactory;
+// Stand-in for non-Android platforms, which decode images with rive-runtime's
+// decoders. It is never instantiated (m_androidFactory stays null), but must be
+// a complete type for RenderContextGL's unique_ptr member.
+class AndroidFactory : public rive::Factory
+{
+};
 #endif
 
 // Log prefix for RenderContext messages (embedded in log strings since macros already provide LOG_TAG)
@@ -92,7 +98,8 @@ static std::string errorString(int32_t errorCode)
  * ## Platform Implementations
  * 
  * - **Android**: `RenderContextGL` (EGL/OpenGL ES) - implemented here
- * - **Desktop**: Would use GLFW or Skia (Phase F)
+ * - **Desktop (Linux)**: `RenderContextHeadlessGL`, a `RenderContextGL` on a
+ *   natively created EGL context rendering to PBuffers (desktopMain/cpp)
  * - **iOS**: Would use EAGLContext or Metal (Future)
  * - **Web/WASM**: Would use WebGL (Future)
  * 
@@ -162,7 +169,7 @@ public:
      * }
      * if (factory == nullptr) {
      *     // Fallback for tests or headless mode
-     *     factory = m_noOpFactory.get();
+     *     factory = SharedFileRegistry::headlessFactory();
      * }
      * auto file = rive::File::import(bytes, factory, ...);
      * ```
@@ -218,7 +225,61 @@ public:
         return rive::make_rcp<rive::RiveRenderImage>(std::move(texture));
     }
 
+    /**
+     * Create a GPU render image that is stored compressed and written to the
+     * CompressedTextureCache under cacheKey.
+     *
+     * Contexts without compressed texture support create a regular image.
+     */
+    virtual rive::rcp<rive::RenderImage> makeCompressedImage(
+        uint32_t width,
+        uint32_t height,
+        std::unique_ptr<uint8_t[]> pixels,
+        uint64_t cacheKey)
+    {
+        return makeImage(width, height, std::move(pixels));
+    }
+
+    /**
+     * Create a GPU render image from the CompressedTextureCache.
+     *
+     * @return The image, or nullptr if there is no cached entry (or no
+     *         compressed texture support); the caller then decodes the image.
+     */
+    virtual rive::rcp<rive::RenderImage> makeCachedImage(uint64_t cacheKey)
+    {
+        return nullptr;
+    }
+
+    /**
+     * Get the factory for lazily created render objects (Phase G.13).
+     *
+     * Wraps getFactory(); created on first use. Files imported with it must be
+     * drawn through a DeferredRenderer.
+     *
+     * @return The deferred factory, or nullptr if there is no GPU factory.
+     */
+    DeferredFactory* getDeferredFactory()
+    {
+        if (m_deferredFactory == nullptr)
+        {
+            rive::Factory* factory = getFactory();
+            if (factory == nullptr)
+            {
+                return nullptr;
+            }
+            m_deferredFactory = std::make_unique<DeferredFactory>(factory);
+        }
+        return m_deferredFactory.get();
+    }
+
+    /** The deferred factory if one has been created, without creating it. */
+    DeferredFactory* deferredFactoryIfCreated() const { return m_deferredFactory.get(); }
+
     std::unique_ptr<rive::gpu::RenderContext> riveContext;
+
+private:
+    std::unique_ptr<DeferredFactory> m_deferredFactory;
 };
 
 /** Create a 1x1 PBuffer surface to bind before Android provides a surface. */
@@ -273,6 +334,19 @@ static EGLSurface createPBufferSurface(EGLDisplay eglDisplay,
  * and overrides decodeImage() to use Android's BitmapFactory through JNI.
  * This provides platform-native image decoding without requiring rive-runtime's
  * built-in image decoders (libpng, libjpeg, libwebp).
+ *
+ * ## Image Uploads
+ *
+ * Decoded images are uploaded by a GpuUploadWorker on its own shared EGL
+ * context, with mip levels filtered on the CPU, so texture creation and mip
+ * generation stay off the render thread. Images show a transparent placeholder until beginFrame() publishes
+ * their upload. If the shared context cannot be created, makeImage() falls
+ * back to uploading on the render thread.
+ *
+ * When the CompressedTextureCache is enabled, the worker also transcodes
+ * images to ETC2 (core in OpenGL ES 3.0) and caches the result on disk;
+ * later loads upload the cached chain without decoding. Without a worker,
+ * images are always uploaded as RGBA8.
  */
 struct RenderContextGL : RenderContext
 {
@@ -326,6 +400,11 @@ struct RenderContextGL : RenderContext
         // This is done after riveContext is created since AndroidFactory delegates to it
         createAndroidFactory();
 
+        m_uploadWorker = GpuUploadWorker::Make(
+            eglDisplay,
+            eglContext,
+            riveContext->static_impl_cast<rive::gpu::RenderContextGLImpl>());
+
         return {true, EGL_SUCCESS, "RenderContextGL initialized successfully"};
     }
 
@@ -335,6 +414,9 @@ struct RenderContextGL : RenderContext
      */
     void destroy() override
     {
+        // Stop uploads while the context is still current
+        m_uploadWorker.reset();
+
         // Cleanup the EGL context and surface
         LOGD(RC_PREFIX "Releasing EGL context and surface bindings");
         eglMakeCurrent(eglDisplay,
@@ -380,6 +462,12 @@ struct RenderContextGL : RenderContext
             EGLSurface currentRead = eglGetCurrentSurface(EGL_READ);
             LOGD(RC_PREFIX "beginFrame: DIAGNOSTIC - current context=%p, draw surface=%p, read surface=%p",
                  currentCtx, currentDraw, currentRead);
+
+            // Swap in every image whose upload has finished before drawing
+            if (m_uploadWorker)
+            {
+                m_uploadWorker->publishCompleted();
+            }
         }
     }
 
@@ -423,6 +511,50 @@ struct RenderContextGL : RenderContext
         return riveContext ? riveContext.get() : nullptr;
     }
 
+    /**
+     * Create a GPU render image from RGBA pixel data.
+     *
+     * Queues the upload on the GpuUploadWorker and returns a placeholder-backed
+     * image immediately, or uploads synchronously if there is no worker.
+     */
+    rive::rcp<rive::RenderImage> makeImage(
+        uint32_t width,
+        uint32_t height,
+        std::unique_ptr<uint8_t[]> pixels) override
+    {
+        if (m_uploadWorker)
+        {
+            return m_uploadWorker->makeImage(width, height, std::move(pixels));
+        }
+        GpuUploadWorker::noteSynchronousUpload();
+        return RenderContext::makeImage(width, height, std::move(pixels));
+    }
+
+    rive::rcp<rive::RenderImage> makeCompressedImage(
+        uint32_t width,
+        uint32_t height,
+        std::unique_ptr<uint8_t[]> pixels,
+        uint64_t cacheKey) override
+    {
+        if (m_uploadWorker)
+        {
+            return m_uploadWorker->makeCompressedImage(width, height, std::move(pixels), cacheKey);
+        }
+        GpuUploadWorker::noteSynchronousUpload();
+        return RenderContext::makeImage(width, height, std::move(pixels));
+    }
+
+    rive::rcp<rive::RenderImage> makeCachedImage(uint64_t cacheKey) override
+    {
+        return m_uploadWorker ? m_uploadWorker->makeCachedImage(cacheKey) : nullptr;
+    }
+
+    /** Image uploads queued or in flight. */
+    size_t pendingImageUploads() const
+    {
+        return m_uploadWorker ? m_uploadWorker->pendingCount() : 0;
+    }
+
     EGLDisplay eglDisplay;
     EGLContext eglContext;
 
@@ -441,6 +573,9 @@ private:
      * surface-less bindings).
      * We must have a valid binding for `MakeContext` to succeed. */
     EGLSurface pBuffer;
+
+    /** Uploads image textures off the render thread; null if unsupported. */
+    std::unique_ptr<GpuUploadWorker> m_uploadWorker;
 };
 
 } // namespace rive_mp
\ No newline at end of file
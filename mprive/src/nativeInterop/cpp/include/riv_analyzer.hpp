@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Static complexity analyzer for .riv files.
+ *
+ * Imports a file headlessly (NoOpFactory, no GPU) and reports what drives
+ * per-frame cost on each artboard, so heavy assets can be flagged before
+ * they ship instead of at runtime on a low-end device.
+ */
+namespace rive_mp {
+    /**
+     * Size of an image asset, read from its encoded header.
+     */
+    struct RivImageStats {
+        std::string name;
+        uint32_t width = 0;               // 0 if the format is not recognized
+        uint32_t height = 0;
+        uint64_t encodedBytes = 0;        // 0 for out-of-band assets
+    };
+
+    /**
+     * Complexity of one artboard (its own objects; nested artboards are
+     * only reflected in nestedArtboardDepth).
+     */
+    struct RivArtboardStats {
+        std::string name;
+        float width = 0.0f;
+        float height = 0.0f;
+        uint32_t objectCount = 0;
+        uint32_t drawableCount = 0;
+        uint32_t shapeCount = 0;
+        uint32_t pathCount = 0;
+        uint32_t vertexCount = 0;
+        uint32_t clipCount = 0;           // Clipping shapes (Rive masks)
+        uint32_t blendModeCount = 0;      // Drawables with a blend mode other than src-over
+        uint32_t imageCount = 0;
+        uint64_t imagePixels = 0;         // Decoded pixels of the images drawn
+        uint32_t textCount = 0;
+        uint32_t nestedArtboardCount = 0;
+        uint32_t nestedArtboardDepth = 0; // 0 if the artboard nests nothing
+        uint32_t animationCount = 0;
+        uint32_t stateMachineCount = 0;
+        uint32_t layerCount = 0;
+        uint32_t stateCount = 0;
+        uint32_t transitionCount = 0;
+        uint32_t inputCount = 0;
+        uint32_t listenerCount = 0;
+        uint32_t dataBindCount = 0;       // Data-binding fan-out
+        double costScore = 0.0;           // See RivCostScore()
+    };
+
+    /**
+     * Complexity of a whole file.
+     */
+    struct RivFileStats {
+        uint64_t fileBytes = 0;
+        uint32_t assetCount = 0;
+        uint32_t viewModelCount = 0;
+        std::vector<RivImageStats> images;
+        std::vector<RivArtboardStats> artboards;
+    };
+
+    /**
+     * Imports a file and collects its statistics.
+     *
+     * @param bytes The .riv file bytes.
+     * @param size The number of bytes.
+     * @param stats Receives the statistics.
+     * @return False if the file cannot be imported.
+     */
+    bool AnalyzeRivFile(const uint8_t* bytes, size_t size, RivFileStats& stats);
+
+    /**
+     * Predicted relative per-frame cost of an artboard.
+     *
+     * A weighted sum of the statistics that dominate advance and render
+     * time: paths and vertices (tessellation), clips and blend modes
+     * (extra passes), image pixels (bandwidth), text (shaping), nesting
+     * and data binds (per-frame update fan-out). The unit is arbitrary;
+     * use it to compare files and to set gating thresholds.
+     */
+    double RivCostScore(const RivArtboardStats& artboard);
+
+    /**
+     * Serializes statistics as a JSON object.
+     */
+    std::string RivFileStatsToJson(const RivFileStats& stats);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Extracts a subset of the artboards of a .riv file, so a screen that needs
+ * two or three artboards of a large design file only pays import time and
+ * memory for those.
+ *
+ * Works on the binary object stream without importing it: every object is
+ * copied or dropped with the artboard it belongs to, and the result is a
+ * regular .riv file that the runtime imports as usual.
+ */
+namespace rive_mp {
+    /**
+     * What a slice kept of its source file.
+     */
+    struct RivSliceStats {
+        uint32_t artboardCount = 0;   // Artboards in the source file
+        uint32_t keptArtboards = 0;   // Requested artboards plus the ones they nest
+        uint64_t keptBytes = 0;       // Size of the sliced file
+        uint64_t skippedBytes = 0;    // Bytes of the artboards left out
+    };
+
+    /**
+     * Writes a copy of a file holding only the named artboards and,
+     * transitively, the artboards they nest.
+     *
+     * Everything before the first artboard (backboard, assets, enums, data
+     * converters and view models) is file-level and always kept, so their
+     * indices stay valid. Everything after an artboard belongs to it.
+     * Nested artboard and view model artboard ids are renumbered to match
+     * the kept artboards, and cleared if they name a dropped one. Artboards
+     * referenced only through view model artboard properties are not
+     * followed; list them explicitly.
+     *
+     * @param bytes The .riv file bytes.
+     * @param size The number of bytes.
+     * @param artboardNames The artboards to keep, in any order.
+     * @param out Receives the sliced file.
+     * @param stats Receives what was kept.
+     * @param error Receives the reason on failure.
+     * @return False if the file cannot be parsed or a name is not found.
+     */
+    bool SliceRivArtboards(const uint8_t* bytes,
+                           size_t size,
+                           const std::vector<std::string>& artboardNames,
+                           std::vector<uint8_t>& out,
+                           RivSliceStats& stats,
+                           std::string& error);
+}
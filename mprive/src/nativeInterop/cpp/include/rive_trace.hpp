@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Multiplatform trace markers for mprive.
+ *
+ * On Android, markers go to the system tracer (ATrace) and show up in
+ * Perfetto/systrace captures. The ATrace entry points are resolved at runtime
+ * from libandroid.so, so no minimum API level is imposed on the library.
+ * On other platforms every call is a no-op.
+ *
+ * Sections must be ended on the thread that began them.
+ */
+namespace rive_mp {
+    /**
+     * Whether a trace capture is currently running.
+     * Callers should check this before building dynamic section names.
+     */
+    bool RiveTraceIsEnabled();
+
+    /**
+     * Begin a named trace section on the calling thread.
+     *
+     * @param sectionName Section name (copied by the tracer).
+     */
+    void RiveTraceBeginSection(const char* sectionName);
+
+    /**
+     * End the most recent trace section on the calling thread.
+     */
+    void RiveTraceEndSection();
+
+    /**
+     * Set a named trace counter (API 29+ on Android; ignored otherwise).
+     *
+     * @param counterName Counter name.
+     * @param value Counter value.
+     */
+    void RiveTraceCounter(const char* counterName, int64_t value);
+
+    /**
+     * RAII helper that brackets a scope with a trace section.
+     * Skips the section entirely when tracing is disabled.
+     */
+    class RiveTraceScope {
+    public:
+        explicit RiveTraceScope(const char* sectionName)
+            : m_active(RiveTraceIsEnabled()) {
+            if (m_active) {
+                RiveTraceBeginSection(sectionName);
+            }
+        }
+        ~RiveTraceScope() {
+            if (m_active) {
+                RiveTraceEndSection();
+            }
+        }
+        RiveTraceScope(const RiveTraceScope&) = delete;
+        RiveTraceScope& operator=(const RiveTraceScope&) = delete;
+
+    private:
+        bool m_active;
+    };
+}
@@ -0,0 +1,118 @@
+#ifndef RIVE_ANDROID_SHARED_FILE_REGISTRY_HPP
+#define RIVE_ANDROID_SHARED_FILE_REGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "rive/file.hpp"
+
+namespace rive {
+class Factory;
+}
+
+namespace rive_android {
+
+/**
+ * Content hash of file or asset bytes (FNV-1a, 64-bit).
+ */
+uint64_t contentHash(const uint8_t* bytes, size_t size);
+
+/**
+ * Process-wide registry of imported rive::File objects (Phase G.9).
+ *
+ * Every CommandServer that loads the same bytes can hold the same
+ * rive::File. Instancing (artboards, state machines, view model instances)
+ * still happens on each server's own worker thread, into objects that
+ * server owns; only the file is shared.
+ *
+ * A file is not immutable after import: viewModelByName() and
+ * viewModelByIndex() append a ViewModelRuntime to a list the file owns on
+ * every call. Each entry therefore carries a mutex, and servers hold it
+ * around those calls and anything they do with the returned runtime.
+ *
+ * Files are keyed by the factory they were imported with and their content
+ * hash: render objects created by one factory cannot be drawn by another.
+ * Each server holds one reference per file handle; an entry is removed when
+ * its last reference is released.
+ *
+ * All methods are thread-safe.
+ */
+class SharedFileRegistry {
+public:
+    struct Key {
+        const rive::Factory* factory = nullptr;
+        uint64_t hash = 0;
+
+        bool operator<(const Key& other) const
+        {
+            return factory != other.factory ? factory < other.factory : hash < other.hash;
+        }
+    };
+
+    static SharedFileRegistry& instance();
+
+    /**
+     * A NoOpFactory shared by every headless server, so their files can be
+     * shared too.
+     */
+    static rive::Factory* headlessFactory();
+
+    /**
+     * Takes a reference to a registered file.
+     *
+     * @param key The file key.
+     * @param size The byte size of the file, or 0 to match any size.
+     * @return The file, or null if none is registered under the key.
+     */
+    rive::rcp<rive::File> acquire(const Key& key, size_t size);
+
+    /**
+     * Registers a newly imported file and takes a reference to it. If another
+     * server registered the same content first, its file is returned instead
+     * and the new one should be dropped.
+     *
+     * @param key The file key.
+     * @param size The byte size of the file.
+     * @param file The imported file.
+     * @return The registered file.
+     */
+    rive::rcp<rive::File> publish(const Key& key, size_t size, rive::rcp<rive::File> file);
+
+    /**
+     * The mutex that guards a registered file's view model runtimes. It
+     * stays valid while the caller holds a reference to the file.
+     *
+     * @param key The file key.
+     * @return The mutex, or null if none is registered under the key.
+     */
+    std::shared_ptr<std::mutex> fileMutex(const Key& key) const;
+
+    /**
+     * Drops a reference taken by acquire() or publish().
+     */
+    void release(const Key& key);
+
+    /**
+     * Number of distinct files currently registered.
+     */
+    size_t fileCount() const;
+
+private:
+    SharedFileRegistry() = default;
+
+    struct Entry {
+        rive::rcp<rive::File> file;
+        std::shared_ptr<std::mutex> fileMutex;  // See the class comment
+        size_t size = 0;
+        uint32_t references = 0;
+    };
+
+    mutable std::mutex m_mutex;
+    std::map<Key, Entry> m_entries;  // Protected by m_mutex
+};
+
+} // namespace rive_android
+
+#endif // RIVE_ANDROID_SHARED_FILE_REGISTRY_HPP
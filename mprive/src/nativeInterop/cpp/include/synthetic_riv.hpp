@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Generator of synthetic .riv files with controlled sizes, for scaling
+ * benchmarks (import time, advance cost, view model and list operations)
+ * that real design files do not cover.
+ *
+ * Objects are written with the type and property keys of the linked
+ * rive-runtime, so the output always matches the runtime it is loaded by.
+ */
+namespace rive_mp {
+    /**
+     * Shape of a synthetic file. Every artboard gets the same content.
+     */
+    struct SyntheticRivSpec {
+        uint32_t artboardCount = 1;
+        uint32_t shapesPerArtboard = 10;
+        uint32_t pathsPerShape = 1;         // Rectangles per shape
+        uint32_t nestingDepth = 0;          // Nodes each shape is nested under
+        uint32_t stateMachineStates = 2;    // Animation states (0 = no animations or state machine)
+        uint32_t stateMachineInputs = 1;    // Number inputs; input 0 drives the transitions
+        uint32_t viewModelProperties = 0;   // Number and string properties of the root view model
+        uint32_t listLength = 0;            // Items in the root view model's list
+        uint32_t dataConverters = 0;        // To-string converters, plus a group of all of them
+        bool nestNextArtboard = false;      // Each artboard but the last nests the one after it
+    };
+
+    /**
+     * Generate a .riv file.
+     *
+     * Artboards are named "Artboard <n>" and each has one state machine,
+     * "State Machine", whose inputs are named "Input <n>". Animation state n
+     * transitions to n + 1 when input 0 equals n + 1. With view model
+     * properties or a list, the file holds a "Root" view model with one
+     * instance and an "Item" view model with one instance per list item.
+     * Data converters are named "Converter <n>" and grouped in "Group".
+     *
+     * @param spec The file shape.
+     * @return The file bytes.
+     */
+    std::vector<uint8_t> GenerateSyntheticRiv(const SyntheticRivSpec& spec);
+}
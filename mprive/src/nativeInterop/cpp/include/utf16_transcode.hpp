@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * UTF-16 <-> UTF-8 transcoding for strings crossing JNI.
+ *
+ * GetStringUTFChars and NewStringUTF speak modified UTF-8, which encodes
+ * supplementary characters (emoji, many CJK extensions) as two 3-byte
+ * surrogates instead of one 4-byte sequence: the runtime receives text it
+ * cannot shape, and NewStringUTF rejects or mangles the standard UTF-8 the
+ * runtime hands back. These convert between Java's UTF-16 and standard UTF-8
+ * directly. Runs of ASCII, by far the common case for names and paths, are
+ * copied 8 or 16 units at a time with NEON on ARM and SSE2 on x86.
+ *
+ * Malformed input (unpaired surrogates, invalid UTF-8) becomes U+FFFD.
+ *
+ * This is a copy of the kotlin module's helpers/utf16_transcode (namespace
+ * rive_android): the two native libraries are built separately and share no
+ * sources. Keep fixes in sync.
+ */
+namespace rive_mp {
+    /**
+     * Worst-case UTF-8 size of a UTF-16 string: 3 bytes per unit (a
+     * surrogate pair takes 2 units for 4 bytes).
+     */
+    constexpr size_t Utf8CapacityForUtf16(size_t units) { return units * 3; }
+
+    /**
+     * Worst-case UTF-16 size of a UTF-8 string: at most one unit per byte.
+     */
+    constexpr size_t Utf16CapacityForUtf8(size_t bytes) { return bytes; }
+
+    /**
+     * @param dst At least Utf8CapacityForUtf16(units) bytes.
+     * @return Bytes written.
+     */
+    size_t Utf16ToUtf8(const uint16_t* src, size_t units, char* dst);
+
+    /**
+     * @param dst At least Utf16CapacityForUtf8(bytes) units.
+     * @return Units written.
+     */
+    size_t Utf8ToUtf16(const char* src, size_t bytes, uint16_t* dst);
+}
@@ -54,9 +54,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateAnimationByName(
         return 0;
     }
     
-    const char* nameChars = env->GetStringUTFChars(name, nullptr);
-    std::string animName(nameChars);
-    env->ReleaseStringUTFChars(name, nameChars);
+    std::string animName = JStringToStdString(env, name);
     
     return static_cast<jlong>(server->createAnimationByNameSync(static_cast<int64_t>(artboardHandle), animName));
 }
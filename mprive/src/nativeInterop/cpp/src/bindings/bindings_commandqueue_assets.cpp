@@ -79,9 +79,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppRegisterImage(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(assetName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(assetName, nameChars);
+    std::string name = JStringToStdString(env, assetName);
 
     server->registerImage(name, static_cast<int64_t>(imageHandle));
 }
@@ -104,9 +102,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppUnregisterImage(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(assetName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(assetName, nameChars);
+    std::string name = JStringToStdString(env, assetName);
 
     server->unregisterImage(name);
 }
@@ -184,9 +180,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppRegisterAudio(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(assetName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(assetName, nameChars);
+    std::string name = JStringToStdString(env, assetName);
 
     server->registerAudio(name, static_cast<int64_t>(audioHandle));
 }
@@ -209,9 +203,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppUnregisterAudio(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(assetName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(assetName, nameChars);
+    std::string name = JStringToStdString(env, assetName);
 
     server->unregisterAudio(name);
 }
@@ -289,9 +281,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppRegisterFont(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(assetName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(assetName, nameChars);
+    std::string name = JStringToStdString(env, assetName);
 
     server->registerFont(name, static_cast<int64_t>(fontHandle));
 }
@@ -314,9 +304,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppUnregisterFont(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(assetName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(assetName, nameChars);
+    std::string name = JStringToStdString(env, assetName);
 
     server->unregisterFont(name);
 }
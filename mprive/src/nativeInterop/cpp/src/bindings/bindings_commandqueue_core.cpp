@@ -27,6 +27,17 @@ jmethodID g_onNumberInputValueMethodID = nullptr;
 jmethodID g_onBooleanInputValueMethodID = nullptr;
 jmethodID g_onInputOperationSuccessMethodID = nullptr;
 jmethodID g_onInputOperationErrorMethodID = nullptr;
+// Reported event callbacks (Phase F)
+jmethodID g_onEventCountResultMethodID = nullptr;
+jmethodID g_onEventDataResultMethodID = nullptr;
+jmethodID g_onEventOperationErrorMethodID = nullptr;
+// Classes for boxing event properties, held as global refs (Phase F)
+jclass g_stringClass = nullptr;
+jclass g_objectClass = nullptr;
+jclass g_booleanClass = nullptr;
+jclass g_floatClass = nullptr;
+jmethodID g_booleanValueOfMethodID = nullptr;
+jmethodID g_floatValueOfMethodID = nullptr;
 // ViewModelInstance callbacks
 jmethodID g_onVMICreatedMethodID = nullptr;
 jmethodID g_onVMIErrorMethodID = nullptr;
@@ -76,6 +87,10 @@ jmethodID g_onAudioDecodedMethodID = nullptr;
 jmethodID g_onAudioErrorMethodID = nullptr;
 jmethodID g_onFontDecodedMethodID = nullptr;
 jmethodID g_onFontErrorMethodID = nullptr;
+// Request cancellation callback (Phase G.2)
+jmethodID g_onRequestCancelledMethodID = nullptr;
+// Frame timing callback (Phase G.4)
+jmethodID g_onDrawCompleteMethodID = nullptr;
 
 /**
  * Initialize cached method IDs for JNI callbacks.
@@ -234,6 +249,44 @@ void initCallbackMethodIDs(JNIEnv* env, jobject commandQueue) {
         "(JLjava/lang/String;)V"  // (requestID: Long, error: String) -> Unit
     );
 
+    // Reported event callbacks (Phase F)
+    g_onEventCountResultMethodID = env->GetMethodID(
+        commandQueueClass,
+        "onEventCountResult",
+        "(JI)V"  // (requestID: Long, count: Int) -> Unit
+    );
+
+    g_onEventDataResultMethodID = env->GetMethodID(
+        commandQueueClass,
+        "onEventDataResult",
+        // (requestID, name, typeCode, delay, url, targetValue, assetId,
+        //  propertyNames: Array<String>, propertyValues: Array<Any>) -> Unit
+        "(JLjava/lang/String;IFLjava/lang/String;II[Ljava/lang/String;[Ljava/lang/Object;)V"
+    );
+
+    g_onEventOperationErrorMethodID = env->GetMethodID(
+        commandQueueClass,
+        "onEventOperationError",
+        "(JLjava/lang/String;)V"  // (requestID: Long, error: String) -> Unit
+    );
+
+    // Event properties cross as boxed values. The classes are looked up once
+    // here, on a thread that can see them, and kept as global refs.
+    auto globalClass = [env](const char* name) {
+        jclass local = env->FindClass(name);
+        auto global = static_cast<jclass>(env->NewGlobalRef(local));
+        env->DeleteLocalRef(local);
+        return global;
+    };
+    g_stringClass = globalClass("java/lang/String");
+    g_objectClass = globalClass("java/lang/Object");
+    g_booleanClass = globalClass("java/lang/Boolean");
+    g_floatClass = globalClass("java/lang/Float");
+    g_booleanValueOfMethodID = env->GetStaticMethodID(
+        g_booleanClass, "valueOf", "(Z)Ljava/lang/Boolean;");
+    g_floatValueOfMethodID = env->GetStaticMethodID(
+        g_floatClass, "valueOf", "(F)Ljava/lang/Float;");
+
     // ViewModelInstance callbacks
     g_onVMICreatedMethodID = env->GetMethodID(
         commandQueueClass,
@@ -478,6 +531,20 @@ void initCallbackMethodIDs(JNIEnv* env, jobject commandQueue) {
         "(JLjava/lang/String;)V"  // (requestID: Long, error: String) -> Unit
     );
 
+    // Request cancellation callback (Phase G.2)
+    g_onRequestCancelledMethodID = env->GetMethodID(
+        commandQueueClass,
+        "onRequestCancelled",
+        "(J)V"  // (requestID: Long) -> Unit
+    );
+
+    // Frame timing callback (Phase G.4)
+    g_onDrawCompleteMethodID = env->GetMethodID(
+        commandQueueClass,
+        "onDrawComplete",
+        "(JJJJJJ)V"  // (drawKey, queueWaitNs, advanceNs, encodeNs, flushNs, presentNs) -> Unit
+    );
+
     env->DeleteLocalRef(commandQueueClass);
 }
 
@@ -579,7 +646,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                 
             case rive_android::MessageType::FileError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onFileErrorMethodID, 
                         static_cast<jlong>(msg.requestID), 
                         errorStr);
@@ -606,7 +673,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                     jobject arrayList = env->NewObject(arrayListClass, arrayListConstructor);
                     
                     for (const auto& name : msg.stringList) {
-                        jstring nameStr = env->NewStringUTF(name.c_str());
+                        jstring nameStr = StdStringToJString(env, name);
                         env->CallBooleanMethod(arrayList, arrayListAdd, nameStr);
                         env->DeleteLocalRef(nameStr);
                     }
@@ -643,7 +710,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                     jobject arrayList = env->NewObject(arrayListClass, arrayListConstructor);
                     
                     for (const auto& str : msg.stringList) {
-                        jstring strVal = env->NewStringUTF(str.c_str());
+                        jstring strVal = StdStringToJString(env, str);
                         env->CallBooleanMethod(arrayList, arrayListAdd, strVal);
                         env->DeleteLocalRef(strVal);
                     }
@@ -668,7 +735,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                     jobject arrayList = env->NewObject(arrayListClass, arrayListConstructor);
                     
                     for (const auto& str : msg.stringList) {
-                        jstring strVal = env->NewStringUTF(str.c_str());
+                        jstring strVal = StdStringToJString(env, str);
                         env->CallBooleanMethod(arrayList, arrayListAdd, strVal);
                         env->DeleteLocalRef(strVal);
                     }
@@ -683,7 +750,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                 
             case rive_android::MessageType::QueryError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onQueryErrorMethodID, 
                         static_cast<jlong>(msg.requestID), 
                         errorStr);
@@ -699,7 +766,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                 
             case rive_android::MessageType::ArtboardError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onArtboardErrorMethodID, 
                         static_cast<jlong>(msg.requestID), 
                         errorStr);
@@ -721,7 +788,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                 
             case rive_android::MessageType::StateMachineError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onStateMachineErrorMethodID, 
                         static_cast<jlong>(msg.requestID), 
                         errorStr);
@@ -758,7 +825,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                     jobject arrayList = env->NewObject(arrayListClass, arrayListConstructor);
 
                     for (const auto& name : msg.stringList) {
-                        jstring nameStr = env->NewStringUTF(name.c_str());
+                        jstring nameStr = StdStringToJString(env, name);
                         env->CallBooleanMethod(arrayList, arrayListAdd, nameStr);
                         env->DeleteLocalRef(nameStr);
                     }
@@ -773,7 +840,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::InputInfoResult:
                 {
-                    jstring nameStr = env->NewStringUTF(msg.inputName.c_str());
+                    jstring nameStr = StdStringToJString(env, msg.inputName);
                     env->CallVoidMethod(receiver, g_onInputInfoResultMethodID,
                         static_cast<jlong>(msg.requestID),
                         nameStr,
@@ -801,7 +868,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::InputOperationError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onInputOperationErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -818,7 +885,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::VMIError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onVMIErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -841,7 +908,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::StringPropertyValue:
                 {
-                    jstring valueStr = env->NewStringUTF(msg.stringValue.c_str());
+                    jstring valueStr = StdStringToJString(env, msg.stringValue);
                     env->CallVoidMethod(receiver, g_onStringPropertyValueMethodID,
                         static_cast<jlong>(msg.requestID),
                         valueStr);
@@ -857,7 +924,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::PropertyError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onPropertyErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -873,7 +940,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
             // Additional property messages (Phase D.3)
             case rive_android::MessageType::EnumPropertyValue:
                 {
-                    jstring valueStr = env->NewStringUTF(msg.stringValue.c_str());
+                    jstring valueStr = StdStringToJString(env, msg.stringValue);
                     env->CallVoidMethod(receiver, g_onEnumPropertyValueMethodID,
                         static_cast<jlong>(msg.requestID),
                         valueStr);
@@ -895,7 +962,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
             // Property subscription updates (Phase D.4)
             case rive_android::MessageType::NumberPropertyUpdated:
                 {
-                    jstring pathStr = env->NewStringUTF(msg.propertyPath.c_str());
+                    jstring pathStr = StdStringToJString(env, msg.propertyPath);
                     env->CallVoidMethod(receiver, g_onNumberPropertyUpdatedMethodID,
                         static_cast<jlong>(msg.vmiHandle),
                         pathStr,
@@ -906,8 +973,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::StringPropertyUpdated:
                 {
-                    jstring pathStr = env->NewStringUTF(msg.propertyPath.c_str());
-                    jstring valueStr = env->NewStringUTF(msg.stringValue.c_str());
+                    jstring pathStr = StdStringToJString(env, msg.propertyPath);
+                    jstring valueStr = StdStringToJString(env, msg.stringValue);
                     env->CallVoidMethod(receiver, g_onStringPropertyUpdatedMethodID,
                         static_cast<jlong>(msg.vmiHandle),
                         pathStr,
@@ -919,7 +986,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::BooleanPropertyUpdated:
                 {
-                    jstring pathStr = env->NewStringUTF(msg.propertyPath.c_str());
+                    jstring pathStr = StdStringToJString(env, msg.propertyPath);
                     env->CallVoidMethod(receiver, g_onBooleanPropertyUpdatedMethodID,
                         static_cast<jlong>(msg.vmiHandle),
                         pathStr,
@@ -930,8 +997,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::EnumPropertyUpdated:
                 {
-                    jstring pathStr = env->NewStringUTF(msg.propertyPath.c_str());
-                    jstring valueStr = env->NewStringUTF(msg.stringValue.c_str());
+                    jstring pathStr = StdStringToJString(env, msg.propertyPath);
+                    jstring valueStr = StdStringToJString(env, msg.stringValue);
                     env->CallVoidMethod(receiver, g_onEnumPropertyUpdatedMethodID,
                         static_cast<jlong>(msg.vmiHandle),
                         pathStr,
@@ -943,7 +1010,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::ColorPropertyUpdated:
                 {
-                    jstring pathStr = env->NewStringUTF(msg.propertyPath.c_str());
+                    jstring pathStr = StdStringToJString(env, msg.propertyPath);
                     env->CallVoidMethod(receiver, g_onColorPropertyUpdatedMethodID,
                         static_cast<jlong>(msg.vmiHandle),
                         pathStr,
@@ -954,7 +1021,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::TriggerPropertyFired:
                 {
-                    jstring pathStr = env->NewStringUTF(msg.propertyPath.c_str());
+                    jstring pathStr = StdStringToJString(env, msg.propertyPath);
                     env->CallVoidMethod(receiver, g_onTriggerPropertyFiredMethodID,
                         static_cast<jlong>(msg.vmiHandle),
                         pathStr);
@@ -982,7 +1049,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::ListOperationError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onListOperationErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -990,6 +1057,73 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                 }
                 break;
 
+            // Phase F: Reported event results
+            case rive_android::MessageType::EventCountResult:
+                env->CallVoidMethod(receiver, g_onEventCountResultMethodID,
+                    static_cast<jlong>(msg.requestID),
+                    static_cast<jint>(msg.intValue));
+                break;
+
+            case rive_android::MessageType::EventDataResult:
+                {
+                    // Custom properties cross as parallel arrays of names and
+                    // boxed values (Boolean, Float or String).
+                    const jsize propertyCount = static_cast<jsize>(msg.eventPropertyNames.size());
+                    jobjectArray propertyNames = env->NewObjectArray(propertyCount, g_stringClass, nullptr);
+                    jobjectArray propertyValues = env->NewObjectArray(propertyCount, g_objectClass, nullptr);
+                    for (jsize i = 0; i < propertyCount; i++) {
+                        jstring propertyName = StdStringToJString(env, msg.eventPropertyNames[i]);
+                        env->SetObjectArrayElement(propertyNames, i, propertyName);
+                        env->DeleteLocalRef(propertyName);
+
+                        jobject value = nullptr;
+                        switch (msg.eventPropertyTypes[i]) {
+                            case 0:
+                                value = env->CallStaticObjectMethod(g_booleanClass, g_booleanValueOfMethodID,
+                                    static_cast<jboolean>(msg.eventPropertyBools[i]));
+                                break;
+                            case 1:
+                                value = env->CallStaticObjectMethod(g_floatClass, g_floatValueOfMethodID,
+                                    static_cast<jfloat>(msg.eventPropertyFloats[i]));
+                                break;
+                            default:
+                                value = StdStringToJString(env, msg.eventPropertyStrings[i]);
+                                break;
+                        }
+                        env->SetObjectArrayElement(propertyValues, i, value);
+                        env->DeleteLocalRef(value);
+                    }
+
+                    jstring nameStr = StdStringToJString(env, msg.eventName);
+                    jstring urlStr = StdStringToJString(env, msg.eventUrl);
+                    env->CallVoidMethod(receiver, g_onEventDataResultMethodID,
+                        static_cast<jlong>(msg.requestID),
+                        nameStr,
+                        static_cast<jint>(msg.eventTypeCode),
+                        static_cast<jfloat>(msg.eventDelay),
+                        urlStr,
+                        static_cast<jint>(msg.eventTargetValue),
+                        static_cast<jint>(msg.eventAssetId),
+                        propertyNames,
+                        propertyValues);
+
+                    env->DeleteLocalRef(urlStr);
+                    env->DeleteLocalRef(nameStr);
+                    env->DeleteLocalRef(propertyValues);
+                    env->DeleteLocalRef(propertyNames);
+                }
+                break;
+
+            case rive_android::MessageType::EventOperationError:
+                {
+                    jstring errorStr = StdStringToJString(env, msg.error);
+                    env->CallVoidMethod(receiver, g_onEventOperationErrorMethodID,
+                        static_cast<jlong>(msg.requestID),
+                        errorStr);
+                    env->DeleteLocalRef(errorStr);
+                }
+                break;
+
             // Phase D.5: Nested VMI operation results
             case rive_android::MessageType::InstancePropertyResult:
                 env->CallVoidMethod(receiver, g_onInstancePropertyResultMethodID,
@@ -1004,7 +1138,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::InstancePropertyError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onInstancePropertyErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1020,7 +1154,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::AssetPropertyError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onAssetPropertyErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1036,7 +1170,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::VMIBindingError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onVMIBindingErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1052,7 +1186,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::DefaultVMIError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onDefaultVMIErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1069,7 +1203,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::RenderTargetError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onRenderTargetErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1091,7 +1225,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::ImageError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onImageErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1107,7 +1241,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::AudioError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onAudioErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1123,7 +1257,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
 
             case rive_android::MessageType::FontError:
                 {
-                    jstring errorStr = env->NewStringUTF(msg.error.c_str());
+                    jstring errorStr = StdStringToJString(env, msg.error);
                     env->CallVoidMethod(receiver, g_onFontErrorMethodID,
                         static_cast<jlong>(msg.requestID),
                         errorStr);
@@ -1131,9 +1265,23 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPollMessages(
                 }
                 break;
 
-            // Phase C.2.6: Draw operation results (fire-and-forget, just log)
+            // Phase G.2: Request cancellation
+            case rive_android::MessageType::RequestCancelled:
+                env->CallVoidMethod(receiver, g_onRequestCancelledMethodID,
+                    static_cast<jlong>(msg.requestID));
+                break;
+
+            // Phase C.2.6: Draw operation results (fire-and-forget)
+            // Phase G.4: Completion carries the per-frame timing breakdown
             case rive_android::MessageType::DrawComplete:
                 LOGI("CommandQueue JNI: DIAGNOSTIC - Draw completed (drawKey=%lld)", static_cast<long long>(msg.handle));
+                env->CallVoidMethod(receiver, g_onDrawCompleteMethodID,
+                    static_cast<jlong>(msg.handle),
+                    static_cast<jlong>(msg.frameTiming.queueWaitNs),
+                    static_cast<jlong>(msg.frameTiming.advanceNs),
+                    static_cast<jlong>(msg.frameTiming.encodeNs),
+                    static_cast<jlong>(msg.frameTiming.flushNs),
+                    static_cast<jlong>(msg.frameTiming.presentNs));
                 break;
 
             case rive_android::MessageType::DrawError:
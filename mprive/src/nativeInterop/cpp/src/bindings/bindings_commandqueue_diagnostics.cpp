@@ -0,0 +1,410 @@
+#include "bindings_commandqueue_internal.hpp"
+#include "riv_analyzer.hpp"
+#include "synthetic_riv.hpp"
+
+extern "C" {
+
+// =============================================================================
+// Phase G.3: Stall Watchdog
+// =============================================================================
+
+/**
+ * Sets the slow command threshold of the watchdog.
+ *
+ * JNI signature: cppSetSlowCommandThreshold(ptr: Long, thresholdMs: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param thresholdMs The threshold in milliseconds (0 disables the watchdog).
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetSlowCommandThreshold(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong thresholdMs
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to set slow command threshold on null CommandServer");
+        return;
+    }
+    server->setSlowCommandThreshold(static_cast<int64_t>(thresholdMs));
+}
+
+/**
+ * Gets the recent slow commands, oldest first.
+ *
+ * JNI signature: cppGetSlowCommands(ptr: Long): LongArray
+ *
+ * Each record is 6 longs: sequence, command type ordinal, requestID,
+ * start time (ns), duration (ns), stalled (0/1).
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @return The flattened records, or an empty array on error.
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetSlowCommands(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get slow commands on null CommandServer");
+        return env->NewLongArray(0);
+    }
+
+    constexpr size_t kFieldsPerRecord = 6;
+    auto records = server->getSlowCommands();
+    std::vector<jlong> values;
+    values.reserve(records.size() * kFieldsPerRecord);
+    for (const auto& record : records) {
+        values.push_back(static_cast<jlong>(record.sequence));
+        values.push_back(static_cast<jlong>(record.type));
+        values.push_back(static_cast<jlong>(record.requestID));
+        values.push_back(static_cast<jlong>(record.startTimeNs));
+        values.push_back(static_cast<jlong>(record.durationNs));
+        values.push_back(record.stalled ? 1 : 0);
+    }
+
+    const jsize length = static_cast<jsize>(values.size());
+    jlongArray result = env->NewLongArray(length);
+    if (result != nullptr && length > 0) {
+        env->SetLongArrayRegion(result, 0, length, values.data());
+    }
+    return result;
+}
+
+/**
+ * Gets the total number of slow commands seen.
+ *
+ * JNI signature: cppGetSlowCommandCount(ptr: Long): Long
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @return The total count, including records rotated out of the ring.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetSlowCommandCount(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get slow command count on null CommandServer");
+        return 0;
+    }
+    return static_cast<jlong>(server->getSlowCommandCount());
+}
+
+/**
+ * Gets the name of a command type.
+ *
+ * JNI signature: cppGetCommandTypeName(commandType: Int): String
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param commandType The command type ordinal.
+ * @return The command type name.
+ */
+JNIEXPORT jstring JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetCommandTypeName(
+    JNIEnv* env,
+    jobject thiz,
+    jint commandType
+) {
+    return env->NewStringUTF(commandTypeName(static_cast<CommandType>(commandType)));
+}
+
+// =============================================================================
+// Phase G.4: Input-to-Present Latency
+// =============================================================================
+
+/**
+ * Gets the input-to-present latency distribution of every input kind.
+ *
+ * JNI signature: cppGetInputLatencyStats(ptr: Long): LongArray
+ *
+ * The result holds kInputEventKindCount records of 6 longs each, in
+ * InputEventKind order: count, min, p50, p90, p99, max (ns).
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @return The flattened distributions, or an empty array on error.
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetInputLatencyStats(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get input latency stats on null CommandServer");
+        return env->NewLongArray(0);
+    }
+
+    constexpr size_t kFieldsPerKind = 6;
+    jlong values[kInputEventKindCount * kFieldsPerKind];
+    for (size_t i = 0; i < kInputEventKindCount; ++i) {
+        auto stats = server->getInputLatencyStats(static_cast<InputEventKind>(i));
+        jlong* out = values + i * kFieldsPerKind;
+        out[0] = static_cast<jlong>(stats.count);
+        out[1] = static_cast<jlong>(stats.minNs);
+        out[2] = static_cast<jlong>(stats.p50Ns);
+        out[3] = static_cast<jlong>(stats.p90Ns);
+        out[4] = static_cast<jlong>(stats.p99Ns);
+        out[5] = static_cast<jlong>(stats.maxNs);
+    }
+
+    const jsize length = static_cast<jsize>(kInputEventKindCount * kFieldsPerKind);
+    jlongArray result = env->NewLongArray(length);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, length, values);
+    }
+    return result;
+}
+
+/**
+ * Clears all input latency samples.
+ *
+ * JNI signature: cppResetInputLatencyStats(ptr: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppResetInputLatencyStats(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to reset input latency stats on null CommandServer");
+        return;
+    }
+    server->resetInputLatencyStats();
+}
+
+/**
+ * Enables or disables the per-frame timing reported with each draw.
+ *
+ * JNI signature: cppSetFrameTimingEnabled(ptr: Long, enabled: Boolean): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param enabled Whether draws report their timing.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetFrameTimingEnabled(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jboolean enabled
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to set frame timing on null CommandServer");
+        return;
+    }
+    server->setFrameTimingEnabled(enabled == JNI_TRUE);
+}
+
+// =============================================================================
+// Phase G.6: Command Capture and Replay
+// =============================================================================
+
+/**
+ * Starts recording enqueued commands.
+ *
+ * JNI signature: cppStartCommandCapture(ptr: Long, windowMs: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param windowMs The flight recorder window in milliseconds (0 keeps everything).
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppStartCommandCapture(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong windowMs
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to start command capture on null CommandServer");
+        return;
+    }
+    server->startCommandCapture(static_cast<int64_t>(windowMs));
+}
+
+/**
+ * Stops recording and writes the capture to a file.
+ *
+ * JNI signature: cppStopCommandCapture(ptr: Long, path: String): Boolean
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param path The file to write (empty discards the recording).
+ * @return True if the capture was written.
+ */
+JNIEXPORT jboolean JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppStopCommandCapture(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jstring path
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to stop command capture on null CommandServer");
+        return JNI_FALSE;
+    }
+    std::string pathStr = JStringToStdString(env, path);
+    return server->stopCommandCapture(pathStr) ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Replays a capture file on a new headless CommandServer. Blocks until done.
+ *
+ * JNI signature: cppReplayCommandCapture(path: String, paced: Boolean): LongArray
+ *
+ * The result starts with 5 longs: command count, skipped count, error count,
+ * recorded span (ns), wall time (ns); followed by 4 longs per command type
+ * that ran: command type ordinal, count, total (ns), max (ns).
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param path The capture file.
+ * @param paced True to keep the recorded pacing.
+ * @return The flattened report, or an empty array if the file cannot be read.
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppReplayCommandCapture(
+    JNIEnv* env,
+    jobject thiz,
+    jstring path,
+    jboolean paced
+) {
+    std::string pathStr = JStringToStdString(env, path);
+    ReplayReport report;
+    if (!CommandServer::replayCommandCapture(env, thiz, pathStr, paced == JNI_TRUE, report)) {
+        return env->NewLongArray(0);
+    }
+
+    std::vector<jlong> values;
+    values.reserve(5 + report.types.size() * 4);
+    values.push_back(static_cast<jlong>(report.commandCount));
+    values.push_back(static_cast<jlong>(report.skippedCount));
+    values.push_back(static_cast<jlong>(report.errorCount));
+    values.push_back(static_cast<jlong>(report.recordedSpanNs));
+    values.push_back(static_cast<jlong>(report.wallTimeNs));
+    for (const auto& timing : report.types) {
+        values.push_back(static_cast<jlong>(timing.type));
+        values.push_back(static_cast<jlong>(timing.count));
+        values.push_back(static_cast<jlong>(timing.totalNs));
+        values.push_back(static_cast<jlong>(timing.maxNs));
+    }
+
+    const jsize length = static_cast<jsize>(values.size());
+    jlongArray result = env->NewLongArray(length);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, length, values.data());
+    }
+    return result;
+}
+
+// =============================================================================
+// Phase G.7: Synthetic Files
+// =============================================================================
+
+/**
+ * Generates a synthetic .riv file for scaling benchmarks.
+ *
+ * JNI signature: cppGenerateSyntheticRiv(spec: IntArray): ByteArray
+ *
+ * The spec holds 10 ints, in SyntheticRivSpec field order: artboard count,
+ * shapes per artboard, paths per shape, nesting depth, state machine states,
+ * state machine inputs, view model properties, list length, data converters,
+ * and 1 to nest the next artboard.
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param spec The file shape.
+ * @return The file bytes, or an empty array if the spec is malformed.
+ */
+JNIEXPORT jbyteArray JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGenerateSyntheticRiv(
+    JNIEnv* env,
+    jobject thiz,
+    jintArray spec
+) {
+    constexpr jsize kSpecFieldCount = 10;
+    if (spec == nullptr || env->GetArrayLength(spec) != kSpecFieldCount) {
+        LOGW("CommandQueue JNI: Synthetic file spec must have %d fields", kSpecFieldCount);
+        return env->NewByteArray(0);
+    }
+    jint values[kSpecFieldCount];
+    env->GetIntArrayRegion(spec, 0, kSpecFieldCount, values);
+    for (jint value : values) {
+        if (value < 0) {
+            LOGW("CommandQueue JNI: Synthetic file spec fields must be >= 0");
+            return env->NewByteArray(0);
+        }
+    }
+
+    SyntheticRivSpec rivSpec;
+    rivSpec.artboardCount = static_cast<uint32_t>(values[0]);
+    rivSpec.shapesPerArtboard = static_cast<uint32_t>(values[1]);
+    rivSpec.pathsPerShape = static_cast<uint32_t>(values[2]);
+    rivSpec.nestingDepth = static_cast<uint32_t>(values[3]);
+    rivSpec.stateMachineStates = static_cast<uint32_t>(values[4]);
+    rivSpec.stateMachineInputs = static_cast<uint32_t>(values[5]);
+    rivSpec.viewModelProperties = static_cast<uint32_t>(values[6]);
+    rivSpec.listLength = static_cast<uint32_t>(values[7]);
+    rivSpec.dataConverters = static_cast<uint32_t>(values[8]);
+    rivSpec.nestNextArtboard = values[9] != 0;
+    return VectorToJByteArray(env, GenerateSyntheticRiv(rivSpec));
+}
+
+// =============================================================================
+// Phase G.8: File Analysis
+// =============================================================================
+
+/**
+ * Imports a .riv file headlessly and reports its per-artboard complexity.
+ *
+ * JNI signature: cppAnalyzeRiv(bytes: ByteArray): String?
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param bytes The .riv file bytes.
+ * @return The statistics as JSON, or null if the file cannot be imported.
+ */
+JNIEXPORT jstring JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppAnalyzeRiv(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray bytes
+) {
+    std::vector<uint8_t> fileData = JByteArrayToVector(env, bytes);
+    RivFileStats stats;
+    if (!AnalyzeRivFile(fileData.data(), fileData.size(), stats)) {
+        return nullptr;
+    }
+    return StdStringToJString(env, RivFileStatsToJson(stats));
+}
+
+} // extern "C"
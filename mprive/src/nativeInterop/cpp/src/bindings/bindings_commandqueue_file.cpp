@@ -213,9 +213,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateArtboardByName(
     }
     
     // Convert Java string to C++ string
-    const char* nameChars = env->GetStringUTFChars(name, nullptr);
-    std::string artboardName(nameChars);
-    env->ReleaseStringUTFChars(name, nameChars);
+    std::string artboardName = JStringToStdString(env, name);
     
     return static_cast<jlong>(server->createArtboardByNameSync(static_cast<int64_t>(fileHandle), artboardName));
 }
@@ -348,9 +346,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetViewModelInstanceNames(
     }
     
     // Convert Java string to C++ string
-    const char* nameChars = env->GetStringUTFChars(viewModelName, nullptr);
-    std::string vmName(nameChars);
-    env->ReleaseStringUTFChars(viewModelName, nameChars);
+    std::string vmName = JStringToStdString(env, viewModelName);
     
     server->getViewModelInstanceNames(
         static_cast<int64_t>(requestID),
@@ -387,9 +383,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetViewModelProperties(
     }
     
     // Convert Java string to C++ string
-    const char* nameChars = env->GetStringUTFChars(viewModelName, nullptr);
-    std::string vmName(nameChars);
-    env->ReleaseStringUTFChars(viewModelName, nameChars);
+    std::string vmName = JStringToStdString(env, viewModelName);
     
     server->getViewModelProperties(
         static_cast<int64_t>(requestID),
@@ -429,4 +423,191 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetEnums(
     );
 }
 
-} // extern "C"
\ No newline at end of file
+// =============================================================================
+// Phase G.9: Shared Files
+// =============================================================================
+
+/**
+ * Attaches a file that another command server in this process has already
+ * imported with the same factory.
+ * 
+ * JNI signature: cppAttachSharedFile(ptr: Long, requestID: Long, contentKey: Long): Unit
+ * 
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param requestID The request ID for async completion.
+ * @param contentKey The content key of the file bytes (see cppGetFileContentKey).
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppAttachSharedFile(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong requestID,
+    jlong contentKey
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to attach shared file on null CommandServer");
+        return;
+    }
+    
+    server->attachSharedFile(
+        static_cast<int64_t>(requestID),
+        static_cast<uint64_t>(contentKey)
+    );
+}
+
+/**
+ * Computes the key a file is shared under.
+ * 
+ * JNI signature: cppGetFileContentKey(bytes: ByteArray): Long
+ * 
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param bytes The Rive file bytes.
+ * @return The content key.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetFileContentKey(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray bytes
+) {
+    std::vector<uint8_t> fileData = JByteArrayToVector(env, bytes);
+    return static_cast<jlong>(contentHash(fileData.data(), fileData.size()));
+}
+
+/**
+ * Gets the number of distinct files shared across command servers.
+ * 
+ * JNI signature: cppGetSharedFileCount(): Int
+ * 
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @return The number of registered files.
+ */
+JNIEXPORT jint JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetSharedFileCount(
+    JNIEnv* env,
+    jobject thiz
+) {
+    return static_cast<jint>(SharedFileRegistry::instance().fileCount());
+}
+
+// =============================================================================
+// Phase G.13: Lazy GPU Resources
+// =============================================================================
+
+/**
+ * Makes files loaded from now on create their render objects on first draw.
+ *
+ * JNI signature: cppSetLazyGpuResources(ptr: Long, enabled: Boolean, idleReleaseNs: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param enabled True to import lazily.
+ * @param idleReleaseNs Release objects not drawn for this many nanoseconds.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetLazyGpuResources(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jboolean enabled,
+    jlong idleReleaseNs
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to set lazy GPU resources on null CommandServer");
+        return;
+    }
+    server->setLazyGpuResources(enabled == JNI_TRUE, static_cast<int64_t>(idleReleaseNs));
+}
+
+/**
+ * Gets the counters of the lazily created render objects.
+ *
+ * JNI signature: cppGetLazyGpuResourceStats(ptr: Long): LongArray
+ *
+ * The result holds liveObjects, materializedObjects, materializations and
+ * releases, in that order.
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @return The counters, or an empty array on error.
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetLazyGpuResourceStats(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get lazy GPU resource stats on null CommandServer");
+        return env->NewLongArray(0);
+    }
+
+    auto stats = server->lazyGpuResourceStats();
+    const jlong values[] = {
+        static_cast<jlong>(stats.liveObjects),
+        static_cast<jlong>(stats.materializedObjects),
+        static_cast<jlong>(stats.materializations),
+        static_cast<jlong>(stats.releases),
+    };
+    const jsize length = static_cast<jsize>(sizeof(values) / sizeof(values[0]));
+    jlongArray result = env->NewLongArray(length);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, length, values);
+    }
+    return result;
+}
+
+// =============================================================================
+// Phase G.14: Partial Import
+// =============================================================================
+
+/**
+ * Loads only some artboards of a Rive file.
+ *
+ * JNI signature: cppLoadFileArtboards(ptr: Long, requestID: Long, bytes: ByteArray, artboardNames: Array<String>): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param requestID The request ID for async completion.
+ * @param bytes The Rive file bytes.
+ * @param artboardNames The artboards to import.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppLoadFileArtboards(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong requestID,
+    jbyteArray bytes,
+    jobjectArray artboardNames
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to load file on null CommandServer");
+        return;
+    }
+
+    std::vector<std::string> names;
+    const jsize count = env->GetArrayLength(artboardNames);
+    names.reserve(static_cast<size_t>(count));
+    for (jsize i = 0; i < count; ++i) {
+        auto name = static_cast<jstring>(env->GetObjectArrayElement(artboardNames, i));
+        names.push_back(JStringToStdString(env, name));
+        env->DeleteLocalRef(name);
+    }
+
+    server->loadFile(static_cast<int64_t>(requestID), JByteArrayToVector(env, bytes), std::move(names));
+}
+
+} // extern "C"
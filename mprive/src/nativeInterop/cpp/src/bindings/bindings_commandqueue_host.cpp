@@ -0,0 +1,134 @@
+#include "bindings_commandqueue_internal.hpp"
+#include "command_server_host.hpp"
+#include <algorithm>
+
+extern "C" {
+
+// =============================================================================
+// Phase G.10: Shared Host Thread
+// =============================================================================
+
+/**
+ * Creates a worker thread that several CommandServers can share.
+ *
+ * JNI signature: cppCreateHost(renderContextPtr: Long): Long
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param renderContextPtr The native pointer to the RenderContext, or 0 for a headless host.
+ * @return The native pointer to the created CommandServerHost.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateHost(
+    JNIEnv* env,
+    jobject thiz,
+    jlong renderContextPtr
+) {
+    LOGI("CommandQueue JNI: Creating CommandServerHost");
+
+    auto* host = new CommandServerHost(reinterpret_cast<void*>(renderContextPtr));
+    return reinterpret_cast<jlong>(host);
+}
+
+/**
+ * Stops and deletes a CommandServerHost. Every hosted CommandServer must have
+ * been deleted first.
+ *
+ * JNI signature: cppDeleteHost(hostPtr: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param hostPtr The native pointer to the CommandServerHost.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppDeleteHost(
+    JNIEnv* env,
+    jobject thiz,
+    jlong hostPtr
+) {
+    auto* host = reinterpret_cast<CommandServerHost*>(hostPtr);
+    if (host == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to delete null CommandServerHost");
+        return;
+    }
+    delete host;
+}
+
+/**
+ * Creates a CommandServer that runs on a shared host thread.
+ *
+ * JNI signature: cppConstructorHosted(hostPtr: Long, weight: Int): Long
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param hostPtr The native pointer to the CommandServerHost.
+ * @param weight Commands the server may run per scheduling round.
+ * @return The native pointer to the created CommandServer.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppConstructorHosted(
+    JNIEnv* env,
+    jobject thiz,
+    jlong hostPtr,
+    jint weight
+) {
+    auto* host = reinterpret_cast<CommandServerHost*>(hostPtr);
+    if (host == nullptr) {
+        LOGE("CommandQueue JNI: Attempted to create CommandServer on null CommandServerHost");
+        return 0;
+    }
+
+    LOGI("CommandQueue JNI: Creating hosted CommandServer (weight=%d)", weight);
+    auto* server = new CommandServer(env, thiz, host, static_cast<uint32_t>(std::max(weight, 1)));
+    return reinterpret_cast<jlong>(server);
+}
+
+/**
+ * Changes a hosted CommandServer's scheduling weight.
+ *
+ * JNI signature: cppSetHostWeight(ptr: Long, weight: Int): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param weight Commands the server may run per scheduling round.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetHostWeight(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jint weight
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to set host weight on null CommandServer");
+        return;
+    }
+    server->setHostWeight(static_cast<uint32_t>(std::max(weight, 1)));
+}
+
+/**
+ * Gets the number of CommandServers attached to a host.
+ *
+ * JNI signature: cppGetHostServerCount(hostPtr: Long): Int
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param hostPtr The native pointer to the CommandServerHost.
+ * @return The number of attached servers.
+ */
+JNIEXPORT jint JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetHostServerCount(
+    JNIEnv* env,
+    jobject thiz,
+    jlong hostPtr
+) {
+    auto* host = reinterpret_cast<CommandServerHost*>(hostPtr);
+    if (host == nullptr) {
+        return 0;
+    }
+    return static_cast<jint>(host->serverCount());
+}
+
+} // extern "C"
@@ -26,9 +26,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetListSize(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getListSize(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -54,9 +52,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetListItem(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getListItem(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(index));
 }
@@ -82,9 +78,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppAddListItem(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->addListItem(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int64_t>(itemHandle));
 }
@@ -111,9 +105,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppAddListItemAt(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->addListItemAt(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(index), static_cast<int64_t>(itemHandle));
 }
@@ -139,9 +131,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppRemoveListItem(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->removeListItem(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int64_t>(itemHandle));
 }
@@ -167,9 +157,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppRemoveListItemAt(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->removeListItemAt(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(index));
 }
@@ -196,9 +184,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSwapListItems(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->swapListItems(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(indexA), static_cast<int32_t>(indexB));
 }
@@ -227,9 +213,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetInstanceProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getInstanceProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -255,9 +239,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetInstanceProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->setInstanceProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int64_t>(nestedHandle));
 }
@@ -287,9 +269,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetImageProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->setImageProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int64_t>(imageHandle));
 }
@@ -316,9 +296,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetArtboardProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->setArtboardProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path, static_cast<int64_t>(fileHandle), static_cast<int64_t>(artboardHandle));
 }
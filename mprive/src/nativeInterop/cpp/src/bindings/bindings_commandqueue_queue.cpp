@@ -0,0 +1,225 @@
+#include "bindings_commandqueue_internal.hpp"
+
+extern "C" {
+
+// =============================================================================
+// Phase G.1: Queue Backpressure
+// =============================================================================
+
+/**
+ * Sets the capacity and overflow policy for a command class.
+ *
+ * JNI signature: cppSetQueuePolicy(ptr: Long, commandClass: Int, policy: Int, capacity: Int): Boolean
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param commandClass The CommandClass ordinal.
+ * @param policy The OverflowPolicy ordinal.
+ * @param capacity Max pending commands of the class (0 = unbounded).
+ * @return true if the policy was applied.
+ */
+JNIEXPORT jboolean JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetQueuePolicy(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jint commandClass,
+    jint policy,
+    jint capacity
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to set queue policy on null CommandServer");
+        return JNI_FALSE;
+    }
+    if (commandClass < 0 || commandClass >= static_cast<jint>(kCommandClassCount) ||
+        policy < 0 || policy > static_cast<jint>(OverflowPolicy::Block) || capacity < 0) {
+        LOGW("CommandQueue JNI: Invalid queue policy (class=%d, policy=%d, capacity=%d)",
+             commandClass, policy, capacity);
+        return JNI_FALSE;
+    }
+
+    QueuePolicy queuePolicy;
+    queuePolicy.policy = static_cast<OverflowPolicy>(policy);
+    queuePolicy.capacity = static_cast<uint32_t>(capacity);
+    return server->setQueuePolicy(static_cast<CommandClass>(commandClass), queuePolicy)
+        ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Gets the queue counters for every command class.
+ *
+ * JNI signature: cppGetQueueStats(ptr: Long): LongArray
+ *
+ * The result holds kCommandClassCount records of 6 longs each, in CommandClass
+ * order: enqueued, dropped, coalesced, blocked, pending, highWater.
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @return The flattened counters, or an empty array on error.
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetQueueStats(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get queue stats on null CommandServer");
+        return env->NewLongArray(0);
+    }
+
+    constexpr size_t kFieldsPerClass = 6;
+    jlong values[kCommandClassCount * kFieldsPerClass];
+    for (size_t i = 0; i < kCommandClassCount; ++i) {
+        auto stats = server->getQueueStats(static_cast<CommandClass>(i));
+        jlong* out = values + i * kFieldsPerClass;
+        out[0] = static_cast<jlong>(stats.enqueued);
+        out[1] = static_cast<jlong>(stats.dropped);
+        out[2] = static_cast<jlong>(stats.coalesced);
+        out[3] = static_cast<jlong>(stats.blocked);
+        out[4] = static_cast<jlong>(stats.pending);
+        out[5] = static_cast<jlong>(stats.highWater);
+    }
+
+    const jsize length = static_cast<jsize>(kCommandClassCount * kFieldsPerClass);
+    jlongArray result = env->NewLongArray(length);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, length, values);
+    }
+    return result;
+}
+
+/**
+ * Resets the cumulative queue counters.
+ *
+ * JNI signature: cppResetQueueStats(ptr: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppResetQueueStats(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to reset queue stats on null CommandServer");
+        return;
+    }
+    server->resetQueueStats();
+}
+
+// =============================================================================
+// Phase G.2: Request Cancellation
+// =============================================================================
+
+/**
+ * Cancels a pending or in-flight request.
+ *
+ * JNI signature: cppCancelRequest(ptr: Long, requestID: Long): Boolean
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param requestID The request ID to cancel.
+ * @return true if a command was cancelled.
+ */
+JNIEXPORT jboolean JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppCancelRequest(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong requestID
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to cancel request on null CommandServer");
+        return JNI_FALSE;
+    }
+    return server->cancel(static_cast<int64_t>(requestID)) ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Cancels every pending cancellable command targeting a handle.
+ *
+ * JNI signature: cppCancelAllFor(ptr: Long, handle: Long): Int
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param handle The file, artboard, state machine or VMI handle.
+ * @return The number of commands cancelled.
+ */
+JNIEXPORT jint JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppCancelAllFor(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong handle
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to cancel commands on null CommandServer");
+        return 0;
+    }
+    return static_cast<jint>(server->cancelAllFor(static_cast<int64_t>(handle)));
+}
+
+/**
+ * Pauses or resumes command execution.
+ *
+ * JNI signature: cppSetWorkerPaused(ptr: Long, paused: Boolean): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param paused Whether the worker should stop taking commands.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetWorkerPaused(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jboolean paused
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to pause null CommandServer");
+        return;
+    }
+    server->setWorkerPaused(paused == JNI_TRUE);
+}
+
+/**
+ * Holds or releases the worker between taking a command and executing it.
+ *
+ * JNI signature: cppSetHoldInFlight(ptr: Long, hold: Boolean): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param hold Whether the worker should wait before executing.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetHoldInFlight(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jboolean hold
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to hold null CommandServer");
+        return;
+    }
+    server->setHoldInFlight(hold == JNI_TRUE);
+}
+
+} // extern "C"
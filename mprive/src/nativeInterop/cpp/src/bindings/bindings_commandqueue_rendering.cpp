@@ -275,7 +275,7 @@ Java_app_rive_mp_RiveSurface_cppDeleteRenderTarget(
  *
  * JNI signature: cppPointerMove(ptr: Long, smHandle: Long, fit: Byte, alignment: Byte, 
  *                               layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float,
- *                               pointerID: Int, x: Float, y: Float): Unit
+ *                               pointerID: Int, x: Float, y: Float, clientTimeNs: Long): Unit
  */
 JNIEXPORT void JNICALL
 Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerMove(
@@ -290,7 +290,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerMove(
     jfloat surfaceHeight,
     jint pointerID,
     jfloat x,
-    jfloat y
+    jfloat y,
+    jlong clientTimeNs
 ) {
     auto* server = reinterpret_cast<CommandServer*>(ptr);
     if (server == nullptr) {
@@ -307,7 +308,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerMove(
         static_cast<float>(surfaceHeight),
         static_cast<int32_t>(pointerID),
         static_cast<float>(x),
-        static_cast<float>(y)
+        static_cast<float>(y),
+        static_cast<int64_t>(clientTimeNs)
     );
 }
 
@@ -316,7 +318,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerMove(
  *
  * JNI signature: cppPointerDown(ptr: Long, smHandle: Long, fit: Byte, alignment: Byte, 
  *                               layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float,
- *                               pointerID: Int, x: Float, y: Float): Unit
+ *                               pointerID: Int, x: Float, y: Float, clientTimeNs: Long): Unit
  */
 JNIEXPORT void JNICALL
 Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerDown(
@@ -331,7 +333,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerDown(
     jfloat surfaceHeight,
     jint pointerID,
     jfloat x,
-    jfloat y
+    jfloat y,
+    jlong clientTimeNs
 ) {
     auto* server = reinterpret_cast<CommandServer*>(ptr);
     if (server == nullptr) {
@@ -348,7 +351,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerDown(
         static_cast<float>(surfaceHeight),
         static_cast<int32_t>(pointerID),
         static_cast<float>(x),
-        static_cast<float>(y)
+        static_cast<float>(y),
+        static_cast<int64_t>(clientTimeNs)
     );
 }
 
@@ -357,7 +361,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerDown(
  *
  * JNI signature: cppPointerUp(ptr: Long, smHandle: Long, fit: Byte, alignment: Byte, 
  *                             layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float,
- *                             pointerID: Int, x: Float, y: Float): Unit
+ *                             pointerID: Int, x: Float, y: Float, clientTimeNs: Long): Unit
  */
 JNIEXPORT void JNICALL
 Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerUp(
@@ -372,7 +376,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerUp(
     jfloat surfaceHeight,
     jint pointerID,
     jfloat x,
-    jfloat y
+    jfloat y,
+    jlong clientTimeNs
 ) {
     auto* server = reinterpret_cast<CommandServer*>(ptr);
     if (server == nullptr) {
@@ -389,7 +394,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerUp(
         static_cast<float>(surfaceHeight),
         static_cast<int32_t>(pointerID),
         static_cast<float>(x),
-        static_cast<float>(y)
+        static_cast<float>(y),
+        static_cast<int64_t>(clientTimeNs)
     );
 }
 
@@ -398,7 +404,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerUp(
  *
  * JNI signature: cppPointerExit(ptr: Long, smHandle: Long, fit: Byte, alignment: Byte, 
  *                               layoutScale: Float, surfaceWidth: Float, surfaceHeight: Float,
- *                               pointerID: Int, x: Float, y: Float): Unit
+ *                               pointerID: Int, x: Float, y: Float, clientTimeNs: Long): Unit
  */
 JNIEXPORT void JNICALL
 Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerExit(
@@ -413,7 +419,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerExit(
     jfloat surfaceHeight,
     jint pointerID,
     jfloat x,
-    jfloat y
+    jfloat y,
+    jlong clientTimeNs
 ) {
     auto* server = reinterpret_cast<CommandServer*>(ptr);
     if (server == nullptr) {
@@ -430,7 +437,8 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppPointerExit(
         static_cast<float>(surfaceHeight),
         static_cast<int32_t>(pointerID),
         static_cast<float>(x),
-        static_cast<float>(y)
+        static_cast<float>(y),
+        static_cast<int64_t>(clientTimeNs)
     );
 }
 
@@ -656,4 +664,144 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppDrawToBuffer(
     env->ReleaseByteArrayElements(buffer, bufferPtr, 0);
 }
 
-} // extern "C"
\ No newline at end of file
+// =============================================================================
+// Phase G.11: Registered Views
+// =============================================================================
+
+/**
+ * Registers a view with the server-driven frame loop, or updates one.
+ *
+ * JNI signature: cppRegisterView(ptr: Long, viewID: Long, artboardHandle: Long, smHandle: Long,
+ *         surfacePtr: Long, renderTargetPtr: Long, drawKey: Long, width: Int, height: Int,
+ *         fit: Byte, alignment: Byte, scaleFactor: Float, clearColor: Int): Long
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param viewID The view to update, or 0 to register a new one.
+ * @param artboardHandle Handle to the artboard to draw.
+ * @param smHandle Handle to the state machine (0 for static artboards).
+ * @param surfacePtr Native surface pointer.
+ * @param renderTargetPtr Rive render target pointer.
+ * @param drawKey Draw key reported with each frame's timing.
+ * @param width Surface width in pixels.
+ * @param height Surface height in pixels.
+ * @param fit Fit enum ordinal as Byte.
+ * @param alignment Alignment enum ordinal as Byte.
+ * @param scaleFactor Scale factor for high DPI displays.
+ * @param clearColor Background clear color in 0xAARRGGBB format.
+ * @return The view ID.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppRegisterView(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong viewID,
+    jlong artboardHandle,
+    jlong smHandle,
+    jlong surfacePtr,
+    jlong renderTargetPtr,
+    jlong drawKey,
+    jint width,
+    jint height,
+    jbyte fit,
+    jbyte alignment,
+    jfloat scaleFactor,
+    jint clearColor
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to register view on null CommandServer");
+        return 0;
+    }
+
+    return static_cast<jlong>(server->registerView(
+        static_cast<int64_t>(viewID),
+        static_cast<int64_t>(artboardHandle),
+        static_cast<int64_t>(smHandle),
+        static_cast<int64_t>(surfacePtr),
+        static_cast<int64_t>(renderTargetPtr),
+        static_cast<int64_t>(drawKey),
+        static_cast<int32_t>(width),
+        static_cast<int32_t>(height),
+        static_cast<int32_t>(fit),
+        static_cast<int32_t>(alignment),
+        static_cast<uint32_t>(clearColor),
+        static_cast<float>(scaleFactor)
+    ));
+}
+
+/**
+ * Removes a registered view.
+ *
+ * JNI signature: cppUnregisterView(ptr: Long, viewID: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param viewID The view ID.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppUnregisterView(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong viewID
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to unregister view on null CommandServer");
+        return;
+    }
+    server->unregisterView(static_cast<int64_t>(viewID));
+}
+
+/**
+ * Advances and draws every registered view that is not settled.
+ *
+ * JNI signature: cppFrameTick(ptr: Long, deltaTimeNs: Long): Unit
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @param deltaTimeNs The time since the previous tick in nanoseconds.
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppFrameTick(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong deltaTimeNs
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        return;
+    }
+    server->frameTick(static_cast<float>(deltaTimeNs) / 1000000000.0f);
+}
+
+/**
+ * Whether every registered view is settled.
+ *
+ * JNI signature: cppViewsIdle(ptr: Long): Boolean
+ *
+ * @param env The JNI environment.
+ * @param thiz The Java CommandQueue object.
+ * @param ptr The native pointer to the CommandServer.
+ * @return True if ticking can stop until further input.
+ */
+JNIEXPORT jboolean JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppViewsIdle(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        return JNI_TRUE;
+    }
+    return server->viewsIdle() ? JNI_TRUE : JNI_FALSE;
+}
+
+} // extern "C"
@@ -60,9 +60,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateStateMachineByName(
     }
     
     // Convert Java string to C++ string
-    const char* nameChars = env->GetStringUTFChars(name, nullptr);
-    std::string smName(nameChars);
-    env->ReleaseStringUTFChars(name, nameChars);
+    std::string smName = JStringToStdString(env, name);
     
     return static_cast<jlong>(server->createStateMachineByNameSync(static_cast<int64_t>(artboardHandle), smName));
 }
@@ -127,6 +125,55 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppDeleteStateMachine(
     server->deleteStateMachine(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle));
 }
 
+// =============================================================================
+// Phase F: Reported Events
+// =============================================================================
+
+/**
+ * Gets the number of events reported by the last advance of a state machine.
+ *
+ * JNI signature: cppGetReportedEventCount(ptr: Long, requestID: Long, smHandle: Long): Unit
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetReportedEventCount(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong requestID,
+    jlong smHandle
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get reported event count on null CommandServer");
+        return;
+    }
+
+    server->getReportedEventCount(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle));
+}
+
+/**
+ * Gets a reported event by index.
+ *
+ * JNI signature: cppGetReportedEventAt(ptr: Long, requestID: Long, smHandle: Long, index: Int): Unit
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetReportedEventAt(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong requestID,
+    jlong smHandle,
+    jint index
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to get reported event on null CommandServer");
+        return;
+    }
+
+    server->getReportedEventAt(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle), static_cast<int32_t>(index));
+}
+
 // =============================================================================
 // Phase C.4: State Machine Input Operations
 // =============================================================================
@@ -218,9 +265,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetNumberInput(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     server->getNumberInput(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle), name);
 }
@@ -246,9 +291,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetNumberInput(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     server->setNumberInput(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle), name, static_cast<float>(value));
 }
@@ -273,9 +316,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetBooleanInput(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     server->getBooleanInput(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle), name);
 }
@@ -301,9 +342,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetBooleanInput(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     server->setBooleanInput(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle), name, static_cast<bool>(value));
 }
@@ -328,9 +367,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppFireTrigger(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     server->fireTrigger(static_cast<int64_t>(requestID), static_cast<int64_t>(smHandle), name);
 }
@@ -360,9 +397,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetStateMachineNumberInput(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     // Fire-and-forget: use 0 as requestID
     server->setNumberInput(0L, static_cast<int64_t>(smHandle), name, static_cast<float>(value));
@@ -389,9 +424,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetStateMachineBooleanInput(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     // Fire-and-forget: use 0 as requestID
     server->setBooleanInput(0L, static_cast<int64_t>(smHandle), name, static_cast<bool>(value));
@@ -417,12 +450,133 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppFireStateMachineTrigger(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(inputName, nullptr);
-    std::string name(nameChars);
-    env->ReleaseStringUTFChars(inputName, nameChars);
+    std::string name = JStringToStdString(env, inputName);
 
     // Fire-and-forget: use 0 as requestID
     server->fireTrigger(0L, static_cast<int64_t>(smHandle), name);
 }
 
-} // extern "C"
\ No newline at end of file
+// =============================================================================
+// Phase G.5: Scheduled Inputs
+// =============================================================================
+
+/**
+ * Schedules a state machine input to fire after a delay in animation time,
+ * or every time an event is reported when onEvent is not empty. The
+ * DelayEvent kind holds back reports of the event named by inputName instead.
+ *
+ * JNI signature: cppScheduleInput(ptr: Long, smHandle: Long, kind: Int, inputName: String,
+ *                                 floatValue: Float, boolValue: Boolean, delaySeconds: Float,
+ *                                 onEvent: String): Long
+ *
+ * @return The scheduled input ID, or 0 on error.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppScheduleInput(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong smHandle,
+    jint kind,
+    jstring inputName,
+    jfloat floatValue,
+    jboolean boolValue,
+    jfloat delaySeconds,
+    jstring onEvent
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to schedule input on null CommandServer");
+        return 0;
+    }
+    if (kind < 0 || kind > static_cast<jint>(ScheduledInputKind::DelayEvent)) {
+        LOGW("CommandQueue JNI: Invalid scheduled input kind: %d", kind);
+        return 0;
+    }
+
+    std::string name = JStringToStdString(env, inputName);
+
+    std::string eventName = JStringToStdString(env, onEvent);
+
+    return static_cast<jlong>(server->scheduleInput(
+        static_cast<int64_t>(smHandle),
+        static_cast<ScheduledInputKind>(kind),
+        name,
+        static_cast<float>(floatValue),
+        boolValue == JNI_TRUE,
+        static_cast<float>(delaySeconds),
+        eventName));
+}
+
+/**
+ * Cancels a scheduled input or event reaction.
+ *
+ * JNI signature: cppCancelScheduledInput(ptr: Long, timerID: Long): Unit
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppCancelScheduledInput(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong timerID
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to cancel scheduled input on null CommandServer");
+        return;
+    }
+    server->cancelScheduledInput(static_cast<int64_t>(timerID));
+}
+
+// =============================================================================
+// Phase G.16: Event Filters
+// =============================================================================
+
+/**
+ * Chooses which of a state machine's reported events reach the client.
+ *
+ * JNI signature: cppSetEventFilter(ptr: Long, smHandle: Long, mode: Int, names: Array<String>,
+ *                                  typeCodes: IntArray): Unit
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetEventFilter(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong smHandle,
+    jint mode,
+    jobjectArray names,
+    jintArray typeCodes
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to set event filter on null CommandServer");
+        return;
+    }
+    if (mode < 0 || mode > static_cast<jint>(EventFilterMode::Matching)) {
+        LOGW("CommandQueue JNI: Invalid event filter mode: %d", mode);
+        return;
+    }
+
+    std::vector<std::string> eventNames;
+    const jsize nameCount = env->GetArrayLength(names);
+    eventNames.reserve(static_cast<size_t>(nameCount));
+    for (jsize i = 0; i < nameCount; ++i) {
+        auto name = static_cast<jstring>(env->GetObjectArrayElement(names, i));
+        eventNames.push_back(JStringToStdString(env, name));
+        env->DeleteLocalRef(name);
+    }
+
+    std::vector<int32_t> eventTypeCodes(static_cast<size_t>(env->GetArrayLength(typeCodes)));
+    if (!eventTypeCodes.empty()) {
+        env->GetIntArrayRegion(typeCodes, 0, static_cast<jsize>(eventTypeCodes.size()),
+                               reinterpret_cast<jint*>(eventTypeCodes.data()));
+    }
+
+    server->setEventFilter(static_cast<int64_t>(smHandle),
+                           static_cast<EventFilterMode>(mode),
+                           std::move(eventNames),
+                           std::move(eventTypeCodes));
+}
+
+} // extern "C"
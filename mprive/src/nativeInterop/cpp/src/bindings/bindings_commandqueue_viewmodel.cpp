@@ -26,9 +26,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateBlankVMI(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(viewModelName, nullptr);
-    std::string vmName(nameChars);
-    env->ReleaseStringUTFChars(viewModelName, nameChars);
+    std::string vmName = JStringToStdString(env, viewModelName);
 
     server->createBlankVMI(static_cast<int64_t>(requestID), static_cast<int64_t>(fileHandle), vmName);
 }
@@ -53,9 +51,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateDefaultVMI(
         return;
     }
 
-    const char* nameChars = env->GetStringUTFChars(viewModelName, nullptr);
-    std::string vmName(nameChars);
-    env->ReleaseStringUTFChars(viewModelName, nameChars);
+    std::string vmName = JStringToStdString(env, viewModelName);
 
     server->createDefaultVMI(static_cast<int64_t>(requestID), static_cast<int64_t>(fileHandle), vmName);
 }
@@ -81,13 +77,9 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateNamedVMI(
         return;
     }
 
-    const char* vmNameChars = env->GetStringUTFChars(viewModelName, nullptr);
-    std::string vmName(vmNameChars);
-    env->ReleaseStringUTFChars(viewModelName, vmNameChars);
+    std::string vmName = JStringToStdString(env, viewModelName);
 
-    const char* instNameChars = env->GetStringUTFChars(instanceName, nullptr);
-    std::string instName(instNameChars);
-    env->ReleaseStringUTFChars(instanceName, instNameChars);
+    std::string instName = JStringToStdString(env, instanceName);
 
     server->createNamedVMI(static_cast<int64_t>(requestID), static_cast<int64_t>(fileHandle), vmName, instName);
 }
@@ -138,9 +130,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetNumberProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getNumberProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -165,9 +155,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetNumberProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     // Fire-and-forget - pass 0 for requestID (no async callback needed)
     server->setNumberProperty(0L, static_cast<int64_t>(vmiHandle), path, static_cast<float>(value));
@@ -193,9 +181,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetStringProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getStringProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -220,13 +206,9 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetStringProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
-    const char* valueChars = env->GetStringUTFChars(value, nullptr);
-    std::string valueStr(valueChars);
-    env->ReleaseStringUTFChars(value, valueChars);
+    std::string valueStr = JStringToStdString(env, value);
 
     // Fire-and-forget - pass 0 for requestID (no async callback needed)
     server->setStringProperty(0L, static_cast<int64_t>(vmiHandle), path, valueStr);
@@ -252,9 +234,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetBooleanProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getBooleanProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -279,9 +259,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetBooleanProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     // Fire-and-forget - pass 0 for requestID (no async callback needed)
     server->setBooleanProperty(0L, static_cast<int64_t>(vmiHandle), path, static_cast<bool>(value));
@@ -311,9 +289,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetEnumProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getEnumProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -338,13 +314,9 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetEnumProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
-    const char* valueChars = env->GetStringUTFChars(value, nullptr);
-    std::string valueStr(valueChars);
-    env->ReleaseStringUTFChars(value, valueChars);
+    std::string valueStr = JStringToStdString(env, value);
 
     // Fire-and-forget - pass 0 for requestID (no async callback needed)
     server->setEnumProperty(0L, static_cast<int64_t>(vmiHandle), path, valueStr);
@@ -370,9 +342,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetColorProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->getColorProperty(static_cast<int64_t>(requestID), static_cast<int64_t>(vmiHandle), path);
 }
@@ -397,9 +367,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSetColorProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     // Fire-and-forget - pass 0 for requestID (no async callback needed)
     server->setColorProperty(0L, static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(value));
@@ -424,9 +392,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppFireTriggerProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     // Fire-and-forget - pass 0 for requestID (no async callback needed)
     server->fireTriggerProperty(0L, static_cast<int64_t>(vmiHandle), path);
@@ -456,9 +422,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppSubscribeToProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->subscribeToProperty(static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(propertyType));
 }
@@ -483,9 +447,7 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppUnsubscribeFromProperty(
         return;
     }
 
-    const char* pathChars = env->GetStringUTFChars(propertyPath, nullptr);
-    std::string path(pathChars);
-    env->ReleaseStringUTFChars(propertyPath, pathChars);
+    std::string path = JStringToStdString(env, propertyPath);
 
     server->unsubscribeFromProperty(static_cast<int64_t>(vmiHandle), path, static_cast<int32_t>(propertyType));
 }
@@ -540,4 +502,43 @@ Java_app_rive_mp_core_CommandQueueJNIBridge_cppGetDefaultViewModelInstance(
     server->getDefaultViewModelInstance(static_cast<int64_t>(requestID), static_cast<int64_t>(fileHandle), static_cast<int64_t>(artboardHandle));
 }
 
-} // extern "C"
\ No newline at end of file
+// =============================================================================
+// Phase G.15: Bulk View Model Instances
+// =============================================================================
+
+/**
+ * Reserves a contiguous range of ViewModelInstances of a named ViewModel,
+ * optionally seeded with another instance's values.
+ *
+ * JNI signature: cppCreateVMIBatch(ptr: Long, requestID: Long, fileHandle: Long, viewModelName: String, count: Int, seedVmiHandle: Long): Long
+ *
+ * @return The first handle of the range, or 0 if count is not positive.
+ */
+JNIEXPORT jlong JNICALL
+Java_app_rive_mp_core_CommandQueueJNIBridge_cppCreateVMIBatch(
+    JNIEnv* env,
+    jobject thiz,
+    jlong ptr,
+    jlong requestID,
+    jlong fileHandle,
+    jstring viewModelName,
+    jint count,
+    jlong seedVmiHandle
+) {
+    auto* server = reinterpret_cast<CommandServer*>(ptr);
+    if (server == nullptr) {
+        LOGW("CommandQueue JNI: Attempted to create VMI batch on null CommandServer");
+        return 0;
+    }
+
+    std::string vmName = JStringToStdString(env, viewModelName);
+
+    return static_cast<jlong>(server->createVMIBatch(
+        static_cast<int64_t>(requestID),
+        static_cast<int64_t>(fileHandle),
+        vmName,
+        static_cast<int32_t>(count),
+        static_cast<int64_t>(seedVmiHandle)));
+}
+
+} // extern "C"
@@ -0,0 +1,110 @@
+/**
+ * JNI test hooks for the DeferredFactory.
+ *
+ * Debug builds only: draws an artboard through a recording factory and
+ * renderer, once imported directly and once through a DeferredFactory, so
+ * instrumented tests can compare what lazy and eager imports draw.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+#include "deferred_factory.hpp"
+#include "jni_helpers.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "recording_renderer.hpp"
+
+#include <string>
+#include <vector>
+
+extern "C" {
+
+/**
+ * Imports a file and draws frames of its default artboard, advancing its
+ * default state machine (or the artboard without one) by 1/60s before each.
+ *
+ * @param bytes The .riv file bytes.
+ * @param lazy True to import through a DeferredFactory and draw through a
+ *        DeferredRenderer, false to import with the recording factory itself.
+ * @param frameCount How many frames to draw.
+ * @param trimEachFrame When lazy, release every idle real object after each
+ *        frame with a forced trim() and an idle time of 0.
+ * @param stats Receives the DeferredFactory counters after the last frame:
+ *        live, materialized, materializations, releases. Zeros when eager.
+ * @return One log per frame, or null if the file has no artboard.
+ */
+JNIEXPORT jobjectArray JNICALL
+Java_app_rive_mp_test_rendering_NativeDeferredFactoryTestHelper_cppRecordFrames(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray bytes,
+    jboolean lazy,
+    jint frameCount,
+    jboolean trimEachFrame,
+    jlongArray stats
+) {
+    std::vector<uint8_t> source = rive_mp::JByteArrayToVector(env, bytes);
+    rive_mp::RecordingFactory recordingFactory;
+    rive_mp::DeferredFactory deferredFactory(&recordingFactory);
+    deferredFactory.setIdleReleaseNs(0);
+    const bool isLazy = lazy == JNI_TRUE;
+
+    // Results are collected before the file goes away: its objects untrack
+    // themselves from the factory as they are destroyed.
+    std::vector<std::string> logs;
+    jlong counters[4] = {0, 0, 0, 0};
+    {
+        auto file = rive::File::import(
+            rive::Span<const uint8_t>(source.data(), source.size()),
+            isLazy ? static_cast<rive::Factory*>(&deferredFactory) : &recordingFactory);
+        auto artboard = file != nullptr ? file->artboardDefault() : nullptr;
+        if (artboard == nullptr) {
+            return nullptr;
+        }
+        auto stateMachine = artboard->defaultStateMachine();
+
+        for (jint frame = 0; frame < frameCount; ++frame) {
+            if (stateMachine != nullptr) {
+                stateMachine->advanceAndApply(1.0f / 60.0f);
+            } else {
+                artboard->advance(1.0f / 60.0f);
+            }
+            rive_mp::RecordingRenderer recorder;
+            if (isLazy) {
+                deferredFactory.beginFrame();
+                rive_mp::DeferredRenderer renderer(&recorder, &deferredFactory);
+                artboard->draw(&renderer);
+                if (trimEachFrame == JNI_TRUE) {
+                    deferredFactory.trim(true);
+                }
+            } else {
+                artboard->draw(&recorder);
+            }
+            logs.push_back(std::move(recorder.log));
+        }
+
+        if (isLazy) {
+            auto factoryStats = deferredFactory.stats();
+            counters[0] = factoryStats.liveObjects;
+            counters[1] = factoryStats.materializedObjects;
+            counters[2] = factoryStats.materializations;
+            counters[3] = factoryStats.releases;
+        }
+    }
+    env->SetLongArrayRegion(stats, 0, 4, counters);
+
+    jclass stringClass = env->FindClass("java/lang/String");
+    jobjectArray result = env->NewObjectArray(static_cast<jsize>(logs.size()), stringClass, nullptr);
+    env->DeleteLocalRef(stringClass);
+    for (size_t i = 0; i < logs.size(); ++i) {
+        jstring log = env->NewStringUTF(logs[i].c_str());
+        env->SetObjectArrayElement(result, static_cast<jsize>(i), log);
+        env->DeleteLocalRef(log);
+    }
+    return result;
+}
+
+} // extern "C"
+
+#endif // DEBUG
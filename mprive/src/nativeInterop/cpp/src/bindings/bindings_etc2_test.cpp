@@ -0,0 +1,49 @@
+/**
+ * JNI test hooks for the ETC2 RGBA8 encoder.
+ *
+ * Debug builds only: lets instrumented tests encode known pixels and check
+ * them against a reference decoder.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+#include "etc2_encoder.hpp"
+#include "jni_helpers.hpp"
+
+extern "C" {
+
+/**
+ * Encodes premultiplied RGBA pixels as ETC2 RGBA8 (EAC alpha).
+ *
+ * @param pixels Tightly packed RGBA, width * height * 4 bytes.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @return 16 bytes per 4x4 block, blocks in row order, or null if the sizes
+ *         don't match the pixels.
+ */
+JNIEXPORT jbyteArray JNICALL
+Java_app_rive_mp_test_rendering_NativeETC2TestHelper_cppEncodeETC2(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray pixels,
+    jint width,
+    jint height
+) {
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    std::vector<uint8_t> src = rive_mp::JByteArrayToVector(env, pixels);
+    if (src.size() != static_cast<size_t>(width) * height * 4) {
+        return nullptr;
+    }
+
+    auto w = static_cast<uint32_t>(width);
+    auto h = static_cast<uint32_t>(height);
+    std::vector<uint8_t> dst(rive_mp::ETC2RGBA8Size(w, h));
+    rive_mp::EncodeETC2RGBA8(src.data(), w, h, dst.data());
+    return rive_mp::VectorToJByteArray(env, dst);
+}
+
+} // extern "C"
+
+#endif // DEBUG
@@ -0,0 +1,56 @@
+/**
+ * JNI test hooks for the CPU mip chain builder.
+ *
+ * Debug builds only: lets instrumented tests run the SIMD and scalar box
+ * filters on the same pixels and compare the results.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+#include "jni_helpers.hpp"
+#include "mipmap_builder.hpp"
+
+extern "C" {
+
+/**
+ * Downsamples premultiplied RGBA pixels by one mip level.
+ *
+ * @param pixels Tightly packed RGBA, width * height * 4 bytes.
+ * @param width Source width in pixels.
+ * @param height Source height in pixels.
+ * @param simd Whether to use the NEON/SSE2 path (DownsampleBox2x) rather than
+ *             the scalar reference (DownsampleBox2xScalar).
+ * @return The next level, or null if the sizes don't match the pixels.
+ */
+JNIEXPORT jbyteArray JNICALL
+Java_app_rive_mp_test_rendering_NativeMipmapTestHelper_cppDownsample(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray pixels,
+    jint width,
+    jint height,
+    jboolean simd
+) {
+    if (width <= 0 || height <= 0) {
+        return nullptr;
+    }
+    std::vector<uint8_t> src = rive_mp::JByteArrayToVector(env, pixels);
+    if (src.size() != static_cast<size_t>(width) * height * 4) {
+        return nullptr;
+    }
+
+    auto w = static_cast<uint32_t>(width);
+    auto h = static_cast<uint32_t>(height);
+    std::vector<uint8_t> dst(static_cast<size_t>(rive_mp::MipLevelSize(w)) *
+                             rive_mp::MipLevelSize(h) * 4);
+    if (simd == JNI_TRUE) {
+        rive_mp::DownsampleBox2x(src.data(), w, h, dst.data());
+    } else {
+        rive_mp::DownsampleBox2xScalar(src.data(), w, h, dst.data());
+    }
+    return rive_mp::VectorToJByteArray(env, dst);
+}
+
+} // extern "C"
+
+#endif // DEBUG
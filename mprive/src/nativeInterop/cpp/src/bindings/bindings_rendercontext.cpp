@@ -8,6 +8,9 @@
  */
 
 #include <jni.h>
+#include "compressed_texture_cache.hpp"
+#include "gpu_upload_worker.hpp"
+#include "jni_helpers.hpp"
 #include "render_context.hpp"
 #include "rive_log.hpp"
 
@@ -62,4 +65,90 @@ Java_app_rive_mp_RenderContextGL_cppDelete(
     LOGD(RCJNI_PREFIX "RenderContextGL deleted");
 }
 
+/**
+ * Enables the compressed texture cache in a directory, or disables it.
+ *
+ * @param directory Cache directory, or an empty string to disable
+ * @return Whether the cache is enabled; false if the directory can't be created
+ */
+JNIEXPORT jboolean JNICALL
+Java_app_rive_mp_TextureCompression_cppConfigure(
+    JNIEnv* env,
+    jobject thiz,
+    jstring directory
+) {
+    bool enabled = rive_mp::CompressedTextureCache::configure(
+        rive_mp::JStringToStdString(env, directory));
+    return enabled ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Returns the compressed texture cache hit and miss counts.
+ *
+ * @return LongArray of [hits, misses]
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_TextureCompression_cppGetCacheStats(
+    JNIEnv* env,
+    jobject thiz
+) {
+    jlong stats[] = {
+        static_cast<jlong>(rive_mp::CompressedTextureCache::hitCount()),
+        static_cast<jlong>(rive_mp::CompressedTextureCache::missCount()),
+    };
+    auto result = env->NewLongArray(2);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, 2, stats);
+    }
+    return result;
+}
+
+/**
+ * Allows or forbids the shared-context image upload thread for render
+ * contexts initialized afterwards.
+ *
+ * @param enabled False to upload images on the render thread
+ */
+JNIEXPORT void JNICALL
+Java_app_rive_mp_ImageUploads_cppSetEnabled(
+    JNIEnv* env,
+    jobject thiz,
+    jboolean enabled
+) {
+    rive_mp::GpuUploadWorker::setEnabled(enabled == JNI_TRUE);
+}
+
+/**
+ * Returns whether the image upload thread is allowed.
+ */
+JNIEXPORT jboolean JNICALL
+Java_app_rive_mp_ImageUploads_cppIsEnabled(
+    JNIEnv* env,
+    jobject thiz
+) {
+    return rive_mp::GpuUploadWorker::enabled() ? JNI_TRUE : JNI_FALSE;
+}
+
+/**
+ * Returns the image upload counts.
+ *
+ * @return LongArray of [queued, published, synchronous]
+ */
+JNIEXPORT jlongArray JNICALL
+Java_app_rive_mp_ImageUploads_cppGetStats(
+    JNIEnv* env,
+    jobject thiz
+) {
+    jlong stats[] = {
+        static_cast<jlong>(rive_mp::GpuUploadWorker::queuedCount()),
+        static_cast<jlong>(rive_mp::GpuUploadWorker::publishedCount()),
+        static_cast<jlong>(rive_mp::GpuUploadWorker::synchronousCount()),
+    };
+    auto result = env->NewLongArray(3);
+    if (result != nullptr) {
+        env->SetLongArrayRegion(result, 0, 3, stats);
+    }
+    return result;
+}
+
 } // extern "C"
\ No newline at end of file
@@ -0,0 +1,167 @@
+/**
+ * JNI test hooks for the .riv artboard slicer.
+ *
+ * Debug builds only: lets instrumented tests inspect the sliced bytes that
+ * loadFile() with artboard names imports, and compare what an artboard
+ * draws in a sliced file and in its source.
+ */
+#ifdef DEBUG
+
+#include <jni.h>
+#include "jni_helpers.hpp"
+#include "recording_renderer.hpp"
+#include "riv_slicer.hpp"
+#include "rive/animation/state_machine_instance.hpp"
+#include "rive/artboard.hpp"
+#include "rive/file.hpp"
+#include "rive/viewmodel/viewmodel_instance.hpp"
+#include "rive/viewmodel/viewmodel_instance_artboard.hpp"
+
+namespace {
+
+jobjectArray ToJStringArray(JNIEnv* env, const std::vector<std::string>& values) {
+    jclass stringClass = env->FindClass("java/lang/String");
+    jobjectArray result = env->NewObjectArray(static_cast<jsize>(values.size()), stringClass, nullptr);
+    env->DeleteLocalRef(stringClass);
+    for (size_t i = 0; i < values.size(); ++i) {
+        jstring value = rive_mp::StdStringToJString(env, values[i]);
+        env->SetObjectArrayElement(result, static_cast<jsize>(i), value);
+        env->DeleteLocalRef(value);
+    }
+    return result;
+}
+
+rive::rcp<rive::File> importRecorded(JNIEnv* env, jbyteArray bytes, rive::Factory* factory) {
+    std::vector<uint8_t> source = rive_mp::JByteArrayToVector(env, bytes);
+    return rive::File::import(rive::Span<const uint8_t>(source.data(), source.size()), factory);
+}
+
+} // namespace
+
+extern "C" {
+
+/**
+ * Slices a .riv file down to the named artboards.
+ *
+ * @param bytes The .riv file bytes.
+ * @param artboardNames The artboards to keep.
+ * @return The sliced file, or null if slicing failed.
+ */
+JNIEXPORT jbyteArray JNICALL
+Java_app_rive_mp_test_file_NativeRivSlicerTestHelper_cppSlice(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray bytes,
+    jobjectArray artboardNames
+) {
+    std::vector<std::string> names;
+    const jsize count = env->GetArrayLength(artboardNames);
+    for (jsize i = 0; i < count; ++i) {
+        auto name = static_cast<jstring>(env->GetObjectArrayElement(artboardNames, i));
+        names.push_back(rive_mp::JStringToStdString(env, name));
+        env->DeleteLocalRef(name);
+    }
+
+    std::vector<uint8_t> source = rive_mp::JByteArrayToVector(env, bytes);
+    std::vector<uint8_t> sliced;
+    rive_mp::RivSliceStats stats;
+    std::string error;
+    if (!rive_mp::SliceRivArtboards(source.data(), source.size(), names, sliced, stats, error)) {
+        return nullptr;
+    }
+    return rive_mp::VectorToJByteArray(env, sliced);
+}
+
+/**
+ * Draws frames of an artboard through a recording renderer, with the default
+ * view model instance of the artboard bound, advancing its default state
+ * machine (or the artboard without one) by 1/60s before each frame.
+ *
+ * @param bytes The .riv file bytes.
+ * @param artboardName The artboard to draw.
+ * @param frameCount How many frames to draw.
+ * @return One log per frame, or null if the artboard is not in the file.
+ */
+JNIEXPORT jobjectArray JNICALL
+Java_app_rive_mp_test_file_NativeRivSlicerTestHelper_cppRecordArtboard(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray bytes,
+    jstring artboardName,
+    jint frameCount
+) {
+    rive_mp::RecordingFactory factory;
+    auto file = importRecorded(env, bytes, &factory);
+    auto artboard = file != nullptr
+                        ? file->artboardNamed(rive_mp::JStringToStdString(env, artboardName))
+                        : nullptr;
+    if (artboard == nullptr) {
+        return nullptr;
+    }
+    auto stateMachine = artboard->defaultStateMachine();
+    auto viewModelInstance = file->createDefaultViewModelInstance(artboard.get());
+    if (viewModelInstance != nullptr) {
+        if (stateMachine != nullptr) {
+            stateMachine->bindViewModelInstance(viewModelInstance);
+        } else {
+            artboard->bindViewModelInstance(viewModelInstance);
+        }
+    }
+
+    std::vector<std::string> logs;
+    for (jint frame = 0; frame < frameCount; ++frame) {
+        if (stateMachine != nullptr) {
+            stateMachine->advanceAndApply(1.0f / 60.0f);
+        } else {
+            artboard->advance(1.0f / 60.0f);
+        }
+        rive_mp::RecordingRenderer recorder;
+        artboard->draw(&recorder);
+        logs.push_back(std::move(recorder.log));
+    }
+    return ToJStringArray(env, logs);
+}
+
+/**
+ * Lists the artboards that the artboard properties of an artboard's default
+ * view model instance refer to. The slicer does not follow these.
+ *
+ * @param bytes The .riv file bytes.
+ * @param artboardName The artboard whose default instance to inspect.
+ * @return One name per artboard property, empty for a property that refers
+ *         to no artboard, or null if the artboard is not in the file.
+ */
+JNIEXPORT jobjectArray JNICALL
+Java_app_rive_mp_test_file_NativeRivSlicerTestHelper_cppBoundArtboards(
+    JNIEnv* env,
+    jobject thiz,
+    jbyteArray bytes,
+    jstring artboardName
+) {
+    rive_mp::RecordingFactory factory;
+    auto file = importRecorded(env, bytes, &factory);
+    auto artboard = file != nullptr
+                        ? file->artboardNamed(rive_mp::JStringToStdString(env, artboardName))
+                        : nullptr;
+    if (artboard == nullptr) {
+        return nullptr;
+    }
+
+    std::vector<std::string> names;
+    auto viewModelInstance = file->createDefaultViewModelInstance(artboard.get());
+    if (viewModelInstance != nullptr) {
+        for (auto* value : viewModelInstance->propertyValues()) {
+            if (!value->is<rive::ViewModelInstanceArtboard>()) {
+                continue;
+            }
+            // Artboard properties hold an index into the file's artboards
+            const uint32_t index = value->as<rive::ViewModelInstanceArtboard>()->propertyValue();
+            names.push_back(index < file->artboardCount() ? file->artboard(index)->name() : "");
+        }
+    }
+    return ToJStringArray(env, names);
+}
+
+} // extern "C"
+
+#endif // DEBUG
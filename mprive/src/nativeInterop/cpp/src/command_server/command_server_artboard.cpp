@@ -55,6 +55,7 @@ int64_t CommandServer::createDefaultArtboardSync(int64_t fileHandle)
     
     LOGI("CommandServer: Artboard created synchronously (handle=%lld)", 
          static_cast<long long>(handle));
+    captureSyncCreate(CommandType::CreateDefaultArtboard, fileHandle, "", handle);
     
     return handle;
 }
@@ -88,6 +89,7 @@ int64_t CommandServer::createArtboardByNameSync(int64_t fileHandle, const std::s
     
     LOGI("CommandServer: Artboard created synchronously (handle=%lld, name=%s)", 
          static_cast<long long>(handle), name.c_str());
+    captureSyncCreate(CommandType::CreateArtboardByName, fileHandle, name, handle);
     
     return handle;
 }
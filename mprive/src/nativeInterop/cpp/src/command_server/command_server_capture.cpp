@@ -0,0 +1,712 @@
+#include "command_server.hpp"
+#include "rive_log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace rive_android {
+
+namespace {
+
+// Capture file layout (little-endian, as written by the device):
+//   header:  u32 magic, u32 version, i64 firstHandle, u32 blobCount,
+//            u32 recordCount
+//   blob:    u64 hash, u32 size, size bytes
+//   record:  i64 time (ns since the first record), u32 payloadSize, payload
+//   payload: u16 command type, then (u8 field, value) pairs for the fields
+//            that differ from their defaults
+constexpr uint32_t kCaptureMagic = 0x50435652;  // "RVCP"
+constexpr uint32_t kCaptureVersion = 2;
+
+// Field tags of the record payload. Append only: the values are on disk.
+enum class CaptureField : uint8_t {
+    RequestID = 1,
+    Handle,
+    Name,
+    DeltaTime,
+    InputName,
+    InputIndex,
+    FloatValue,
+    BoolValue,
+    EventIndex,
+    ViewModelName,
+    InstanceName,
+    PropertyPath,
+    StringValue,
+    ColorValue,
+    PropertyType,
+    ListIndex,
+    ListIndexB,
+    ItemHandle,
+    NestedHandle,
+    AssetHandle,
+    FileHandle,
+    VmiHandle,
+    RtWidth,
+    RtHeight,
+    SampleCount,
+    ArtboardHandle,
+    SmHandle,
+    SurfacePtr,
+    RenderTargetPtr,
+    DrawKey,
+    SurfaceWidth,
+    SurfaceHeight,
+    FitMode,
+    AlignmentMode,
+    ClearColor,
+    ScaleFactor,
+    PointerFit,
+    PointerAlignment,
+    LayoutScale,
+    PointerSurfaceWidth,
+    PointerSurfaceHeight,
+    PointerID,
+    PointerX,
+    PointerY,
+    ScheduledKind,
+    DelaySeconds,
+    TimerID,
+    BytesHash,               // Bytes stored in the blob table
+    ClientTimeOffset,        // Client event time relative to the enqueue time
+    ContentKey,              // Shared file key (Phase G.9)
+    ArtboardName,            // One per artboard of a partial LoadFile (Phase G.14)
+    FirstHandle,             // Reserved VMI range (Phase G.15)
+    InstanceCount,
+    EventFilterMode,         // Event filter (Phase G.16)
+    EventName,               // One per listed event name
+    EventTypeCode,           // One per listed event type
+    ResultHandle,            // Handle returned by a synchronous create
+};
+
+class CaptureWriter {
+public:
+    explicit CaptureWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+    template <typename T>
+    void raw(T value)
+    {
+        const auto* p = reinterpret_cast<const uint8_t*>(&value);
+        m_out.insert(m_out.end(), p, p + sizeof(T));
+    }
+
+    void bytes(const uint8_t* data, size_t size) { m_out.insert(m_out.end(), data, data + size); }
+
+    template <typename T>
+    void field(CaptureField tag, T value, T defaultValue)
+    {
+        if (value == defaultValue) {
+            return;
+        }
+        raw(static_cast<uint8_t>(tag));
+        raw(value);
+    }
+
+    void field(CaptureField tag, const std::string& value)
+    {
+        if (value.empty()) {
+            return;
+        }
+        raw(static_cast<uint8_t>(tag));
+        raw(static_cast<uint32_t>(value.size()));
+        bytes(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+    }
+
+private:
+    std::vector<uint8_t>& m_out;
+};
+
+class CaptureReader {
+public:
+    CaptureReader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    bool raw(T& value)
+    {
+        if (m_size - m_offset < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, m_data + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    bool bytes(size_t size, const uint8_t*& data)
+    {
+        if (m_size - m_offset < size) {
+            return false;
+        }
+        data = m_data + m_offset;
+        m_offset += size;
+        return true;
+    }
+
+    bool string(std::string& value)
+    {
+        uint32_t size = 0;
+        const uint8_t* data = nullptr;
+        if (!raw(size) || !bytes(size, data)) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(data), size);
+        return true;
+    }
+
+    bool done() const { return m_offset == m_size; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset = 0;
+};
+
+void encodeCommand(const Command& cmd,
+                   uint64_t bytesHash,
+                   int64_t resultHandle,
+                   std::vector<uint8_t>& out)
+{
+    const Command defaults;
+    CaptureWriter w(out);
+    w.raw(static_cast<uint16_t>(cmd.type));
+    w.field(CaptureField::RequestID, cmd.requestID, defaults.requestID);
+    w.field(CaptureField::Handle, cmd.handle, defaults.handle);
+    w.field(CaptureField::Name, cmd.name);
+    w.field(CaptureField::DeltaTime, cmd.deltaTime, defaults.deltaTime);
+    w.field(CaptureField::InputName, cmd.inputName);
+    w.field(CaptureField::InputIndex, cmd.inputIndex, defaults.inputIndex);
+    w.field(CaptureField::FloatValue, cmd.floatValue, defaults.floatValue);
+    w.field(CaptureField::BoolValue, static_cast<uint8_t>(cmd.boolValue), uint8_t{0});
+    w.field(CaptureField::EventIndex, cmd.eventIndex, defaults.eventIndex);
+    w.field(CaptureField::ViewModelName, cmd.viewModelName);
+    w.field(CaptureField::InstanceName, cmd.instanceName);
+    w.field(CaptureField::PropertyPath, cmd.propertyPath);
+    w.field(CaptureField::StringValue, cmd.stringValue);
+    w.field(CaptureField::ColorValue, cmd.colorValue, defaults.colorValue);
+    w.field(CaptureField::PropertyType, cmd.propertyType, defaults.propertyType);
+    w.field(CaptureField::ListIndex, cmd.listIndex, defaults.listIndex);
+    w.field(CaptureField::ListIndexB, cmd.listIndexB, defaults.listIndexB);
+    w.field(CaptureField::ItemHandle, cmd.itemHandle, defaults.itemHandle);
+    w.field(CaptureField::NestedHandle, cmd.nestedHandle, defaults.nestedHandle);
+    w.field(CaptureField::AssetHandle, cmd.assetHandle, defaults.assetHandle);
+    w.field(CaptureField::FileHandle, cmd.fileHandle, defaults.fileHandle);
+    w.field(CaptureField::VmiHandle, cmd.vmiHandle, defaults.vmiHandle);
+    w.field(CaptureField::RtWidth, cmd.rtWidth, defaults.rtWidth);
+    w.field(CaptureField::RtHeight, cmd.rtHeight, defaults.rtHeight);
+    w.field(CaptureField::SampleCount, cmd.sampleCount, defaults.sampleCount);
+    w.field(CaptureField::ArtboardHandle, cmd.artboardHandle, defaults.artboardHandle);
+    w.field(CaptureField::SmHandle, cmd.smHandle, defaults.smHandle);
+    w.field(CaptureField::SurfacePtr, cmd.surfacePtr, defaults.surfacePtr);
+    w.field(CaptureField::RenderTargetPtr, cmd.renderTargetPtr, defaults.renderTargetPtr);
+    w.field(CaptureField::DrawKey, cmd.drawKey, defaults.drawKey);
+    w.field(CaptureField::SurfaceWidth, cmd.surfaceWidth, defaults.surfaceWidth);
+    w.field(CaptureField::SurfaceHeight, cmd.surfaceHeight, defaults.surfaceHeight);
+    w.field(CaptureField::FitMode, cmd.fitMode, defaults.fitMode);
+    w.field(CaptureField::AlignmentMode, cmd.alignmentMode, defaults.alignmentMode);
+    w.field(CaptureField::ClearColor, cmd.clearColor, defaults.clearColor);
+    w.field(CaptureField::ScaleFactor, cmd.scaleFactor, defaults.scaleFactor);
+    w.field(CaptureField::PointerFit, cmd.pointerFit, defaults.pointerFit);
+    w.field(CaptureField::PointerAlignment, cmd.pointerAlignment, defaults.pointerAlignment);
+    w.field(CaptureField::LayoutScale, cmd.layoutScale, defaults.layoutScale);
+    w.field(CaptureField::PointerSurfaceWidth, cmd.pointerSurfaceWidth, defaults.pointerSurfaceWidth);
+    w.field(CaptureField::PointerSurfaceHeight, cmd.pointerSurfaceHeight, defaults.pointerSurfaceHeight);
+    w.field(CaptureField::PointerID, cmd.pointerID, defaults.pointerID);
+    w.field(CaptureField::PointerX, cmd.pointerX, defaults.pointerX);
+    w.field(CaptureField::PointerY, cmd.pointerY, defaults.pointerY);
+    w.field(CaptureField::ScheduledKind, cmd.scheduledKind, defaults.scheduledKind);
+    w.field(CaptureField::DelaySeconds, cmd.delaySeconds, defaults.delaySeconds);
+    w.field(CaptureField::TimerID, cmd.timerID, defaults.timerID);
+    if (!cmd.bytes.empty()) {
+        w.field(CaptureField::BytesHash, bytesHash, uint64_t{0});
+    }
+    w.field(CaptureField::ClientTimeOffset, cmd.clientTimeNs - cmd.enqueueTimeNs, int64_t{0});
+    w.field(CaptureField::ContentKey, cmd.contentKey, defaults.contentKey);
+    w.field(CaptureField::FirstHandle, cmd.firstHandle, defaults.firstHandle);
+    w.field(CaptureField::InstanceCount, cmd.instanceCount, defaults.instanceCount);
+    for (const auto& artboardName : cmd.artboardNames) {
+        w.field(CaptureField::ArtboardName, artboardName);
+    }
+    w.field(CaptureField::EventFilterMode, cmd.eventFilterMode, defaults.eventFilterMode);
+    for (const auto& eventName : cmd.eventNames) {
+        w.field(CaptureField::EventName, eventName);
+    }
+    for (const auto typeCode : cmd.eventTypeCodes) {
+        w.raw(static_cast<uint8_t>(CaptureField::EventTypeCode));
+        w.raw(typeCode);
+    }
+    w.field(CaptureField::ResultHandle, resultHandle, int64_t{0});
+}
+
+bool decodeCommand(CaptureReader& r,
+                   const std::map<uint64_t, std::vector<uint8_t>>& blobs,
+                   Command& cmd,
+                   int64_t& clientTimeOffsetNs,
+                   int64_t& resultHandle)
+{
+    uint16_t type = 0;
+    if (!r.raw(type) || type >= kCommandTypeCount) {
+        return false;
+    }
+    cmd.type = static_cast<CommandType>(type);
+    clientTimeOffsetNs = 0;
+    resultHandle = 0;
+
+    while (!r.done()) {
+        uint8_t tag = 0;
+        if (!r.raw(tag)) {
+            return false;
+        }
+        bool ok = true;
+        switch (static_cast<CaptureField>(tag)) {
+            case CaptureField::RequestID: ok = r.raw(cmd.requestID); break;
+            case CaptureField::Handle: ok = r.raw(cmd.handle); break;
+            case CaptureField::Name: ok = r.string(cmd.name); break;
+            case CaptureField::DeltaTime: ok = r.raw(cmd.deltaTime); break;
+            case CaptureField::InputName: ok = r.string(cmd.inputName); break;
+            case CaptureField::InputIndex: ok = r.raw(cmd.inputIndex); break;
+            case CaptureField::FloatValue: ok = r.raw(cmd.floatValue); break;
+            case CaptureField::BoolValue: {
+                uint8_t value = 0;
+                ok = r.raw(value);
+                cmd.boolValue = value != 0;
+                break;
+            }
+            case CaptureField::EventIndex: ok = r.raw(cmd.eventIndex); break;
+            case CaptureField::ViewModelName: ok = r.string(cmd.viewModelName); break;
+            case CaptureField::InstanceName: ok = r.string(cmd.instanceName); break;
+            case CaptureField::PropertyPath: ok = r.string(cmd.propertyPath); break;
+            case CaptureField::StringValue: ok = r.string(cmd.stringValue); break;
+            case CaptureField::ColorValue: ok = r.raw(cmd.colorValue); break;
+            case CaptureField::PropertyType: ok = r.raw(cmd.propertyType); break;
+            case CaptureField::ListIndex: ok = r.raw(cmd.listIndex); break;
+            case CaptureField::ListIndexB: ok = r.raw(cmd.listIndexB); break;
+            case CaptureField::ItemHandle: ok = r.raw(cmd.itemHandle); break;
+            case CaptureField::NestedHandle: ok = r.raw(cmd.nestedHandle); break;
+            case CaptureField::AssetHandle: ok = r.raw(cmd.assetHandle); break;
+            case CaptureField::FileHandle: ok = r.raw(cmd.fileHandle); break;
+            case CaptureField::VmiHandle: ok = r.raw(cmd.vmiHandle); break;
+            case CaptureField::RtWidth: ok = r.raw(cmd.rtWidth); break;
+            case CaptureField::RtHeight: ok = r.raw(cmd.rtHeight); break;
+            case CaptureField::SampleCount: ok = r.raw(cmd.sampleCount); break;
+            case CaptureField::ArtboardHandle: ok = r.raw(cmd.artboardHandle); break;
+            case CaptureField::SmHandle: ok = r.raw(cmd.smHandle); break;
+            case CaptureField::SurfacePtr: ok = r.raw(cmd.surfacePtr); break;
+            case CaptureField::RenderTargetPtr: ok = r.raw(cmd.renderTargetPtr); break;
+            case CaptureField::DrawKey: ok = r.raw(cmd.drawKey); break;
+            case CaptureField::SurfaceWidth: ok = r.raw(cmd.surfaceWidth); break;
+            case CaptureField::SurfaceHeight: ok = r.raw(cmd.surfaceHeight); break;
+            case CaptureField::FitMode: ok = r.raw(cmd.fitMode); break;
+            case CaptureField::AlignmentMode: ok = r.raw(cmd.alignmentMode); break;
+            case CaptureField::ClearColor: ok = r.raw(cmd.clearColor); break;
+            case CaptureField::ScaleFactor: ok = r.raw(cmd.scaleFactor); break;
+            case CaptureField::PointerFit: ok = r.raw(cmd.pointerFit); break;
+            case CaptureField::PointerAlignment: ok = r.raw(cmd.pointerAlignment); break;
+            case CaptureField::LayoutScale: ok = r.raw(cmd.layoutScale); break;
+            case CaptureField::PointerSurfaceWidth: ok = r.raw(cmd.pointerSurfaceWidth); break;
+            case CaptureField::PointerSurfaceHeight: ok = r.raw(cmd.pointerSurfaceHeight); break;
+            case CaptureField::PointerID: ok = r.raw(cmd.pointerID); break;
+            case CaptureField::PointerX: ok = r.raw(cmd.pointerX); break;
+            case CaptureField::PointerY: ok = r.raw(cmd.pointerY); break;
+            case CaptureField::ScheduledKind: ok = r.raw(cmd.scheduledKind); break;
+            case CaptureField::DelaySeconds: ok = r.raw(cmd.delaySeconds); break;
+            case CaptureField::TimerID: ok = r.raw(cmd.timerID); break;
+            case CaptureField::BytesHash: {
+                uint64_t hash = 0;
+                ok = r.raw(hash);
+                auto blob = blobs.find(hash);
+                if (!ok || blob == blobs.end()) {
+                    return false;
+                }
+                cmd.bytes = blob->second;
+                break;
+            }
+            case CaptureField::ClientTimeOffset: ok = r.raw(clientTimeOffsetNs); break;
+            case CaptureField::ContentKey: ok = r.raw(cmd.contentKey); break;
+            case CaptureField::FirstHandle: ok = r.raw(cmd.firstHandle); break;
+            case CaptureField::InstanceCount: ok = r.raw(cmd.instanceCount); break;
+            case CaptureField::ArtboardName: {
+                std::string artboardName;
+                ok = r.string(artboardName);
+                cmd.artboardNames.push_back(std::move(artboardName));
+                break;
+            }
+            case CaptureField::EventFilterMode: ok = r.raw(cmd.eventFilterMode); break;
+            case CaptureField::EventName: {
+                std::string eventName;
+                ok = r.string(eventName);
+                cmd.eventNames.push_back(std::move(eventName));
+                break;
+            }
+            case CaptureField::EventTypeCode: {
+                int32_t typeCode = 0;
+                ok = r.raw(typeCode);
+                cmd.eventTypeCodes.push_back(typeCode);
+                break;
+            }
+            case CaptureField::ResultHandle: ok = r.raw(resultHandle); break;
+            default:
+                // Unknown tags have no known size; the rest of the record is unreadable.
+                return false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& data)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint8_t buffer[64 * 1024];
+    size_t count = 0;
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    const bool ok = ferror(file) == 0;
+    fclose(file);
+    return ok;
+}
+
+// Rewrites the handle fields of a replayed command that refer to objects whose
+// replayed handle differs from the recorded one.
+void remapHandles(Command& cmd, const std::map<int64_t, int64_t>& remap)
+{
+    if (remap.empty()) {
+        return;
+    }
+    for (int64_t* handle : {&cmd.handle, &cmd.itemHandle, &cmd.nestedHandle, &cmd.assetHandle,
+                            &cmd.fileHandle, &cmd.vmiHandle, &cmd.artboardHandle, &cmd.smHandle}) {
+        auto it = remap.find(*handle);
+        if (*handle != 0 && it != remap.end()) {
+            *handle = it->second;
+        }
+    }
+}
+
+} // namespace
+
+// =============================================================================
+// Phase G.6: Command Capture
+// =============================================================================
+
+void CommandServer::startCommandCapture(int64_t windowMs)
+{
+    LOGI("CommandServer: Starting command capture (window=%lld ms)",
+         static_cast<long long>(windowMs));
+
+    std::lock_guard<std::mutex> lock(m_captureMutex);
+    m_captureWindowNs = std::max<int64_t>(windowMs, 0) * 1000000LL;
+    m_captureTrimAt = 1024;
+    m_capturedCommands.clear();
+    m_captureBlobs.clear();
+    // Commands enqueued from here on can only refer to handles minted from
+    // this one on; replay rejects captures that did not start at the first.
+    m_captureFirstHandle = m_nextHandle.load();
+    m_capturing.store(true);
+}
+
+void CommandServer::captureSyncCreate(CommandType type,
+                                      int64_t parentHandle,
+                                      const std::string& name,
+                                      int64_t handle)
+{
+    if (!m_capturing.load()) {
+        return;
+    }
+    // Recorded as the equivalent async command, plus the handle the caller
+    // got back, so replay can create it at the same point in the stream.
+    Command cmd(type);
+    cmd.handle = parentHandle;
+    cmd.name = name;
+    cmd.enqueueTimeNs = steadyClockNowNs();
+    cmd.clientTimeNs = cmd.enqueueTimeNs;
+    captureCommand(cmd, handle);
+}
+
+void CommandServer::captureCommand(const Command& cmd, int64_t resultHandle)
+{
+    // The callback of a RunOnce cannot be serialized; it only carries GL
+    // work of the caller, not renderer state.
+    if (cmd.type == CommandType::RunOnce) {
+        return;
+    }
+
+    // Hash and encode outside the lock; only the append is serialized.
+    const uint64_t bytesHash = cmd.bytes.empty() ? 0 : contentHash(cmd.bytes.data(), cmd.bytes.size());
+    CapturedCommand record;
+    record.timeNs = cmd.enqueueTimeNs;
+    record.commandClass = commandClassOf(cmd.type);
+    encodeCommand(cmd, bytesHash, resultHandle, record.payload);
+
+    std::lock_guard<std::mutex> lock(m_captureMutex);
+    if (!m_capturing.load()) {
+        return;
+    }
+    if (bytesHash != 0 && m_captureBlobs.find(bytesHash) == m_captureBlobs.end()) {
+        m_captureBlobs.emplace(bytesHash, cmd.bytes);
+    }
+    m_capturedCommands.push_back(std::move(record));
+    if (m_captureWindowNs > 0 && m_capturedCommands.size() >= m_captureTrimAt) {
+        trimCaptureLocked(cmd.enqueueTimeNs);
+        // Trim again once the log has doubled, so trimming stays amortized O(1).
+        m_captureTrimAt = std::max<size_t>(m_capturedCommands.size() * 2, 1024);
+    }
+}
+
+void CommandServer::trimCaptureLocked(int64_t nowNs)
+{
+    const int64_t cutoffNs = nowNs - m_captureWindowNs;
+    m_capturedCommands.erase(
+        std::remove_if(m_capturedCommands.begin(), m_capturedCommands.end(),
+                       [cutoffNs](const CapturedCommand& record) {
+                           return record.commandClass != CommandClass::Ordered &&
+                                  record.timeNs < cutoffNs;
+                       }),
+        m_capturedCommands.end());
+}
+
+bool CommandServer::stopCommandCapture(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(m_captureMutex);
+    if (!m_capturing.exchange(false)) {
+        LOGW("CommandServer: stopCommandCapture called without a running capture");
+        return false;
+    }
+
+    if (m_captureWindowNs > 0) {
+        trimCaptureLocked(steadyClockNowNs());
+    }
+    const int64_t firstHandle = m_captureFirstHandle;
+    std::vector<CapturedCommand> records = std::move(m_capturedCommands);
+    std::map<uint64_t, std::vector<uint8_t>> blobs = std::move(m_captureBlobs);
+    m_capturedCommands.clear();
+    m_captureBlobs.clear();
+    if (path.empty()) {
+        LOGI("CommandServer: Command capture discarded");
+        return false;
+    }
+
+    std::vector<uint8_t> out;
+    CaptureWriter w(out);
+    w.raw(kCaptureMagic);
+    w.raw(kCaptureVersion);
+    w.raw(firstHandle);
+    w.raw(static_cast<uint32_t>(blobs.size()));
+    w.raw(static_cast<uint32_t>(records.size()));
+    for (const auto& blob : blobs) {
+        w.raw(blob.first);
+        w.raw(static_cast<uint32_t>(blob.second.size()));
+        w.bytes(blob.second.data(), blob.second.size());
+    }
+    const int64_t baseNs = records.empty() ? 0 : records.front().timeNs;
+    for (const auto& record : records) {
+        w.raw(record.timeNs - baseNs);
+        w.raw(static_cast<uint32_t>(record.payload.size()));
+        w.bytes(record.payload.data(), record.payload.size());
+    }
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        LOGE("CommandServer: Cannot open capture file %s", path.c_str());
+        return false;
+    }
+    const bool written = fwrite(out.data(), 1, out.size(), file) == out.size();
+    const bool closed = fclose(file) == 0;
+    if (!written || !closed) {
+        LOGE("CommandServer: Failed to write capture file %s", path.c_str());
+        return false;
+    }
+
+    LOGI("CommandServer: Wrote %zu commands and %zu blobs (%zu bytes) to %s",
+         records.size(), blobs.size(), out.size(), path.c_str());
+    return true;
+}
+
+// =============================================================================
+// Phase G.6: Replay
+// =============================================================================
+
+void CommandServer::noteReplayTiming(const Command& cmd, int64_t durationNs)
+{
+    if (m_replayTimings.empty() || cmd.type == CommandType::RunOnce) {
+        return;
+    }
+    auto& timing = m_replayTimings[static_cast<size_t>(cmd.type)];
+    timing.type = cmd.type;
+    timing.count++;
+    timing.totalNs += durationNs;
+    timing.maxNs = std::max(timing.maxNs, durationNs);
+}
+
+bool CommandServer::replayCommandCapture(JNIEnv* env,
+                                         jobject commandQueue,
+                                         const std::string& path,
+                                         bool paced,
+                                         ReplayReport& report)
+{
+    report = ReplayReport();
+
+    std::vector<uint8_t> data;
+    if (!readFile(path, data)) {
+        LOGE("CommandServer: Cannot read capture file %s", path.c_str());
+        return false;
+    }
+
+    CaptureReader r(data.data(), data.size());
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    int64_t firstHandle = 0;
+    uint32_t blobCount = 0;
+    uint32_t recordCount = 0;
+    if (!r.raw(magic) || magic != kCaptureMagic || !r.raw(version)) {
+        LOGE("CommandServer: %s is not a command capture", path.c_str());
+        return false;
+    }
+    if (version != kCaptureVersion) {
+        LOGE("CommandServer: %s is a version %u capture; this build replays version %u",
+             path.c_str(), version, kCaptureVersion);
+        return false;
+    }
+    if (!r.raw(firstHandle) || !r.raw(blobCount) || !r.raw(recordCount)) {
+        LOGE("CommandServer: Truncated header in %s", path.c_str());
+        return false;
+    }
+    // The replay server starts empty, so commands that refer to files,
+    // artboards or instances created before the capture have nothing to act on.
+    if (firstHandle != 1) {
+        LOGE("CommandServer: %s was captured mid-session (%lld handles already created); "
+             "start the capture before loading any file to replay it",
+             path.c_str(), static_cast<long long>(firstHandle - 1));
+        return false;
+    }
+
+    std::map<uint64_t, std::vector<uint8_t>> blobs;
+    for (uint32_t i = 0; i < blobCount; ++i) {
+        uint64_t hash = 0;
+        uint32_t size = 0;
+        const uint8_t* bytes = nullptr;
+        if (!r.raw(hash) || !r.raw(size) || !r.bytes(size, bytes)) {
+            LOGE("CommandServer: Truncated blob table in %s", path.c_str());
+            return false;
+        }
+        blobs[hash].assign(bytes, bytes + size);
+    }
+
+    struct ReplayRecord {
+        int64_t timeNs = 0;
+        int64_t clientTimeOffsetNs = 0;
+        int64_t resultHandle = 0;               // Non-zero for synchronous creates
+        Command cmd;
+    };
+    std::vector<ReplayRecord> records(recordCount);
+    for (auto& record : records) {
+        uint32_t size = 0;
+        const uint8_t* payload = nullptr;
+        if (!r.raw(record.timeNs) || !r.raw(size) || !r.bytes(size, payload)) {
+            LOGE("CommandServer: Truncated record in %s", path.c_str());
+            return false;
+        }
+        CaptureReader payloadReader(payload, size);
+        if (!decodeCommand(payloadReader, blobs, record.cmd, record.clientTimeOffsetNs,
+                           record.resultHandle)) {
+            LOGE("CommandServer: Malformed record in %s", path.c_str());
+            return false;
+        }
+    }
+    if (!records.empty()) {
+        report.recordedSpanNs = records.back().timeNs;
+    }
+
+    LOGI("CommandServer: Replaying %zu commands from %s (%s)",
+         records.size(), path.c_str(), paced ? "paced" : "as fast as possible");
+
+    auto server = std::make_unique<CommandServer>(env, commandQueue, nullptr);
+    // Replay the recorded stream as-is; backpressure already shaped it when captured.
+    for (size_t i = 0; i < kCommandClassCount; ++i) {
+        server->setQueuePolicy(static_cast<CommandClass>(i), QueuePolicy());
+    }
+    server->m_replayTimings.resize(kCommandTypeCount);
+
+    // Recorded handle -> replayed handle, for objects that got a different one
+    std::map<int64_t, int64_t> remap;
+    const int64_t startNs = steadyClockNowNs();
+    for (auto& record : records) {
+        // Draws need a surface and a render context, neither of which exists here.
+        if (record.cmd.type == CommandType::Draw) {
+            report.skippedCount++;
+            continue;
+        }
+        if (paced) {
+            const int64_t dueNs = startNs + record.timeNs;
+            const int64_t waitNs = dueNs - steadyClockNowNs();
+            if (waitNs > 0) {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(waitNs));
+            }
+        }
+        remapHandles(record.cmd, remap);
+        if (record.resultHandle != 0) {
+            // A synchronous create ran on the caller's thread after the commands
+            // before it; drain them so it sees the same objects.
+            server->runOnce([] {});
+            const int64_t handle = server->replaySyncCreate(record.cmd);
+            if (handle == 0) {
+                report.errorCount++;
+            } else if (handle != record.resultHandle) {
+                remap[record.resultHandle] = handle;
+            }
+            report.commandCount++;
+            continue;
+        }
+        if (record.clientTimeOffsetNs != 0) {
+            record.cmd.clientTimeNs = steadyClockNowNs() + record.clientTimeOffsetNs;
+        }
+        server->enqueueCommand(std::move(record.cmd));
+        report.commandCount++;
+    }
+
+    // RunOnce runs after everything enqueued before it, so it marks the end of the replay.
+    server->runOnce([] {});
+    report.wallTimeNs = steadyClockNowNs() - startNs;
+
+    for (const auto& message : server->getMessages()) {
+        if (!message.error.empty()) {
+            report.errorCount++;
+        }
+    }
+    for (const auto& timing : server->m_replayTimings) {
+        if (timing.count > 0) {
+            report.types.push_back(timing);
+        }
+    }
+    server.reset();
+
+    LOGI("CommandServer: Replay finished: %u commands (%u skipped, %u errors) in %.1f ms, recorded span %.1f ms",
+         report.commandCount, report.skippedCount, report.errorCount,
+         static_cast<double>(report.wallTimeNs) / 1e6,
+         static_cast<double>(report.recordedSpanNs) / 1e6);
+    return true;
+}
+
+int64_t CommandServer::replaySyncCreate(const Command& cmd)
+{
+    switch (cmd.type) {
+        case CommandType::CreateDefaultArtboard:
+            return createDefaultArtboardSync(cmd.handle);
+        case CommandType::CreateArtboardByName:
+            return createArtboardByNameSync(cmd.handle, cmd.name);
+        case CommandType::CreateDefaultStateMachine:
+            return createDefaultStateMachineSync(cmd.handle);
+        case CommandType::CreateStateMachineByName:
+            return createStateMachineByNameSync(cmd.handle, cmd.name);
+        default:
+            LOGW("CommandServer: Unexpected synchronous create in capture (type=%s)",
+                 commandTypeName(cmd.type));
+            return 0;
+    }
+}
+
+} // namespace rive_android
@@ -1,6 +1,7 @@
 #include "command_server.hpp"
 #include "render_context.hpp"
 #include "rive_log.hpp"
+#include "rive_trace.hpp"
 #include <future>
 
 namespace rive_android {
@@ -10,6 +11,18 @@ CommandServer::CommandServer(JNIEnv* env, jobject commandQueue, void* renderCont
     , m_renderContext(renderContext)
 {
     LOGI("CommandServer: Constructing");
+    initQueuePolicies();
+    start();
+}
+
+CommandServer::CommandServer(JNIEnv* env, jobject commandQueue, CommandServerHost* host, uint32_t weight)
+    : m_host(host)
+    , m_hostWeight(weight)
+    , m_commandQueueRef(env, commandQueue)
+    , m_renderContext(host->renderContext())
+{
+    LOGI("CommandServer: Constructing on shared host (weight=%u)", weight);
+    initQueuePolicies();
     start();
 }
 
@@ -17,13 +30,36 @@ CommandServer::~CommandServer()
 {
     LOGI("CommandServer: Destructing");
     stop();
+
+    // Phase G.9: Drop this server's references to shared files
+    for (const auto& entry : m_sharedFileKeys) {
+        SharedFileRegistry::instance().release(entry.second);
+    }
+}
+
+void CommandServer::initQueuePolicies()
+{
+    // Phase G.1: Bound the fire-and-forget classes by default so a stalled
+    // worker cannot accumulate an unbounded backlog of frames and pointer moves.
+    m_queuePolicies[static_cast<size_t>(CommandClass::Advance)] = {OverflowPolicy::Coalesce, 8};
+    m_queuePolicies[static_cast<size_t>(CommandClass::Pointer)] = {OverflowPolicy::Coalesce, 64};
+    m_queuePolicies[static_cast<size_t>(CommandClass::Draw)] = {OverflowPolicy::Coalesce, 4};
 }
 
 void CommandServer::start()
 {
-    LOGI("CommandServer: Starting worker thread");
     m_running.store(true);
+    if (m_host != nullptr) {
+        // Phase G.10: The host's thread runs our commands. There is no
+        // watchdog thread either; slow commands are still recorded when
+        // they complete, but stalls are not flagged while in flight.
+        LOGI("CommandServer: Joining shared host");
+        m_host->attach(this, m_hostWeight);
+        return;
+    }
+    LOGI("CommandServer: Starting worker thread");
     m_thread = std::thread(&CommandServer::commandLoop, this);
+    m_watchdogThread = std::thread(&CommandServer::watchdogLoop, this);
 }
 
 void CommandServer::stop()
@@ -34,8 +70,20 @@ void CommandServer::stop()
     {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_running.store(false);
+        // Drain what is queued even if a test paused the worker.
+        m_workerPaused = false;
+        m_holdInFlight = false;
     }
     m_cv.notify_all();
+    m_queueSpaceCv.notify_all();
+    m_holdCv.notify_all();
+    
+    if (m_host != nullptr) {
+        // Phase G.10: Runs the commands still queued, then leaves the rotation
+        LOGI("CommandServer: Leaving shared host");
+        m_host->detach(this);
+        return;
+    }
     
     // Wait for the thread to finish
     if (m_thread.joinable()) {
@@ -43,15 +91,51 @@ void CommandServer::stop()
         m_thread.join();
         LOGI("CommandServer: Worker thread finished");
     }
+
+    // Stop the watchdog after the worker so the final commands are still observed
+    {
+        std::lock_guard<std::mutex> lock(m_watchdogMutex);
+        m_watchdogStop = true;
+    }
+    m_watchdogCv.notify_all();
+    if (m_watchdogThread.joinable()) {
+        m_watchdogThread.join();
+    }
 }
 
 void CommandServer::enqueueCommand(Command cmd)
 {
+    cmd.enqueueTimeNs = steadyClockNowNs();
+    if (cmd.clientTimeNs == 0) {
+        cmd.clientTimeNs = cmd.enqueueTimeNs;
+    }
+    // Phase G.6: Record what the client sent, before backpressure merges or drops it
+    if (m_capturing.load(std::memory_order_relaxed)) {
+        captureCommand(cmd);
+    }
+    const CommandType type = cmd.type;
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_commandQueue.push(std::move(cmd));
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!admitCommandLocked(cmd, lock)) {
+            // Merged into a pending command or dropped; the worker is already due to wake.
+            return;
+        }
+        auto& stats = m_queueStats[static_cast<size_t>(commandClassOf(cmd.type))];
+        stats.pending++;
+        if (stats.pending > stats.highWater) {
+            stats.highWater = stats.pending;
+        }
+        m_commandQueue.push_back(std::move(cmd));
+    }
+    if (viewTargetOf(type) != ViewTarget::None) {
+        // Phase G.11: Keep the frame clock running until the worker has seen this command
+        m_viewsIdle.store(false, std::memory_order_relaxed);
+    }
+    if (m_host != nullptr) {
+        m_host->notifyWork();
+    } else {
+        m_cv.notify_one();
     }
-    m_cv.notify_one();
 }
 
 void CommandServer::runOnce(std::function<void()> func)
@@ -96,14 +180,12 @@ void CommandServer::commandLoop()
     }
     
     while (true) {
-        Command cmd;
-        
         {
             std::unique_lock<std::mutex> lock(m_mutex);
             
             // Wait for a command or stop signal
             m_cv.wait(lock, [this] { 
-                return !m_commandQueue.empty() || !m_running.load(); 
+                return (!m_commandQueue.empty() && !m_workerPaused) || !m_running.load(); 
             });
             
             // Check if we should stop
@@ -111,18 +193,9 @@ void CommandServer::commandLoop()
                 LOGI("CommandServer: Worker thread stopping");
                 break;
             }
-            
-            // Get the next command if available
-            if (!m_commandQueue.empty()) {
-                cmd = std::move(m_commandQueue.front());
-                m_commandQueue.pop();
-            }
         }
         
-        // Execute the command outside the lock
-        if (cmd.type != CommandType::None) {
-            executeCommand(cmd);
-        }
+        runNextCommand();
     }
     
     // Cleanup OpenGL context on shutdown
@@ -135,6 +208,83 @@ void CommandServer::commandLoop()
     LOGI("CommandServer: Worker thread stopped");
 }
 
+bool CommandServer::runNextCommand()
+{
+    Command cmd;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_commandQueue.empty() || m_workerPaused) {
+            return false;
+        }
+        cmd = std::move(m_commandQueue.front());
+        m_commandQueue.pop_front();
+        m_queueStats[static_cast<size_t>(commandClassOf(cmd.type))].pending--;
+        m_inFlight = &cmd;
+        {
+            std::lock_guard<std::mutex> replyLock(m_messageMutex);
+            m_inFlightReplyID = cmd.requestID;
+            m_inFlightReplied = false;
+        }
+        m_holdCv.wait(lock, [this] { return !m_holdInFlight; });
+    }
+    m_queueSpaceCv.notify_all();
+    
+    // Execute the command outside the lock
+    if (cmd.type != CommandType::None) {
+        const int64_t startNs = beginCommandTiming(cmd);
+        {
+            rive_mp::RiveTraceScope trace(commandTypeName(cmd.type));
+            executeCommand(cmd);
+        }
+        endCommandTiming(cmd, startNs);
+        const int64_t durationNs = steadyClockNowNs() - startNs;
+        noteCommandExecuted(cmd, durationNs);
+        noteReplayTiming(cmd, durationNs);
+        if (!m_views.empty()) {
+            wakeViewsFor(cmd);
+        }
+    }
+
+    // Phase G.2: Clear the cancellation token; a cancelled request gets
+    // its single RequestCancelled message in place of the result.
+    bool cancelled = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inFlight = nullptr;
+        cancelled = cmd.requestID != 0 &&
+                    m_cancelledRequestID.exchange(0) == cmd.requestID;
+        std::lock_guard<std::mutex> replyLock(m_messageMutex);
+        m_inFlightReplyID = 0;
+    }
+    if (cancelled) {
+        LOGI("CommandServer: In-flight request cancelled (requestID=%lld)",
+             static_cast<long long>(cmd.requestID));
+        enqueueMessage(Message(MessageType::RequestCancelled, cmd.requestID));
+    }
+    return true;
+}
+
+bool CommandServer::hasPendingCommands() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return !m_commandQueue.empty();
+}
+
+bool CommandServer::isWorkerThread() const
+{
+    if (m_host != nullptr) {
+        return m_host->isWorkerThread();
+    }
+    return std::this_thread::get_id() == m_thread.get_id();
+}
+
+void CommandServer::setHostWeight(uint32_t weight)
+{
+    if (m_host != nullptr) {
+        m_host->setWeight(this, weight);
+    }
+}
+
 void CommandServer::executeCommand(const Command& cmd)
 {
     switch (cmd.type) {
@@ -474,6 +624,40 @@ void CommandServer::executeCommand(const Command& cmd)
             }
             break;
 
+        // Phase G.5: Scheduled inputs
+        case CommandType::ScheduleInput:
+            handleScheduleInput(cmd);
+            break;
+
+        case CommandType::CancelScheduledInput:
+            handleCancelScheduledInput(cmd);
+            break;
+
+        case CommandType::AttachSharedFile:
+            handleAttachSharedFile(cmd);
+            break;
+
+        // Phase G.11: Registered views
+        case CommandType::RegisterView:
+            handleRegisterView(cmd);
+            break;
+
+        case CommandType::UnregisterView:
+            handleUnregisterView(cmd);
+            break;
+
+        case CommandType::FrameTick:
+            handleFrameTick(cmd);
+            break;
+
+        case CommandType::CreateVMIBatch:
+            handleCreateVMIBatch(cmd);
+            break;
+
+        case CommandType::SetEventFilter:
+            handleSetEventFilter(cmd);
+            break;
+
         default:
             LOGW("CommandServer: Unknown command type: %d",
                  static_cast<int>(cmd.type));
@@ -513,6 +697,17 @@ void CommandServer::enqueueMessage(Message msg)
 {
     {
         std::lock_guard<std::mutex> lock(m_messageMutex);
+        if (msg.requestID != 0 && msg.type != MessageType::RequestCancelled) {
+            // Phase G.2: Results of a cancelled in-flight request are
+            // discarded; once a result is posted the request can no longer
+            // be cancelled (see cancelInFlightLocked()).
+            if (msg.requestID == m_cancelledRequestID.load()) {
+                return;
+            }
+            if (msg.requestID == m_inFlightReplyID) {
+                m_inFlightReplied = true;
+            }
+        }
         m_messageQueue.push(std::move(msg));
     }
     // Note: We don't notify here because pollMessages is called from Kotlin
@@ -0,0 +1,258 @@
+#include "command_server.hpp"
+#include "rive_log.hpp"
+#include "rive_trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace rive_android {
+
+int64_t steadyClockNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const char* commandTypeName(CommandType type)
+{
+    switch (type) {
+        case CommandType::None: return "None";
+        case CommandType::Stop: return "Stop";
+        case CommandType::LoadFile: return "LoadFile";
+        case CommandType::DeleteFile: return "DeleteFile";
+        case CommandType::GetArtboardNames: return "GetArtboardNames";
+        case CommandType::GetStateMachineNames: return "GetStateMachineNames";
+        case CommandType::GetViewModelNames: return "GetViewModelNames";
+        case CommandType::GetViewModelInstanceNames: return "GetViewModelInstanceNames";
+        case CommandType::GetViewModelProperties: return "GetViewModelProperties";
+        case CommandType::GetEnums: return "GetEnums";
+        case CommandType::CreateDefaultArtboard: return "CreateDefaultArtboard";
+        case CommandType::CreateArtboardByName: return "CreateArtboardByName";
+        case CommandType::DeleteArtboard: return "DeleteArtboard";
+        case CommandType::ResizeArtboard: return "ResizeArtboard";
+        case CommandType::ResetArtboardSize: return "ResetArtboardSize";
+        case CommandType::CreateDefaultStateMachine: return "CreateDefaultStateMachine";
+        case CommandType::CreateStateMachineByName: return "CreateStateMachineByName";
+        case CommandType::AdvanceStateMachine: return "AdvanceStateMachine";
+        case CommandType::DeleteStateMachine: return "DeleteStateMachine";
+        case CommandType::GetInputCount: return "GetInputCount";
+        case CommandType::GetInputNames: return "GetInputNames";
+        case CommandType::GetInputInfo: return "GetInputInfo";
+        case CommandType::GetNumberInput: return "GetNumberInput";
+        case CommandType::SetNumberInput: return "SetNumberInput";
+        case CommandType::GetBooleanInput: return "GetBooleanInput";
+        case CommandType::SetBooleanInput: return "SetBooleanInput";
+        case CommandType::FireTrigger: return "FireTrigger";
+        case CommandType::GetReportedEventCount: return "GetReportedEventCount";
+        case CommandType::GetReportedEventAt: return "GetReportedEventAt";
+        case CommandType::CreateBlankVMI: return "CreateBlankVMI";
+        case CommandType::CreateDefaultVMI: return "CreateDefaultVMI";
+        case CommandType::CreateNamedVMI: return "CreateNamedVMI";
+        case CommandType::DeleteVMI: return "DeleteVMI";
+        case CommandType::GetNumberProperty: return "GetNumberProperty";
+        case CommandType::SetNumberProperty: return "SetNumberProperty";
+        case CommandType::GetStringProperty: return "GetStringProperty";
+        case CommandType::SetStringProperty: return "SetStringProperty";
+        case CommandType::GetBooleanProperty: return "GetBooleanProperty";
+        case CommandType::SetBooleanProperty: return "SetBooleanProperty";
+        case CommandType::GetEnumProperty: return "GetEnumProperty";
+        case CommandType::SetEnumProperty: return "SetEnumProperty";
+        case CommandType::GetColorProperty: return "GetColorProperty";
+        case CommandType::SetColorProperty: return "SetColorProperty";
+        case CommandType::FireTriggerProperty: return "FireTriggerProperty";
+        case CommandType::SubscribeToProperty: return "SubscribeToProperty";
+        case CommandType::UnsubscribeFromProperty: return "UnsubscribeFromProperty";
+        case CommandType::GetListSize: return "GetListSize";
+        case CommandType::GetListItem: return "GetListItem";
+        case CommandType::AddListItem: return "AddListItem";
+        case CommandType::AddListItemAt: return "AddListItemAt";
+        case CommandType::RemoveListItem: return "RemoveListItem";
+        case CommandType::RemoveListItemAt: return "RemoveListItemAt";
+        case CommandType::SwapListItems: return "SwapListItems";
+        case CommandType::GetInstanceProperty: return "GetInstanceProperty";
+        case CommandType::SetInstanceProperty: return "SetInstanceProperty";
+        case CommandType::SetImageProperty: return "SetImageProperty";
+        case CommandType::SetArtboardProperty: return "SetArtboardProperty";
+        case CommandType::BindViewModelInstance: return "BindViewModelInstance";
+        case CommandType::GetDefaultVMI: return "GetDefaultVMI";
+        case CommandType::CreateRenderTarget: return "CreateRenderTarget";
+        case CommandType::DeleteRenderTarget: return "DeleteRenderTarget";
+        case CommandType::Draw: return "Draw";
+        case CommandType::PointerMove: return "PointerMove";
+        case CommandType::PointerDown: return "PointerDown";
+        case CommandType::PointerUp: return "PointerUp";
+        case CommandType::PointerExit: return "PointerExit";
+        case CommandType::DecodeImage: return "DecodeImage";
+        case CommandType::DeleteImage: return "DeleteImage";
+        case CommandType::RegisterImage: return "RegisterImage";
+        case CommandType::UnregisterImage: return "UnregisterImage";
+        case CommandType::DecodeAudio: return "DecodeAudio";
+        case CommandType::DeleteAudio: return "DeleteAudio";
+        case CommandType::RegisterAudio: return "RegisterAudio";
+        case CommandType::UnregisterAudio: return "UnregisterAudio";
+        case CommandType::DecodeFont: return "DecodeFont";
+        case CommandType::DeleteFont: return "DeleteFont";
+        case CommandType::RegisterFont: return "RegisterFont";
+        case CommandType::UnregisterFont: return "UnregisterFont";
+        case CommandType::RunOnce: return "RunOnce";
+        case CommandType::ScheduleInput: return "ScheduleInput";
+        case CommandType::CancelScheduledInput: return "CancelScheduledInput";
+        case CommandType::AttachSharedFile: return "AttachSharedFile";
+        case CommandType::RegisterView: return "RegisterView";
+        case CommandType::UnregisterView: return "UnregisterView";
+        case CommandType::FrameTick: return "FrameTick";
+        case CommandType::CreateVMIBatch: return "CreateVMIBatch";
+        case CommandType::SetEventFilter: return "SetEventFilter";
+    }
+    return "Unknown";
+}
+
+// =============================================================================
+// Phase G.3: Stall Watchdog
+// =============================================================================
+
+int64_t CommandServer::beginCommandTiming(const Command& cmd)
+{
+    const int64_t startNs = steadyClockNowNs();
+    m_currentCommandType.store(static_cast<int32_t>(cmd.type), std::memory_order_relaxed);
+    m_currentRequestID.store(cmd.requestID, std::memory_order_relaxed);
+    m_currentStartNs.store(startNs, std::memory_order_relaxed);
+    m_commandSequence.fetch_add(1, std::memory_order_release);
+    return startNs;
+}
+
+void CommandServer::endCommandTiming(const Command& cmd, int64_t startNs)
+{
+    m_currentStartNs.store(0, std::memory_order_relaxed);
+
+    const int64_t thresholdNs = m_slowThresholdNs.load(std::memory_order_relaxed);
+    const int64_t durationNs = steadyClockNowNs() - startNs;
+    if (thresholdNs <= 0 || durationNs < thresholdNs) {
+        return;
+    }
+
+    LOGW("CommandServer: Slow command %s (requestID=%lld) took %.1f ms",
+         commandTypeName(cmd.type), static_cast<long long>(cmd.requestID),
+         static_cast<double>(durationNs) / 1e6);
+
+    SlowCommandRecord record;
+    record.sequence = m_commandSequence.load(std::memory_order_relaxed);
+    record.type = cmd.type;
+    record.requestID = cmd.requestID;
+    record.startTimeNs = startNs;
+    record.durationNs = durationNs;
+    record.stalled = false;
+
+    std::lock_guard<std::mutex> lock(m_watchdogMutex);
+    recordSlowCommandLocked(record);
+}
+
+void CommandServer::recordSlowCommandLocked(const SlowCommandRecord& record)
+{
+    // A stall flagged by the watchdog is completed in place by the worker.
+    for (auto& existing : m_slowCommands) {
+        if (existing.sequence == record.sequence && existing.type == record.type &&
+            existing.startTimeNs == record.startTimeNs) {
+            existing = record;
+            return;
+        }
+    }
+    m_slowCommands[m_slowCommandNext] = record;
+    m_slowCommandNext = (m_slowCommandNext + 1) % kSlowCommandRingSize;
+    m_slowCommandCount++;
+}
+
+void CommandServer::watchdogLoop()
+{
+    LOGI("CommandServer: Watchdog thread started");
+
+    std::unique_lock<std::mutex> lock(m_watchdogMutex);
+    uint64_t flaggedSequence = 0;
+    while (!m_watchdogStop) {
+        const int64_t thresholdNs = m_slowThresholdNs.load(std::memory_order_relaxed);
+        if (thresholdNs <= 0) {
+            // Disabled: sleep until re-enabled or stopped.
+            m_watchdogCv.wait(lock, [this] {
+                return m_watchdogStop || m_slowThresholdNs.load(std::memory_order_relaxed) > 0;
+            });
+            continue;
+        }
+
+        const auto interval = std::chrono::nanoseconds(
+            std::max<int64_t>(thresholdNs / 2, 1000000LL));
+        if (m_watchdogCv.wait_for(lock, interval, [this] { return m_watchdogStop; })) {
+            break;
+        }
+
+        // Sample the in-flight command; retry next tick if the worker moved on mid-read.
+        const uint64_t sequence = m_commandSequence.load(std::memory_order_acquire);
+        const int64_t startNs = m_currentStartNs.load(std::memory_order_relaxed);
+        const auto type = static_cast<CommandType>(
+            m_currentCommandType.load(std::memory_order_relaxed));
+        const int64_t requestID = m_currentRequestID.load(std::memory_order_relaxed);
+        if (startNs == 0 || sequence == flaggedSequence ||
+            m_commandSequence.load(std::memory_order_acquire) != sequence) {
+            continue;
+        }
+
+        const int64_t elapsedNs = steadyClockNowNs() - startNs;
+        if (elapsedNs < thresholdNs) {
+            continue;
+        }
+        flaggedSequence = sequence;
+
+        LOGW("CommandServer: Watchdog - %s (requestID=%lld) running for %.1f ms",
+             commandTypeName(type), static_cast<long long>(requestID),
+             static_cast<double>(elapsedNs) / 1e6);
+
+        if (rive_mp::RiveTraceIsEnabled()) {
+            char section[96];
+            snprintf(section, sizeof(section), "Rive stall: %s (%lld ms)",
+                     commandTypeName(type), static_cast<long long>(elapsedNs / 1000000));
+            rive_mp::RiveTraceBeginSection(section);
+            rive_mp::RiveTraceEndSection();
+        }
+
+        SlowCommandRecord record;
+        record.sequence = sequence;
+        record.type = type;
+        record.requestID = requestID;
+        record.startTimeNs = startNs;
+        record.durationNs = elapsedNs;
+        record.stalled = true;
+        recordSlowCommandLocked(record);
+    }
+
+    LOGI("CommandServer: Watchdog thread stopped");
+}
+
+void CommandServer::setSlowCommandThreshold(int64_t thresholdMs)
+{
+    LOGI("CommandServer: Setting slow command threshold to %lld ms",
+         static_cast<long long>(thresholdMs));
+    m_slowThresholdNs.store(std::max<int64_t>(thresholdMs, 0) * 1000000LL);
+    m_watchdogCv.notify_all();
+}
+
+std::vector<SlowCommandRecord> CommandServer::getSlowCommands() const
+{
+    std::lock_guard<std::mutex> lock(m_watchdogMutex);
+    std::vector<SlowCommandRecord> records;
+    const size_t count = static_cast<size_t>(
+        std::min<uint64_t>(m_slowCommandCount, kSlowCommandRingSize));
+    records.reserve(count);
+    // m_slowCommandNext is the oldest entry once the ring has wrapped.
+    const size_t first = (m_slowCommandCount > kSlowCommandRingSize) ? m_slowCommandNext : 0;
+    for (size_t i = 0; i < count; ++i) {
+        records.push_back(m_slowCommands[(first + i) % kSlowCommandRingSize]);
+    }
+    return records;
+}
+
+uint64_t CommandServer::getSlowCommandCount() const
+{
+    std::lock_guard<std::mutex> lock(m_watchdogMutex);
+    return m_slowCommandCount;
+}
+
+} // namespace rive_android
@@ -1,6 +1,7 @@
 #include "command_server.hpp"
 #include "render_context.hpp"
 #include "rive_log.hpp"
+#include "riv_slicer.hpp"
 #include "rive/viewmodel/viewmodel.hpp"
 #include "rive/viewmodel/viewmodel_property.hpp"
 #include "rive/viewmodel/data_enum.hpp"
@@ -19,6 +20,20 @@ void CommandServer::loadFile(int64_t requestID, const std::vector<uint8_t>& byte
     enqueueCommand(std::move(cmd));
 }
 
+void CommandServer::loadFile(int64_t requestID,
+                             const std::vector<uint8_t>& bytes,
+                             std::vector<std::string> artboardNames)
+{
+    LOGI("CommandServer: Enqueuing LoadFile command (requestID=%lld, size=%zu, artboards=%zu)",
+         static_cast<long long>(requestID), bytes.size(), artboardNames.size());
+    
+    Command cmd(CommandType::LoadFile, requestID);
+    cmd.bytes = bytes;
+    cmd.artboardNames = std::move(artboardNames);
+    
+    enqueueCommand(std::move(cmd));
+}
+
 void CommandServer::deleteFile(int64_t requestID, int64_t fileHandle)
 {
     LOGI("CommandServer: Enqueuing DeleteFile command (requestID=%lld, handle=%lld)",
@@ -30,11 +45,19 @@ void CommandServer::deleteFile(int64_t requestID, int64_t fileHandle)
     enqueueCommand(std::move(cmd));
 }
 
-void CommandServer::handleLoadFile(const Command& cmd)
+void CommandServer::attachSharedFile(int64_t requestID, uint64_t contentKey)
 {
-    LOGI("CommandServer: Handling LoadFile command (requestID=%lld, size=%zu)",
-         static_cast<long long>(cmd.requestID), cmd.bytes.size());
+    LOGI("CommandServer: Enqueuing AttachSharedFile command (requestID=%lld, key=%llx)",
+         static_cast<long long>(requestID), static_cast<unsigned long long>(contentKey));
+    
+    Command cmd(CommandType::AttachSharedFile, requestID);
+    cmd.contentKey = contentKey;
+    
+    enqueueCommand(std::move(cmd));
+}
 
+rive::Factory* CommandServer::importFactory()
+{
     // Get the factory for creating GPU-accelerated render objects.
     // 
     // IMPORTANT: The factory determines how render objects (paths, paints, images)
@@ -46,7 +69,13 @@ void CommandServer::handleLoadFile(const Command& cmd)
     rive::Factory* factory = nullptr;
     if (m_renderContext != nullptr) {
         auto* renderContext = static_cast<rive_mp::RenderContext*>(m_renderContext);
-        factory = renderContext->getFactory();
+        // Phase G.13: Defer GPU objects until an artboard is drawn
+        if (m_lazyGpuResources.load(std::memory_order_relaxed)) {
+            factory = renderContext->getDeferredFactory();
+        }
+        if (factory == nullptr) {
+            factory = renderContext->getFactory();
+        }
         if (factory != nullptr) {
             LOGI("CommandServer: Using GPU factory from RenderContext");
         }
@@ -54,25 +83,103 @@ void CommandServer::handleLoadFile(const Command& cmd)
     if (factory == nullptr) {
         // Fallback to NoOpFactory for tests or when no render context is available.
         // Note: Files loaded with NoOpFactory will NOT render visible content!
+        // Phase G.9: The NoOpFactory is process-wide so headless servers can
+        // share their files.
         LOGW("CommandServer: No GPU factory available, using NoOpFactory (content will not render)");
-        if (!m_noOpFactory) {
-            m_noOpFactory = std::make_unique<rive::NoOpFactory>();
+        factory = SharedFileRegistry::headlessFactory();
+    }
+    return factory;
+}
+
+rive_mp::DeferredFactory::Stats CommandServer::lazyGpuResourceStats() const
+{
+    if (m_renderContext == nullptr) {
+        return {};
+    }
+    auto* renderContext = static_cast<rive_mp::RenderContext*>(m_renderContext);
+    rive_mp::DeferredFactory* factory = renderContext->deferredFactoryIfCreated();
+    return factory != nullptr ? factory->stats() : rive_mp::DeferredFactory::Stats{};
+}
+
+void CommandServer::handleLoadFile(const Command& cmd)
+{
+    LOGI("CommandServer: Handling LoadFile command (requestID=%lld, size=%zu)",
+         static_cast<long long>(cmd.requestID), cmd.bytes.size());
+
+    rive::Factory* factory = importFactory();
+
+    // Phase G.2: Skip the import entirely if the caller already gave up
+    if (isCancelled(cmd)) {
+        return;
+    }
+
+    // Phase G.14: Cut the file down to the requested artboards. Slicing is a
+    // single pass over the bytes, far cheaper than importing what is dropped.
+    rive::Span<const uint8_t> bytes(cmd.bytes.data(), cmd.bytes.size());
+    std::vector<uint8_t> slicedBytes;
+    if (!cmd.artboardNames.empty()) {
+        rive_mp::RivSliceStats sliceStats;
+        std::string sliceError;
+        if (!rive_mp::SliceRivArtboards(cmd.bytes.data(), cmd.bytes.size(), cmd.artboardNames,
+                                        slicedBytes, sliceStats, sliceError)) {
+            LOGE("CommandServer: Failed to select artboards: %s", sliceError.c_str());
+            
+            Message msg(MessageType::FileError, cmd.requestID);
+            msg.error = sliceError;
+            enqueueMessage(std::move(msg));
+            return;
         }
-        factory = m_noOpFactory.get();
+        bytes = rive::Span<const uint8_t>(slicedBytes.data(), slicedBytes.size());
+    }
+
+    // Phase G.9: Reuse the file if any server already imported these bytes
+    // with the same factory. A slice is shared under its own content.
+    auto& registry = SharedFileRegistry::instance();
+    const SharedFileRegistry::Key key{factory, contentHash(bytes.data(), bytes.size())};
+    rive::rcp<rive::File> file = registry.acquire(key, bytes.size());
+    if (file) {
+        int64_t handle = m_nextHandle.fetch_add(1);
+        m_files[handle] = file;
+        m_sharedFileKeys[handle] = key;
+        m_sharedFileMutexes[handle] = registry.fileMutex(key);
+        
+        LOGI("CommandServer: Attached shared file (handle=%lld)", static_cast<long long>(handle));
+        
+        Message msg(MessageType::FileLoaded, cmd.requestID);
+        msg.handle = handle;
+        enqueueMessage(std::move(msg));
+        return;
     }
 
     // Import the Rive file
-    auto file = rive::File::import(
-        rive::Span<const uint8_t>(cmd.bytes.data(), cmd.bytes.size()),
+    file = rive::File::import(
+        bytes,
         factory,
         nullptr,  // ImportResult
         nullptr   // No asset loader for now (Phase E)
     );
     
+    // The import itself can't be interrupted; drop the result instead of
+    // registering a file nobody will delete.
+    if (isCancelled(cmd)) {
+        LOGI("CommandServer: Discarding imported file for cancelled request (requestID=%lld)",
+             static_cast<long long>(cmd.requestID));
+        return;
+    }
+
     if (file) {
         // Generate a unique handle
         int64_t handle = m_nextHandle.fetch_add(1);
         
+        // Phase G.9: Register the file for other servers. If another server
+        // won the race, use its file; on a hash collision keep ours private.
+        auto shared = registry.publish(key, bytes.size(), file);
+        if (shared) {
+            file = shared;
+            m_sharedFileKeys[handle] = key;
+            m_sharedFileMutexes[handle] = registry.fileMutex(key);
+        }
+        
         // Store the file
         m_files[handle] = file;
         
@@ -102,6 +209,23 @@ void CommandServer::handleDeleteFile(const Command& cmd)
     if (it != m_files.end()) {
         m_files.erase(it);
         
+        // Phase G.9: Drop this handle's reference to the shared file
+        auto keyIt = m_sharedFileKeys.find(cmd.handle);
+        if (keyIt != m_sharedFileKeys.end()) {
+            SharedFileRegistry::instance().release(keyIt->second);
+            m_sharedFileKeys.erase(keyIt);
+            m_sharedFileMutexes.erase(cmd.handle);
+        }
+        
+        // Phase G.15: Instances of the file's batches can no longer be created
+        for (auto batchIt = m_vmiBatches.begin(); batchIt != m_vmiBatches.end();) {
+            if (batchIt->second.fileHandle == cmd.handle) {
+                batchIt = m_vmiBatches.erase(batchIt);
+            } else {
+                ++batchIt;
+            }
+        }
+        
         LOGI("CommandServer: File deleted successfully (handle=%lld)", 
              static_cast<long long>(cmd.handle));
         
@@ -120,6 +244,42 @@ void CommandServer::handleDeleteFile(const Command& cmd)
     }
 }
 
+void CommandServer::handleAttachSharedFile(const Command& cmd)
+{
+    LOGI("CommandServer: Handling AttachSharedFile command (requestID=%lld, key=%llx)",
+         static_cast<long long>(cmd.requestID), static_cast<unsigned long long>(cmd.contentKey));
+    
+    const SharedFileRegistry::Key key{importFactory(), cmd.contentKey};
+    auto file = SharedFileRegistry::instance().acquire(key, 0);
+    if (!file) {
+        LOGW("CommandServer: No shared file with key %llx",
+             static_cast<unsigned long long>(cmd.contentKey));
+        
+        Message msg(MessageType::FileError, cmd.requestID);
+        msg.error = "No shared file with this key";
+        enqueueMessage(std::move(msg));
+        return;
+    }
+    
+    int64_t handle = m_nextHandle.fetch_add(1);
+    m_files[handle] = file;
+    m_sharedFileKeys[handle] = key;
+    m_sharedFileMutexes[handle] = SharedFileRegistry::instance().fileMutex(key);
+    
+    Message msg(MessageType::FileLoaded, cmd.requestID);
+    msg.handle = handle;
+    enqueueMessage(std::move(msg));
+}
+
+std::unique_lock<std::mutex> CommandServer::lockSharedFile(int64_t fileHandle)
+{
+    auto it = m_sharedFileMutexes.find(fileHandle);
+    if (it == m_sharedFileMutexes.end() || !it->second) {
+        return {};
+    }
+    return std::unique_lock<std::mutex>(*it->second);
+}
+
 void CommandServer::getArtboardNames(int64_t requestID, int64_t fileHandle)
 {
     LOGI("CommandServer: Enqueuing GetArtboardNames command (requestID=%lld, fileHandle=%lld)",
@@ -0,0 +1,171 @@
+#include "command_server_host.hpp"
+#include "command_server.hpp"
+#include "render_context.hpp"
+#include "rive_log.hpp"
+#include <algorithm>
+
+namespace rive_android {
+
+CommandServerHost::CommandServerHost(void* renderContext)
+    : m_renderContext(renderContext)
+{
+    LOGI("CommandServerHost: Starting worker thread");
+    m_thread = std::thread(&CommandServerHost::hostLoop, this);
+}
+
+CommandServerHost::~CommandServerHost()
+{
+    LOGI("CommandServerHost: Stopping worker thread");
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_servers.empty()) {
+            LOGE("CommandServerHost: Destroyed with %zu servers attached", m_servers.size());
+        }
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+void CommandServerHost::attach(CommandServer* server, uint32_t weight)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    HostedServer hosted;
+    hosted.server = server;
+    hosted.weight = std::max<uint32_t>(weight, 1);
+    m_servers.push_back(hosted);
+    LOGI("CommandServerHost: Attached server (weight=%u, servers=%zu)",
+         hosted.weight, m_servers.size());
+}
+
+void CommandServerHost::detach(CommandServer* server)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto isServer = [server](const HostedServer& hosted) { return hosted.server == server; };
+    auto it = std::find_if(m_servers.begin(), m_servers.end(), isServer);
+    if (it == m_servers.end()) {
+        return;
+    }
+    if (m_stop) {
+        // The worker is gone; nothing left to drain.
+        m_servers.erase(it);
+        return;
+    }
+
+    // The worker removes the server once its queue is empty, so commands
+    // enqueued before the detach still run, as with a dedicated thread.
+    it->detaching = true;
+    m_wakeups++;
+    m_cv.notify_one();
+    m_detachCv.wait(lock, [this, &isServer] {
+        return std::none_of(m_servers.begin(), m_servers.end(), isServer);
+    });
+    LOGI("CommandServerHost: Detached server (servers=%zu)", m_servers.size());
+}
+
+void CommandServerHost::setWeight(CommandServer* server, uint32_t weight)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& hosted : m_servers) {
+        if (hosted.server == server) {
+            hosted.weight = std::max<uint32_t>(weight, 1);
+        }
+    }
+}
+
+void CommandServerHost::notifyWork()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_wakeups++;
+    }
+    m_cv.notify_one();
+}
+
+size_t CommandServerHost::serverCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_servers.size();
+}
+
+void CommandServerHost::hostLoop()
+{
+    LOGI("CommandServerHost: Worker thread started");
+
+    // Same thread-affinity rule as a dedicated CommandServer: the context is
+    // created, used and destroyed on this thread only.
+    auto* renderContext = static_cast<rive_mp::RenderContext*>(m_renderContext);
+    if (renderContext != nullptr) {
+        auto result = renderContext->initialize();
+        if (!result.success) {
+            LOGE("CommandServerHost: Failed to initialize RenderContext: %s (error code: %d)",
+                 result.message.c_str(), result.errorCode);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv.wait(lock, [this] { return m_wakeups > 0 || m_stop; });
+        if (m_stop) {
+            break;
+        }
+        m_wakeups = 0;
+
+        // Keep going while any server has work; wakeups that arrive
+        // meanwhile are absorbed by the next wait check.
+        lock.unlock();
+        while (runRound()) {
+        }
+        lock.lock();
+    }
+    lock.unlock();
+
+    if (renderContext != nullptr) {
+        LOGI("CommandServerHost: Destroying RenderContext");
+        renderContext->destroy();
+    }
+
+    LOGI("CommandServerHost: Worker thread stopped");
+}
+
+bool CommandServerHost::runRound()
+{
+    // Servers only leave m_servers on this thread, so the snapshot stays valid
+    // for the whole round.
+    std::vector<HostedServer> round;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_servers.empty()) {
+            return false;
+        }
+        const size_t first = m_nextServer % m_servers.size();
+        m_nextServer = first + 1;
+        round.reserve(m_servers.size());
+        for (size_t i = 0; i < m_servers.size(); ++i) {
+            round.push_back(m_servers[(first + i) % m_servers.size()]);
+        }
+    }
+
+    bool ranAny = false;
+    for (const auto& hosted : round) {
+        for (uint32_t i = 0; i < hosted.weight; ++i) {
+            if (!hosted.server->runNextCommand()) {
+                break;
+            }
+            ranAny = true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = std::find_if(m_servers.begin(), m_servers.end(),
+                               [&hosted](const HostedServer& s) { return s.server == hosted.server; });
+        if (it != m_servers.end() && it->detaching && !hosted.server->hasPendingCommands()) {
+            m_servers.erase(it);
+            m_detachCv.notify_all();
+        }
+    }
+    return ranAny;
+}
+
+} // namespace rive_android
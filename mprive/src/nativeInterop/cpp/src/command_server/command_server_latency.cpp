@@ -0,0 +1,149 @@
+#include "command_server.hpp"
+#include "rive_log.hpp"
+#include <algorithm>
+
+namespace rive_android {
+
+namespace {
+
+// Inputs kept per state machine while waiting for a frame. A state machine
+// that is fed input but never drawn must not grow without bound.
+constexpr size_t kMaxPendingInputsPerStateMachine = 128;
+
+} // namespace
+
+// =============================================================================
+// Phase G.4: Input-to-Present Latency - Worker Thread
+// =============================================================================
+
+void CommandServer::noteCommandExecuted(const Command& cmd, int64_t durationNs)
+{
+    InputEventKind kind;
+    if (inputEventKindOf(cmd.type, kind)) {
+        if (m_stateMachines.find(cmd.handle) == m_stateMachines.end()) {
+            return;
+        }
+        auto& pending = m_pendingInputs[cmd.handle];
+        if (pending.size() >= kMaxPendingInputsPerStateMachine) {
+            pending.erase(pending.begin());
+        }
+        PendingInput input;
+        input.kind = kind;
+        input.clientTimeNs = cmd.clientTimeNs;
+        pending.push_back(input);
+        return;
+    }
+
+    switch (cmd.type) {
+        case CommandType::AdvanceStateMachine: {
+            m_frameAdvanceNs[cmd.handle] += durationNs;
+            auto it = m_pendingInputs.find(cmd.handle);
+            if (it != m_pendingInputs.end()) {
+                for (auto& input : it->second) {
+                    input.advanced = true;
+                }
+            }
+            break;
+        }
+        case CommandType::DeleteStateMachine:
+            m_pendingInputs.erase(cmd.handle);
+            m_frameAdvanceNs.erase(cmd.handle);
+            break;
+        default:
+            break;
+    }
+}
+
+int64_t CommandServer::takeFrameAdvanceNs(int64_t smHandle)
+{
+    auto it = m_frameAdvanceNs.find(smHandle);
+    if (it == m_frameAdvanceNs.end()) {
+        return 0;
+    }
+    const int64_t advanceNs = it->second;
+    it->second = 0;
+    return advanceNs;
+}
+
+void CommandServer::notePresented(int64_t smHandle, int64_t presentedNs)
+{
+    auto it = m_pendingInputs.find(smHandle);
+    if (it == m_pendingInputs.end() || it->second.empty()) {
+        return;
+    }
+
+    auto& pending = it->second;
+    {
+        std::lock_guard<std::mutex> lock(m_latencyMutex);
+        for (const auto& input : pending) {
+            if (!input.advanced) {
+                continue;
+            }
+            const auto idx = static_cast<size_t>(input.kind);
+            // Clamp in case the client clock is ahead of ours.
+            const int64_t latencyNs = std::max<int64_t>(presentedNs - input.clientTimeNs, 0);
+            m_latencySamples[idx][m_latencySampleNext[idx]] = latencyNs;
+            m_latencySampleNext[idx] = (m_latencySampleNext[idx] + 1) % kLatencySampleCount;
+            m_latencyCount[idx]++;
+        }
+    }
+
+    // Inputs applied after the last advance wait for the next frame.
+    pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                 [](const PendingInput& input) { return input.advanced; }),
+                  pending.end());
+}
+
+// =============================================================================
+// Phase G.4: Input-to-Present Latency - Public API
+// =============================================================================
+
+LatencyStats CommandServer::getInputLatencyStats(InputEventKind kind) const
+{
+    const auto idx = static_cast<size_t>(kind);
+    LatencyStats stats;
+    if (idx >= kInputEventKindCount) {
+        return stats;
+    }
+
+    std::vector<int64_t> samples;
+    {
+        std::lock_guard<std::mutex> lock(m_latencyMutex);
+        stats.count = m_latencyCount[idx];
+        const size_t n = static_cast<size_t>(
+            std::min<uint64_t>(m_latencyCount[idx], kLatencySampleCount));
+        samples.assign(m_latencySamples[idx], m_latencySamples[idx] + n);
+    }
+    if (samples.empty()) {
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](size_t p) {
+        return samples[(samples.size() - 1) * p / 100];
+    };
+    stats.minNs = samples.front();
+    stats.p50Ns = percentile(50);
+    stats.p90Ns = percentile(90);
+    stats.p99Ns = percentile(99);
+    stats.maxNs = samples.back();
+    return stats;
+}
+
+void CommandServer::resetInputLatencyStats()
+{
+    LOGI("CommandServer: Resetting input latency stats");
+    std::lock_guard<std::mutex> lock(m_latencyMutex);
+    for (size_t i = 0; i < kInputEventKindCount; ++i) {
+        m_latencySampleNext[i] = 0;
+        m_latencyCount[i] = 0;
+    }
+}
+
+void CommandServer::setFrameTimingEnabled(bool enabled)
+{
+    LOGI("CommandServer: %s frame timing", enabled ? "Enabling" : "Disabling");
+    m_frameTimingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+} // namespace rive_android
@@ -121,7 +121,7 @@ void CommandServer::setArtboardProperty(int64_t requestID, int64_t vmiHandle, co
 
 void CommandServer::handleGetListSize(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -144,7 +144,7 @@ void CommandServer::handleGetListSize(const Command& cmd)
 
 void CommandServer::handleGetListItem(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -186,7 +186,7 @@ void CommandServer::handleGetListItem(const Command& cmd)
 
 void CommandServer::handleAddListItem(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -202,7 +202,7 @@ void CommandServer::handleAddListItem(const Command& cmd)
         return;
     }
 
-    auto itemIt = m_viewModelInstances.find(cmd.itemHandle);
+    auto itemIt = findVMI(cmd.itemHandle);
     if (itemIt == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid item ViewModelInstance handle";
@@ -218,7 +218,7 @@ void CommandServer::handleAddListItem(const Command& cmd)
 
 void CommandServer::handleAddListItemAt(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -234,7 +234,7 @@ void CommandServer::handleAddListItemAt(const Command& cmd)
         return;
     }
 
-    auto itemIt = m_viewModelInstances.find(cmd.itemHandle);
+    auto itemIt = findVMI(cmd.itemHandle);
     if (itemIt == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid item ViewModelInstance handle";
@@ -256,7 +256,7 @@ void CommandServer::handleAddListItemAt(const Command& cmd)
 
 void CommandServer::handleRemoveListItem(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -272,7 +272,7 @@ void CommandServer::handleRemoveListItem(const Command& cmd)
         return;
     }
 
-    auto itemIt = m_viewModelInstances.find(cmd.itemHandle);
+    auto itemIt = findVMI(cmd.itemHandle);
     if (itemIt == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid item ViewModelInstance handle";
@@ -288,7 +288,7 @@ void CommandServer::handleRemoveListItem(const Command& cmd)
 
 void CommandServer::handleRemoveListItemAt(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -319,7 +319,7 @@ void CommandServer::handleRemoveListItemAt(const Command& cmd)
 
 void CommandServer::handleSwapListItems(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::ListOperationError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -356,7 +356,7 @@ void CommandServer::handleSwapListItems(const Command& cmd)
 
 void CommandServer::handleGetInstanceProperty(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::InstancePropertyError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -383,7 +383,7 @@ void CommandServer::handleGetInstanceProperty(const Command& cmd)
 
 void CommandServer::handleSetInstanceProperty(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::InstancePropertyError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -391,7 +391,7 @@ void CommandServer::handleSetInstanceProperty(const Command& cmd)
         return;
     }
 
-    auto nestedIt = m_viewModelInstances.find(cmd.nestedHandle);
+    auto nestedIt = findVMI(cmd.nestedHandle);
     if (nestedIt == m_viewModelInstances.end()) {
         Message msg(MessageType::InstancePropertyError, cmd.requestID);
         msg.error = "Invalid nested ViewModelInstance handle";
@@ -417,7 +417,7 @@ void CommandServer::handleSetInstanceProperty(const Command& cmd)
 
 void CommandServer::handleSetImageProperty(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::AssetPropertyError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -451,7 +451,7 @@ void CommandServer::handleSetImageProperty(const Command& cmd)
 
 void CommandServer::handleSetArtboardProperty(const Command& cmd)
 {
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         Message msg(MessageType::AssetPropertyError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -56,7 +56,7 @@ static rive::Alignment getAlignmentFromOrdinalPointer(int32_t ordinal)
 
 void CommandServer::pointerMove(int64_t smHandle, int8_t fit, int8_t alignment,
                                  float layoutScale, float surfaceWidth, float surfaceHeight,
-                                 int32_t pointerID, float x, float y)
+                                 int32_t pointerID, float x, float y, int64_t clientTimeNs)
 {
     LOGI("CommandServer: Enqueuing PointerMove (smHandle=%lld, x=%f, y=%f)",
          static_cast<long long>(smHandle), x, y);
@@ -71,13 +71,14 @@ void CommandServer::pointerMove(int64_t smHandle, int8_t fit, int8_t alignment,
     cmd.pointerID = pointerID;
     cmd.pointerX = x;
     cmd.pointerY = y;
+    cmd.clientTimeNs = clientTimeNs;
 
     enqueueCommand(std::move(cmd));
 }
 
 void CommandServer::pointerDown(int64_t smHandle, int8_t fit, int8_t alignment,
                                  float layoutScale, float surfaceWidth, float surfaceHeight,
-                                 int32_t pointerID, float x, float y)
+                                 int32_t pointerID, float x, float y, int64_t clientTimeNs)
 {
     LOGI("CommandServer: Enqueuing PointerDown (smHandle=%lld, x=%f, y=%f)",
          static_cast<long long>(smHandle), x, y);
@@ -92,13 +93,14 @@ void CommandServer::pointerDown(int64_t smHandle, int8_t fit, int8_t alignment,
     cmd.pointerID = pointerID;
     cmd.pointerX = x;
     cmd.pointerY = y;
+    cmd.clientTimeNs = clientTimeNs;
 
     enqueueCommand(std::move(cmd));
 }
 
 void CommandServer::pointerUp(int64_t smHandle, int8_t fit, int8_t alignment,
                                float layoutScale, float surfaceWidth, float surfaceHeight,
-                               int32_t pointerID, float x, float y)
+                               int32_t pointerID, float x, float y, int64_t clientTimeNs)
 {
     LOGI("CommandServer: Enqueuing PointerUp (smHandle=%lld, x=%f, y=%f)",
          static_cast<long long>(smHandle), x, y);
@@ -113,13 +115,14 @@ void CommandServer::pointerUp(int64_t smHandle, int8_t fit, int8_t alignment,
     cmd.pointerID = pointerID;
     cmd.pointerX = x;
     cmd.pointerY = y;
+    cmd.clientTimeNs = clientTimeNs;
 
     enqueueCommand(std::move(cmd));
 }
 
 void CommandServer::pointerExit(int64_t smHandle, int8_t fit, int8_t alignment,
                                  float layoutScale, float surfaceWidth, float surfaceHeight,
-                                 int32_t pointerID, float x, float y)
+                                 int32_t pointerID, float x, float y, int64_t clientTimeNs)
 {
     LOGI("CommandServer: Enqueuing PointerExit (smHandle=%lld)",
          static_cast<long long>(smHandle));
@@ -134,6 +137,7 @@ void CommandServer::pointerExit(int64_t smHandle, int8_t fit, int8_t alignment,
     cmd.pointerID = pointerID;
     cmd.pointerX = x;
     cmd.pointerY = y;
+    cmd.clientTimeNs = clientTimeNs;
 
     enqueueCommand(std::move(cmd));
 }
@@ -92,7 +92,7 @@ void CommandServer::handleGetNumberProperty(const Command& cmd)
     LOGI("CommandServer: Handling GetNumberProperty command (requestID=%lld, vmiHandle=%lld, path=%s)",
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle), cmd.propertyPath.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -129,7 +129,7 @@ void CommandServer::handleSetNumberProperty(const Command& cmd)
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle),
          cmd.propertyPath.c_str(), cmd.floatValue);
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -167,7 +167,7 @@ void CommandServer::handleGetStringProperty(const Command& cmd)
     LOGI("CommandServer: Handling GetStringProperty command (requestID=%lld, vmiHandle=%lld, path=%s)",
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle), cmd.propertyPath.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -204,7 +204,7 @@ void CommandServer::handleSetStringProperty(const Command& cmd)
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle),
          cmd.propertyPath.c_str(), cmd.stringValue.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -242,7 +242,7 @@ void CommandServer::handleGetBooleanProperty(const Command& cmd)
     LOGI("CommandServer: Handling GetBooleanProperty command (requestID=%lld, vmiHandle=%lld, path=%s)",
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle), cmd.propertyPath.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -279,7 +279,7 @@ void CommandServer::handleSetBooleanProperty(const Command& cmd)
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle),
          cmd.propertyPath.c_str(), cmd.boolValue ? 1 : 0);
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -417,7 +417,7 @@ void CommandServer::handleGetEnumProperty(const Command& cmd)
     LOGI("CommandServer: Handling GetEnumProperty command (requestID=%lld, vmiHandle=%lld, path=%s)",
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle), cmd.propertyPath.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -454,7 +454,7 @@ void CommandServer::handleSetEnumProperty(const Command& cmd)
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle),
          cmd.propertyPath.c_str(), cmd.stringValue.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -492,7 +492,7 @@ void CommandServer::handleGetColorProperty(const Command& cmd)
     LOGI("CommandServer: Handling GetColorProperty command (requestID=%lld, vmiHandle=%lld, path=%s)",
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle), cmd.propertyPath.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -529,7 +529,7 @@ void CommandServer::handleSetColorProperty(const Command& cmd)
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle),
          cmd.propertyPath.c_str(), cmd.colorValue);
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -567,7 +567,7 @@ void CommandServer::handleFireTriggerProperty(const Command& cmd)
     LOGI("CommandServer: Handling FireTriggerProperty command (requestID=%lld, vmiHandle=%lld, path=%s)",
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle), cmd.propertyPath.c_str());
 
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle: %lld", static_cast<long long>(cmd.handle));
 
@@ -610,7 +610,7 @@ void CommandServer::handleSubscribeToProperty(const Command& cmd)
          static_cast<long long>(cmd.handle), cmd.propertyPath.c_str(), cmd.propertyType);
 
     // Validate the VMI handle exists
-    auto it = m_viewModelInstances.find(cmd.handle);
+    auto it = findVMI(cmd.handle);
     if (it == m_viewModelInstances.end()) {
         LOGW("CommandServer: Invalid VMI handle for subscription: %lld", static_cast<long long>(cmd.handle));
         return;
@@ -681,7 +681,7 @@ void CommandServer::emitPropertyUpdateIfSubscribed(int64_t vmiHandle, const std:
     }
 
     // Get the VMI
-    auto it = m_viewModelInstances.find(vmiHandle);
+    auto it = findVMI(vmiHandle);
     if (it == m_viewModelInstances.end()) {
         return;
     }
@@ -0,0 +1,367 @@
+#include "command_server.hpp"
+#include "rive_log.hpp"
+#include <algorithm>
+#include <vector>
+
+namespace rive_android {
+
+namespace {
+
+/**
+ * Whether a pending command may be merged into a later one of the same key
+ * under Coalesce. Discrete pointer events carry gesture state and never are.
+ */
+bool isCoalescible(CommandType type)
+{
+    switch (type) {
+        case CommandType::AdvanceStateMachine:
+        case CommandType::FrameTick:
+        case CommandType::PointerMove:
+        case CommandType::Draw:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Whether a pending command may be discarded under DropOldest. A FrameTick
+ * is coalescible but not droppable: its time is merged, never lost, and it
+ * is the only thing that draws registered views.
+ */
+bool isDroppable(CommandType type)
+{
+    return isCoalescible(type) && type != CommandType::FrameTick;
+}
+
+/**
+ * Whether two commands of the same type target the same thing and can be merged.
+ */
+bool sameCoalescingKey(const Command& pending, const Command& incoming)
+{
+    switch (incoming.type) {
+        case CommandType::AdvanceStateMachine:
+            return pending.handle == incoming.handle;
+        case CommandType::FrameTick:
+            return true;
+        case CommandType::PointerMove:
+            return pending.handle == incoming.handle &&
+                   pending.pointerID == incoming.pointerID;
+        case CommandType::Draw:
+            return pending.drawKey == incoming.drawKey;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+bool CommandServer::admitCommandLocked(Command& cmd, std::unique_lock<std::mutex>& lock)
+{
+    const auto cls = commandClassOf(cmd.type);
+    const auto idx = static_cast<size_t>(cls);
+    auto& stats = m_queueStats[idx];
+    stats.enqueued++;
+
+    const auto policy = m_queuePolicies[idx];
+    if (policy.policy == OverflowPolicy::Unbounded || policy.capacity == 0) {
+        return true;
+    }
+
+    if (stats.pending < policy.capacity) {
+        return true;
+    }
+
+    switch (policy.policy) {
+        case OverflowPolicy::Block:
+            // Never block the worker on its own queue; it would deadlock.
+            if (isWorkerThread()) {
+                return true;
+            }
+            stats.blocked++;
+            m_queueSpaceCv.wait(lock, [this, idx] {
+                const auto capacity = m_queuePolicies[idx].capacity;
+                return !m_running.load() ||
+                       m_queuePolicies[idx].policy != OverflowPolicy::Block ||
+                       capacity == 0 || m_queueStats[idx].pending < capacity;
+            });
+            return true;
+
+        case OverflowPolicy::DropOldest:
+            if (dropOldestLocked(cls)) {
+                stats.dropped++;
+            }
+            // Non-droppable commands (e.g. PointerDown) are admitted even when
+            // nothing could be dropped; the class is bounded by its droppable share.
+            return true;
+
+        case OverflowPolicy::Coalesce:
+            if (coalescePendingLocked(cmd)) {
+                stats.coalesced++;
+                return false;
+            }
+            // Nothing with the same key to merge into, e.g. because ordered
+            // commands sit between them. Fall back to DropOldest so the
+            // capacity holds for droppable commands during a stall.
+            if (dropOldestLocked(cls)) {
+                stats.dropped++;
+            } else if (isDroppable(cmd.type)) {
+                // Only barriers are pending; the incoming command is the oldest droppable one.
+                LOGW("CommandServer: Queue full, dropping incoming command type %d",
+                     static_cast<int>(cmd.type));
+                stats.dropped++;
+                return false;
+            }
+            return true;
+
+        case OverflowPolicy::Unbounded:
+            break;
+    }
+    return true;
+}
+
+bool CommandServer::coalescePendingLocked(Command& cmd)
+{
+    if (!isCoalescible(cmd.type)) {
+        return false;
+    }
+
+    for (auto it = m_commandQueue.rbegin(); it != m_commandQueue.rend(); ++it) {
+        // Stop at anything that is not itself coalescible: merging past it
+        // would move this command's effect across an ordered state change.
+        if (!isCoalescible(it->type)) {
+            return false;
+        }
+        if (it->type != cmd.type || !sameCoalescingKey(*it, cmd)) {
+            continue;
+        }
+
+        switch (cmd.type) {
+            case CommandType::AdvanceStateMachine:
+            case CommandType::FrameTick:
+                it->deltaTime += cmd.deltaTime;
+                break;
+            case CommandType::PointerMove:
+            case CommandType::Draw: {
+                // Latest position / frame parameters win, but latency is
+                // measured from the oldest merged event.
+                const int64_t enqueueTimeNs = it->enqueueTimeNs;
+                const int64_t clientTimeNs = std::min(it->clientTimeNs, cmd.clientTimeNs);
+                *it = std::move(cmd);
+                it->enqueueTimeNs = enqueueTimeNs;
+                it->clientTimeNs = clientTimeNs;
+                break;
+            }
+            default:
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool CommandServer::dropOldestLocked(CommandClass commandClass)
+{
+    for (auto it = m_commandQueue.begin(); it != m_commandQueue.end(); ++it) {
+        if (commandClassOf(it->type) == commandClass && isDroppable(it->type)) {
+            LOGW("CommandServer: Queue full, dropping pending command type %d",
+                 static_cast<int>(it->type));
+            m_commandQueue.erase(it);
+            m_queueStats[static_cast<size_t>(commandClass)].pending--;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CommandServer::setQueuePolicy(CommandClass commandClass, QueuePolicy policy)
+{
+    if (commandClass == CommandClass::Ordered &&
+        (policy.policy == OverflowPolicy::DropOldest ||
+         policy.policy == OverflowPolicy::Coalesce)) {
+        LOGW("CommandServer: Ordered commands cannot be dropped or coalesced");
+        return false;
+    }
+
+    LOGI("CommandServer: Setting queue policy (class=%d, policy=%d, capacity=%u)",
+         static_cast<int>(commandClass), static_cast<int>(policy.policy),
+         policy.capacity);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queuePolicies[static_cast<size_t>(commandClass)] = policy;
+    }
+    // Producers blocked under the old policy re-evaluate against the new one.
+    m_queueSpaceCv.notify_all();
+    return true;
+}
+
+QueuePolicy CommandServer::getQueuePolicy(CommandClass commandClass) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queuePolicies[static_cast<size_t>(commandClass)];
+}
+
+QueueStats CommandServer::getQueueStats(CommandClass commandClass) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_queueStats[static_cast<size_t>(commandClass)];
+}
+
+void CommandServer::resetQueueStats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& stats : m_queueStats) {
+        const auto pending = stats.pending;
+        stats = QueueStats{};
+        stats.pending = pending;
+        stats.highWater = pending;
+    }
+}
+
+// =============================================================================
+// Phase G.2: Request Cancellation
+// =============================================================================
+
+namespace {
+
+bool targetsHandle(const Command& cmd, int64_t handle)
+{
+    return cmd.handle == handle ||
+           cmd.fileHandle == handle ||
+           cmd.artboardHandle == handle ||
+           cmd.smHandle == handle ||
+           cmd.vmiHandle == handle;
+}
+
+} // namespace
+
+std::deque<Command>::iterator CommandServer::cancelPendingLocked(std::deque<Command>::iterator it,
+                                                                 std::vector<int64_t>& cancelledRequestIDs)
+{
+    // Fire-and-forget commands have no waiting caller to notify.
+    if (it->requestID != 0 && commandClassOf(it->type) == CommandClass::Ordered) {
+        cancelledRequestIDs.push_back(it->requestID);
+    }
+    m_queueStats[static_cast<size_t>(commandClassOf(it->type))].pending--;
+    return m_commandQueue.erase(it);
+}
+
+bool CommandServer::cancel(int64_t requestID)
+{
+    if (requestID == 0) {
+        return false;
+    }
+
+    LOGI("CommandServer: Cancelling request (requestID=%lld)",
+         static_cast<long long>(requestID));
+
+    bool cancelled = false;
+    std::vector<int64_t> cancelledRequestIDs;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_commandQueue.begin(); it != m_commandQueue.end(); ++it) {
+            if (it->requestID == requestID && isCancellable(it->type)) {
+                cancelPendingLocked(it, cancelledRequestIDs);
+                cancelled = true;
+                break;
+            }
+        }
+        if (!cancelled && m_inFlight != nullptr && m_inFlight->requestID == requestID &&
+            isCancellable(m_inFlight->type)) {
+            cancelled = cancelInFlightLocked();
+        }
+    }
+    for (const int64_t id : cancelledRequestIDs) {
+        enqueueMessage(Message(MessageType::RequestCancelled, id));
+    }
+    if (cancelled) {
+        m_queueSpaceCv.notify_all();
+    }
+    return cancelled;
+}
+
+int32_t CommandServer::cancelAllFor(int64_t handle)
+{
+    if (handle == 0) {
+        return 0;
+    }
+
+    LOGI("CommandServer: Cancelling all commands for handle %lld",
+         static_cast<long long>(handle));
+
+    int32_t count = 0;
+    std::vector<int64_t> cancelledRequestIDs;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_commandQueue.begin(); it != m_commandQueue.end();) {
+            if (isCancellable(it->type) && targetsHandle(*it, handle)) {
+                it = cancelPendingLocked(it, cancelledRequestIDs);
+                count++;
+            } else {
+                ++it;
+            }
+        }
+        // Fire-and-forget commands in flight have no caller to notify and
+        // simply finish.
+        if (m_inFlight != nullptr && m_inFlight->requestID != 0 &&
+            isCancellable(m_inFlight->type) && targetsHandle(*m_inFlight, handle) &&
+            cancelInFlightLocked()) {
+            count++;
+        }
+    }
+    for (const int64_t id : cancelledRequestIDs) {
+        enqueueMessage(Message(MessageType::RequestCancelled, id));
+    }
+    if (count > 0) {
+        m_queueSpaceCv.notify_all();
+    }
+    return count;
+}
+
+void CommandServer::setWorkerPaused(bool paused)
+{
+    LOGI("CommandServer: %s worker", paused ? "Pausing" : "Resuming");
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_workerPaused = paused;
+    }
+    if (!paused) {
+        if (m_host != nullptr) {
+            m_host->notifyWork();
+        } else {
+            m_cv.notify_one();
+        }
+    }
+}
+
+void CommandServer::setHoldInFlight(bool hold)
+{
+    LOGI("CommandServer: %s in-flight commands", hold ? "Holding" : "Releasing");
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_holdInFlight = hold && m_running.load();
+    }
+    if (!hold) {
+        m_holdCv.notify_all();
+    }
+}
+
+bool CommandServer::cancelInFlightLocked()
+{
+    std::lock_guard<std::mutex> replyLock(m_messageMutex);
+    if (m_inFlightReplied) {
+        LOGI("CommandServer: In-flight request already completed (requestID=%lld)",
+             static_cast<long long>(m_inFlight->requestID));
+        return false;
+    }
+    // The worker sends the RequestCancelled message once the handler returns.
+    m_cancelledRequestID.store(m_inFlight->requestID);
+    return true;
+}
+
+bool CommandServer::isCancelled(const Command& cmd) const
+{
+    return cmd.requestID != 0 && m_cancelledRequestID.load() == cmd.requestID;
+}
+
+} // namespace rive_android
@@ -201,8 +201,14 @@ static rive::Alignment getAlignmentFromOrdinal(int32_t ordinal)
 // Phase C.2.6: Rendering Operations - Handler
 // =============================================================================
 
-void CommandServer::handleDraw(const Command& cmd)
+void CommandServer::handleDraw(const Command& cmd, bool reportComplete)
 {
+    // Phase G.4: Per-frame timing breakdown
+    FrameTiming timing;
+    int64_t stageStartNs = steadyClockNowNs();
+    timing.queueWaitNs = stageStartNs - cmd.enqueueTimeNs;
+    timing.advanceNs = takeFrameAdvanceNs(cmd.smHandle);
+
     LOGI("CommandServer: DIAGNOSTIC - Handling Draw command (requestID=%lld, artboard=%lld, sm=%lld, %dx%d)",
          static_cast<long long>(cmd.requestID),
          static_cast<long long>(cmd.artboardHandle),
@@ -288,6 +294,7 @@ void CommandServer::handleDraw(const Command& cmd)
 
     // 6. Make EGL context current for this surface
     void* surfacePtr = reinterpret_cast<void*>(cmd.surfacePtr);
+    stageStartNs = steadyClockNowNs();
     LOGD("CommandServer: DIAGNOSTIC - About to call beginFrame with surfacePtr=%p (from %lld)",
          surfacePtr, static_cast<long long>(cmd.surfacePtr));
     renderContext->beginFrame(surfacePtr);
@@ -322,7 +329,15 @@ void CommandServer::handleDraw(const Command& cmd)
     }
 
     // 8. Create renderer and apply fit/alignment transformation
-    auto renderer = rive::RiveRenderer(renderContext->riveContext.get());
+    auto riveRenderer = rive::RiveRenderer(renderContext->riveContext.get());
+
+    // Phase G.13: Lazily imported files resolve their render objects here
+    rive_mp::DeferredFactory* deferredFactory = renderContext->deferredFactoryIfCreated();
+    if (deferredFactory != nullptr) {
+        deferredFactory->setIdleReleaseNs(m_lazyIdleReleaseNs.load(std::memory_order_relaxed));
+        deferredFactory->beginFrame();
+    }
+    auto renderer = rive_mp::DeferredRenderer(&riveRenderer, deferredFactory);
 
     // Convert ordinals to rive enums
     rive::Fit fit = getFitFromOrdinal(cmd.fitMode);
@@ -398,7 +413,12 @@ void CommandServer::handleDraw(const Command& cmd)
     // 11. Flush Rive GPU context to submit rendering commands
     LOGD("CommandServer: DIAGNOSTIC - Flushing to renderTarget=%p (width=%d, height=%d)",
          renderTarget, renderTarget->width(), renderTarget->height());
+    int64_t stageEndNs = steadyClockNowNs();
+    timing.encodeNs = stageEndNs - stageStartNs;
+    stageStartNs = stageEndNs;
     renderContext->riveContext->flush({.renderTarget = renderTarget});
+    stageEndNs = steadyClockNowNs();
+    timing.flushNs = stageEndNs - stageStartNs;
     
     // Check GL errors after flush
     glErr = glGetError();
@@ -412,9 +432,20 @@ void CommandServer::handleDraw(const Command& cmd)
     LOGD("CommandServer: DIAGNOSTIC - After flush, current FBO binding=%d", currentFBO);
 
 
+    // Phase G.13: Release render objects of artboards no longer drawn
+    if (deferredFactory != nullptr) {
+        deferredFactory->trim();
+    }
+
     // 11. Present the frame (swap buffers)
     LOGD("CommandServer: DIAGNOSTIC - About to call present with surfacePtr=%p", surfacePtr);
+    stageStartNs = steadyClockNowNs();
     renderContext->present(surfacePtr);
+    stageEndNs = steadyClockNowNs();
+    timing.presentNs = stageEndNs - stageStartNs;
+    if (cmd.smHandle != 0) {
+        notePresented(cmd.smHandle, stageEndNs);
+    }
     
     // Check GL errors after present
     glErr = glGetError();
@@ -428,9 +459,13 @@ void CommandServer::handleDraw(const Command& cmd)
          static_cast<int>(artboard->width()),
          static_cast<int>(artboard->height()));
 
-    Message msg(MessageType::DrawComplete, cmd.requestID);
-    msg.handle = cmd.drawKey;  // Return the draw key for correlation
-    enqueueMessage(std::move(msg));
+    // Phase G.4: Only report the breakdown when someone is listening
+    if (reportComplete && m_frameTimingEnabled.load(std::memory_order_relaxed)) {
+        Message msg(MessageType::DrawComplete, cmd.requestID);
+        msg.handle = cmd.drawKey;  // Return the draw key for correlation
+        msg.frameTiming = timing;
+        enqueueMessage(std::move(msg));
+    }
 }
 
 } // namespace rive_android
\ No newline at end of file
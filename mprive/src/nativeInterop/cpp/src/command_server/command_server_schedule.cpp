@@ -0,0 +1,336 @@
+#include "command_server.hpp"
+#include "rive_log.hpp"
+#include "rive/animation/state_machine_input_instance.hpp"
+#include "rive/animation/state_machine_bool.hpp"
+#include "rive/animation/state_machine_number.hpp"
+#include "rive/animation/state_machine_trigger.hpp"
+#include "rive/event.hpp"
+#include "rive/event_report.hpp"
+#include <algorithm>
+
+namespace rive_android {
+
+namespace {
+
+/**
+ * Applies a scheduled input to a state machine.
+ * Mismatched or missing inputs are logged and skipped; there is no caller
+ * waiting for a result by the time a timer fires.
+ */
+void applyScheduledInput(rive::StateMachineInstance* sm,
+                         ScheduledInputKind kind,
+                         const std::string& inputName,
+                         float floatValue,
+                         bool boolValue)
+{
+    rive::SMIInput* foundInput = nullptr;
+    for (size_t i = 0; i < sm->inputCount(); i++) {
+        auto input = sm->input(i);
+        if (input && input->name() == inputName) {
+            foundInput = input;
+            break;
+        }
+    }
+    if (!foundInput) {
+        LOGW("CommandServer: Scheduled input not found: %s", inputName.c_str());
+        return;
+    }
+
+    switch (kind) {
+        case ScheduledInputKind::Trigger:
+            if (foundInput->input()->is<rive::StateMachineTrigger>()) {
+                reinterpret_cast<rive::SMITrigger*>(foundInput)->fire();
+                return;
+            }
+            break;
+        case ScheduledInputKind::Number:
+            if (foundInput->input()->is<rive::StateMachineNumber>()) {
+                reinterpret_cast<rive::SMINumber*>(foundInput)->value(floatValue);
+                return;
+            }
+            break;
+        case ScheduledInputKind::Boolean:
+            if (foundInput->input()->is<rive::StateMachineBool>()) {
+                reinterpret_cast<rive::SMIBool*>(foundInput)->value(boolValue);
+                return;
+            }
+            break;
+        case ScheduledInputKind::DelayEvent:
+            // Never a timer; handleScheduleInput keeps these in eventDelays.
+            break;
+    }
+    LOGW("CommandServer: Scheduled input has the wrong type: %s", inputName.c_str());
+}
+
+} // namespace
+
+// =============================================================================
+// Phase G.5: Scheduled Inputs - Public API
+// =============================================================================
+
+int64_t CommandServer::scheduleInput(int64_t smHandle,
+                                     ScheduledInputKind kind,
+                                     const std::string& inputName,
+                                     float floatValue,
+                                     bool boolValue,
+                                     float delaySeconds,
+                                     const std::string& onEvent)
+{
+    // Timer IDs have their own counter so scheduling from the caller thread
+    // does not shift the resource handles the worker hands out.
+    const int64_t timerID = m_nextTimerID.fetch_add(1);
+
+    LOGI("CommandServer: Enqueuing ScheduleInput (smHandle=%lld, name=%s, delay=%f, onEvent=%s, id=%lld)",
+         static_cast<long long>(smHandle), inputName.c_str(), delaySeconds,
+         onEvent.c_str(), static_cast<long long>(timerID));
+
+    Command cmd(CommandType::ScheduleInput, 0);
+    cmd.handle = smHandle;
+    cmd.scheduledKind = static_cast<int32_t>(kind);
+    cmd.inputName = inputName;
+    cmd.floatValue = floatValue;
+    cmd.boolValue = boolValue;
+    cmd.delaySeconds = std::max(delaySeconds, 0.0f);
+    cmd.name = onEvent;
+    cmd.timerID = timerID;
+
+    enqueueCommand(std::move(cmd));
+    return timerID;
+}
+
+void CommandServer::cancelScheduledInput(int64_t timerID)
+{
+    LOGI("CommandServer: Enqueuing CancelScheduledInput (id=%lld)",
+         static_cast<long long>(timerID));
+
+    Command cmd(CommandType::CancelScheduledInput, 0);
+    cmd.timerID = timerID;
+
+    enqueueCommand(std::move(cmd));
+}
+
+// =============================================================================
+// Phase G.5: Scheduled Inputs - Handlers
+// =============================================================================
+
+void CommandServer::handleScheduleInput(const Command& cmd)
+{
+    if (m_stateMachines.find(cmd.handle) == m_stateMachines.end()) {
+        // Fire-and-forget - just log warning (matches AdvanceStateMachine)
+        LOGW("CommandServer: Cannot schedule input on invalid state machine handle: %lld",
+             static_cast<long long>(cmd.handle));
+        return;
+    }
+
+    ScheduledInput input;
+    input.id = cmd.timerID;
+    input.kind = static_cast<ScheduledInputKind>(cmd.scheduledKind);
+    input.inputName = cmd.inputName;
+    input.floatValue = cmd.floatValue;
+    input.boolValue = cmd.boolValue;
+    input.delaySeconds = cmd.delaySeconds;
+    input.onEvent = cmd.name;
+
+    auto& schedule = m_schedules[cmd.handle];
+    if (input.kind == ScheduledInputKind::DelayEvent) {
+        schedule.eventDelays.push_back(std::move(input));
+    } else if (input.onEvent.empty()) {
+        const double dueTime = schedule.clock + input.delaySeconds;
+        schedule.timers.emplace(dueTime, std::move(input));
+    } else {
+        schedule.reactions.push_back(std::move(input));
+    }
+}
+
+void CommandServer::handleCancelScheduledInput(const Command& cmd)
+{
+    for (auto it = m_schedules.begin(); it != m_schedules.end(); ++it) {
+        auto& schedule = it->second;
+        auto& reactions = schedule.reactions;
+        const size_t reactionCount = reactions.size();
+        reactions.erase(std::remove_if(reactions.begin(), reactions.end(),
+                                       [&cmd](const ScheduledInput& input) {
+                                           return input.id == cmd.timerID;
+                                       }),
+                        reactions.end());
+        auto& delays = schedule.eventDelays;
+        const size_t delayCount = delays.size();
+        delays.erase(std::remove_if(delays.begin(), delays.end(),
+                                    [&cmd](const ScheduledInput& input) {
+                                        return input.id == cmd.timerID;
+                                    }),
+                     delays.end());
+        // Cancelling a reaction also drops the timers it has already armed,
+        // and cancelling an event delay drops the events it is holding.
+        bool found = reactions.size() != reactionCount || delays.size() != delayCount;
+        for (auto timer = schedule.timers.begin(); timer != schedule.timers.end();) {
+            if (timer->second.id == cmd.timerID) {
+                timer = schedule.timers.erase(timer);
+                found = true;
+            } else {
+                ++timer;
+            }
+        }
+        for (auto held = schedule.heldEvents.begin(); held != schedule.heldEvents.end();) {
+            if (held->second.id == cmd.timerID) {
+                held = schedule.heldEvents.erase(held);
+                found = true;
+            } else {
+                ++held;
+            }
+        }
+        if (found) {
+            if (schedule.empty()) {
+                m_schedules.erase(it);
+            }
+            return;
+        }
+    }
+}
+
+void CommandServer::armEventReactions(rive::StateMachineInstance* sm,
+                                      StateMachineSchedule& schedule)
+{
+    if (schedule.reactions.empty()) {
+        return;
+    }
+    const size_t count = sm->reportedEventCount();
+    for (size_t i = 0; i < count; i++) {
+        const rive::EventReport report = sm->reportedEventAt(i);
+        rive::Event* event = report.event();
+        if (event == nullptr) {
+            continue;
+        }
+        // secondsDelay is how long before the end of the advance the event
+        // occurred, so the reaction is timed from the event, not the frame.
+        const double occurredAt = schedule.clock - report.secondsDelay();
+        for (const auto& reaction : schedule.reactions) {
+            if (reaction.onEvent != event->name()) {
+                continue;
+            }
+            const double dueTime = std::max(occurredAt + reaction.delaySeconds, schedule.clock);
+            schedule.timers.emplace(dueTime, reaction);
+        }
+    }
+}
+
+void CommandServer::delayFrameEvents(StateMachineSchedule& schedule,
+                                     std::vector<FrameEvent>& events)
+{
+    if (schedule.eventDelays.empty() && schedule.heldEvents.empty()) {
+        return;
+    }
+    const double endTime = schedule.clock;
+
+    auto delayFor = [&schedule](const rive::Event* event) -> const ScheduledInput* {
+        if (event == nullptr) {
+            return nullptr;
+        }
+        for (const auto& delay : schedule.eventDelays) {
+            if (delay.inputName == event->name()) {
+                return &delay;
+            }
+        }
+        return nullptr;
+    };
+
+    // Events are delivered at the animation time they occurred plus their
+    // delay. Those still in the future are held for a later advance.
+    auto kept = events.begin();
+    for (auto& frameEvent : events) {
+        const ScheduledInput* delay = delayFor(frameEvent.event);
+        if (delay != nullptr && delay->delaySeconds > 0.0f) {
+            const double dueTime = endTime - frameEvent.secondsDelay + delay->delaySeconds;
+            if (dueTime > endTime) {
+                schedule.heldEvents.emplace(dueTime, HeldEvent{delay->id, frameEvent.event});
+                continue;
+            }
+            frameEvent.secondsDelay = static_cast<float>(endTime - dueTime);
+        }
+        *kept++ = frameEvent;
+    }
+    events.erase(kept, events.end());
+
+    while (!schedule.heldEvents.empty() && schedule.heldEvents.begin()->first <= endTime) {
+        auto node = schedule.heldEvents.extract(schedule.heldEvents.begin());
+        FrameEvent frameEvent;
+        frameEvent.event = node.mapped().event;
+        frameEvent.secondsDelay = static_cast<float>(endTime - node.key());
+        events.push_back(frameEvent);
+    }
+
+    // Earliest delivery first, as the runtime reports them.
+    std::stable_sort(events.begin(), events.end(),
+                     [](const FrameEvent& a, const FrameEvent& b) {
+                         return a.secondsDelay > b.secondsDelay;
+                     });
+}
+
+void CommandServer::collectFrameEvents(rive::StateMachineInstance* sm,
+                                       double laterSeconds,
+                                       std::vector<FrameEvent>& events)
+{
+    const size_t count = sm->reportedEventCount();
+    for (size_t i = 0; i < count; i++) {
+        const rive::EventReport report = sm->reportedEventAt(i);
+        FrameEvent frameEvent;
+        frameEvent.event = report.event();
+        frameEvent.secondsDelay = static_cast<float>(report.secondsDelay() + laterSeconds);
+        events.push_back(frameEvent);
+    }
+}
+
+bool CommandServer::advanceWithScheduledInputs(int64_t smHandle,
+                                               rive::StateMachineInstance* sm,
+                                               float deltaTime)
+{
+    auto& frameEvents = m_frameEvents[smHandle];
+    frameEvents.clear();
+
+    auto scheduleIt = m_schedules.find(smHandle);
+    if (scheduleIt == m_schedules.end()) {
+        const bool stillPlaying = sm->advanceAndApply(deltaTime);
+        collectFrameEvents(sm, 0.0, frameEvents);
+        filterFrameEvents(smHandle);
+        return stillPlaying;
+    }
+
+    auto& schedule = scheduleIt->second;
+    const double endTime = schedule.clock + deltaTime;
+
+    // Split the advance at each due time so inputs land on their exact
+    // animation time. Reactions armed by a partial advance can fire within
+    // the same frame.
+    while (!schedule.timers.empty() && schedule.timers.begin()->first <= endTime) {
+        auto node = schedule.timers.extract(schedule.timers.begin());
+        const double step = node.key() - schedule.clock;
+        if (step > 0.0) {
+            sm->advanceAndApply(static_cast<float>(step));
+            schedule.clock = node.key();
+            // The next step clears these reports; keep them for the frame.
+            collectFrameEvents(sm, endTime - schedule.clock, frameEvents);
+            armEventReactions(sm, schedule);
+        }
+        const auto& input = node.mapped();
+        LOGI("CommandServer: Firing scheduled input %s (id=%lld)",
+             input.inputName.c_str(), static_cast<long long>(input.id));
+        applyScheduledInput(sm, input.kind, input.inputName, input.floatValue, input.boolValue);
+    }
+
+    const bool stillPlaying = sm->advanceAndApply(static_cast<float>(endTime - schedule.clock));
+    schedule.clock = endTime;
+    collectFrameEvents(sm, 0.0, frameEvents);
+    armEventReactions(sm, schedule);
+    delayFrameEvents(schedule, frameEvents);
+    filterFrameEvents(smHandle);
+
+    const bool pending = !schedule.timers.empty() || !schedule.heldEvents.empty();
+    if (schedule.empty()) {
+        m_schedules.erase(scheduleIt);
+    }
+    // Pending timers and held events keep the state machine awake so they
+    // are still delivered.
+    return stillPlaying || pending;
+}
+
+} // namespace rive_android
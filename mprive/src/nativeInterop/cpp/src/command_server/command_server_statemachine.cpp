@@ -1,5 +1,6 @@
 #include "command_server.hpp"
 #include "rive_log.hpp"
+#include <algorithm>
 #include "rive/animation/state_machine_input_instance.hpp"
 #include "rive/animation/state_machine_bool.hpp"
 #include "rive/animation/state_machine_number.hpp"
@@ -82,6 +83,7 @@ int64_t CommandServer::createDefaultStateMachineSync(int64_t artboardHandle)
     
     LOGI("CommandServer: State machine created synchronously (handle=%lld)", 
          static_cast<long long>(handle));
+    captureSyncCreate(CommandType::CreateDefaultStateMachine, artboardHandle, "", handle);
     
     return handle;
 }
@@ -134,6 +136,7 @@ int64_t CommandServer::createStateMachineByNameSync(int64_t artboardHandle, cons
     
     LOGI("CommandServer: State machine created synchronously (handle=%lld, name=%s)", 
          static_cast<long long>(handle), name.c_str());
+    captureSyncCreate(CommandType::CreateStateMachineByName, artboardHandle, name, handle);
     
     return handle;
 }
@@ -297,7 +300,8 @@ void CommandServer::handleAdvanceStateMachine(const Command& cmd)
     // AND the artboard together, ensuring proper animation synchronization.
     // The artboard's advanceInternal() is called internally with the same deltaTime.
     // IMPORTANT: Capture the return value - it indicates if animations will continue!
-    bool stillPlaying = sm->advanceAndApply(cmd.deltaTime);
+    // Phase G.5: Scheduled inputs fire at their exact animation time within the advance.
+    bool stillPlaying = advanceWithScheduledInputs(cmd.handle, sm.get(), cmd.deltaTime);
     
     // DIAGNOSTIC: Log animation state AFTER advance
     size_t animCountAfter = sm->currentAnimationCount();
@@ -327,6 +331,11 @@ void CommandServer::handleDeleteStateMachine(const Command& cmd)
     auto it = m_stateMachines.find(cmd.handle);
     if (it != m_stateMachines.end()) {
         m_stateMachines.erase(it);
+        m_schedules.erase(cmd.handle);
+        m_frameEvents.erase(cmd.handle);
+        m_unfilteredFrameEvents.erase(cmd.handle);
+        m_eventFilters.erase(cmd.handle);
+        m_viewModelBindings.erase(cmd.handle);
 
         LOGI("CommandServer: State machine deleted successfully (handle=%lld)",
              static_cast<long long>(cmd.handle));
@@ -870,8 +879,11 @@ void CommandServer::handleGetReportedEventCount(const Command& cmd)
         return;
     }
 
-    auto& sm = it->second;
-    size_t count = sm->reportedEventCount();
+    // Phase G.5: Every step of the last advance, not only the final one.
+    // Phase G.16: Already filtered, so the client never asks for the others.
+    // A state machine that has not advanced yet has no entry.
+    auto events = m_frameEvents.find(cmd.handle);
+    const size_t count = events != m_frameEvents.end() ? events->second.size() : 0;
 
     LOGI("CommandServer: Reported event count: %zu", count);
 
@@ -895,12 +907,19 @@ void CommandServer::handleGetReportedEventAt(const Command& cmd)
         return;
     }
 
-    auto& sm = it->second;
+    // Phase G.5: Every step of the last advance, not only the final one.
+    // Phase G.16: Already filtered, so the index counts only passing events.
+    // Looked up without inserting, so a query never creates an entry.
+    static const std::vector<FrameEvent> kNoEvents;
+    auto found = m_frameEvents.find(cmd.handle);
+    const auto& events = found != m_frameEvents.end() ? found->second : kNoEvents;
+    const size_t count = events.size();
+    const size_t reportIndex = cmd.eventIndex >= 0 ? static_cast<size_t>(cmd.eventIndex) : count;
 
     // Validate index
-    if (cmd.eventIndex < 0 || static_cast<size_t>(cmd.eventIndex) >= sm->reportedEventCount()) {
+    if (reportIndex >= count) {
         LOGW("CommandServer: Event index out of bounds: %d (count=%zu)",
-             cmd.eventIndex, sm->reportedEventCount());
+             cmd.eventIndex, count);
 
         Message msg(MessageType::EventOperationError, cmd.requestID);
         msg.error = "Event index out of bounds";
@@ -909,8 +928,8 @@ void CommandServer::handleGetReportedEventAt(const Command& cmd)
     }
 
     // Get the event report
-    const rive::EventReport report = sm->reportedEventAt(static_cast<size_t>(cmd.eventIndex));
-    rive::Event* event = report.event();
+    const FrameEvent& report = events[reportIndex];
+    rive::Event* event = report.event;
 
     if (!event) {
         LOGW("CommandServer: Event at index %d is null", cmd.eventIndex);
@@ -924,7 +943,7 @@ void CommandServer::handleGetReportedEventAt(const Command& cmd)
     // Build the message with event data
     Message msg(MessageType::EventDataResult, cmd.requestID);
     msg.eventName = event->name();
-    msg.eventDelay = report.secondsDelay();
+    msg.eventDelay = report.secondsDelay;
     msg.eventTypeCode = static_cast<int32_t>(event->coreType());
 
     LOGI("CommandServer: Event name=%s, type=%d, delay=%f",
@@ -979,4 +998,101 @@ void CommandServer::handleGetReportedEventAt(const Command& cmd)
     enqueueMessage(std::move(msg));
 }
 
-} // namespace rive_android
\ No newline at end of file
+// =============================================================================
+// Phase G.16: Event Filters
+// =============================================================================
+
+void CommandServer::setEventFilter(int64_t smHandle,
+                                   EventFilterMode mode,
+                                   std::vector<std::string> names,
+                                   std::vector<int32_t> typeCodes)
+{
+    LOGI("CommandServer: Enqueuing SetEventFilter command (smHandle=%lld, mode=%d, names=%zu, types=%zu)",
+         static_cast<long long>(smHandle), static_cast<int>(mode), names.size(), typeCodes.size());
+
+    Command cmd(CommandType::SetEventFilter);
+    cmd.handle = smHandle;
+    cmd.eventFilterMode = static_cast<int32_t>(mode);
+    cmd.eventNames = std::move(names);
+    cmd.eventTypeCodes = std::move(typeCodes);
+
+    enqueueCommand(std::move(cmd));
+}
+
+void CommandServer::handleSetEventFilter(const Command& cmd)
+{
+    if (m_stateMachines.find(cmd.handle) == m_stateMachines.end()) {
+        LOGW("CommandServer: SetEventFilter on invalid state machine handle: %lld",
+             static_cast<long long>(cmd.handle));
+        return;
+    }
+
+    // Put back every event of the last advance, then filter them again
+    auto allIt = m_unfilteredFrameEvents.find(cmd.handle);
+    if (allIt != m_unfilteredFrameEvents.end()) {
+        m_frameEvents[cmd.handle].swap(allIt->second);
+        m_unfilteredFrameEvents.erase(allIt);
+    }
+
+    const auto mode = static_cast<EventFilterMode>(cmd.eventFilterMode);
+    if (mode == EventFilterMode::All) {
+        m_eventFilters.erase(cmd.handle);
+        return;
+    }
+
+    auto& filter = m_eventFilters[cmd.handle];
+    filter.mode = mode;
+    filter.names = cmd.eventNames;
+    filter.typeCodes = cmd.eventTypeCodes;
+    filterFrameEvents(cmd.handle);
+}
+
+void CommandServer::filterFrameEvents(int64_t smHandle)
+{
+    auto filterIt = m_eventFilters.find(smHandle);
+    if (filterIt == m_eventFilters.end()) {
+        return;
+    }
+
+    // Both lists keep their capacity, so steady-state frames don't allocate
+    auto& events = m_frameEvents[smHandle];
+    auto& all = m_unfilteredFrameEvents[smHandle];
+    all.swap(events);
+    events.clear();
+    for (const auto& frameEvent : all) {
+        if (eventPassesFilter(&filterIt->second, frameEvent.event)) {
+            events.push_back(frameEvent);
+        }
+    }
+}
+
+bool CommandServer::eventPassesFilter(const EventFilter* filter, const rive::Event* event)
+{
+    if (event == nullptr) {
+        // Unfiltered, a null event is still counted and GetReportedEventAt
+        // reports it as an error; any filter drops it.
+        return filter == nullptr || filter->mode == EventFilterMode::All;
+    }
+    if (filter == nullptr) {
+        return true;
+    }
+    switch (filter->mode) {
+        case EventFilterMode::All:
+            return true;
+        case EventFilterMode::None:
+            return false;
+        case EventFilterMode::Matching:
+            break;
+    }
+
+    // The lists hold a handful of entries; a linear scan beats hashing the name.
+    const auto typeCode = static_cast<int32_t>(event->coreType());
+    if (std::find(filter->typeCodes.begin(), filter->typeCodes.end(), typeCode) !=
+        filter->typeCodes.end()) {
+        return true;
+    }
+    const std::string& name = event->name();
+    return std::find(filter->names.begin(), filter->names.end(), name) != filter->names.end();
+}
+
+} // namespace rive_android
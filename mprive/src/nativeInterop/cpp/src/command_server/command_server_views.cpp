@@ -0,0 +1,273 @@
+#include "command_server.hpp"
+#include "rive_log.hpp"
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace rive_android {
+
+// =============================================================================
+// Phase G.11: Registered Views - Public API
+// =============================================================================
+
+int64_t CommandServer::registerView(int64_t viewID,
+                                    int64_t artboardHandle,
+                                    int64_t smHandle,
+                                    int64_t surfacePtr,
+                                    int64_t renderTargetPtr,
+                                    int64_t drawKey,
+                                    int32_t width,
+                                    int32_t height,
+                                    int32_t fitMode,
+                                    int32_t alignmentMode,
+                                    uint32_t clearColor,
+                                    float scaleFactor)
+{
+    // View IDs have their own counter, like timer IDs, so registering from
+    // the caller thread does not shift the resource handles.
+    if (viewID == 0) {
+        viewID = m_nextViewID.fetch_add(1);
+    }
+
+    LOGI("CommandServer: Enqueuing RegisterView (view=%lld, artboard=%lld, sm=%lld, %dx%d)",
+         static_cast<long long>(viewID), static_cast<long long>(artboardHandle),
+         static_cast<long long>(smHandle), width, height);
+
+    Command cmd(CommandType::RegisterView);
+    cmd.handle = viewID;
+    cmd.artboardHandle = artboardHandle;
+    cmd.smHandle = smHandle;
+    cmd.surfacePtr = surfacePtr;
+    cmd.renderTargetPtr = renderTargetPtr;
+    cmd.drawKey = drawKey;
+    cmd.surfaceWidth = width;
+    cmd.surfaceHeight = height;
+    cmd.fitMode = fitMode;
+    cmd.alignmentMode = alignmentMode;
+    cmd.clearColor = clearColor;
+    cmd.scaleFactor = scaleFactor;
+
+    // The new view draws on the next tick
+    m_viewsIdle.store(false, std::memory_order_relaxed);
+    enqueueCommand(std::move(cmd));
+    return viewID;
+}
+
+void CommandServer::unregisterView(int64_t viewID)
+{
+    LOGI("CommandServer: Enqueuing UnregisterView (view=%lld)", static_cast<long long>(viewID));
+
+    Command cmd(CommandType::UnregisterView);
+    cmd.handle = viewID;
+
+    enqueueCommand(std::move(cmd));
+}
+
+void CommandServer::frameTick(float deltaTime)
+{
+    Command cmd(CommandType::FrameTick);
+    cmd.deltaTime = deltaTime;
+
+    enqueueCommand(std::move(cmd));
+}
+
+// =============================================================================
+// Phase G.11: Registered Views - Handlers
+// =============================================================================
+
+CommandServer::ViewTarget CommandServer::viewTargetOf(CommandType type)
+{
+    switch (type) {
+        case CommandType::ResizeArtboard:
+        case CommandType::ResetArtboardSize:
+            return ViewTarget::Artboard;
+        case CommandType::AdvanceStateMachine:
+        case CommandType::SetNumberInput:
+        case CommandType::SetBooleanInput:
+        case CommandType::FireTrigger:
+        case CommandType::BindViewModelInstance:
+        case CommandType::PointerMove:
+        case CommandType::PointerDown:
+        case CommandType::PointerUp:
+        case CommandType::PointerExit:
+        case CommandType::ScheduleInput:
+            return ViewTarget::StateMachine;
+        case CommandType::SetNumberProperty:
+        case CommandType::SetStringProperty:
+        case CommandType::SetBooleanProperty:
+        case CommandType::SetEnumProperty:
+        case CommandType::SetColorProperty:
+        case CommandType::FireTriggerProperty:
+        case CommandType::AddListItem:
+        case CommandType::AddListItemAt:
+        case CommandType::RemoveListItem:
+        case CommandType::RemoveListItemAt:
+        case CommandType::SwapListItems:
+        case CommandType::SetInstanceProperty:
+        case CommandType::SetImageProperty:
+        case CommandType::SetArtboardProperty:
+            return ViewTarget::ViewModelInstance;
+        default:
+            return ViewTarget::None;
+    }
+}
+
+void CommandServer::wakeViewsFor(const Command& cmd)
+{
+    const ViewTarget target = viewTargetOf(cmd.type);
+
+    // State machines a view model instance is bound to. An instance that is
+    // not bound directly (e.g. a nested instance) may belong to any of them.
+    std::vector<int64_t> boundTo;
+    if (target == ViewTarget::ViewModelInstance) {
+        for (const auto& binding : m_viewModelBindings) {
+            if (binding.second == cmd.handle) {
+                boundTo.push_back(binding.first);
+            }
+        }
+    }
+
+    bool woken = false;
+    for (auto& entry : m_views) {
+        auto& view = entry.second;
+        bool uses = false;
+        switch (target) {
+            case ViewTarget::Artboard:
+                uses = view.draw.artboardHandle == cmd.handle;
+                break;
+            case ViewTarget::StateMachine:
+                uses = view.draw.smHandle == cmd.handle;
+                break;
+            case ViewTarget::ViewModelInstance:
+                uses = boundTo.empty() ||
+                       std::find(boundTo.begin(), boundTo.end(), view.draw.smHandle) != boundTo.end();
+                break;
+            case ViewTarget::None:
+                break;
+        }
+        if (uses) {
+            view.dirty = true;
+            woken = true;
+        }
+    }
+    if (woken) {
+        m_viewsIdle.store(false, std::memory_order_relaxed);
+    }
+}
+
+void CommandServer::handleRegisterView(const Command& cmd)
+{
+    LOGI("CommandServer: Handling RegisterView (view=%lld)", static_cast<long long>(cmd.handle));
+
+    auto& view = m_views[cmd.handle];
+    view.draw = cmd;
+    view.draw.type = CommandType::Draw;
+    view.draw.handle = 0;
+    view.dirty = true;
+    view.settled = false;
+}
+
+void CommandServer::handleUnregisterView(const Command& cmd)
+{
+    LOGI("CommandServer: Handling UnregisterView (view=%lld)", static_cast<long long>(cmd.handle));
+
+    if (m_views.erase(cmd.handle) == 0) {
+        LOGW("CommandServer: Attempted to unregister unknown view %lld",
+             static_cast<long long>(cmd.handle));
+    }
+    if (m_views.empty()) {
+        m_viewsIdle.store(true, std::memory_order_relaxed);
+    }
+}
+
+void CommandServer::handleFrameTick(const Command& cmd)
+{
+    // Views may share a state machine or, without one, an artboard; advance
+    // each one once per tick.
+    std::map<int64_t, bool> stillPlaying;
+    std::map<int64_t, bool> artboardChanged;
+    bool allSettled = true;
+
+    for (auto it = m_views.begin(); it != m_views.end();) {
+        auto& view = it->second;
+
+        // Drop views whose artboard is gone rather than failing every frame
+        auto artboardIt = m_artboards.find(view.draw.artboardHandle);
+        if (artboardIt == m_artboards.end()) {
+            LOGW("CommandServer: Dropping view %lld, its artboard was deleted",
+                 static_cast<long long>(it->first));
+            it = m_views.erase(it);
+            continue;
+        }
+
+        rive::StateMachineInstance* sm = nullptr;
+        const int64_t smHandle = view.draw.smHandle;
+        if (smHandle != 0) {
+            auto smIt = m_stateMachines.find(smHandle);
+            if (smIt == m_stateMachines.end()) {
+                LOGW("CommandServer: Dropping view %lld, its state machine was deleted",
+                     static_cast<long long>(it->first));
+                it = m_views.erase(it);
+                continue;
+            }
+            sm = smIt->second.get();
+        }
+
+        // A pending scheduled input or held event only elapses while the
+        // state machine advances.
+        auto scheduleIt = m_schedules.find(smHandle);
+        const bool hasTimers = sm != nullptr && scheduleIt != m_schedules.end() &&
+                               (!scheduleIt->second.timers.empty() ||
+                                !scheduleIt->second.heldEvents.empty());
+        const bool awake = view.dirty || !view.settled || hasTimers ||
+                           (sm != nullptr && sm->needsAdvance());
+        if (!awake) {
+            ++it;
+            continue;
+        }
+
+        if (sm != nullptr) {
+            auto playing = stillPlaying.find(smHandle);
+            if (playing == stillPlaying.end()) {
+                // Account the advance like an AdvanceStateMachine command so
+                // frame timing and input latency keep working.
+                Command advance(CommandType::AdvanceStateMachine);
+                advance.handle = smHandle;
+                advance.deltaTime = cmd.deltaTime;
+                const int64_t startNs = steadyClockNowNs();
+                const bool playingNow = advanceWithScheduledInputs(smHandle, sm, cmd.deltaTime);
+                noteCommandExecuted(advance, steadyClockNowNs() - startNs);
+                playing = stillPlaying.emplace(smHandle, playingNow).first;
+            }
+            view.settled = !playing->second;
+        } else {
+            // Without a state machine the artboard advances itself (nested
+            // artboards, layout); it settles once an advance changes nothing.
+            auto changed = artboardChanged.find(view.draw.artboardHandle);
+            if (changed == artboardChanged.end()) {
+                auto* artboard = artboardIt->second->artboard();
+                const bool changedNow = artboard != nullptr && artboard->advance(cmd.deltaTime);
+                changed = artboardChanged.emplace(view.draw.artboardHandle, changedNow).first;
+            }
+            view.settled = !changed->second;
+        }
+        view.dirty = false;
+
+        // Headless servers (tests, replays) still advance views
+        if (m_renderContext != nullptr) {
+            view.draw.enqueueTimeNs = cmd.enqueueTimeNs;
+            // The frame loop draws every tick; a per-frame callback would
+            // only flood the message queue, so views report no DrawComplete.
+            handleDraw(view.draw, false);
+        }
+
+        if (!view.settled || hasTimers) {
+            allSettled = false;
+        }
+        ++it;
+    }
+
+    m_viewsIdle.store(allSettled, std::memory_order_relaxed);
+}
+
+} // namespace rive_android
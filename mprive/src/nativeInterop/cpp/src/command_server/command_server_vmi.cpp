@@ -78,7 +78,9 @@ void CommandServer::handleCreateBlankVMI(const Command& cmd)
 
     auto& file = it->second;
 
-    // Get the ViewModelRuntime by name
+    // Get the ViewModelRuntime by name. The file may be shared, and each
+    // lookup adds a runtime to it.
+    auto fileLock = lockSharedFile(cmd.handle);
     auto* vmRuntime = file->viewModelByName(cmd.viewModelName);
     if (!vmRuntime) {
         LOGW("CommandServer: ViewModel not found: %s", cmd.viewModelName.c_str());
@@ -132,7 +134,9 @@ void CommandServer::handleCreateDefaultVMI(const Command& cmd)
 
     auto& file = it->second;
 
-    // Get the ViewModelRuntime by name
+    // Get the ViewModelRuntime by name. The file may be shared, and each
+    // lookup adds a runtime to it.
+    auto fileLock = lockSharedFile(cmd.handle);
     auto* vmRuntime = file->viewModelByName(cmd.viewModelName);
     if (!vmRuntime) {
         LOGW("CommandServer: ViewModel not found: %s", cmd.viewModelName.c_str());
@@ -187,7 +191,9 @@ void CommandServer::handleCreateNamedVMI(const Command& cmd)
 
     auto& file = it->second;
 
-    // Get the ViewModelRuntime by name
+    // Get the ViewModelRuntime by name. The file may be shared, and each
+    // lookup adds a runtime to it.
+    auto fileLock = lockSharedFile(cmd.handle);
     auto* vmRuntime = file->viewModelByName(cmd.viewModelName);
     if (!vmRuntime) {
         LOGW("CommandServer: ViewModel not found: %s", cmd.viewModelName.c_str());
@@ -230,8 +236,10 @@ void CommandServer::handleDeleteVMI(const Command& cmd)
          static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle));
 
     auto it = m_viewModelInstances.find(cmd.handle);
-    if (it != m_viewModelInstances.end()) {
-        m_viewModelInstances.erase(it);
+    if (it != m_viewModelInstances.end() || releasePendingVMI(cmd.handle)) {
+        if (it != m_viewModelInstances.end()) {
+            m_viewModelInstances.erase(it);
+        }
 
         LOGI("CommandServer: VMI deleted successfully (handle=%lld)",
              static_cast<long long>(cmd.handle));
@@ -287,7 +295,7 @@ void CommandServer::handleBindViewModelInstance(const Command& cmd)
     }
 
     // Look up VMI
-    auto vmiIt = m_viewModelInstances.find(cmd.vmiHandle);
+    auto vmiIt = findVMI(cmd.vmiHandle);
     if (vmiIt == m_viewModelInstances.end()) {
         Message msg(MessageType::VMIBindingError, cmd.requestID);
         msg.error = "Invalid ViewModelInstance handle";
@@ -299,6 +307,7 @@ void CommandServer::handleBindViewModelInstance(const Command& cmd)
     // StateMachineInstance::bindViewModelInstance takes rcp<ViewModelInstance>
     // ViewModelInstanceRuntime wraps a ViewModelInstance, use instance() to get it
     smIt->second->bindViewModelInstance(vmiIt->second->instance());
+    m_viewModelBindings[cmd.handle] = cmd.vmiHandle;
 
     Message msg(MessageType::VMIBindingSuccess, cmd.requestID);
     enqueueMessage(std::move(msg));
@@ -335,7 +344,11 @@ void CommandServer::handleGetDefaultVMI(const Command& cmd)
 
     // Get default VMI from file for the artboard
     // File::createDefaultViewModelInstance returns rcp<ViewModelInstance>
-    auto defaultVMI = fileIt->second->createDefaultViewModelInstance(artboard);
+    rive::rcp<rive::ViewModelInstance> defaultVMI;
+    {
+        auto fileLock = lockSharedFile(cmd.fileHandle);
+        defaultVMI = fileIt->second->createDefaultViewModelInstance(artboard);
+    }
 
     if (!defaultVMI) {
         // No default VMI for this artboard - return 0 handle (not an error, just no default)
@@ -360,4 +373,247 @@ void CommandServer::handleGetDefaultVMI(const Command& cmd)
     enqueueMessage(std::move(msg));
 }
 
-} // namespace rive_android
\ No newline at end of file
+// =============================================================================
+// Phase G.15: Bulk View Model Instances
+// =============================================================================
+
+int64_t CommandServer::createVMIBatch(int64_t requestID, int64_t fileHandle,
+                                      const std::string& viewModelName, int32_t count,
+                                      int64_t seedVmiHandle)
+{
+    // The range is taken on the calling thread so the caller can address
+    // every instance right away; commands using it are queued behind this one.
+    const int64_t firstHandle = count > 0 ? m_nextHandle.fetch_add(count) : 0;
+
+    LOGI("CommandServer: Enqueuing CreateVMIBatch command (requestID=%lld, fileHandle=%lld, vmName=%s, count=%d, first=%lld)",
+         static_cast<long long>(requestID), static_cast<long long>(fileHandle),
+         viewModelName.c_str(), count, static_cast<long long>(firstHandle));
+
+    Command cmd(CommandType::CreateVMIBatch, requestID);
+    cmd.handle = fileHandle;
+    cmd.viewModelName = viewModelName;
+    cmd.firstHandle = firstHandle;
+    cmd.instanceCount = count;
+    cmd.vmiHandle = seedVmiHandle;
+
+    enqueueCommand(std::move(cmd));
+    return firstHandle;
+}
+
+void CommandServer::handleCreateVMIBatch(const Command& cmd)
+{
+    LOGI("CommandServer: Handling CreateVMIBatch command (requestID=%lld, fileHandle=%lld, vmName=%s, count=%d)",
+         static_cast<long long>(cmd.requestID), static_cast<long long>(cmd.handle),
+         cmd.viewModelName.c_str(), cmd.instanceCount);
+
+    auto fail = [&](std::string error) {
+        LOGW("CommandServer: CreateVMIBatch failed: %s", error.c_str());
+
+        Message msg(MessageType::VMIError, cmd.requestID);
+        msg.error = std::move(error);
+        enqueueMessage(std::move(msg));
+    };
+
+    if (cmd.instanceCount <= 0) {
+        fail("Instance count must be positive");
+        return;
+    }
+
+    // A replayed capture carries its recorded range; keep later handles past it.
+    const int64_t endHandle = cmd.firstHandle + cmd.instanceCount;
+    int64_t next = m_nextHandle.load();
+    while (next < endHandle && !m_nextHandle.compare_exchange_weak(next, endHandle)) {
+    }
+    auto usedIt = m_viewModelInstances.lower_bound(cmd.firstHandle);
+    bool inUse = usedIt != m_viewModelInstances.end() && usedIt->first < endHandle;
+    // Batches don't overlap, so only the last one starting before the end can
+    auto batchIt = m_vmiBatches.lower_bound(endHandle);
+    if (!inUse && batchIt != m_vmiBatches.begin()) {
+        --batchIt;
+        inUse = batchIt->first + static_cast<int64_t>(batchIt->second.pending.size()) > cmd.firstHandle;
+    }
+    if (inUse) {
+        fail("ViewModelInstance handle range already in use");
+        return;
+    }
+
+    auto it = m_files.find(cmd.handle);
+    if (it == m_files.end()) {
+        fail("Invalid file handle");
+        return;
+    }
+
+    bool found;
+    {
+        auto fileLock = lockSharedFile(cmd.handle);
+        found = it->second->viewModelByName(cmd.viewModelName) != nullptr;
+    }
+    if (!found) {
+        fail("ViewModel not found: " + cmd.viewModelName);
+        return;
+    }
+
+    VMIBatch batch;
+    batch.fileHandle = cmd.handle;
+    batch.viewModelName = cmd.viewModelName;
+    batch.firstHandle = cmd.firstHandle;
+    batch.pending.assign(static_cast<size_t>(cmd.instanceCount), true);
+    batch.pendingCount = batch.pending.size();
+
+    if (cmd.vmiHandle != 0) {
+        auto seedIt = findVMI(cmd.vmiHandle);
+        if (seedIt == m_viewModelInstances.end()) {
+            fail("Invalid seed ViewModelInstance handle");
+            return;
+        }
+        auto& seed = seedIt->second;
+
+        // Snapshot the seed now, so writes to it after this command do not
+        // leak into instances that are created later. Values whose name and
+        // type the view model does not have are skipped when applied.
+        for (const auto& property : seed->properties()) {
+            VMISeedValue value;
+            value.name = property.name;
+            value.type = static_cast<PropertyDataType>(property.type);
+            switch (value.type) {
+                case PropertyDataType::NUMBER:
+                    if (auto* prop = seed->propertyNumber(property.name)) {
+                        value.numberValue = prop->value();
+                        batch.seedValues.push_back(std::move(value));
+                    }
+                    break;
+                case PropertyDataType::STRING:
+                    if (auto* prop = seed->propertyString(property.name)) {
+                        value.stringValue = prop->value();
+                        batch.seedValues.push_back(std::move(value));
+                    }
+                    break;
+                case PropertyDataType::BOOLEAN:
+                    if (auto* prop = seed->propertyBoolean(property.name)) {
+                        value.boolValue = prop->value();
+                        batch.seedValues.push_back(std::move(value));
+                    }
+                    break;
+                case PropertyDataType::ENUM:
+                    if (auto* prop = seed->propertyEnum(property.name)) {
+                        value.stringValue = prop->value();
+                        batch.seedValues.push_back(std::move(value));
+                    }
+                    break;
+                case PropertyDataType::COLOR:
+                    if (auto* prop = seed->propertyColor(property.name)) {
+                        value.colorValue = prop->value();
+                        batch.seedValues.push_back(std::move(value));
+                    }
+                    break;
+                default:
+                    // Lists, nested instances, images and artboards keep
+                    // the view model defaults.
+                    break;
+            }
+        }
+    }
+
+    LOGI("CommandServer: VMI batch reserved (first=%lld, count=%d, seedValues=%zu)",
+         static_cast<long long>(cmd.firstHandle), cmd.instanceCount, batch.seedValues.size());
+
+    m_vmiBatches[cmd.firstHandle] = std::move(batch);
+
+    Message msg(MessageType::VMICreated, cmd.requestID);
+    msg.handle = cmd.firstHandle;
+    enqueueMessage(std::move(msg));
+}
+
+std::map<int64_t, rive::rcp<rive::ViewModelInstanceRuntime>>::iterator
+CommandServer::findVMI(int64_t handle)
+{
+    auto it = m_viewModelInstances.find(handle);
+    if (it != m_viewModelInstances.end() || m_vmiBatches.empty()) {
+        return it;
+    }
+
+    auto batchIt = m_vmiBatches.upper_bound(handle);
+    if (batchIt == m_vmiBatches.begin()) {
+        return m_viewModelInstances.end();
+    }
+    --batchIt;
+    const auto& batch = batchIt->second;
+    const auto index = static_cast<size_t>(handle - batch.firstHandle);
+    if (index >= batch.pending.size() || !batch.pending[index]) {
+        return m_viewModelInstances.end();
+    }
+
+    rive::rcp<rive::ViewModelInstanceRuntime> instance;
+    auto fileIt = m_files.find(batch.fileHandle);
+    if (fileIt != m_files.end()) {
+        auto fileLock = lockSharedFile(batch.fileHandle);
+        if (auto* vmRuntime = fileIt->second->viewModelByName(batch.viewModelName)) {
+            instance = vmRuntime->createDefaultInstance();
+        }
+    }
+    if (!instance) {
+        // The view model could not be instantiated.
+        LOGW("CommandServer: Cannot create batched VMI %lld from file %lld",
+             static_cast<long long>(handle), static_cast<long long>(batch.fileHandle));
+        releasePendingVMI(handle);
+        return m_viewModelInstances.end();
+    }
+
+    for (const auto& value : batch.seedValues) {
+        switch (value.type) {
+            case PropertyDataType::NUMBER:
+                if (auto* prop = instance->propertyNumber(value.name)) {
+                    prop->value(value.numberValue);
+                }
+                break;
+            case PropertyDataType::STRING:
+                if (auto* prop = instance->propertyString(value.name)) {
+                    prop->value(value.stringValue);
+                }
+                break;
+            case PropertyDataType::BOOLEAN:
+                if (auto* prop = instance->propertyBoolean(value.name)) {
+                    prop->value(value.boolValue);
+                }
+                break;
+            case PropertyDataType::ENUM:
+                if (auto* prop = instance->propertyEnum(value.name)) {
+                    prop->value(value.stringValue);
+                }
+                break;
+            case PropertyDataType::COLOR:
+                if (auto* prop = instance->propertyColor(value.name)) {
+                    prop->value(value.colorValue);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    releasePendingVMI(handle);
+    m_viewModelInstances[handle] = instance;
+    return m_viewModelInstances.find(handle);
+}
+
+bool CommandServer::releasePendingVMI(int64_t handle)
+{
+    auto batchIt = m_vmiBatches.upper_bound(handle);
+    if (batchIt == m_vmiBatches.begin()) {
+        return false;
+    }
+    --batchIt;
+    auto& batch = batchIt->second;
+    const auto index = static_cast<size_t>(handle - batch.firstHandle);
+    if (index >= batch.pending.size() || !batch.pending[index]) {
+        return false;
+    }
+
+    batch.pending[index] = false;
+    if (--batch.pendingCount == 0) {
+        m_vmiBatches.erase(batchIt);
+    }
+    return true;
+}
+
+} // namespace rive_android
@@ -0,0 +1,100 @@
+#include "shared_file_registry.hpp"
+#include "rive_log.hpp"
+#include "utils/no_op_factory.hpp"
+
+namespace rive_android {
+
+uint64_t contentHash(const uint8_t* bytes, size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+SharedFileRegistry& SharedFileRegistry::instance()
+{
+    static SharedFileRegistry registry;
+    return registry;
+}
+
+rive::Factory* SharedFileRegistry::headlessFactory()
+{
+    static rive::NoOpFactory factory;
+    return &factory;
+}
+
+rive::rcp<rive::File> SharedFileRegistry::acquire(const Key& key, size_t size)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end() || (size != 0 && it->second.size != size)) {
+        return nullptr;
+    }
+    it->second.references++;
+    return it->second.file;
+}
+
+rive::rcp<rive::File> SharedFileRegistry::publish(const Key& key, size_t size, rive::rcp<rive::File> file)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        if (it->second.size == size) {
+            // Another server finished importing the same bytes first.
+            it->second.references++;
+            return it->second.file;
+        }
+        // A hash collision between different files: keep the new file
+        // private rather than handing out the wrong one.
+        LOGW("SharedFileRegistry: Hash collision (hash=%llx), file not shared",
+             static_cast<unsigned long long>(key.hash));
+        return nullptr;
+    }
+
+    Entry entry;
+    entry.file = std::move(file);
+    entry.fileMutex = std::make_shared<std::mutex>();
+    entry.size = size;
+    entry.references = 1;
+    auto inserted = m_entries.emplace(key, std::move(entry));
+    LOGI("SharedFileRegistry: Registered file (hash=%llx, size=%zu, files=%zu)",
+         static_cast<unsigned long long>(key.hash), size, m_entries.size());
+    return inserted.first->second.file;
+}
+
+std::shared_ptr<std::mutex> SharedFileRegistry::fileMutex(const Key& key) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    return it != m_entries.end() ? it->second.fileMutex : nullptr;
+}
+
+void SharedFileRegistry::release(const Key& key)
+{
+    rive::rcp<rive::File> last;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end()) {
+            return;
+        }
+        if (--it->second.references > 0) {
+            return;
+        }
+        last = std::move(it->second.file);
+        m_entries.erase(it);
+    }
+    // The file may be destroyed here; do it outside the lock.
+    LOGI("SharedFileRegistry: Released file (hash=%llx)", static_cast<unsigned long long>(key.hash));
+}
+
+size_t SharedFileRegistry::fileCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+} // namespace rive_android
@@ -0,0 +1,250 @@
+#include "compressed_texture_cache.hpp"
+#include "etc2_encoder.hpp"
+#include "mipmap_builder.hpp"
+#include "rive_log.hpp"
+#include "shared_file_registry.hpp"
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Log prefix for CompressedTextureCache messages (embedded in log strings since macros already provide LOG_TAG)
+#define CTC_PREFIX "[CompressedTextureCache] "
+
+namespace rive_mp
+{
+
+namespace
+{
+constexpr char kMagic[4] = {'R', 'V', 'T', 'C'};
+constexpr uint32_t kFileVersion = 2;
+
+struct FileHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t glFormat;
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelCount;
+    /** FNV-1a over every level's bytes, in order. */
+    uint64_t checksum;
+};
+
+constexpr uint64_t kFNVOffset = 0xcbf29ce484222325ull;
+
+uint64_t checksumLevels(const std::vector<std::vector<uint8_t>>& levels)
+{
+    uint64_t hash = kFNVOffset;
+    for (const auto& level : levels)
+    {
+        for (uint8_t byte : level)
+        {
+            hash ^= byte;
+            hash *= 0x100000001b3ull;
+        }
+    }
+    return hash;
+}
+
+bool readFileHeader(FILE* file, FileHeader* header)
+{
+    if (fread(header, sizeof(FileHeader), 1, file) != 1)
+    {
+        return false;
+    }
+    return memcmp(header->magic, kMagic, sizeof(kMagic)) == 0 &&
+           header->version == kFileVersion &&
+           header->glFormat == kGLCompressedRGBA8ETC2EAC && header->width > 0 &&
+           header->height > 0 &&
+           header->levelCount == MipLevelCount(header->width, header->height);
+}
+} // namespace
+
+std::mutex CompressedTextureCache::s_mutex;
+std::string CompressedTextureCache::s_directory;
+std::atomic<bool> CompressedTextureCache::s_enabled{false};
+std::atomic<uint64_t> CompressedTextureCache::s_hits{0};
+std::atomic<uint64_t> CompressedTextureCache::s_misses{0};
+
+bool CompressedTextureCache::configure(const std::string& directory)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (directory.empty())
+    {
+        s_directory.clear();
+        s_enabled.store(false, std::memory_order_release);
+        LOGD(CTC_PREFIX "Disabled");
+        return false;
+    }
+
+    if (mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST)
+    {
+        LOGE(CTC_PREFIX "Cannot create %s (%s); cache disabled",
+             directory.c_str(),
+             strerror(errno));
+        s_directory.clear();
+        s_enabled.store(false, std::memory_order_release);
+        return false;
+    }
+    s_directory = directory;
+    s_enabled.store(true, std::memory_order_release);
+    LOGD(CTC_PREFIX "Enabled in %s", directory.c_str());
+    return true;
+}
+
+uint64_t CompressedTextureCache::keyFor(const uint8_t* encodedBytes, size_t size)
+{
+    // Fold the settings into the content hash (FNV-1a step per word)
+    uint64_t key = rive_android::contentHash(encodedBytes, size);
+    const uint32_t settings[] = {kGLCompressedRGBA8ETC2EAC, kETC2EncoderVersion, kFileVersion};
+    for (uint32_t value : settings)
+    {
+        key ^= value;
+        key *= 0x100000001b3ull;
+    }
+    return key;
+}
+
+std::string CompressedTextureCache::pathFor(uint64_t key)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_directory.empty())
+    {
+        return {};
+    }
+    char name[32];
+    snprintf(name, sizeof(name), "%016" PRIx64 ".rvtc", key);
+    return s_directory + "/" + name;
+}
+
+bool CompressedTextureCache::load(uint64_t key, CompressedTexture* texture)
+{
+    auto path = pathFor(key);
+    FILE* file = path.empty() ? nullptr : fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        s_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    FileHeader header;
+    bool valid = readFileHeader(file, &header);
+    if (valid)
+    {
+        texture->glFormat = header.glFormat;
+        texture->width = header.width;
+        texture->height = header.height;
+        texture->levels.assign(header.levelCount, {});
+
+        uint32_t levelWidth = header.width;
+        uint32_t levelHeight = header.height;
+        for (auto& level : texture->levels)
+        {
+            uint32_t size = 0;
+            if (fread(&size, sizeof(size), 1, file) != 1 ||
+                size != ETC2RGBA8Size(levelWidth, levelHeight))
+            {
+                valid = false;
+                break;
+            }
+            level.resize(size);
+            if (fread(level.data(), 1, size, file) != size)
+            {
+                valid = false;
+                break;
+            }
+            levelWidth = MipLevelSize(levelWidth);
+            levelHeight = MipLevelSize(levelHeight);
+        }
+        // Nothing may follow the last level, and the blocks must be intact
+        valid = valid && fgetc(file) == EOF && checksumLevels(texture->levels) == header.checksum;
+    }
+    fclose(file);
+
+    if (!valid)
+    {
+        LOGW(CTC_PREFIX "Deleting invalid entry %s", path.c_str());
+        ::remove(path.c_str());
+        texture->levels.clear();
+        s_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    s_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool CompressedTextureCache::store(uint64_t key, const CompressedTexture& texture)
+{
+    auto path = pathFor(key);
+    if (path.empty())
+    {
+        return false;
+    }
+
+    // Write beside the final name, then rename: readers only ever see
+    // complete entries. Each writer gets its own temp file, so two workers
+    // (or processes) storing the same key never write into one file.
+    std::string tempPath = path + ".tmp.XXXXXX";
+    const int fd = mkstemp(&tempPath[0]);
+    FILE* file = fd >= 0 ? fdopen(fd, "wb") : nullptr;
+    if (file == nullptr)
+    {
+        LOGW(CTC_PREFIX "Cannot write %s (%s)", tempPath.c_str(), strerror(errno));
+        if (fd >= 0)
+        {
+            close(fd);
+            ::remove(tempPath.c_str());
+        }
+        return false;
+    }
+
+    FileHeader header;
+    memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kFileVersion;
+    header.glFormat = texture.glFormat;
+    header.width = texture.width;
+    header.height = texture.height;
+    header.levelCount = static_cast<uint32_t>(texture.levels.size());
+    header.checksum = checksumLevels(texture.levels);
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (const auto& level : texture.levels)
+    {
+        if (!written)
+        {
+            break;
+        }
+        const uint32_t size = static_cast<uint32_t>(level.size());
+        written = fwrite(&size, sizeof(size), 1, file) == 1 &&
+                  fwrite(level.data(), 1, level.size(), file) == level.size();
+    }
+    written = (fclose(file) == 0) && written;
+
+    if (!written || rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        LOGW(CTC_PREFIX "Failed to write %s", path.c_str());
+        ::remove(tempPath.c_str());
+        return false;
+    }
+    LOGD(CTC_PREFIX "Stored %ux%u texture (%zu levels)",
+         texture.width,
+         texture.height,
+         texture.levels.size());
+    return true;
+}
+
+void CompressedTextureCache::remove(uint64_t key)
+{
+    auto path = pathFor(key);
+    if (!path.empty())
+    {
+        ::remove(path.c_str());
+    }
+}
+
+} // namespace rive_mp
@@ -0,0 +1,537 @@
+#include "deferred_factory.hpp"
+#include "rive_log.hpp"
+
+#include <chrono>
+#include <cstring>
+
+// Log prefix for DeferredFactory messages (embedded in log strings since macros already provide LOG_TAG)
+#define DF_PREFIX "[DeferredFactory] "
+
+namespace rive_mp
+{
+
+namespace
+{
+int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+constexpr int64_t kTrimIntervalNs = 1'000'000'000LL;
+} // namespace
+
+// =============================================================================
+// DeferredRenderPath
+// =============================================================================
+
+DeferredRenderPath::DeferredRenderPath(DeferredFactory* factory, rive::FillRule fillRule) :
+    DeferredResource(factory), m_fillRule(fillRule)
+{
+    m_owner->track(static_cast<rive::RenderPath*>(this), this);
+}
+
+DeferredRenderPath::DeferredRenderPath(DeferredFactory* factory,
+                                       rive::RawPath& rawPath,
+                                       rive::FillRule fillRule) :
+    DeferredResource(factory), m_fillRule(fillRule)
+{
+    m_rawPath.swap(rawPath);
+    m_owner->track(static_cast<rive::RenderPath*>(this), this);
+}
+
+DeferredRenderPath::~DeferredRenderPath()
+{
+    m_owner->untrack(static_cast<rive::RenderPath*>(this));
+}
+
+void DeferredRenderPath::rewind()
+{
+    if (m_real != nullptr)
+    {
+        forwardToReal()->rewind();
+        return;
+    }
+    m_rawPath.rewind();
+    m_dirty = true;
+}
+
+void DeferredRenderPath::addRenderPath(rive::RenderPath* path, const rive::Mat2D& transform)
+{
+    // The runtime only combines paths from the factory it imported with.
+    auto* source = path != nullptr ? lite_rtti_cast<DeferredRenderPath*>(path) : nullptr;
+    if (source == nullptr || source->owner() != m_owner)
+    {
+        LOGW(DF_PREFIX "addRenderPath: ignoring a path from another factory");
+        return;
+    }
+    if (m_real == nullptr && !source->m_forwarding)
+    {
+        m_rawPath.addPath(source->m_rawPath, &transform);
+        m_dirty = true;
+        return;
+    }
+    // A forwarding source's contours only exist in its real path
+    forwardToReal()->addRenderPath(source->syncReal(), transform);
+}
+
+void DeferredRenderPath::addRawPath(const rive::RawPath& path)
+{
+    if (m_real != nullptr)
+    {
+        forwardToReal()->addRawPath(path);
+        return;
+    }
+    m_rawPath.addPath(path);
+    m_dirty = true;
+}
+
+void DeferredRenderPath::moveTo(float x, float y)
+{
+    if (m_real != nullptr)
+    {
+        forwardToReal()->moveTo(x, y);
+        return;
+    }
+    m_rawPath.moveTo(x, y);
+    m_dirty = true;
+}
+
+void DeferredRenderPath::lineTo(float x, float y)
+{
+    if (m_real != nullptr)
+    {
+        forwardToReal()->lineTo(x, y);
+        return;
+    }
+    m_rawPath.lineTo(x, y);
+    m_dirty = true;
+}
+
+void DeferredRenderPath::cubicTo(float ox, float oy, float ix, float iy, float x, float y)
+{
+    if (m_real != nullptr)
+    {
+        forwardToReal()->cubicTo(ox, oy, ix, iy, x, y);
+        return;
+    }
+    m_rawPath.cubicTo(ox, oy, ix, iy, x, y);
+    m_dirty = true;
+}
+
+void DeferredRenderPath::close()
+{
+    if (m_real != nullptr)
+    {
+        forwardToReal()->close();
+        return;
+    }
+    m_rawPath.close();
+    m_dirty = true;
+}
+
+void DeferredRenderPath::fillRule(rive::FillRule value)
+{
+    m_fillRule = value;
+    if (m_real != nullptr)
+    {
+        forwardToReal()->fillRule(value);
+        return;
+    }
+    m_dirty = true;
+}
+
+rive::RenderPath* DeferredRenderPath::syncReal()
+{
+    if (m_real == nullptr)
+    {
+        m_real = m_owner->inner()->makeEmptyRenderPath();
+        setMaterialized(true);
+        m_owner->noteMaterialized();
+        m_dirty = true;
+    }
+    if (m_dirty)
+    {
+        m_real->rewind();
+        m_real->fillRule(m_fillRule);
+        m_real->addRawPath(m_rawPath);
+        m_dirty = false;
+    }
+    return m_real.get();
+}
+
+rive::RenderPath* DeferredRenderPath::forwardToReal()
+{
+    auto* real = syncReal();
+    if (!m_forwarding)
+    {
+        // The real path is up to date; from here on it is the only copy.
+        rive::RawPath().swap(m_rawPath);
+        m_forwarding = true;
+    }
+    return real;
+}
+
+rive::RenderPath* DeferredRenderPath::materialize(int64_t frameNs)
+{
+    m_lastUsedNs = frameNs;
+    return syncReal();
+}
+
+bool DeferredRenderPath::releaseMaterialized()
+{
+    if (m_forwarding)
+    {
+        return false; // Nothing to rebuild it from
+    }
+    m_real = nullptr;
+    setMaterialized(false);
+    return true;
+}
+
+// =============================================================================
+// DeferredRenderPaint
+// =============================================================================
+
+DeferredRenderPaint::DeferredRenderPaint(DeferredFactory* factory) : DeferredResource(factory)
+{
+    m_owner->track(static_cast<rive::RenderPaint*>(this), this);
+}
+
+DeferredRenderPaint::~DeferredRenderPaint()
+{
+    m_owner->untrack(static_cast<rive::RenderPaint*>(this));
+}
+
+// Setters record the value and keep a live real paint in sync.
+void DeferredRenderPaint::style(rive::RenderPaintStyle style)
+{
+    m_style = style;
+    if (m_real) m_real->style(style);
+}
+
+void DeferredRenderPaint::color(rive::ColorInt value)
+{
+    m_color = value;
+    if (m_real) m_real->color(value);
+}
+
+void DeferredRenderPaint::thickness(float value)
+{
+    m_thickness = value;
+    if (m_real) m_real->thickness(value);
+}
+
+void DeferredRenderPaint::join(rive::StrokeJoin value)
+{
+    m_join = value;
+    if (m_real) m_real->join(value);
+}
+
+void DeferredRenderPaint::cap(rive::StrokeCap value)
+{
+    m_cap = value;
+    if (m_real) m_real->cap(value);
+}
+
+void DeferredRenderPaint::blendMode(rive::BlendMode value)
+{
+    m_blendMode = value;
+    if (m_real) m_real->blendMode(value);
+}
+
+void DeferredRenderPaint::shader(rive::rcp<rive::RenderShader> shader)
+{
+    m_shader = shader;
+    if (m_real) m_real->shader(std::move(shader));
+}
+
+void DeferredRenderPaint::invalidateStroke()
+{
+    if (m_real) m_real->invalidateStroke();
+}
+
+rive::RenderPaint* DeferredRenderPaint::materialize(int64_t frameNs)
+{
+    m_lastUsedNs = frameNs;
+    if (m_real == nullptr)
+    {
+        m_real = m_owner->inner()->makeRenderPaint();
+        m_real->style(m_style);
+        m_real->color(m_color);
+        m_real->thickness(m_thickness);
+        m_real->join(m_join);
+        m_real->cap(m_cap);
+        m_real->blendMode(m_blendMode);
+        m_real->shader(m_shader);
+        setMaterialized(true);
+        m_owner->noteMaterialized();
+    }
+    return m_real.get();
+}
+
+// =============================================================================
+// DeferredRenderBuffer
+// =============================================================================
+
+DeferredRenderBuffer::DeferredRenderBuffer(DeferredFactory* factory,
+                                           rive::RenderBufferType type,
+                                           rive::RenderBufferFlags flags,
+                                           size_t sizeInBytes) :
+    LITE_RTTI_OVERRIDE(rive::RenderBuffer, DeferredRenderBuffer)(type, flags, sizeInBytes),
+    DeferredResource(factory),
+    m_data(sizeInBytes)
+{
+    m_owner->track(static_cast<rive::RenderBuffer*>(this), this);
+}
+
+DeferredRenderBuffer::~DeferredRenderBuffer()
+{
+    m_owner->untrack(static_cast<rive::RenderBuffer*>(this));
+}
+
+rive::rcp<rive::RenderBuffer> DeferredRenderBuffer::materialize(int64_t frameNs)
+{
+    m_lastUsedNs = frameNs;
+
+    // A mapped-once buffer cannot take new contents; replace it instead.
+    const bool mappedOnce =
+        (static_cast<uint32_t>(flags()) &
+         static_cast<uint32_t>(rive::RenderBufferFlags::mappedOnceAtInitialization)) != 0;
+    if (m_real != nullptr && m_dirty && mappedOnce)
+    {
+        m_real = nullptr;
+        setMaterialized(false);
+    }
+    if (m_real == nullptr)
+    {
+        m_real = m_owner->inner()->makeRenderBuffer(type(), flags(), sizeInBytes());
+        if (m_real == nullptr)
+        {
+            return nullptr;
+        }
+        setMaterialized(true);
+        m_owner->noteMaterialized();
+        m_dirty = true;
+    }
+    if (m_dirty)
+    {
+        memcpy(m_real->map(), m_data.data(), m_data.size());
+        m_real->unmap();
+        m_dirty = false;
+    }
+    return m_real;
+}
+
+// =============================================================================
+// DeferredFactory
+// =============================================================================
+
+DeferredFactory::DeferredFactory(rive::Factory* inner) : m_inner(inner) {}
+
+rive::rcp<rive::RenderBuffer> DeferredFactory::makeRenderBuffer(rive::RenderBufferType type,
+                                                                rive::RenderBufferFlags flags,
+                                                                size_t sizeInBytes)
+{
+    return rive::make_rcp<DeferredRenderBuffer>(this, type, flags, sizeInBytes);
+}
+
+rive::rcp<rive::RenderShader> DeferredFactory::makeLinearGradient(float sx,
+                                                                  float sy,
+                                                                  float ex,
+                                                                  float ey,
+                                                                  const rive::ColorInt colors[],
+                                                                  const float stops[],
+                                                                  size_t count)
+{
+    return m_inner->makeLinearGradient(sx, sy, ex, ey, colors, stops, count);
+}
+
+rive::rcp<rive::RenderShader> DeferredFactory::makeRadialGradient(float cx,
+                                                                  float cy,
+                                                                  float radius,
+                                                                  const rive::ColorInt colors[],
+                                                                  const float stops[],
+                                                                  size_t count)
+{
+    return m_inner->makeRadialGradient(cx, cy, radius, colors, stops, count);
+}
+
+rive::rcp<rive::RenderPath> DeferredFactory::makeRenderPath(rive::RawPath& rawPath,
+                                                            rive::FillRule fillRule)
+{
+    return rive::make_rcp<DeferredRenderPath>(this, rawPath, fillRule);
+}
+
+rive::rcp<rive::RenderPath> DeferredFactory::makeEmptyRenderPath()
+{
+    return rive::make_rcp<DeferredRenderPath>(this, rive::FillRule::nonZero);
+}
+
+rive::rcp<rive::RenderPaint> DeferredFactory::makeRenderPaint()
+{
+    return rive::make_rcp<DeferredRenderPaint>(this);
+}
+
+rive::rcp<rive::RenderImage> DeferredFactory::decodeImage(rive::Span<const uint8_t> encodedBytes)
+{
+    return m_inner->decodeImage(encodedBytes);
+}
+
+void DeferredFactory::beginFrame()
+{
+    m_frameNs = nowNs();
+    if (m_lastTrimNs == 0)
+    {
+        m_lastTrimNs = m_frameNs;
+    }
+}
+
+size_t DeferredFactory::trim(bool force)
+{
+    const int64_t now = m_frameNs != 0 ? m_frameNs : nowNs();
+    if (!force && now - m_lastTrimNs < kTrimIntervalNs)
+    {
+        return 0;
+    }
+    m_lastTrimNs = now;
+
+    // Release under the lock. An object whose last reference drops on another
+    // thread blocks in untrack() until we are done, so every tracked object
+    // stays alive here. Taking references instead would revive objects that
+    // are already being destroyed. Releasing only drops real objects from the
+    // inner factory, which never call back into this one.
+    size_t released = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& entry : m_objects)
+        {
+            DeferredResource* resource = entry.second;
+            if (resource->isMaterialized() && now - resource->lastUsedNs() >= m_idleReleaseNs &&
+                resource->releaseMaterialized())
+            {
+                released++;
+            }
+        }
+    }
+    m_releases.fetch_add(static_cast<int64_t>(released), std::memory_order_relaxed);
+    if (released != 0)
+    {
+        LOGD(DF_PREFIX "Released %zu idle render objects", released);
+    }
+    return released;
+}
+
+DeferredFactory::Stats DeferredFactory::stats() const
+{
+    Stats stats;
+    stats.materializations = m_materializations.load(std::memory_order_relaxed);
+    stats.releases = m_releases.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    stats.liveObjects = static_cast<int64_t>(m_objects.size());
+    for (const auto& entry : m_objects)
+    {
+        if (entry.second->isMaterialized())
+        {
+            stats.materializedObjects++;
+        }
+    }
+    return stats;
+}
+
+void DeferredFactory::track(const void* object, DeferredResource* resource)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_objects.emplace(object, resource);
+}
+
+void DeferredFactory::untrack(const void* object)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_objects.erase(object);
+}
+
+// =============================================================================
+// DeferredRenderer
+// =============================================================================
+
+// Deferred objects are recognized by their lite RTTI type: no lock or lookup
+// per draw call.
+
+rive::RenderPath* DeferredRenderer::resolve(rive::RenderPath* path) const
+{
+    auto* deferred = m_factory != nullptr && path != nullptr
+                         ? lite_rtti_cast<DeferredRenderPath*>(path)
+                         : nullptr;
+    if (deferred == nullptr || deferred->owner() != m_factory)
+    {
+        return path;
+    }
+    return deferred->materialize(m_factory->frameNs());
+}
+
+rive::RenderPaint* DeferredRenderer::resolve(rive::RenderPaint* paint) const
+{
+    auto* deferred = m_factory != nullptr && paint != nullptr
+                         ? lite_rtti_cast<DeferredRenderPaint*>(paint)
+                         : nullptr;
+    if (deferred == nullptr || deferred->owner() != m_factory)
+    {
+        return paint;
+    }
+    return deferred->materialize(m_factory->frameNs());
+}
+
+rive::rcp<rive::RenderBuffer> DeferredRenderer::resolve(rive::rcp<rive::RenderBuffer> buffer) const
+{
+    auto* deferred = m_factory != nullptr && buffer != nullptr
+                         ? lite_rtti_cast<DeferredRenderBuffer*>(buffer.get())
+                         : nullptr;
+    if (deferred == nullptr || deferred->owner() != m_factory)
+    {
+        return buffer;
+    }
+    return deferred->materialize(m_factory->frameNs());
+}
+
+void DeferredRenderer::clipPath(rive::RenderPath* path)
+{
+    m_renderer->clipPath(resolve(path));
+}
+
+void DeferredRenderer::drawPath(rive::RenderPath* path, rive::RenderPaint* paint)
+{
+    m_renderer->drawPath(resolve(path), resolve(paint));
+}
+
+void DeferredRenderer::drawImage(const rive::RenderImage* image,
+                                 rive::ImageSampler options,
+                                 rive::BlendMode blendMode,
+                                 float opacity)
+{
+    m_renderer->drawImage(image, options, blendMode, opacity);
+}
+
+void DeferredRenderer::drawImageMesh(const rive::RenderImage* image,
+                                     rive::ImageSampler options,
+                                     rive::rcp<rive::RenderBuffer> vertices_f32,
+                                     rive::rcp<rive::RenderBuffer> uvCoords_f32,
+                                     rive::rcp<rive::RenderBuffer> indices_u16,
+                                     uint32_t vertexCount,
+                                     uint32_t indexCount,
+                                     rive::BlendMode blendMode,
+                                     float opacity)
+{
+    m_renderer->drawImageMesh(image,
+                              options,
+                              resolve(std::move(vertices_f32)),
+                              resolve(std::move(uvCoords_f32)),
+                              resolve(std::move(indices_u16)),
+                              vertexCount,
+                              indexCount,
+                              blendMode,
+                              opacity);
+}
+
+} // namespace rive_mp
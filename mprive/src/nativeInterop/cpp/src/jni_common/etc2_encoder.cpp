@@ -0,0 +1,261 @@
+#include "etc2_encoder.hpp"
+
+#include <algorithm>
+#include <climits>
+
+namespace rive_mp {
+
+namespace {
+
+// ETC1/ETC2 color modifier tables; the index stored per pixel picks
+// +small, +large, -small, -large.
+const int kColorModifiers[8][2] = {
+    {2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183},
+};
+
+// EAC alpha modifier tables.
+const int kAlphaModifiers[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14},  {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12},  {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11},  {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10},  {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9},   {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9},   {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9},   {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8},    {-3, -5, -7, -9, 2, 4, 6, 8},
+};
+
+inline int clamp255(int v) { return v < 0 ? 0 : (v > 255 ? 255 : v); }
+
+// Pixels of a block in ETC order: index = x * 4 + y.
+struct Block {
+    uint8_t px[16][4];
+};
+
+void loadBlock(const uint8_t* rgba, uint32_t width, uint32_t height,
+               uint32_t bx, uint32_t by, Block* block) {
+    for (uint32_t x = 0; x < 4; ++x) {
+        const uint32_t sx = std::min(bx + x, width - 1);
+        for (uint32_t y = 0; y < 4; ++y) {
+            const uint32_t sy = std::min(by + y, height - 1);
+            const uint8_t* p = rgba + (static_cast<size_t>(sy) * width + sx) * 4;
+            std::copy(p, p + 4, block->px[x * 4 + y]);
+        }
+    }
+}
+
+// Pixels of subblock `half` (0/1) for a flip setting.
+void subblockPixels(bool flip, int half, int indices[8]) {
+    int n = 0;
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 4; ++y) {
+            const int side = flip ? (y >= 2) : (x >= 2);
+            if (side == half) {
+                indices[n++] = x * 4 + y;
+            }
+        }
+    }
+}
+
+struct SubblockFit {
+    int table = 0;
+    uint32_t error = UINT_MAX;
+    uint8_t selectors[8] = {};  // 2-bit ETC pixel indices
+};
+
+// Best table and per-pixel modifiers for a subblock with a fixed base color.
+SubblockFit fitSubblock(const Block& block, const int indices[8], const int base[3]) {
+    SubblockFit best;
+    for (int table = 0; table < 8; ++table) {
+        const int small = kColorModifiers[table][0];
+        const int large = kColorModifiers[table][1];
+        const int deltas[4] = {small, large, -small, -large};
+        SubblockFit fit;
+        fit.table = table;
+        fit.error = 0;
+        for (int i = 0; i < 8 && fit.error < best.error; ++i) {
+            const uint8_t* p = block.px[indices[i]];
+            uint32_t bestError = UINT_MAX;
+            for (int s = 0; s < 4; ++s) {
+                uint32_t error = 0;
+                for (int c = 0; c < 3; ++c) {
+                    const int d = clamp255(base[c] + deltas[s]) - p[c];
+                    error += static_cast<uint32_t>(d * d);
+                }
+                if (error < bestError) {
+                    bestError = error;
+                    fit.selectors[i] = static_cast<uint8_t>(s);
+                }
+            }
+            fit.error += bestError;
+        }
+        if (fit.error < best.error) {
+            best = fit;
+        }
+    }
+    return best;
+}
+
+void averageColor(const Block& block, const int indices[8], int avg[3]) {
+    for (int c = 0; c < 3; ++c) {
+        int sum = 0;
+        for (int i = 0; i < 8; ++i) {
+            sum += block.px[indices[i]][c];
+        }
+        avg[c] = (sum + 4) / 8;
+    }
+}
+
+struct ColorCandidate {
+    uint64_t bits = 0;
+    uint32_t error = UINT_MAX;
+};
+
+uint64_t packSelectors(const int indices[2][8], const SubblockFit fits[2]) {
+    uint64_t msb = 0;
+    uint64_t lsb = 0;
+    for (int half = 0; half < 2; ++half) {
+        for (int i = 0; i < 8; ++i) {
+            const int pixel = indices[half][i];
+            const uint8_t s = fits[half].selectors[i];
+            msb |= static_cast<uint64_t>(s >> 1) << pixel;
+            lsb |= static_cast<uint64_t>(s & 1) << pixel;
+        }
+    }
+    return (msb << 16) | lsb;
+}
+
+ColorCandidate encodeColor(const Block& block, bool flip) {
+    int indices[2][8];
+    subblockPixels(flip, 0, indices[0]);
+    subblockPixels(flip, 1, indices[1]);
+
+    int avg[2][3];
+    averageColor(block, indices[0], avg[0]);
+    averageColor(block, indices[1], avg[1]);
+
+    // Differential mode when the 5-bit colors are close enough, else
+    // individual mode with 4-bit colors.
+    int q5[2][3];
+    bool differential = true;
+    for (int c = 0; c < 3; ++c) {
+        q5[0][c] = (avg[0][c] * 31 + 127) / 255;
+        q5[1][c] = (avg[1][c] * 31 + 127) / 255;
+        const int d = q5[1][c] - q5[0][c];
+        differential = differential && d >= -4 && d <= 3;
+    }
+
+    int base[2][3];
+    int stored[2][3];
+    for (int half = 0; half < 2; ++half) {
+        for (int c = 0; c < 3; ++c) {
+            if (differential) {
+                stored[half][c] = q5[half][c];
+                base[half][c] = (q5[half][c] << 3) | (q5[half][c] >> 2);
+            } else {
+                const int q4 = (avg[half][c] * 15 + 127) / 255;
+                stored[half][c] = q4;
+                base[half][c] = (q4 << 4) | q4;
+            }
+        }
+    }
+
+    SubblockFit fits[2] = {fitSubblock(block, indices[0], base[0]),
+                           fitSubblock(block, indices[1], base[1])};
+
+    uint64_t bits = 0;
+    for (int c = 0; c < 3; ++c) {
+        const int shift = 59 - c * 8;  // R at 63, G at 55, B at 47
+        if (differential) {
+            const int d = (stored[1][c] - stored[0][c]) & 7;
+            bits |= static_cast<uint64_t>(stored[0][c]) << shift;
+            bits |= static_cast<uint64_t>(d) << (shift - 3);
+        } else {
+            bits |= static_cast<uint64_t>(stored[0][c]) << (shift + 1);
+            bits |= static_cast<uint64_t>(stored[1][c]) << (shift - 3);
+        }
+    }
+    bits |= static_cast<uint64_t>(fits[0].table) << 37;
+    bits |= static_cast<uint64_t>(fits[1].table) << 34;
+    bits |= static_cast<uint64_t>(differential ? 1 : 0) << 33;
+    bits |= static_cast<uint64_t>(flip ? 1 : 0) << 32;
+    bits |= packSelectors(indices, fits);
+
+    ColorCandidate candidate;
+    candidate.bits = bits;
+    candidate.error = fits[0].error + fits[1].error;
+    return candidate;
+}
+
+uint64_t encodeAlpha(const Block& block) {
+    int minA = 255;
+    int maxA = 0;
+    for (int i = 0; i < 16; ++i) {
+        minA = std::min<int>(minA, block.px[i][3]);
+        maxA = std::max<int>(maxA, block.px[i][3]);
+    }
+
+    uint64_t bestBits = 0;
+    uint32_t bestError = UINT_MAX;
+    for (int table = 0; table < 16 && bestError > 0; ++table) {
+        const int* mods = kAlphaModifiers[table];
+        const int span = mods[7] - mods[3];  // largest positive - most negative
+        const int ideal = (maxA - minA + span / 2) / span;
+        for (int mult = std::max(1, ideal - 1); mult <= std::min(15, ideal + 1); ++mult) {
+            const int base = clamp255((minA + maxA + 1) / 2 -
+                                      ((mods[7] + mods[3]) * mult) / 2);
+            uint32_t error = 0;
+            uint64_t selectors = 0;
+            for (int i = 0; i < 16; ++i) {
+                const int a = block.px[i][3];
+                int bestSel = 0;
+                int bestDiff = INT_MAX;
+                for (int s = 0; s < 8; ++s) {
+                    const int d = std::abs(clamp255(base + mods[s] * mult) - a);
+                    if (d < bestDiff) {
+                        bestDiff = d;
+                        bestSel = s;
+                    }
+                }
+                error += static_cast<uint32_t>(bestDiff * bestDiff);
+                selectors |= static_cast<uint64_t>(bestSel) << (45 - i * 3);
+            }
+            if (error < bestError) {
+                bestError = error;
+                bestBits = (static_cast<uint64_t>(base) << 56) |
+                           (static_cast<uint64_t>(mult) << 52) |
+                           (static_cast<uint64_t>(table) << 48) | selectors;
+            }
+        }
+    }
+    return bestBits;
+}
+
+void storeBigEndian(uint64_t bits, uint8_t* out) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<uint8_t>(bits >> (56 - i * 8));
+    }
+}
+
+} // namespace
+
+void EncodeETC2RGBA8(const uint8_t* rgba, uint32_t width, uint32_t height, uint8_t* out) {
+    Block block;
+    for (uint32_t by = 0; by < height; by += 4) {
+        for (uint32_t bx = 0; bx < width; bx += 4) {
+            loadBlock(rgba, width, height, bx, by, &block);
+
+            ColorCandidate color = encodeColor(block, false);
+            ColorCandidate flipped = encodeColor(block, true);
+            if (flipped.error < color.error) {
+                color = flipped;
+            }
+
+            storeBigEndian(encodeAlpha(block), out);
+            storeBigEndian(color.bits, out + 8);
+            out += 16;
+        }
+    }
+}
+
+} // namespace rive_mp
@@ -0,0 +1,494 @@
+#include "gpu_upload_worker.hpp"
+#include "etc2_encoder.hpp"
+#include "mipmap_builder.hpp"
+#include "rive_log.hpp"
+#include "rive_trace.hpp"
+
+// Log prefix for GpuUploadWorker messages (embedded in log strings since macros already provide LOG_TAG)
+#define GUW_PREFIX "[GpuUploadWorker] "
+
+namespace rive_mp
+{
+
+std::atomic<bool> GpuUploadWorker::s_enabled{true};
+std::atomic<uint64_t> GpuUploadWorker::s_queued{0};
+std::atomic<uint64_t> GpuUploadWorker::s_published{0};
+std::atomic<uint64_t> GpuUploadWorker::s_synchronous{0};
+
+/** Find the EGLConfig the share context was created with. */
+static bool configForContext(EGLDisplay display, EGLContext context, EGLConfig* config)
+{
+    EGLint configID = 0;
+    eglQueryContext(display, context, EGL_CONFIG_ID, &configID);
+
+    EGLint configCount = 0;
+    EGLint configAttributes[] = {EGL_CONFIG_ID, configID, EGL_NONE};
+    return eglChooseConfig(display, configAttributes, config, 1, &configCount) &&
+           configCount == 1;
+}
+
+std::unique_ptr<GpuUploadWorker> GpuUploadWorker::Make(EGLDisplay display,
+                                                       EGLContext shareContext,
+                                                       rive::gpu::RenderContextGLImpl* impl)
+{
+    if (display == EGL_NO_DISPLAY || shareContext == EGL_NO_CONTEXT || impl == nullptr)
+    {
+        return nullptr;
+    }
+    if (!enabled())
+    {
+        LOGI(GUW_PREFIX "Disabled; uploading on the render thread");
+        return nullptr;
+    }
+
+    EGLConfig config;
+    if (!configForContext(display, shareContext, &config))
+    {
+        LOGW(GUW_PREFIX "No EGL config for the share context; uploading on the render thread");
+        return nullptr;
+    }
+
+    // Same client version as the render context, or the share fails
+    EGLint clientVersion = 3;
+    eglQueryContext(display, shareContext, EGL_CONTEXT_CLIENT_VERSION, &clientVersion);
+    EGLint contextAttributes[] = {EGL_CONTEXT_CLIENT_VERSION, clientVersion, EGL_NONE};
+    EGLContext context = eglCreateContext(display, config, shareContext, contextAttributes);
+    if (context == EGL_NO_CONTEXT)
+    {
+        LOGW(GUW_PREFIX "eglCreateContext failed (0x%04x); uploading on the render thread",
+             eglGetError());
+        return nullptr;
+    }
+
+    EGLint pBufferAttributes[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+    EGLSurface surface = eglCreatePbufferSurface(display, config, pBufferAttributes);
+    if (surface == EGL_NO_SURFACE)
+    {
+        LOGD(GUW_PREFIX "No pbuffer for the upload context; trying surfaceless");
+    }
+
+    // Sampled by every image until its upload is published. Created here, on
+    // the render thread, so it is ready before the first upload is queued.
+    const uint8_t transparent[4] = {0, 0, 0, 0};
+    auto placeholder = impl->makeImageTexture(1, 1, 1, transparent);
+
+    std::unique_ptr<GpuUploadWorker> worker(
+        new GpuUploadWorker(display, context, surface, impl, std::move(placeholder)));
+
+    bool started;
+    {
+        std::unique_lock<std::mutex> lock(worker->m_mutex);
+        worker->m_cv.wait(lock,
+                          [&worker] { return worker->m_startState != StartState::Starting; });
+        started = worker->m_startState == StartState::Running;
+    }
+    if (!started)
+    {
+        return nullptr; // The destructor joins the thread and frees the context
+    }
+    LOGI(GUW_PREFIX "Upload thread started (%s)",
+         surface == EGL_NO_SURFACE ? "surfaceless" : "pbuffer");
+    return worker;
+}
+
+GpuUploadWorker::GpuUploadWorker(EGLDisplay display,
+                                 EGLContext context,
+                                 EGLSurface surface,
+                                 rive::gpu::RenderContextGLImpl* impl,
+                                 rive::rcp<rive::gpu::Texture> placeholder) :
+    m_display(display),
+    m_context(context),
+    m_surface(surface),
+    m_impl(impl),
+    m_placeholder(std::move(placeholder))
+{
+    m_thread = std::thread(&GpuUploadWorker::uploadLoop, this);
+}
+
+GpuUploadWorker::~GpuUploadWorker()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    // Fences belong to the share group; the render context is current here.
+    for (auto& upload : m_completed)
+    {
+        glDeleteSync(upload.fence);
+    }
+    m_completed.clear();
+    m_placeholder = nullptr;
+
+    if (m_surface != EGL_NO_SURFACE)
+    {
+        eglDestroySurface(m_display, m_surface);
+    }
+    eglDestroyContext(m_display, m_context);
+}
+
+rive::rcp<rive::RenderImage> GpuUploadWorker::makeImage(uint32_t width,
+                                                        uint32_t height,
+                                                        std::unique_ptr<uint8_t[]> pixels)
+{
+    UploadJob job;
+    job.width = width;
+    job.height = height;
+    job.pixels = std::move(pixels);
+    return queueJob(std::move(job));
+}
+
+rive::rcp<rive::RenderImage> GpuUploadWorker::makeCompressedImage(uint32_t width,
+                                                                  uint32_t height,
+                                                                  std::unique_ptr<uint8_t[]> pixels,
+                                                                  uint64_t cacheKey)
+{
+    UploadJob job;
+    job.width = width;
+    job.height = height;
+    job.pixels = std::move(pixels);
+    job.source = JobSource::Transcode;
+    job.cacheKey = cacheKey;
+    return queueJob(std::move(job));
+}
+
+rive::rcp<rive::RenderImage> GpuUploadWorker::makeCachedImage(uint64_t cacheKey)
+{
+    // Read everything up front: once an image is returned there are no
+    // pixels left to fall back on, so a bad entry must be caught here.
+    UploadJob job;
+    if (!CompressedTextureCache::load(cacheKey, &job.cached))
+    {
+        return nullptr;
+    }
+    job.width = job.cached.width;
+    job.height = job.cached.height;
+    job.source = JobSource::Cache;
+    job.cacheKey = cacheKey;
+    return queueJob(std::move(job));
+}
+
+rive::rcp<rive::RenderImage> GpuUploadWorker::queueJob(UploadJob job)
+{
+    auto image = rive::make_rcp<UploadedRenderImage>(job.width, job.height, m_placeholder);
+    job.image = image;
+
+    const uint32_t width = job.width;
+    const uint32_t height = job.height;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(std::move(job));
+        m_inFlight++;
+    }
+    s_queued.fetch_add(1, std::memory_order_relaxed);
+    m_cv.notify_one();
+
+    LOGD(GUW_PREFIX "Queued %ux%u upload", width, height);
+    return image;
+}
+
+size_t GpuUploadWorker::publishCompleted()
+{
+    std::vector<CompletedUpload> completed;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_completed.empty())
+        {
+            return 0;
+        }
+        completed.swap(m_completed);
+    }
+
+    size_t published = 0;
+    std::vector<CompletedUpload> notReady;
+    for (auto& upload : completed)
+    {
+        // Zero timeout: poll, never stall the frame on an upload.
+        GLenum status = glClientWaitSync(upload.fence, 0, 0);
+        if (status == GL_TIMEOUT_EXPIRED)
+        {
+            notReady.push_back(std::move(upload));
+            continue;
+        }
+        if (status == GL_WAIT_FAILED)
+        {
+            LOGW(GUW_PREFIX "glClientWaitSync failed (0x%04x); publishing anyway", glGetError());
+        }
+        glDeleteSync(upload.fence);
+        upload.image->publish(std::move(upload.texture));
+        published++;
+    }
+
+    s_published.fetch_add(published, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_inFlight -= published;
+    for (auto& upload : notReady)
+    {
+        m_completed.push_back(std::move(upload));
+    }
+    return published;
+}
+
+size_t GpuUploadWorker::pendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_inFlight;
+}
+
+rive::rcp<rive::gpu::Texture> GpuUploadWorker::uploadMipChain(uint32_t width,
+                                                              uint32_t height,
+                                                              std::unique_ptr<uint8_t[]> pixels)
+{
+    const uint32_t levelCount = MipLevelCount(width, height);
+
+    GLuint textureID = 0;
+    glGenTextures(1, &textureID);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    glTexStorage2D(GL_TEXTURE_2D,
+                   static_cast<GLsizei>(levelCount),
+                   GL_RGBA8,
+                   static_cast<GLsizei>(width),
+                   static_cast<GLsizei>(height));
+    if (auto error = glGetError(); error != GL_NO_ERROR)
+    {
+        LOGE(GUW_PREFIX "glTexStorage2D %ux%u failed (0x%04x)", width, height, error);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glDeleteTextures(1, &textureID);
+        return nullptr;
+    }
+
+    // Upload each level, then derive the next from it. glTexSubImage2D copies
+    // client memory before returning, so the previous level can go at once.
+    std::unique_ptr<uint8_t[]> level = std::move(pixels);
+    uint32_t levelWidth = width;
+    uint32_t levelHeight = height;
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D,
+                        static_cast<GLint>(i),
+                        0,
+                        0,
+                        static_cast<GLsizei>(levelWidth),
+                        static_cast<GLsizei>(levelHeight),
+                        GL_RGBA,
+                        GL_UNSIGNED_BYTE,
+                        level.get());
+        if (i + 1 == levelCount)
+        {
+            break;
+        }
+
+        const uint32_t nextWidth = MipLevelSize(levelWidth);
+        const uint32_t nextHeight = MipLevelSize(levelHeight);
+        std::unique_ptr<uint8_t[]> next(new uint8_t[static_cast<size_t>(nextWidth) * nextHeight * 4]);
+        DownsampleBox2x(level.get(), levelWidth, levelHeight, next.get());
+        level = std::move(next);
+        levelWidth = nextWidth;
+        levelHeight = nextHeight;
+    }
+    level.reset();
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // The impl takes ownership of the texture name.
+    return m_impl->adoptImageTexture(width, height, textureID);
+}
+
+CompressedTexture GpuUploadWorker::transcodeMipChain(uint32_t width,
+                                                     uint32_t height,
+                                                     const uint8_t* pixels)
+{
+    CompressedTexture texture;
+    texture.glFormat = kGLCompressedRGBA8ETC2EAC;
+    texture.width = width;
+    texture.height = height;
+    texture.levels.resize(MipLevelCount(width, height));
+
+    // Same two-level streaming as uploadMipChain, but the source pixels stay
+    // owned by the job so they can still be uploaded as RGBA8 on failure.
+    std::unique_ptr<uint8_t[]> derived;
+    const uint8_t* level = pixels;
+    uint32_t levelWidth = width;
+    uint32_t levelHeight = height;
+    for (size_t i = 0; i < texture.levels.size(); ++i)
+    {
+        texture.levels[i].resize(ETC2RGBA8Size(levelWidth, levelHeight));
+        EncodeETC2RGBA8(level, levelWidth, levelHeight, texture.levels[i].data());
+        if (i + 1 == texture.levels.size())
+        {
+            break;
+        }
+
+        const uint32_t nextWidth = MipLevelSize(levelWidth);
+        const uint32_t nextHeight = MipLevelSize(levelHeight);
+        std::unique_ptr<uint8_t[]> next(new uint8_t[static_cast<size_t>(nextWidth) * nextHeight * 4]);
+        DownsampleBox2x(level, levelWidth, levelHeight, next.get());
+        derived = std::move(next);
+        level = derived.get();
+        levelWidth = nextWidth;
+        levelHeight = nextHeight;
+    }
+    return texture;
+}
+
+rive::rcp<rive::gpu::Texture> GpuUploadWorker::uploadCompressed(const CompressedTexture& texture)
+{
+    GLuint textureID = 0;
+    glGenTextures(1, &textureID);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    glTexStorage2D(GL_TEXTURE_2D,
+                   static_cast<GLsizei>(texture.levels.size()),
+                   texture.glFormat,
+                   static_cast<GLsizei>(texture.width),
+                   static_cast<GLsizei>(texture.height));
+
+    uint32_t levelWidth = texture.width;
+    uint32_t levelHeight = texture.height;
+    for (size_t i = 0; i < texture.levels.size(); ++i)
+    {
+        glCompressedTexSubImage2D(GL_TEXTURE_2D,
+                                  static_cast<GLint>(i),
+                                  0,
+                                  0,
+                                  static_cast<GLsizei>(levelWidth),
+                                  static_cast<GLsizei>(levelHeight),
+                                  texture.glFormat,
+                                  static_cast<GLsizei>(texture.levels[i].size()),
+                                  texture.levels[i].data());
+        levelWidth = MipLevelSize(levelWidth);
+        levelHeight = MipLevelSize(levelHeight);
+    }
+    if (auto error = glGetError(); error != GL_NO_ERROR)
+    {
+        LOGE(GUW_PREFIX "Compressed upload %ux%u failed (0x%04x)",
+             texture.width,
+             texture.height,
+             error);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glDeleteTextures(1, &textureID);
+        return nullptr;
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return m_impl->adoptImageTexture(texture.width, texture.height, textureID);
+}
+
+rive::rcp<rive::gpu::Texture> GpuUploadWorker::runJob(UploadJob& job)
+{
+    switch (job.source)
+    {
+        case JobSource::Pixels:
+            break;
+
+        case JobSource::Cache:
+        {
+            auto uploaded = uploadCompressed(job.cached);
+            job.cached.levels.clear();
+            if (uploaded == nullptr)
+            {
+                // Verified blocks that still fail to upload mean the driver
+                // can't take them; decode this image on the next load.
+                CompressedTextureCache::remove(job.cacheKey);
+            }
+            return uploaded;
+        }
+
+        case JobSource::Transcode:
+        {
+            CompressedTexture texture;
+            {
+                RiveTraceScope trace("GpuTranscode");
+                texture = transcodeMipChain(job.width, job.height, job.pixels.get());
+            }
+            if (auto uploaded = uploadCompressed(texture))
+            {
+                job.pixels.reset();
+                CompressedTextureCache::store(job.cacheKey, texture);
+                return uploaded;
+            }
+            LOGW(GUW_PREFIX "ETC2 unavailable; uploading %ux%u as RGBA8", job.width, job.height);
+            break;
+        }
+    }
+    return uploadMipChain(job.width, job.height, std::move(job.pixels));
+}
+
+void GpuUploadWorker::uploadLoop()
+{
+    const bool current = eglMakeCurrent(m_display, m_surface, m_surface, m_context);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_startState = current ? StartState::Running : StartState::Failed;
+    }
+    m_cv.notify_all();
+    if (!current)
+    {
+        LOGW(GUW_PREFIX "eglMakeCurrent failed (0x%04x); uploading on the render thread",
+             eglGetError());
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+        m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+        if (m_stop)
+        {
+            break;
+        }
+
+        UploadJob job = std::move(m_jobs.front());
+        m_jobs.pop_front();
+        lock.unlock();
+
+        CompletedUpload upload;
+        {
+            RiveTraceScope trace("GpuUpload");
+            upload.texture = runJob(job);
+        }
+        if (upload.texture != nullptr)
+        {
+            upload.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            // Submit now so the fence can signal without another upload.
+            glFlush();
+            upload.image = std::move(job.image);
+        }
+        else
+        {
+            LOGE(GUW_PREFIX "Failed to create %ux%u texture", job.width, job.height);
+        }
+
+        lock.lock();
+        if (upload.image != nullptr)
+        {
+            m_completed.push_back(std::move(upload));
+        }
+        else
+        {
+            m_inFlight--;
+        }
+    }
+
+    // Queued images keep their placeholder.
+    m_inFlight -= m_jobs.size();
+    m_jobs.clear();
+    lock.unlock();
+
+    eglMakeCurrent(m_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+}
+
+} // namespace rive_mp
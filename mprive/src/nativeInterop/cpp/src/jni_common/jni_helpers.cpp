@@ -1,25 +1,56 @@
 #include "jni_helpers.hpp"
+#include "utf16_transcode.hpp"
 #include <cstring>
 
 namespace rive_mp {
+    namespace {
+        // Strings up to this many UTF-16 units are marshalled through the stack.
+        constexpr jsize kStackStringUnits = 256;
+    }
+
     std::string JStringToStdString(JNIEnv* env, jstring jstr) {
         if (jstr == nullptr) {
             return "";
         }
-        
-        const char* chars = env->GetStringUTFChars(jstr, nullptr);
-        if (chars == nullptr) {
+
+        const jsize length = env->GetStringLength(jstr);
+        if (length == 0) {
             return "";
         }
-        
-        std::string result(chars);
-        env->ReleaseStringUTFChars(jstr, chars);
-        
+
+        std::string result(Utf8CapacityForUtf16(static_cast<size_t>(length)), '\0');
+        size_t written;
+        if (length <= kStackStringUnits) {
+            // Short strings (names, paths) are copied out without pinning.
+            jchar units[kStackStringUnits];
+            env->GetStringRegion(jstr, 0, length, units);
+            written = Utf16ToUtf8(reinterpret_cast<const uint16_t*>(units),
+                                  static_cast<size_t>(length),
+                                  &result[0]);
+        } else {
+            // No JNI calls are allowed until the critical section is released.
+            const jchar* units = env->GetStringCritical(jstr, nullptr);
+            if (units == nullptr) {
+                return "";
+            }
+            written = Utf16ToUtf8(reinterpret_cast<const uint16_t*>(units),
+                                  static_cast<size_t>(length),
+                                  &result[0]);
+            env->ReleaseStringCritical(jstr, units);
+        }
+        result.resize(written);
         return result;
     }
     
     jstring StdStringToJString(JNIEnv* env, const std::string& str) {
-        return env->NewStringUTF(str.c_str());
+        if (str.size() <= static_cast<size_t>(kStackStringUnits)) {
+            jchar units[kStackStringUnits];
+            size_t length = Utf8ToUtf16(str.data(), str.size(), reinterpret_cast<uint16_t*>(units));
+            return env->NewString(units, static_cast<jsize>(length));
+        }
+        std::vector<jchar> units(Utf16CapacityForUtf8(str.size()));
+        size_t length = Utf8ToUtf16(str.data(), str.size(), reinterpret_cast<uint16_t*>(units.data()));
+        return env->NewString(units.data(), static_cast<jsize>(length));
     }
     
     std::vector<uint8_t> JByteArrayToVector(JNIEnv* env, jbyteArray arr) {
@@ -0,0 +1,119 @@
+#include "mipmap_builder.hpp"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define MIPMAP_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MIPMAP_SSE2 1
+#endif
+
+namespace rive_mp {
+
+uint32_t MipLevelCount(uint32_t width, uint32_t height) {
+    uint32_t levels = 1;
+    while (width > 1 || height > 1) {
+        width = MipLevelSize(width);
+        height = MipLevelSize(height);
+        levels++;
+    }
+    return levels;
+}
+
+/**
+ * Average output pixels [x, dstWidth) of one row from two source rows.
+ * Requires a source width of at least 2.
+ */
+static void boxRowScalar(const uint8_t* row0,
+                         const uint8_t* row1,
+                         uint32_t x,
+                         uint32_t dstWidth,
+                         uint8_t* dst) {
+    for (; x < dstWidth; ++x) {
+        const uint8_t* a = row0 + x * 8;
+        const uint8_t* b = row1 + x * 8;
+        uint8_t* out = dst + x * 4;
+        for (int c = 0; c < 4; ++c) {
+            out[c] = static_cast<uint8_t>((a[c] + a[c + 4] + b[c] + b[c + 4] + 2) >> 2);
+        }
+    }
+}
+
+static void boxRow(const uint8_t* row0, const uint8_t* row1, uint32_t dstWidth, uint8_t* dst) {
+    uint32_t x = 0;
+#if MIPMAP_NEON
+    // 16 source pixels -> 8 output pixels, channels deinterleaved
+    for (; x + 8 <= dstWidth; x += 8) {
+        uint8x16x4_t a = vld4q_u8(row0 + x * 8);
+        uint8x16x4_t b = vld4q_u8(row1 + x * 8);
+        uint8x8x4_t out;
+        for (int c = 0; c < 4; ++c) {
+            uint16x8_t sum = vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c]));
+            out.val[c] = vrshrn_n_u16(sum, 2);
+        }
+        vst4_u8(dst + x * 4, out);
+    }
+#elif MIPMAP_SSE2
+    // 4 source pixels -> 2 output pixels
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(2);
+    for (; x + 2 <= dstWidth; x += 2) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row0 + x * 8));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row1 + x * 8));
+        // Vertical sums: pixels 0-1 and 2-3 widened to 16 bits
+        __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+        __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+        // Horizontal sums: pixel 0 + 1, pixel 2 + 3
+        lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+        hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+        __m128i sum = _mm_unpacklo_epi64(lo, hi);
+        sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x * 4), _mm_packus_epi16(sum, zero));
+    }
+#endif
+    boxRowScalar(row0, row1, x, dstWidth, dst);
+}
+
+using BoxRowFn = void (*)(const uint8_t*, const uint8_t*, uint32_t, uint8_t*);
+
+static void boxRowScalarFrom0(const uint8_t* row0,
+                              const uint8_t* row1,
+                              uint32_t dstWidth,
+                              uint8_t* dst) {
+    boxRowScalar(row0, row1, 0, dstWidth, dst);
+}
+
+static void downsample(const uint8_t* src,
+                       uint32_t width,
+                       uint32_t height,
+                       uint8_t* dst,
+                       BoxRowFn rowFn) {
+    const uint32_t dstWidth = MipLevelSize(width);
+    const uint32_t dstHeight = MipLevelSize(height);
+    const size_t srcStride = static_cast<size_t>(width) * 4;
+
+    for (uint32_t y = 0; y < dstHeight; ++y) {
+        const uint8_t* row0 = src + static_cast<size_t>(y) * 2 * srcStride;
+        const uint8_t* row1 = height > 1 ? row0 + srcStride : row0;
+        uint8_t* out = dst + static_cast<size_t>(y) * dstWidth * 4;
+
+        if (width > 1) {
+            rowFn(row0, row1, dstWidth, out);
+        } else {
+            // 1-pixel-wide column: average vertically only
+            for (int c = 0; c < 4; ++c) {
+                out[c] = static_cast<uint8_t>((row0[c] + row1[c] + 1) >> 1);
+            }
+        }
+    }
+}
+
+void DownsampleBox2x(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst) {
+    downsample(src, width, height, dst, boxRow);
+}
+
+void DownsampleBox2xScalar(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst) {
+    downsample(src, width, height, dst, boxRowScalarFrom0);
+}
+
+} // namespace rive_mp
@@ -0,0 +1,348 @@
+#include "riv_analyzer.hpp"
+#include "rive_log.hpp"
+#include "rive/animation/layer_state.hpp"
+#include "rive/animation/state_machine.hpp"
+#include "rive/animation/state_machine_layer.hpp"
+#include "rive/artboard.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/drawable.hpp"
+#include "rive/file.hpp"
+#include "rive/file_asset_loader.hpp"
+#include "rive/nested_artboard.hpp"
+#include "rive/shapes/clipping_shape.hpp"
+#include "rive/shapes/image.hpp"
+#include "rive/shapes/path.hpp"
+#include "rive/shapes/path_vertex.hpp"
+#include "rive/shapes/shape.hpp"
+#include "rive/text/text.hpp"
+#include "utils/no_op_factory.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <map>
+
+namespace rive_mp {
+    namespace {
+        // Deeper nesting than this is reported as this (and guards against cycles).
+        constexpr uint32_t kMaxNestedDepth = 32;
+
+        uint32_t readBE32(const uint8_t* p) {
+            return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+        }
+
+        uint32_t readLE24(const uint8_t* p) {
+            return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16);
+        }
+
+        /**
+         * Reads the dimensions of a PNG, JPEG or WebP image from its header,
+         * without decoding it.
+         */
+        bool readImageSize(const uint8_t* data, size_t size, uint32_t& width, uint32_t& height) {
+            // PNG: signature, then the IHDR chunk
+            static const uint8_t kPng[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            if (size >= 24 && std::equal(kPng, kPng + sizeof(kPng), data)) {
+                width = readBE32(data + 16);
+                height = readBE32(data + 20);
+                return true;
+            }
+
+            // JPEG: walk the segments up to the first start-of-frame
+            if (size >= 4 && data[0] == 0xFF && data[1] == 0xD8) {
+                size_t offset = 2;
+                while (offset + 9 <= size) {
+                    if (data[offset] != 0xFF) {
+                        return false;
+                    }
+                    const uint8_t marker = data[offset + 1];
+                    const size_t length = (size_t(data[offset + 2]) << 8) | data[offset + 3];
+                    const bool isStartOfFrame = marker >= 0xC0 && marker <= 0xCF &&
+                                                marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+                    if (isStartOfFrame) {
+                        height = (uint32_t(data[offset + 5]) << 8) | data[offset + 6];
+                        width = (uint32_t(data[offset + 7]) << 8) | data[offset + 8];
+                        return true;
+                    }
+                    offset += 2 + length;
+                }
+                return false;
+            }
+
+            // WebP: RIFF container with a VP8, VP8L or VP8X first chunk
+            if (size >= 30 && std::equal(data, data + 4, "RIFF") && std::equal(data + 8, data + 12, "WEBP")) {
+                const uint8_t* chunk = data + 12;
+                if (std::equal(chunk, chunk + 4, "VP8 ")) {
+                    width = (uint32_t(chunk[14]) | (uint32_t(chunk[15]) << 8)) & 0x3FFF;
+                    height = (uint32_t(chunk[16]) | (uint32_t(chunk[17]) << 8)) & 0x3FFF;
+                    return true;
+                }
+                if (std::equal(chunk, chunk + 4, "VP8L")) {
+                    const uint32_t bits = uint32_t(chunk[9]) | (uint32_t(chunk[10]) << 8) |
+                                          (uint32_t(chunk[11]) << 16) | (uint32_t(chunk[12]) << 24);
+                    width = (bits & 0x3FFF) + 1;
+                    height = ((bits >> 14) & 0x3FFF) + 1;
+                    return true;
+                }
+                if (std::equal(chunk, chunk + 4, "VP8X")) {
+                    width = readLE24(chunk + 12) + 1;
+                    height = readLE24(chunk + 15) + 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Records the size of every in-band image, then lets the runtime
+         * import it as usual.
+         */
+        class AnalyzerAssetLoader : public rive::FileAssetLoader {
+        public:
+            bool loadContents(rive::FileAsset& asset,
+                              rive::Span<const uint8_t> inBandBytes,
+                              rive::Factory* factory) override {
+                if (asset.is<rive::ImageAsset>()) {
+                    RivImageStats image;
+                    image.name = asset.name();
+                    image.encodedBytes = inBandBytes.size();
+                    readImageSize(inBandBytes.data(), inBandBytes.size(), image.width, image.height);
+                    images[&asset] = std::move(image);
+                }
+                return false;
+            }
+
+            std::map<const rive::FileAsset*, RivImageStats> images;
+        };
+
+        uint32_t nestedDepth(rive::Artboard* artboard, uint32_t depth) {
+            if (depth >= kMaxNestedDepth) {
+                return kMaxNestedDepth;
+            }
+            uint32_t deepest = depth;
+            for (auto* object : artboard->objects()) {
+                if (object == nullptr || !object->is<rive::NestedArtboard>()) {
+                    continue;
+                }
+                auto* nested = object->as<rive::NestedArtboard>()->artboardInstance();
+                if (nested != nullptr) {
+                    deepest = std::max(deepest, nestedDepth(nested, depth + 1));
+                } else {
+                    deepest = std::max(deepest, depth + 1);
+                }
+            }
+            return deepest;
+        }
+
+        void analyzeStateMachines(rive::Artboard* artboard, RivArtboardStats& stats) {
+            stats.stateMachineCount = static_cast<uint32_t>(artboard->stateMachineCount());
+            for (size_t i = 0; i < artboard->stateMachineCount(); i++) {
+                auto* stateMachine = artboard->stateMachine(i);
+                if (stateMachine == nullptr) {
+                    continue;
+                }
+                stats.inputCount += static_cast<uint32_t>(stateMachine->inputCount());
+                stats.listenerCount += static_cast<uint32_t>(stateMachine->listenerCount());
+                stats.layerCount += static_cast<uint32_t>(stateMachine->layerCount());
+                for (size_t l = 0; l < stateMachine->layerCount(); l++) {
+                    auto* layer = stateMachine->layer(l);
+                    stats.stateCount += static_cast<uint32_t>(layer->stateCount());
+                    for (size_t s = 0; s < layer->stateCount(); s++) {
+                        stats.transitionCount += static_cast<uint32_t>(layer->state(s)->transitionCount());
+                    }
+                }
+            }
+        }
+
+        void analyzeArtboard(rive::Artboard* artboard,
+                             const std::map<const rive::FileAsset*, RivImageStats>& images,
+                             RivArtboardStats& stats) {
+            stats.name = artboard->name();
+            stats.width = artboard->width();
+            stats.height = artboard->height();
+            stats.objectCount = static_cast<uint32_t>(artboard->objects().size());
+            stats.animationCount = static_cast<uint32_t>(artboard->animationCount());
+            stats.dataBindCount = static_cast<uint32_t>(artboard->dataBinds().size());
+
+            for (auto* object : artboard->objects()) {
+                if (object == nullptr) {
+                    continue;
+                }
+                if (object->is<rive::Drawable>()) {
+                    stats.drawableCount++;
+                    if (object->as<rive::Drawable>()->blendMode() != rive::BlendMode::srcOver) {
+                        stats.blendModeCount++;
+                    }
+                }
+                if (object->is<rive::Shape>()) {
+                    stats.shapeCount++;
+                } else if (object->is<rive::Path>()) {
+                    stats.pathCount++;
+                } else if (object->is<rive::PathVertex>()) {
+                    stats.vertexCount++;
+                } else if (object->is<rive::ClippingShape>()) {
+                    stats.clipCount++;
+                } else if (object->is<rive::Text>()) {
+                    stats.textCount++;
+                } else if (object->is<rive::NestedArtboard>()) {
+                    stats.nestedArtboardCount++;
+                } else if (object->is<rive::Image>()) {
+                    stats.imageCount++;
+                    auto image = images.find(object->as<rive::Image>()->imageAsset());
+                    if (image != images.end()) {
+                        stats.imagePixels += uint64_t(image->second.width) * image->second.height;
+                    }
+                }
+            }
+
+            stats.nestedArtboardDepth = nestedDepth(artboard, 0);
+            analyzeStateMachines(artboard, stats);
+            stats.costScore = RivCostScore(stats);
+        }
+
+        void appendJsonString(std::string& out, const std::string& value) {
+            out += '"';
+            for (char c : value) {
+                switch (c) {
+                    case '"': out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\r': out += "\\r"; break;
+                    case '\t': out += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char escaped[8];
+                            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                            out += escaped;
+                        } else {
+                            out += c;
+                        }
+                }
+            }
+            out += '"';
+        }
+
+        void appendJsonField(std::string& out, const char* key, uint64_t value) {
+            out += '"';
+            out += key;
+            out += "\":";
+            out += std::to_string(value);
+            out += ',';
+        }
+
+        void appendJsonField(std::string& out, const char* key, double value) {
+            char number[32];
+            snprintf(number, sizeof(number), "%.3f", value);
+            out += '"';
+            out += key;
+            out += "\":";
+            out += number;
+            out += ',';
+        }
+
+        void endJsonObject(std::string& out) {
+            if (out.back() == ',') {
+                out.pop_back();
+            }
+            out += '}';
+        }
+    }
+
+    bool AnalyzeRivFile(const uint8_t* bytes, size_t size, RivFileStats& stats) {
+        stats = RivFileStats();
+        stats.fileBytes = size;
+
+        rive::NoOpFactory factory;
+        AnalyzerAssetLoader loader;
+        rive::ImportResult result;
+        auto file = rive::File::import(rive::Span<const uint8_t>(bytes, size), &factory, &result, &loader);
+        if (!file) {
+            LOGW("RivAnalyzer: Failed to import file (%zu bytes)", size);
+            return false;
+        }
+
+        stats.assetCount = static_cast<uint32_t>(file->assets().size());
+        stats.viewModelCount = static_cast<uint32_t>(file->viewModelCount());
+        for (const auto& image : loader.images) {
+            stats.images.push_back(image.second);
+        }
+
+        stats.artboards.resize(file->artboardCount());
+        for (size_t i = 0; i < file->artboardCount(); i++) {
+            auto* artboard = file->artboard(i);
+            if (artboard != nullptr) {
+                analyzeArtboard(artboard, loader.images, stats.artboards[i]);
+            }
+        }
+        return true;
+    }
+
+    double RivCostScore(const RivArtboardStats& a) {
+        return a.pathCount * 1.0 +
+               a.vertexCount * 0.05 +
+               a.clipCount * 4.0 +
+               a.blendModeCount * 6.0 +
+               static_cast<double>(a.imagePixels) / 65536.0 +
+               a.textCount * 3.0 +
+               a.nestedArtboardCount * 2.0 +
+               a.nestedArtboardDepth * 2.0 +
+               a.layerCount * 0.5 +
+               a.transitionCount * 0.1 +
+               a.listenerCount * 0.5 +
+               a.dataBindCount * 0.2;
+    }
+
+    std::string RivFileStatsToJson(const RivFileStats& stats) {
+        std::string out = "{";
+        appendJsonField(out, "fileBytes", stats.fileBytes);
+        appendJsonField(out, "assetCount", uint64_t{stats.assetCount});
+        appendJsonField(out, "viewModelCount", uint64_t{stats.viewModelCount});
+
+        out += "\"images\":[";
+        for (size_t i = 0; i < stats.images.size(); i++) {
+            const auto& image = stats.images[i];
+            out += i == 0 ? "{" : ",{";
+            out += "\"name\":";
+            appendJsonString(out, image.name);
+            out += ',';
+            appendJsonField(out, "width", uint64_t{image.width});
+            appendJsonField(out, "height", uint64_t{image.height});
+            appendJsonField(out, "encodedBytes", image.encodedBytes);
+            endJsonObject(out);
+        }
+        out += "],";
+
+        out += "\"artboards\":[";
+        for (size_t i = 0; i < stats.artboards.size(); i++) {
+            const auto& a = stats.artboards[i];
+            out += i == 0 ? "{" : ",{";
+            out += "\"name\":";
+            appendJsonString(out, a.name);
+            out += ',';
+            appendJsonField(out, "width", double{a.width});
+            appendJsonField(out, "height", double{a.height});
+            appendJsonField(out, "objectCount", uint64_t{a.objectCount});
+            appendJsonField(out, "drawableCount", uint64_t{a.drawableCount});
+            appendJsonField(out, "shapeCount", uint64_t{a.shapeCount});
+            appendJsonField(out, "pathCount", uint64_t{a.pathCount});
+            appendJsonField(out, "vertexCount", uint64_t{a.vertexCount});
+            appendJsonField(out, "clipCount", uint64_t{a.clipCount});
+            appendJsonField(out, "blendModeCount", uint64_t{a.blendModeCount});
+            appendJsonField(out, "imageCount", uint64_t{a.imageCount});
+            appendJsonField(out, "imagePixels", a.imagePixels);
+            appendJsonField(out, "textCount", uint64_t{a.textCount});
+            appendJsonField(out, "nestedArtboardCount", uint64_t{a.nestedArtboardCount});
+            appendJsonField(out, "nestedArtboardDepth", uint64_t{a.nestedArtboardDepth});
+            appendJsonField(out, "animationCount", uint64_t{a.animationCount});
+            appendJsonField(out, "stateMachineCount", uint64_t{a.stateMachineCount});
+            appendJsonField(out, "layerCount", uint64_t{a.layerCount});
+            appendJsonField(out, "stateCount", uint64_t{a.stateCount});
+            appendJsonField(out, "transitionCount", uint64_t{a.transitionCount});
+            appendJsonField(out, "inputCount", uint64_t{a.inputCount});
+            appendJsonField(out, "listenerCount", uint64_t{a.listenerCount});
+            appendJsonField(out, "dataBindCount", uint64_t{a.dataBindCount});
+            appendJsonField(out, "costScore", a.costScore);
+            endJsonObject(out);
+        }
+        out += "]}";
+        return out;
+    }
+}
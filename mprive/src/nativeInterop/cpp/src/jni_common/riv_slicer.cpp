@@ -0,0 +1,352 @@
+#include "riv_slicer.hpp"
+#include "rive_log.hpp"
+#include "rive/core.hpp"
+#include "rive/core/field_types/core_bool_type.hpp"
+#include "rive/core/field_types/core_color_type.hpp"
+#include "rive/core/field_types/core_double_type.hpp"
+#include "rive/core/field_types/core_string_type.hpp"
+#include "rive/core/field_types/core_uint_type.hpp"
+#include "rive/generated/artboard_base.hpp"
+#include "rive/generated/core_registry.hpp"
+#include "rive/generated/nested_artboard_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_instance_artboard_base.hpp"
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+
+namespace rive_mp {
+    namespace {
+        // Owner of objects that are not part of any artboard
+        constexpr int32_t kFileLevel = -1;
+
+        /**
+         * Reads the primitives of the .riv format, tracking the offset so
+         * objects can be copied as byte ranges.
+         */
+        class RivReader {
+        public:
+            RivReader(const uint8_t* bytes, size_t size) : m_bytes(bytes), m_size(size) {}
+
+            size_t offset() const { return m_offset; }
+            bool failed() const { return m_failed; }
+            bool atEnd() const { return m_offset >= m_size; }
+
+            uint64_t varUint() {
+                uint64_t value = 0;
+                for (unsigned shift = 0; shift < 64; shift += 7) {
+                    if (m_offset >= m_size) {
+                        break;
+                    }
+                    const uint8_t byte = m_bytes[m_offset++];
+                    value |= uint64_t(byte & 0x7F) << shift;
+                    if ((byte & 0x80) == 0) {
+                        return value;
+                    }
+                }
+                m_failed = true;
+                return 0;
+            }
+
+            uint32_t uint32() {
+                uint32_t value = 0;
+                if (skip(sizeof(value))) {
+                    std::memcpy(&value, m_bytes + m_offset - sizeof(value), sizeof(value));
+                }
+                return value;
+            }
+
+            std::string string() {
+                const uint64_t length = varUint();
+                if (!skip(length)) {
+                    return {};
+                }
+                return std::string(reinterpret_cast<const char*>(m_bytes + m_offset - length), length);
+            }
+
+            bool skip(uint64_t count) {
+                if (m_failed || count > m_size - m_offset) {
+                    m_failed = true;
+                    return false;
+                }
+                m_offset += count;
+                return true;
+            }
+
+        private:
+            const uint8_t* m_bytes;
+            size_t m_size;
+            size_t m_offset = 0;
+            bool m_failed = false;
+        };
+
+        void appendVarUint(std::vector<uint8_t>& out, uint64_t value) {
+            do {
+                uint8_t byte = value & 0x7F;
+                value >>= 7;
+                if (value != 0) {
+                    byte |= 0x80;
+                }
+                out.push_back(byte);
+            } while (value != 0);
+        }
+
+        // Artboard id that refers to no artboard (the runtime's default)
+        constexpr uint64_t kNoArtboard = 0xFFFFFFFF;
+
+        /**
+         * Finds the property holding an artboard index on each type key, by
+         * instantiating the type once through the core registry so subtypes
+         * added by newer runtimes are covered.
+         */
+        class ArtboardIdProperties {
+        public:
+            // Returns 0 if the type has no artboard id property
+            uint32_t get(uint32_t typeKey) {
+                auto it = m_keys.find(typeKey);
+                if (it != m_keys.end()) {
+                    return it->second;
+                }
+
+                uint32_t propertyKey = 0;
+                std::unique_ptr<rive::Core> object(
+                    rive::CoreRegistry::makeCoreInstance(static_cast<int>(typeKey)));
+                if (object != nullptr) {
+                    if (object->isTypeOf(rive::NestedArtboardBase::typeKey)) {
+                        propertyKey = rive::NestedArtboardBase::artboardIdPropertyKey;
+                    } else if (object->isTypeOf(rive::ViewModelInstanceArtboardBase::typeKey)) {
+                        propertyKey = rive::ViewModelInstanceArtboardBase::propertyValuePropertyKey;
+                    }
+                }
+                m_keys.emplace(typeKey, propertyKey);
+                return propertyKey;
+            }
+
+        private:
+            std::unordered_map<uint32_t, uint32_t> m_keys;
+        };
+
+        struct RivObject {
+            size_t start = 0;
+            size_t end = 0;
+            int32_t owner = kFileLevel;    // Index of the artboard the object belongs to
+        };
+
+        // An artboard id value in the stream, to renumber it
+        struct ArtboardReference {
+            size_t start = 0;
+            size_t end = 0;
+            uint64_t artboardId = 0;
+        };
+
+        struct RivArtboard {
+            std::string name;
+            std::vector<uint64_t> nested;  // artboardId of each nested artboard
+            uint64_t bytes = 0;
+        };
+
+        /**
+         * Reads the header up to the first object. The table of contents
+         * gives the field type of properties the runtime may not know.
+         */
+        bool readHeader(RivReader& reader, std::unordered_map<uint32_t, int>& fieldTypes) {
+            reader.skip(4);    // "RIVE", checked by the caller
+            reader.varUint();  // Major version
+            reader.varUint();  // Minor version
+            reader.varUint();  // File ID
+
+            std::vector<uint32_t> propertyKeys;
+            for (uint64_t key = reader.varUint(); key != 0 && !reader.failed(); key = reader.varUint()) {
+                propertyKeys.push_back(static_cast<uint32_t>(key));
+            }
+
+            // Two bits per property, four properties per 32-bit word
+            uint32_t word = 0;
+            unsigned bit = 8;
+            for (uint32_t key : propertyKeys) {
+                if (bit == 8) {
+                    word = reader.uint32();
+                    bit = 0;
+                }
+                fieldTypes[key] = static_cast<int>((word >> bit) & 3);
+                bit += 2;
+            }
+            return !reader.failed();
+        }
+
+        bool skipProperty(RivReader& reader, int fieldType) {
+            if (fieldType == rive::CoreUintType::id) {
+                reader.varUint();
+            } else if (fieldType == rive::CoreBoolType::id) {
+                reader.skip(1);
+            } else if (fieldType == rive::CoreStringType::id) {
+                reader.skip(reader.varUint());
+            } else if (fieldType == rive::CoreDoubleType::id || fieldType == rive::CoreColorType::id) {
+                reader.skip(4);
+            } else {
+                return false;
+            }
+            return !reader.failed();
+        }
+    }
+
+    bool SliceRivArtboards(const uint8_t* bytes,
+                           size_t size,
+                           const std::vector<std::string>& artboardNames,
+                           std::vector<uint8_t>& out,
+                           RivSliceStats& stats,
+                           std::string& error) {
+        stats = RivSliceStats();
+        out.clear();
+
+        RivReader reader(bytes, size);
+        std::unordered_map<uint32_t, int> tocFieldTypes;
+        if (size < 4 || std::memcmp(bytes, "RIVE", 4) != 0 || !readHeader(reader, tocFieldTypes)) {
+            error = "Not a Rive file";
+            return false;
+        }
+        const size_t headerEnd = reader.offset();
+
+        // Pass 1: split the stream into objects and assign each to its
+        // artboard. Files list the backboard, assets, enums, converters and
+        // view models first, then each artboard followed by its components,
+        // animations and state machines, so ownership follows from position
+        // alone: objects before the first artboard are file-level, and every
+        // later object belongs to the artboard before it.
+        ArtboardIdProperties artboardIdProperties;
+        std::vector<RivObject> objects;
+        std::vector<ArtboardReference> references;
+        std::vector<RivArtboard> artboards;
+        while (!reader.atEnd()) {
+            RivObject object;
+            object.start = reader.offset();
+            const uint32_t typeKey = static_cast<uint32_t>(reader.varUint());
+            const bool isArtboard = typeKey == rive::ArtboardBase::typeKey;
+            const uint32_t artboardIdKey = artboardIdProperties.get(typeKey);
+            if (isArtboard) {
+                artboards.emplace_back();
+            }
+            if (!artboards.empty()) {
+                object.owner = static_cast<int32_t>(artboards.size() - 1);
+            }
+
+            for (uint64_t key = reader.varUint(); key != 0 && !reader.failed(); key = reader.varUint()) {
+                const uint32_t propertyKey = static_cast<uint32_t>(key);
+                if (isArtboard && propertyKey == rive::ArtboardBase::namePropertyKey) {
+                    artboards.back().name = reader.string();
+                    continue;
+                }
+                if (artboardIdKey != 0 && propertyKey == artboardIdKey) {
+                    ArtboardReference reference;
+                    reference.start = reader.offset();
+                    reference.artboardId = reader.varUint();
+                    reference.end = reader.offset();
+                    references.push_back(reference);
+                    // Only nesting pulls in artboards; data-bound artboards are not followed
+                    if (object.owner != kFileLevel &&
+                        artboardIdKey == rive::NestedArtboardBase::artboardIdPropertyKey) {
+                        artboards[object.owner].nested.push_back(reference.artboardId);
+                    }
+                    continue;
+                }
+
+                int fieldType = rive::CoreRegistry::propertyFieldId(static_cast<int>(propertyKey));
+                if (fieldType == -1) {
+                    auto toc = tocFieldTypes.find(propertyKey);
+                    fieldType = toc != tocFieldTypes.end() ? toc->second : -1;
+                }
+                if (!skipProperty(reader, fieldType) && !reader.failed()) {
+                    error = "Unknown property " + std::to_string(propertyKey) + " at offset " +
+                            std::to_string(reader.offset());
+                    return false;
+                }
+            }
+            if (reader.failed()) {
+                error = "Truncated object at offset " + std::to_string(object.start);
+                return false;
+            }
+
+            object.end = reader.offset();
+            if (object.owner != kFileLevel) {
+                artboards[object.owner].bytes += object.end - object.start;
+            }
+            objects.push_back(object);
+        }
+        stats.artboardCount = static_cast<uint32_t>(artboards.size());
+
+        // Requested artboards, then everything they nest
+        std::vector<bool> kept(artboards.size(), false);
+        std::vector<size_t> pending;
+        for (const auto& name : artboardNames) {
+            bool found = false;
+            for (size_t i = 0; i < artboards.size(); i++) {
+                if (artboards[i].name == name) {
+                    found = true;
+                    if (!kept[i]) {
+                        kept[i] = true;
+                        pending.push_back(i);
+                    }
+                    break;
+                }
+            }
+            if (!found) {
+                error = "Artboard not found: " + name;
+                return false;
+            }
+        }
+        while (!pending.empty()) {
+            const size_t index = pending.back();
+            pending.pop_back();
+            for (uint64_t nested : artboards[index].nested) {
+                // Out-of-range ids are left for the runtime to ignore
+                if (nested < artboards.size() && !kept[nested]) {
+                    kept[nested] = true;
+                    pending.push_back(static_cast<size_t>(nested));
+                }
+            }
+        }
+
+        std::vector<uint64_t> newIndex(artboards.size(), 0);
+        uint64_t next = 0;
+        for (size_t i = 0; i < artboards.size(); i++) {
+            if (kept[i]) {
+                newIndex[i] = next++;
+            } else {
+                stats.skippedBytes += artboards[i].bytes;
+            }
+        }
+        stats.keptArtboards = static_cast<uint32_t>(next);
+
+        // Pass 2: copy the header and every kept object, renumbering the
+        // artboard ids in it. Ids of dropped artboards are cleared so they
+        // can't resolve to a different kept artboard.
+        out.reserve(size - stats.skippedBytes + 16);
+        out.insert(out.end(), bytes, bytes + headerEnd);
+        size_t nextReference = 0;
+        for (const auto& object : objects) {
+            size_t copied = object.start;
+            const bool keep = object.owner == kFileLevel || kept[object.owner];
+            for (; nextReference < references.size() && references[nextReference].start < object.end;
+                 nextReference++) {
+                const ArtboardReference& reference = references[nextReference];
+                // Out-of-range ids are left for the runtime to ignore
+                if (!keep || reference.artboardId >= artboards.size()) {
+                    continue;
+                }
+                out.insert(out.end(), bytes + copied, bytes + reference.start);
+                appendVarUint(out, kept[reference.artboardId] ? newIndex[reference.artboardId] : kNoArtboard);
+                copied = reference.end;
+            }
+            if (keep) {
+                out.insert(out.end(), bytes + copied, bytes + object.end);
+            }
+        }
+        stats.keptBytes = out.size();
+
+        LOGD("RivSlicer: Kept %u of %u artboards (%llu of %zu bytes)",
+             stats.keptArtboards,
+             stats.artboardCount,
+             static_cast<unsigned long long>(stats.keptBytes),
+             size);
+        return true;
+    }
+}
@@ -0,0 +1,77 @@
+#include "rive_trace.hpp"
+#include "platform.hpp"
+
+#if RIVE_PLATFORM_ANDROID
+    #include <dlfcn.h>
+    #include <mutex>
+#endif
+
+namespace rive_mp {
+#if RIVE_PLATFORM_ANDROID
+    namespace {
+        typedef bool (*fp_ATrace_isEnabled)();
+        typedef void (*fp_ATrace_beginSection)(const char* sectionName);
+        typedef void (*fp_ATrace_endSection)();
+        typedef void (*fp_ATrace_setCounter)(const char* counterName, int64_t counterValue);
+
+        struct ATraceFunctions {
+            fp_ATrace_isEnabled isEnabled = nullptr;
+            fp_ATrace_beginSection beginSection = nullptr;
+            fp_ATrace_endSection endSection = nullptr;
+            fp_ATrace_setCounter setCounter = nullptr;
+        };
+
+        const ATraceFunctions& atrace() {
+            static ATraceFunctions functions;
+            static std::once_flag once;
+            std::call_once(once, [] {
+                void* lib = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+                if (lib == nullptr) {
+                    return;
+                }
+                functions.isEnabled = reinterpret_cast<fp_ATrace_isEnabled>(
+                    dlsym(lib, "ATrace_isEnabled"));
+                functions.beginSection = reinterpret_cast<fp_ATrace_beginSection>(
+                    dlsym(lib, "ATrace_beginSection"));
+                functions.endSection = reinterpret_cast<fp_ATrace_endSection>(
+                    dlsym(lib, "ATrace_endSection"));
+                functions.setCounter = reinterpret_cast<fp_ATrace_setCounter>(
+                    dlsym(lib, "ATrace_setCounter"));
+            });
+            return functions;
+        }
+    }
+
+    bool RiveTraceIsEnabled() {
+        const auto& fns = atrace();
+        return fns.isEnabled != nullptr && fns.beginSection != nullptr &&
+               fns.endSection != nullptr && fns.isEnabled();
+    }
+
+    void RiveTraceBeginSection(const char* sectionName) {
+        const auto& fns = atrace();
+        if (fns.beginSection != nullptr && sectionName != nullptr) {
+            fns.beginSection(sectionName);
+        }
+    }
+
+    void RiveTraceEndSection() {
+        const auto& fns = atrace();
+        if (fns.endSection != nullptr) {
+            fns.endSection();
+        }
+    }
+
+    void RiveTraceCounter(const char* counterName, int64_t value) {
+        const auto& fns = atrace();
+        if (fns.setCounter != nullptr && counterName != nullptr) {
+            fns.setCounter(counterName, value);
+        }
+    }
+#else
+    bool RiveTraceIsEnabled() { return false; }
+    void RiveTraceBeginSection(const char*) {}
+    void RiveTraceEndSection() {}
+    void RiveTraceCounter(const char*, int64_t) {}
+#endif
+}
@@ -0,0 +1,369 @@
+#include "synthetic_riv.hpp"
+#include "rive/file.hpp"
+#include "rive/generated/animation/any_state_base.hpp"
+#include "rive/generated/animation/animation_state_base.hpp"
+#include "rive/generated/animation/entry_state_base.hpp"
+#include "rive/generated/animation/exit_state_base.hpp"
+#include "rive/generated/animation/keyed_object_base.hpp"
+#include "rive/generated/animation/keyed_property_base.hpp"
+#include "rive/generated/animation/keyframe_double_base.hpp"
+#include "rive/generated/animation/linear_animation_base.hpp"
+#include "rive/generated/animation/state_machine_base.hpp"
+#include "rive/generated/animation/state_machine_layer_base.hpp"
+#include "rive/generated/animation/state_machine_number_base.hpp"
+#include "rive/generated/animation/state_transition_base.hpp"
+#include "rive/generated/animation/transition_number_condition_base.hpp"
+#include "rive/generated/artboard_base.hpp"
+#include "rive/generated/backboard_base.hpp"
+#include "rive/generated/data_bind/converters/data_converter_group_base.hpp"
+#include "rive/generated/data_bind/converters/data_converter_group_item_base.hpp"
+#include "rive/generated/data_bind/converters/data_converter_to_string_base.hpp"
+#include "rive/generated/nested_artboard_base.hpp"
+#include "rive/generated/node_base.hpp"
+#include "rive/generated/shapes/paint/fill_base.hpp"
+#include "rive/generated/shapes/paint/solid_color_base.hpp"
+#include "rive/generated/shapes/rectangle_base.hpp"
+#include "rive/generated/shapes/shape_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_instance_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_instance_list_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_instance_list_item_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_instance_number_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_instance_string_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_property_list_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_property_number_base.hpp"
+#include "rive/generated/viewmodel/viewmodel_property_string_base.hpp"
+#include <cstring>
+#include <string>
+
+namespace rive_mp {
+    namespace {
+        constexpr uint32_t kLinearInterpolation = 1;
+        constexpr uint32_t kLoop = 1;
+        constexpr uint32_t kConditionEqual = 0;
+        constexpr uint32_t kFps = 60;
+
+        /**
+         * Writes the .riv object stream: each object is its type key, then
+         * (property key, value) pairs, then a 0 terminator.
+         */
+        class RivWriter {
+        public:
+            explicit RivWriter(std::vector<uint8_t>& out) : m_out(out) {}
+
+            void varUint(uint64_t value) {
+                do {
+                    uint8_t byte = value & 0x7F;
+                    value >>= 7;
+                    if (value != 0) {
+                        byte |= 0x80;
+                    }
+                    m_out.push_back(byte);
+                } while (value != 0);
+            }
+
+            void header() {
+                m_out.insert(m_out.end(), {'R', 'I', 'V', 'E'});
+                varUint(rive::File::majorVersion);
+                varUint(rive::File::minorVersion);
+                varUint(0);  // File ID
+                // Empty table of contents: every property written here is
+                // known to the runtime, so none needs a field type.
+                varUint(0);
+            }
+
+            void begin(uint16_t typeKey) { varUint(typeKey); }
+            void end() { varUint(0); }
+
+            void uintProperty(uint16_t key, uint64_t value) {
+                varUint(key);
+                varUint(value);
+            }
+
+            void doubleProperty(uint16_t key, float value) {
+                varUint(key);
+                uint8_t bytes[sizeof(float)];
+                std::memcpy(bytes, &value, sizeof(float));
+                m_out.insert(m_out.end(), bytes, bytes + sizeof(float));
+            }
+
+            void colorProperty(uint16_t key, uint32_t value) {
+                varUint(key);
+                uint8_t bytes[sizeof(uint32_t)];
+                std::memcpy(bytes, &value, sizeof(uint32_t));
+                m_out.insert(m_out.end(), bytes, bytes + sizeof(uint32_t));
+            }
+
+            void stringProperty(uint16_t key, const std::string& value) {
+                varUint(key);
+                varUint(value.size());
+                m_out.insert(m_out.end(), value.begin(), value.end());
+            }
+
+        private:
+            std::vector<uint8_t>& m_out;
+        };
+
+        void writeDataConverters(RivWriter& w, const SyntheticRivSpec& spec) {
+            for (uint32_t i = 0; i < spec.dataConverters; i++) {
+                w.begin(rive::DataConverterToStringBase::typeKey);
+                w.stringProperty(rive::DataConverterToStringBase::namePropertyKey,
+                                 "Converter " + std::to_string(i));
+                w.end();
+            }
+
+            // Then a group chaining all of them; items refer to converters by index
+            w.begin(rive::DataConverterGroupBase::typeKey);
+            w.stringProperty(rive::DataConverterGroupBase::namePropertyKey, "Group");
+            w.end();
+            for (uint32_t i = 0; i < spec.dataConverters; i++) {
+                w.begin(rive::DataConverterGroupItemBase::typeKey);
+                w.uintProperty(rive::DataConverterGroupItemBase::converterIdPropertyKey, i);
+                w.end();
+            }
+        }
+
+        void writeViewModels(RivWriter& w, const SyntheticRivSpec& spec) {
+            // View model 0: "Item", one instance per list item
+            w.begin(rive::ViewModelBase::typeKey);
+            w.stringProperty(rive::ViewModelBase::namePropertyKey, "Item");
+            w.end();
+            w.begin(rive::ViewModelPropertyNumberBase::typeKey);
+            w.stringProperty(rive::ViewModelPropertyNumberBase::namePropertyKey, "value");
+            w.end();
+            for (uint32_t i = 0; i < spec.listLength; i++) {
+                w.begin(rive::ViewModelInstanceBase::typeKey);
+                w.uintProperty(rive::ViewModelInstanceBase::viewModelIdPropertyKey, 0);
+                w.stringProperty(rive::ViewModelInstanceBase::namePropertyKey,
+                                 "Item " + std::to_string(i));
+                w.end();
+                w.begin(rive::ViewModelInstanceNumberBase::typeKey);
+                w.uintProperty(rive::ViewModelInstanceNumberBase::viewModelPropertyIdPropertyKey, 0);
+                w.doubleProperty(rive::ViewModelInstanceNumberBase::propertyValuePropertyKey,
+                                 static_cast<float>(i));
+                w.end();
+            }
+
+            // View model 1: "Root", alternating number and string properties, then the list
+            w.begin(rive::ViewModelBase::typeKey);
+            w.stringProperty(rive::ViewModelBase::namePropertyKey, "Root");
+            w.end();
+            for (uint32_t i = 0; i < spec.viewModelProperties; i++) {
+                const std::string name = "prop " + std::to_string(i);
+                if (i % 2 == 0) {
+                    w.begin(rive::ViewModelPropertyNumberBase::typeKey);
+                    w.stringProperty(rive::ViewModelPropertyNumberBase::namePropertyKey, name);
+                } else {
+                    w.begin(rive::ViewModelPropertyStringBase::typeKey);
+                    w.stringProperty(rive::ViewModelPropertyStringBase::namePropertyKey, name);
+                }
+                w.end();
+            }
+            if (spec.listLength > 0) {
+                w.begin(rive::ViewModelPropertyListBase::typeKey);
+                w.stringProperty(rive::ViewModelPropertyListBase::namePropertyKey, "items");
+                w.end();
+            }
+
+            w.begin(rive::ViewModelInstanceBase::typeKey);
+            w.uintProperty(rive::ViewModelInstanceBase::viewModelIdPropertyKey, 1);
+            w.stringProperty(rive::ViewModelInstanceBase::namePropertyKey, "Root");
+            w.end();
+            for (uint32_t i = 0; i < spec.viewModelProperties; i++) {
+                if (i % 2 == 0) {
+                    w.begin(rive::ViewModelInstanceNumberBase::typeKey);
+                    w.uintProperty(rive::ViewModelInstanceNumberBase::viewModelPropertyIdPropertyKey, i);
+                    w.doubleProperty(rive::ViewModelInstanceNumberBase::propertyValuePropertyKey,
+                                     static_cast<float>(i));
+                } else {
+                    w.begin(rive::ViewModelInstanceStringBase::typeKey);
+                    w.uintProperty(rive::ViewModelInstanceStringBase::viewModelPropertyIdPropertyKey, i);
+                    w.stringProperty(rive::ViewModelInstanceStringBase::propertyValuePropertyKey,
+                                     "value " + std::to_string(i));
+                }
+                w.end();
+            }
+            if (spec.listLength > 0) {
+                w.begin(rive::ViewModelInstanceListBase::typeKey);
+                w.uintProperty(rive::ViewModelInstanceListBase::viewModelPropertyIdPropertyKey,
+                               spec.viewModelProperties);
+                w.end();
+                for (uint32_t i = 0; i < spec.listLength; i++) {
+                    w.begin(rive::ViewModelInstanceListItemBase::typeKey);
+                    w.uintProperty(rive::ViewModelInstanceListItemBase::viewModelIdPropertyKey, 0);
+                    w.uintProperty(rive::ViewModelInstanceListItemBase::viewModelInstanceIdPropertyKey, i);
+                    w.end();
+                }
+            }
+        }
+
+        /**
+         * Writes the components of an artboard and returns the artboard-local
+         * ID of the first shape (0 if there is none).
+         */
+        uint32_t writeComponents(RivWriter& w, const SyntheticRivSpec& spec) {
+            // Component IDs are indices into the artboard's objects; the artboard is 0.
+            uint32_t nextId = 1;
+            uint32_t firstShapeId = 0;
+            for (uint32_t s = 0; s < spec.shapesPerArtboard; s++) {
+                uint32_t parentId = 0;
+                for (uint32_t d = 0; d < spec.nestingDepth; d++) {
+                    w.begin(rive::NodeBase::typeKey);
+                    w.uintProperty(rive::NodeBase::parentIdPropertyKey, parentId);
+                    w.doubleProperty(rive::NodeBase::xPropertyKey, 1.0f);
+                    w.end();
+                    parentId = nextId++;
+                }
+
+                w.begin(rive::ShapeBase::typeKey);
+                w.uintProperty(rive::ShapeBase::parentIdPropertyKey, parentId);
+                w.doubleProperty(rive::ShapeBase::xPropertyKey, static_cast<float>(20 + (s % 20) * 22));
+                w.doubleProperty(rive::ShapeBase::yPropertyKey, static_cast<float>(20 + (s / 20 % 20) * 22));
+                w.end();
+                const uint32_t shapeId = nextId++;
+                if (firstShapeId == 0) {
+                    firstShapeId = shapeId;
+                }
+
+                for (uint32_t p = 0; p < spec.pathsPerShape; p++) {
+                    w.begin(rive::RectangleBase::typeKey);
+                    w.uintProperty(rive::RectangleBase::parentIdPropertyKey, shapeId);
+                    w.doubleProperty(rive::RectangleBase::widthPropertyKey, 20.0f - (p % 10));
+                    w.doubleProperty(rive::RectangleBase::heightPropertyKey, 20.0f - (p % 10));
+                    w.end();
+                    nextId++;
+                }
+
+                w.begin(rive::FillBase::typeKey);
+                w.uintProperty(rive::FillBase::parentIdPropertyKey, shapeId);
+                w.end();
+                const uint32_t fillId = nextId++;
+
+                w.begin(rive::SolidColorBase::typeKey);
+                w.uintProperty(rive::SolidColorBase::parentIdPropertyKey, fillId);
+                w.colorProperty(rive::SolidColorBase::colorValuePropertyKey, 0xFF3366CC + s * 0x10305);
+                w.end();
+                nextId++;
+            }
+            return firstShapeId;
+        }
+
+        void writeAnimations(RivWriter& w, const SyntheticRivSpec& spec, uint32_t shapeId) {
+            for (uint32_t a = 0; a < spec.stateMachineStates; a++) {
+                w.begin(rive::LinearAnimationBase::typeKey);
+                w.stringProperty(rive::LinearAnimationBase::namePropertyKey,
+                                 "Animation " + std::to_string(a));
+                w.uintProperty(rive::LinearAnimationBase::fpsPropertyKey, kFps);
+                w.uintProperty(rive::LinearAnimationBase::durationPropertyKey, kFps);
+                w.uintProperty(rive::LinearAnimationBase::loopValuePropertyKey, kLoop);
+                w.end();
+                if (shapeId == 0) {
+                    continue;
+                }
+
+                // Spin the first shape so advancing the animation has work to do.
+                w.begin(rive::KeyedObjectBase::typeKey);
+                w.uintProperty(rive::KeyedObjectBase::objectIdPropertyKey, shapeId);
+                w.end();
+                w.begin(rive::KeyedPropertyBase::typeKey);
+                w.uintProperty(rive::KeyedPropertyBase::propertyKeyPropertyKey,
+                               rive::NodeBase::rotationPropertyKey);
+                w.end();
+                for (uint32_t k = 0; k < 2; k++) {
+                    w.begin(rive::KeyFrameDoubleBase::typeKey);
+                    w.uintProperty(rive::KeyFrameDoubleBase::framePropertyKey, k * kFps);
+                    w.uintProperty(rive::KeyFrameDoubleBase::interpolationTypePropertyKey,
+                                   kLinearInterpolation);
+                    w.doubleProperty(rive::KeyFrameDoubleBase::valuePropertyKey,
+                                     k * 6.2831853f * (a % 2 == 0 ? 1.0f : -1.0f));
+                    w.end();
+                }
+            }
+        }
+
+        void writeStateMachine(RivWriter& w, const SyntheticRivSpec& spec) {
+            w.begin(rive::StateMachineBase::typeKey);
+            w.stringProperty(rive::StateMachineBase::namePropertyKey, "State Machine");
+            w.end();
+            for (uint32_t i = 0; i < spec.stateMachineInputs; i++) {
+                w.begin(rive::StateMachineNumberBase::typeKey);
+                w.stringProperty(rive::StateMachineNumberBase::namePropertyKey,
+                                 "Input " + std::to_string(i));
+                w.end();
+            }
+
+            w.begin(rive::StateMachineLayerBase::typeKey);
+            w.stringProperty(rive::StateMachineLayerBase::namePropertyKey, "Layer");
+            w.end();
+
+            // Layer state indices: entry 0, any 1, exit 2, animation states from 3.
+            constexpr uint32_t kFirstAnimationState = 3;
+            w.begin(rive::EntryStateBase::typeKey);
+            w.end();
+            w.begin(rive::StateTransitionBase::typeKey);
+            w.uintProperty(rive::StateTransitionBase::stateToIdPropertyKey, kFirstAnimationState);
+            w.end();
+            w.begin(rive::AnyStateBase::typeKey);
+            w.end();
+            w.begin(rive::ExitStateBase::typeKey);
+            w.end();
+
+            for (uint32_t s = 0; s < spec.stateMachineStates; s++) {
+                w.begin(rive::AnimationStateBase::typeKey);
+                w.uintProperty(rive::AnimationStateBase::animationIdPropertyKey, s);
+                w.end();
+                if (spec.stateMachineInputs == 0 || s + 1 >= spec.stateMachineStates) {
+                    continue;
+                }
+                w.begin(rive::StateTransitionBase::typeKey);
+                w.uintProperty(rive::StateTransitionBase::stateToIdPropertyKey,
+                               kFirstAnimationState + s + 1);
+                w.end();
+                w.begin(rive::TransitionNumberConditionBase::typeKey);
+                w.uintProperty(rive::TransitionNumberConditionBase::inputIdPropertyKey, 0);
+                w.uintProperty(rive::TransitionNumberConditionBase::opValuePropertyKey, kConditionEqual);
+                w.doubleProperty(rive::TransitionNumberConditionBase::valuePropertyKey,
+                                 static_cast<float>(s + 1));
+                w.end();
+            }
+        }
+    }
+
+    std::vector<uint8_t> GenerateSyntheticRiv(const SyntheticRivSpec& spec) {
+        std::vector<uint8_t> out;
+        RivWriter w(out);
+        w.header();
+
+        w.begin(rive::BackboardBase::typeKey);
+        w.end();
+
+        if (spec.dataConverters > 0) {
+            writeDataConverters(w, spec);
+        }
+        if (spec.viewModelProperties > 0 || spec.listLength > 0) {
+            writeViewModels(w, spec);
+        }
+
+        for (uint32_t a = 0; a < spec.artboardCount; a++) {
+            w.begin(rive::ArtboardBase::typeKey);
+            w.stringProperty(rive::ArtboardBase::namePropertyKey, "Artboard " + std::to_string(a));
+            w.doubleProperty(rive::ArtboardBase::widthPropertyKey, 500.0f);
+            w.doubleProperty(rive::ArtboardBase::heightPropertyKey, 500.0f);
+            w.end();
+
+            const uint32_t shapeId = writeComponents(w, spec);
+            if (spec.nestNextArtboard && a + 1 < spec.artboardCount) {
+                // Added after the shapes so their component IDs don't move
+                w.begin(rive::NestedArtboardBase::typeKey);
+                w.uintProperty(rive::NestedArtboardBase::parentIdPropertyKey, 0);
+                w.uintProperty(rive::NestedArtboardBase::artboardIdPropertyKey, a + 1);
+                w.end();
+            }
+            if (spec.stateMachineStates > 0) {
+                writeAnimations(w, spec, shapeId);
+                writeStateMachine(w, spec);
+            }
+        }
+        return out;
+    }
+}
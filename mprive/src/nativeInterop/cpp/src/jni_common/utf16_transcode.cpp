@@ -0,0 +1,182 @@
+// Kept in sync with kotlin/src/main/cpp/src/helpers/utf16_transcode.cpp.
+#include "utf16_transcode.hpp"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define UTF16_NEON 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define UTF16_SSE2 1
+#endif
+
+namespace rive_mp {
+
+namespace {
+constexpr uint32_t kReplacement = 0xFFFD;
+
+inline char* EncodeUtf8(uint32_t cp, char* out) {
+    if (cp < 0x80) {
+        *out++ = static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (cp >> 6));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (cp >> 12));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | (cp >> 18));
+        *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+    }
+    return out;
+}
+
+inline bool IsContinuation(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+
+// Decodes one sequence at src[0], which is not ASCII. Returns its length in
+// bytes (1 for malformed input, which yields U+FFFD).
+inline size_t DecodeUtf8(const uint8_t* src, size_t remaining, uint32_t* cp) {
+    const uint8_t lead = src[0];
+    size_t length;
+    uint32_t value;
+    uint32_t min;
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+        value = lead & 0x1F;
+        min = 0x80;
+    } else if (lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        value = lead & 0x0F;
+        min = 0x800;
+    } else if (lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        value = lead & 0x07;
+        min = 0x10000;
+    } else {
+        *cp = kReplacement;
+        return 1;
+    }
+    if (remaining < length) {
+        *cp = kReplacement;
+        return 1;
+    }
+    for (size_t i = 1; i < length; ++i) {
+        if (!IsContinuation(src[i])) {
+            *cp = kReplacement;
+            return 1;
+        }
+        value = (value << 6) | (src[i] & 0x3F);
+    }
+    // Overlong forms, UTF-16 surrogates and values past U+10FFFF are invalid.
+    if (value < min || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+        *cp = kReplacement;
+        return 1;
+    }
+    *cp = value;
+    return length;
+}
+} // namespace
+
+size_t Utf16ToUtf8(const uint16_t* src, size_t units, char* dst) {
+    char* out = dst;
+    size_t i = 0;
+    while (i < units) {
+        // ASCII runs: narrow 8 units at a time.
+#if UTF16_NEON
+        const uint16x8_t nonAsciiMask = vdupq_n_u16(0xFF80);
+        while (i + 8 <= units) {
+            uint16x8_t v = vld1q_u16(src + i);
+            uint64x2_t high = vreinterpretq_u64_u16(vandq_u16(v, nonAsciiMask));
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0) {
+                break;
+            }
+            vst1_u8(reinterpret_cast<uint8_t*>(out), vmovn_u16(v));
+            out += 8;
+            i += 8;
+        }
+#elif UTF16_SSE2
+        const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        while (i + 8 <= units) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            __m128i high = _mm_and_si128(v, nonAsciiMask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xFFFF) {
+                break;
+            }
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(v, v));
+            out += 8;
+            i += 8;
+        }
+#endif
+        if (i >= units) {
+            break;
+        }
+
+        uint32_t unit = src[i++];
+        if (unit >= 0xD800 && unit <= 0xDFFF) {
+            if (unit <= 0xDBFF && i < units && src[i] >= 0xDC00 && src[i] <= 0xDFFF) {
+                unit = 0x10000 + ((unit - 0xD800) << 10) + (src[i++] - 0xDC00);
+            } else {
+                unit = kReplacement;
+            }
+        }
+        out = EncodeUtf8(unit, out);
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+size_t Utf8ToUtf16(const char* src, size_t bytes, uint16_t* dst) {
+    const auto* in = reinterpret_cast<const uint8_t*>(src);
+    uint16_t* out = dst;
+    size_t i = 0;
+    while (i < bytes) {
+        // ASCII runs: widen 16 bytes at a time.
+#if UTF16_NEON
+        while (i + 16 <= bytes) {
+            uint8x16_t v = vld1q_u8(in + i);
+            uint64x2_t high = vreinterpretq_u64_u8(vandq_u8(v, vdupq_n_u8(0x80)));
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0) {
+                break;
+            }
+            vst1q_u16(out, vmovl_u8(vget_low_u8(v)));
+            vst1q_u16(out + 8, vmovl_u8(vget_high_u8(v)));
+            out += 16;
+            i += 16;
+        }
+#elif UTF16_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        while (i + 16 <= bytes) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            if (_mm_movemask_epi8(v) != 0) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpackhi_epi8(v, zero));
+            out += 16;
+            i += 16;
+        }
+#endif
+        if (i >= bytes) {
+            break;
+        }
+
+        if (in[i] < 0x80) {
+            *out++ = in[i++];
+            continue;
+        }
+        uint32_t cp;
+        i += DecodeUtf8(in + i, bytes - i, &cp);
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            *out++ = static_cast<uint16_t>(0xD800 + (cp >> 10));
+            *out++ = static_cast<uint16_t>(0xDC00 + (cp & 0x3FF));
+        } else {
+            *out++ = static_cast<uint16_t>(cp);
+        }
+    }
+    return static_cast<size_t>(out - dst);
+}
+
+}